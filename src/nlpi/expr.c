@@ -10142,6 +10142,40 @@ SCIP_RETCODE exprgraphNodeEvalWithChildren(
    return SCIP_OKAY;
 }
 
+/** returns whether the interval evaluation of a node consists of basic interval arithmetic operations only
+ *
+ *  The basic interval operations compute both bounds while rounding upwards and do not change the rounding mode
+ *  if it is upwards already. Thus, the bounds of such nodes can be updated within one scope of upwards rounding,
+ *  while other operations (e.g., exp or pow) rely on rounding to nearest.
+ */
+static
+SCIP_Bool exprgraphNodeHasArithmeticInteval(
+   SCIP_EXPRGRAPHNODE*   node                /**< expression graph node */
+   )
+{
+   assert(node != NULL);
+
+   switch( node->op )
+   {
+   case SCIP_EXPR_PLUS:
+   case SCIP_EXPR_MINUS:
+   case SCIP_EXPR_MUL:
+   case SCIP_EXPR_DIV:
+   case SCIP_EXPR_SQUARE:
+   case SCIP_EXPR_MIN:
+   case SCIP_EXPR_MAX:
+   case SCIP_EXPR_ABS:
+   case SCIP_EXPR_SIGN:
+   case SCIP_EXPR_SUM:
+   case SCIP_EXPR_PRODUCT:
+   case SCIP_EXPR_LINEAR:
+      return TRUE;
+
+   default:
+      return FALSE;
+   }
+}
+
 /** updates bounds of a node if a children has changed its bounds */
 static
 SCIP_RETCODE exprgraphNodeUpdateBounds(
@@ -12717,6 +12751,305 @@ SCIP_RETCODE exprgraphFindParentByOperator(
    return SCIP_OKAY;
 }
 
+/** brings an expression graph node into a canonical form, such that equal nodes can be compared without reordering
+ *
+ *  Sorts the children of commutative operators with n children (together with the coefficients of a linear node) and
+ *  the quadratic elements or monomials of quadratic and polynomial nodes.
+ */
+static
+void exprgraphNodeCanonicalize(
+   SCIP_EXPRGRAPHNODE*   node                /**< expression graph node */
+   )
+{
+   assert(node != NULL);
+
+   switch( node->op )
+   {
+   case SCIP_EXPR_SUM    :
+   case SCIP_EXPR_PRODUCT:
+      SCIPsortPtr((void**)node->children, exprgraphnodecomp, node->nchildren);
+      break;
+
+   case SCIP_EXPR_LINEAR :
+      SCIPsortPtrReal((void**)node->children, (SCIP_Real*)node->data.data, exprgraphnodecomp, node->nchildren);
+      break;
+
+   case SCIP_EXPR_QUADRATIC:
+      quadraticdataSort((SCIP_EXPRDATA_QUADRATIC*)node->data.data);
+      break;
+
+   case SCIP_EXPR_POLYNOMIAL:
+      polynomialdataSortMonomials((SCIP_EXPRDATA_POLYNOMIAL*)node->data.data);
+      break;
+
+   default:
+      break;
+   }
+}
+
+/** checks whether two expression graph nodes represent the same operator with the same data on the same children
+ *
+ *  Both nodes need to be in canonical form, see exprgraphNodeCanonicalize(); the nodes are not modified.
+ */
+static
+SCIP_Bool exprgraphAreNodesEqual(
+   SCIP_EXPRGRAPHNODE*   node1,              /**< first expression graph node */
+   SCIP_EXPRGRAPHNODE*   node2               /**< second expression graph node */
+   )
+{
+   int i;
+
+   assert(node1 != NULL);
+   assert(node2 != NULL);
+
+   if( node1 == node2 )
+      return TRUE;
+
+   if( node1->op != node2->op || node1->nchildren != node2->nchildren )
+      return FALSE;
+
+   switch( node1->op )
+   {
+      /* commutative operands with two children */
+   case SCIP_EXPR_PLUS:
+   case SCIP_EXPR_MUL:
+   case SCIP_EXPR_MIN:
+   case SCIP_EXPR_MAX:
+      return (node1->children[0] == node2->children[0] && node1->children[1] == node2->children[1]) ||
+         (node1->children[0] == node2->children[1] && node1->children[1] == node2->children[0]);
+
+      /* non-commutative operands with two children */
+   case SCIP_EXPR_MINUS:
+   case SCIP_EXPR_DIV:
+      return node1->children[0] == node2->children[0] && node1->children[1] == node2->children[1];
+
+      /* operands with one child */
+   case SCIP_EXPR_SQUARE:
+   case SCIP_EXPR_SQRT  :
+   case SCIP_EXPR_EXP   :
+   case SCIP_EXPR_LOG   :
+   case SCIP_EXPR_SIN   :
+   case SCIP_EXPR_COS   :
+   case SCIP_EXPR_TAN   :
+      /* case SCIP_EXPR_ERF   : */
+      /* case SCIP_EXPR_ERFI  : */
+   case SCIP_EXPR_ABS   :
+   case SCIP_EXPR_SIGN  :
+      return node1->children[0] == node2->children[0];
+
+   case SCIP_EXPR_REALPOWER:
+   case SCIP_EXPR_SIGNPOWER:
+      return node1->data.dbl == node2->data.dbl && node1->children[0] == node2->children[0];  /*lint !e777*/
+
+   case SCIP_EXPR_INTPOWER:
+      return node1->data.intval == node2->data.intval && node1->children[0] == node2->children[0];
+
+      /* commutative operands with n children */
+   case SCIP_EXPR_SUM    :
+   case SCIP_EXPR_PRODUCT:
+   {
+      for( i = 0; i < node1->nchildren; ++i )
+         if( node1->children[i] != node2->children[i] )
+            return FALSE;
+
+      return TRUE;
+   }
+
+   case SCIP_EXPR_LINEAR :
+   {
+      SCIP_Real* data1;
+      SCIP_Real* data2;
+
+      data1 = (SCIP_Real*)node1->data.data;
+      data2 = (SCIP_Real*)node2->data.data;
+
+      if( data1[node1->nchildren] != data2[node2->nchildren] )  /*lint !e777*/
+         return FALSE;
+
+      for( i = 0; i < node1->nchildren; ++i )
+         if( node1->children[i] != node2->children[i] || data1[i] != data2[i] )  /*lint !e777*/
+            return FALSE;
+
+      return TRUE;
+   }
+
+   case SCIP_EXPR_QUADRATIC:
+   {
+      SCIP_EXPRDATA_QUADRATIC* data1;
+      SCIP_EXPRDATA_QUADRATIC* data2;
+
+      data1 = (SCIP_EXPRDATA_QUADRATIC*)node1->data.data;
+      data2 = (SCIP_EXPRDATA_QUADRATIC*)node2->data.data;
+
+      if( data1->nquadelems != data2->nquadelems || data1->constant != data2->constant )  /*lint !e777*/
+         return FALSE;
+
+      for( i = 0; i < node1->nchildren; ++i )
+      {
+         if( node1->children[i] != node2->children[i] )
+            return FALSE;
+         if( (data1->lincoefs != NULL ? data1->lincoefs[i] : 0.0) != (data2->lincoefs != NULL ? data2->lincoefs[i] : 0.0) )  /*lint !e777*/
+            return FALSE;
+      }
+
+      assert(data1->sorted);
+      assert(data2->sorted);
+
+      for( i = 0; i < data1->nquadelems; ++i )
+         if( data1->quadelems[i].idx1 != data2->quadelems[i].idx1 ||
+            data1->quadelems[i].idx2 != data2->quadelems[i].idx2 ||
+            data1->quadelems[i].coef != data2->quadelems[i].coef )  /*lint !e777*/
+            return FALSE;
+
+      return TRUE;
+   }
+
+   case SCIP_EXPR_POLYNOMIAL:
+   {
+      SCIP_EXPRDATA_POLYNOMIAL* data1;
+      SCIP_EXPRDATA_POLYNOMIAL* data2;
+
+      data1 = (SCIP_EXPRDATA_POLYNOMIAL*)node1->data.data;
+      data2 = (SCIP_EXPRDATA_POLYNOMIAL*)node2->data.data;
+
+      if( data1->nmonomials != data2->nmonomials || data1->constant != data2->constant )  /*lint !e777*/
+         return FALSE;
+
+      for( i = 0; i < node1->nchildren; ++i )
+         if( node1->children[i] != node2->children[i] )
+            return FALSE;
+
+      assert(data1->sorted);
+      assert(data2->sorted);
+
+      for( i = 0; i < data1->nmonomials; ++i )
+         if( !SCIPexprAreMonomialsEqual(data1->monomials[i], data2->monomials[i], 0.0) )
+            return FALSE;
+
+      return TRUE;
+   }
+
+   case SCIP_EXPR_VARIDX:
+   case SCIP_EXPR_PARAM:
+   case SCIP_EXPR_CONST:
+   case SCIP_EXPR_USER:
+      /* variables and constants are unique in the graph, user expressions cannot be compared */
+      return FALSE;
+
+   case SCIP_EXPR_LAST:
+      break;
+   }
+
+   SCIPerrorMessage("this should never happen\n");
+   SCIPABORT();
+   return FALSE;  /*lint !e527*/
+}
+
+/** checks whether two expression graph nodes represent the same expression */
+static
+SCIP_DECL_HASHKEYEQ(exprgraphNodeHashKeyEq)
+{  /*lint --e{715}*/
+   return exprgraphAreNodesEqual((SCIP_EXPRGRAPHNODE*)key1, (SCIP_EXPRGRAPHNODE*)key2);
+}
+
+/** gets hash value of an expression graph node from its operator and (unordered) children */
+static
+SCIP_DECL_HASHKEYVAL(exprgraphNodeHashKeyVal)
+{  /*lint --e{715}*/
+   SCIP_EXPRGRAPHNODE* node;
+   uint32_t childrenhash;
+   int i;
+
+   node = (SCIP_EXPRGRAPHNODE*)key;
+   assert(node != NULL);
+
+   /* sum up hashes of children, so that the hash value does not depend on the order of the children */
+   childrenhash = 0;
+   for( i = 0; i < node->nchildren; ++i )
+      childrenhash += (uint32_t)(size_t)node->children[i];
+
+   return SCIPhashThree((int)node->op, node->nchildren, childrenhash);
+}
+
+/** merges nodes that represent the same expression
+ *
+ *  Nodes are processed bottom-up, brought into canonical form, and looked up in a hash table by their operator and
+ *  children. If an equal node has been found already, the parents are moved to that node, so that the common
+ *  subexpression is evaluated and propagated only once.
+ */
+static
+SCIP_RETCODE exprgraphMergeCommonSubexpressions(
+   SCIP_EXPRGRAPH*       exprgraph,          /**< expression graph */
+   SCIP_Bool*            havechange          /**< buffer to indicate whether the graph has been modified */
+   )
+{
+   SCIP_HASHTABLE* nodetable;
+   SCIP_EXPRGRAPHNODE* node;
+   SCIP_EXPRGRAPHNODE* samenode;
+   int nnodes;
+   int d;
+   int i;
+
+   assert(exprgraph != NULL);
+   assert(havechange != NULL);
+
+   nnodes = 0;
+   for( d = 1; d < exprgraph->depth; ++d )
+      nnodes += exprgraph->nnodes[d];
+
+   if( nnodes <= 1 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPhashtableCreate(&nodetable, exprgraph->blkmem, nnodes, SCIPhashGetKeyStandard,
+         exprgraphNodeHashKeyEq, exprgraphNodeHashKeyVal, NULL) );
+
+   for( d = 1; d < exprgraph->depth; ++d )
+   {
+      for( i = 0; i < exprgraph->nnodes[d]; ++i )
+      {
+         node = exprgraph->nodes[d][i];
+         assert(node != NULL);
+
+         if( node->nchildren == 0 || node->op == SCIP_EXPR_USER )
+            continue;
+
+         /* the comparison of nodes in the hash table relies on the canonical form */
+         exprgraphNodeCanonicalize(node);
+
+         samenode = (SCIP_EXPRGRAPHNODE*)SCIPhashtableRetrieve(nodetable, (void*)node);
+         if( samenode == NULL )
+         {
+            SCIP_CALL( SCIPhashtableInsert(nodetable, (void*)node) );
+            continue;
+         }
+         assert(samenode != node);
+         assert(samenode->depth <= d);
+
+         if( node->nparents == 0 )
+            continue;
+
+         SCIPdebugMessage("merge node %p (%d,%d) into equal node %p (%d,%d)\n", (void*)node, node->depth, node->pos,
+            (void*)samenode, samenode->depth, samenode->pos);
+
+         if( node->enabled )
+            SCIPexprgraphEnableNode(exprgraph, samenode);
+
+         /* move parents of this node to samenode, node may be freed if not in use */
+         SCIP_CALL( SCIPexprgraphMoveNodeParents(exprgraph, &node, samenode) );
+         assert(node == NULL || node->nuses > 0);
+         *havechange = TRUE;
+
+         /* if node was freed, exprgraph->nodes[d][i] points to the next node that needs to be checked */
+         if( node == NULL )
+            --i;
+      }
+   }  /*lint !e850*/
+
+   SCIPhashtableFree(&nodetable);
+
+   return SCIP_OKAY;
+}
+
 /** adds an expression into an expression graph
  *
  *  Enables corresponding nodes.
@@ -12854,10 +13187,11 @@ SCIP_RETCODE exprgraphAddExpr(
 
 /** sets bounds in variable nodes to those stored in exprgraph's varbounds array */
 static
-void exprgraphUpdateVarNodeBounds(
+SCIP_RETCODE exprgraphUpdateVarNodeBounds(
    SCIP_EXPRGRAPH*       exprgraph,          /**< expression graph */
    SCIP_Bool*            clearreverseprop,   /**< flag to set if we had reset bound tightenings from reverse propagation */
-   SCIP_Bool*            boundchanged        /**< buffer to store whether a variables bound has changes, compared to those stored in nodes */
+   SCIP_Bool*            boundchanged,       /**< buffer to store whether a variables bound has changes, compared to those stored in nodes */
+   SCIP_PQUEUE*          worklist            /**< queue to insert parents of variable nodes with tightened bounds into, or NULL */
    )
 {
    SCIP_EXPRGRAPHNODE* node;
@@ -12908,7 +13242,13 @@ void exprgraphUpdateVarNodeBounds(
          (     isUbBetter(1e-9, exprgraph->varbounds[i].sup, node->bounds.inf, node->bounds.sup)) )
       {
          for( p = 0; p < node->nparents; ++p )
+         {
             node->parents[p]->boundstatus |= SCIP_EXPRBOUNDSTATUS_CHILDTIGHTENED;
+            if( worklist != NULL )
+            {
+               SCIP_CALL( SCIPpqueueInsert(worklist, (void*)node->parents[p]) );
+            }
+         }
 
          node->bounds = exprgraph->varbounds[i];
          SCIPdebugMessage("registered tightened bound [%g,%g] of var %d for propagation\n", node->bounds.inf, node->bounds.sup, i);
@@ -12923,6 +13263,34 @@ void exprgraphUpdateVarNodeBounds(
 
       node->boundstatus = SCIP_EXPRBOUNDSTATUS_VALID;
    }
+
+   return SCIP_OKAY;
+}
+
+/** forgets about nodes tightened by a parent and ensures that the tightenednodes array can hold all nodes of the graph
+ *
+ *  To be called after a propagation of variable bounds, which has updated the bounds of all nodes tightened by a parent.
+ */
+static
+SCIP_RETCODE exprgraphResetTightenedNodes(
+   SCIP_EXPRGRAPH*       exprgraph           /**< expression graph */
+   )
+{
+   int nnodes;
+   int d;
+
+   assert(exprgraph != NULL);
+
+   nnodes = 0;
+   for( d = 1; d < exprgraph->depth; ++d )
+      nnodes += exprgraph->nnodes[d];
+
+   ensureBlockMemoryArraySize(exprgraph->blkmem, &exprgraph->tightenednodes, &exprgraph->tightenednodessize, nnodes);
+
+   exprgraph->ntightenednodes = 0;
+   exprgraph->tightenednodesvalid = TRUE;
+
+   return SCIP_OKAY;
 }
 
 /**@} */
@@ -14530,6 +14898,10 @@ SCIP_RETCODE SCIPexprgraphReleaseNode(
    }
    --exprgraph->nnodes[(*node)->depth];
 
+   /* node may be remembered as tightened by a parent, so forget about these nodes */
+   exprgraph->ntightenednodes = 0;
+   exprgraph->tightenednodesvalid = FALSE;
+
    /* node is now not in graph anymore */
    (*node)->depth = -1;
    (*node)->pos   = -1;
@@ -14761,6 +15133,16 @@ void SCIPexprgraphTightenNodeBounds(
       return;
    }
 
+   /* remember nodes that get tightened by a parent for the first time, so the next propagation of variable bounds can update them */
+   if( node->depth > 0 && (node->boundstatus & SCIP_EXPRBOUNDSTATUS_TIGHTENEDBYPARENT) == 0 && exprgraph->tightenednodesvalid &&
+      (minstrength < 0.0 || nodebounds.inf > node->bounds.inf || nodebounds.sup < node->bounds.sup) )
+   {
+      if( exprgraph->ntightenednodes < exprgraph->tightenednodessize )
+         exprgraph->tightenednodes[exprgraph->ntightenednodes++] = node;
+      else
+         exprgraph->tightenednodesvalid = FALSE;
+   }
+
    /* if minstrength is negative, always mark that node has recently tightened bounds,
     * if bounds are considerably improved or tightening leads to an empty interval,
     * mark that node has recently tightened bounds
@@ -15183,6 +15565,9 @@ SCIP_RETCODE SCIPexprgraphFree(
    /* free constants array */
    BMSfreeBlockMemoryArrayNull(blkmem, &(*exprgraph)->constnodes, (*exprgraph)->constssize);
 
+   /* free array of nodes tightened by a parent */
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*exprgraph)->tightenednodes, (*exprgraph)->tightenednodessize);
+
    /* free graph struct */
    BMSfreeBlockMemory(blkmem, exprgraph);
 
@@ -15670,6 +16055,9 @@ SCIP_RETCODE SCIPexprgraphReplaceVarByLinearSum(
             varnode->parents[i]->simplified = FALSE;
       }
 
+      /* parents of varnode need to update their bounds in the next propagation round */
+      exprgraph->needvarboundprop = TRUE;
+
       return SCIP_OKAY;
    }
 
@@ -15702,6 +16090,7 @@ SCIP_RETCODE SCIPexprgraphReplaceVarByLinearSum(
    /* set value and bounds to invalid, curvature can remain (still linear) */
    varnode->value = SCIP_INVALID;
    varnode->boundstatus = SCIP_EXPRBOUNDSTATUS_CHILDRELAXED;
+   exprgraph->needvarboundprop = TRUE;
 
    /* mark varnode and its parents as not simplified */
    varnode->simplified = FALSE;
@@ -15858,7 +16247,15 @@ SCIP_RETCODE SCIPexprgraphEval(
    return SCIP_OKAY;
 }
 
-/** propagates bound changes in variables forward through the expression graph */
+/** propagates bound changes in variables forward through the expression graph
+ *
+ *  If no variable bound has been relaxed, no reset of reverse propagation is requested, and the graph has not changed
+ *  since the previous propagation, then only nodes whose children have changed their bounds or that have been tightened
+ *  by a parent are reevaluated. These nodes are processed from a worklist in the order of increasing depth, so each
+ *  node is evaluated at most once. Parents are only put onto the worklist if the bounds of a node changed by more than
+ *  a small relative amount, so that slowly converging bounds do not trigger a reevaluation of all ancestors.
+ *  Otherwise, all nodes of the graph are visited.
+ */
 SCIP_RETCODE SCIPexprgraphPropagateVarBounds(
    SCIP_EXPRGRAPH*       exprgraph,          /**< expression graph */
    SCIP_Real             infinity,           /**< value for infinity in interval arithmetics */
@@ -15867,6 +16264,9 @@ SCIP_RETCODE SCIPexprgraphPropagateVarBounds(
    )
 {
    SCIP_EXPRGRAPHNODE* node;
+   SCIP_PQUEUE* worklist;
+   SCIP_ROUNDMODE roundmode;
+   SCIP_Bool roundupwards;
    SCIP_Bool boundchanged;
    int d;
    int i;
@@ -15876,35 +16276,128 @@ SCIP_RETCODE SCIPexprgraphPropagateVarBounds(
 
    *domainerror = FALSE;
 
+   /* if we know all nodes that need to be reevaluated besides the parents of variable nodes, then setup a worklist */
+   worklist = NULL;
+   if( !clearreverseprop && !exprgraph->needvarboundprop && exprgraph->tightenednodesvalid )
+   {
+      SCIP_CALL( SCIPpqueueCreate(&worklist, MAX(exprgraph->ntightenednodes, 1), 2.0, exprgraphnodecomp, NULL) );
+   }
+
    /* update bounds in varnodes of expression graph */
-   exprgraphUpdateVarNodeBounds(exprgraph, &clearreverseprop, &boundchanged);
+   SCIP_CALL( exprgraphUpdateVarNodeBounds(exprgraph, &clearreverseprop, &boundchanged, worklist) );
 
    /* if variable bounds have not changed and we do not have to clear a previous backward propagation, we can just return */
    if( !boundchanged && !clearreverseprop && !exprgraph->needvarboundprop )
    {
       SCIPdebugMessage("no bounds changed and clearreverseprop is FALSE -> skip propagation of variable bounds\n");
+      if( worklist != NULL )
+         SCIPpqueueFree(&worklist);
       return SCIP_OKAY;
    }
 
-   /* propagate bound changes, interrupt if we get to a node with empty bounds */
-   for( d = 1; d < exprgraph->depth; ++d )
+   /* if a variable bound has been relaxed, then bounds of all nodes tightened by reverse propagation need to be reset */
+   if( worklist != NULL && clearreverseprop )
+      SCIPpqueueFree(&worklist);
+
+   /* propagate bound changes, interrupt if we get to a node with empty bounds
+    * nodes with basic arithmetic operations are evaluated while rounding upwards, which is switched off only for nodes with other operations
+    */
+   roundmode = SCIPintervalGetRoundingMode();
+   roundupwards = FALSE;
+   if( worklist != NULL )
    {
-      for( i = 0; i < exprgraph->nnodes[d]; ++i )
+      int p;
+
+      for( i = 0; i < exprgraph->ntightenednodes; ++i )
       {
-         node = exprgraph->nodes[d][i];
-         SCIP_CALL( exprgraphNodeUpdateBounds(node, infinity, 1e-9, clearreverseprop) );
+         SCIP_CALL( SCIPpqueueInsert(worklist, (void*)exprgraph->tightenednodes[i]) );
+      }
+
+      /* the worklist is ordered by depth, so all children of a node have been updated before the node is evaluated
+       * a node may have been inserted several times, but only its first removal finds the node without valid bounds
+       */
+      while( SCIPpqueueNElems(worklist) > 0 )
+      {
+         node = (SCIP_EXPRGRAPHNODE*)SCIPpqueueRemove(worklist);
+         assert(node->depth >= 1);
+
+         if( !node->enabled || node->boundstatus == SCIP_EXPRBOUNDSTATUS_VALID )
+            continue;
+
+         if( exprgraphNodeHasArithmeticInteval(node) != roundupwards )
+         {
+            roundupwards = !roundupwards;
+            if( roundupwards )
+               SCIPintervalSetRoundingModeUpwards();
+            else
+               SCIPintervalSetRoundingMode(roundmode);
+         }
+
+         SCIP_CALL( exprgraphNodeUpdateBounds(node, infinity, 1e-9, FALSE) );
          if( SCIPintervalIsEmpty(infinity, node->bounds) )
          {
             SCIPdebugMessage("bounds of node %p(%d,%d) empty, stop bounds propagation\n", (void*)node, node->depth, node->pos);
-            /* we keep exprgraph->needvarboundprop at TRUE, since we interrupt propagation */
+            /* remaining nodes on the worklist are not updated, so the next propagation needs to visit all nodes */
+            exprgraph->needvarboundprop = TRUE;
             *domainerror = TRUE;
-            return SCIP_OKAY;
+            break;
+         }
+
+         /* put parents onto the worklist that have been notified about a change in the bounds of node */
+         for( p = 0; p < node->nparents; ++p )
+         {
+            if( node->parents[p]->boundstatus & (SCIP_EXPRBOUNDSTATUS_CHILDTIGHTENED | SCIP_EXPRBOUNDSTATUS_CHILDRELAXED) )
+            {
+               SCIP_CALL( SCIPpqueueInsert(worklist, (void*)node->parents[p]) );
+            }
          }
       }
+
+      SCIPpqueueFree(&worklist);
    }
+   else
+   {
+      for( d = 1; d < exprgraph->depth && !*domainerror; ++d )
+      {
+         for( i = 0; i < exprgraph->nnodes[d]; ++i )
+         {
+            node = exprgraph->nodes[d][i];
+
+            if( node->enabled && node->boundstatus != SCIP_EXPRBOUNDSTATUS_VALID && exprgraphNodeHasArithmeticInteval(node) != roundupwards )
+            {
+               roundupwards = !roundupwards;
+               if( roundupwards )
+                  SCIPintervalSetRoundingModeUpwards();
+               else
+                  SCIPintervalSetRoundingMode(roundmode);
+            }
+
+            SCIP_CALL( exprgraphNodeUpdateBounds(node, infinity, 1e-9, clearreverseprop) );
+            if( SCIPintervalIsEmpty(infinity, node->bounds) )
+            {
+               SCIPdebugMessage("bounds of node %p(%d,%d) empty, stop bounds propagation\n", (void*)node, node->depth, node->pos);
+               /* the remaining nodes are not updated, so the next propagation needs to visit all nodes, also if this
+                * one was not triggered by needvarboundprop
+                */
+               exprgraph->needvarboundprop = TRUE;
+               *domainerror = TRUE;
+               break;
+            }
+         }
+      }
+   }
+
+   if( roundupwards )
+      SCIPintervalSetRoundingMode(roundmode);
+
+   if( *domainerror )
+      return SCIP_OKAY;
 
    exprgraph->needvarboundprop = FALSE;
 
+   /* all nodes that have been tightened by a parent have been updated now */
+   SCIP_CALL( exprgraphResetTightenedNodes(exprgraph) );
+
    return SCIP_OKAY;
 }
 
@@ -15959,7 +16452,7 @@ SCIP_RETCODE SCIPexprgraphCheckCurvature(
    assert(exprgraph != NULL);
 
    /* update bounds in varnodes of expression graph */
-   exprgraphUpdateVarNodeBounds(exprgraph, &clearreverseprop, &boundchanged);
+   SCIP_CALL( exprgraphUpdateVarNodeBounds(exprgraph, &clearreverseprop, &boundchanged, NULL) );
 
 #ifndef NDEBUG
    for( i = 0; i < exprgraph->nnodes[0]; ++i )
@@ -16164,8 +16657,6 @@ SCIP_RETCODE SCIPexprgraphSimplify(
    if( allsimplified || *domainerror )
       goto EXPRGRAPHSIMPLIFY_CLEANUP;
 
-   /* @todo find duplicate subexpressions in expression graph */
-
    /* unconvert polynomials into simpler expressions, where possible */
    for( d = 1; d < exprgraph->depth; ++d )
    {
@@ -16199,6 +16690,9 @@ SCIP_RETCODE SCIPexprgraphSimplify(
       }
    }  /*lint !e850*/
 
+   /* merge nodes that became equal subexpressions, e.g., of different constraints */
+   SCIP_CALL( exprgraphMergeCommonSubexpressions(exprgraph, havechange) );
+
 #ifdef SCIP_OUTPUT
    {
       FILE* file;
@@ -115,6 +115,21 @@ SCIP_RETCODE SCIPexprintEval(
    SCIP_Real*            val                 /**< buffer to store value of expression */
    );
 
+/** evaluates an expression tree at several points
+ *
+ *  The compiled data of the tree (e.g., a tape) depends only on the structure and the parameter values of the tree.
+ *  Thus, the points may also belong to other expression trees that have the same structure and parameter values as
+ *  the given one, see SCIPexprAreEqual(). Afterwards, the last point is the current point of the tree.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPexprintEvalBatch(
+   SCIP_EXPRINT*         exprint,            /**< interpreter data structure */
+   SCIP_EXPRTREE*        tree,               /**< expression tree */
+   int                   npoints,            /**< number of points */
+   SCIP_Real*            varvals,            /**< values of variables, one point after the other, length npoints * SCIPexprtreeGetNVars(tree) */
+   SCIP_Real*            vals                /**< buffer to store values of expression, length npoints */
+   );
+
 /** evaluates an expression tree on intervals */
 SCIP_EXPORT
 SCIP_RETCODE SCIPexprintEvalInt(
@@ -136,6 +151,21 @@ SCIP_RETCODE SCIPexprintGrad(
    SCIP_Real*            gradient            /**< buffer to store expression gradient, need to have length at least SCIPexprtreeGetNVars(tree) */
    );
 
+/** computes values and gradients of an expression tree at several points
+ *
+ *  As for SCIPexprintEvalBatch(), the points may also belong to other expression trees with the same structure and
+ *  parameter values. Afterwards, the last point is the current point of the tree.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPexprintGradBatch(
+   SCIP_EXPRINT*         exprint,            /**< interpreter data structure */
+   SCIP_EXPRTREE*        tree,               /**< expression tree */
+   int                   npoints,            /**< number of points */
+   SCIP_Real*            varvals,            /**< values of variables, one point after the other, length npoints * SCIPexprtreeGetNVars(tree) */
+   SCIP_Real*            vals,               /**< buffer to store values of expression, length npoints */
+   SCIP_Real*            gradients           /**< buffer to store gradients of expression, one point after the other, length npoints * SCIPexprtreeGetNVars(tree) */
+   );
+
 /** computes interval value and interval gradient of an expression tree */
 SCIP_EXPORT
 SCIP_RETCODE SCIPexprintGradInt(
@@ -175,6 +205,38 @@ SCIP_RETCODE SCIPexprintHessianDense(
    SCIP_Real*            hessian             /**< buffer to store hessian values, need to have size at least n*n */
    );
 
+/** gives sparsity pattern of lower triangle of Hessian
+ *
+ *  The nonzeros are sorted by row and then by column, and the column index of each nonzero is at most its row index.
+ *  The arrays belong to the interpreter data of the tree and stay valid until the tree is compiled again.
+ *  Since the AD code might need to do a forward sweep, variable values need to be passed in here.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPexprintHessianSparsity(
+   SCIP_EXPRINT*         exprint,            /**< interpreter data structure */
+   SCIP_EXPRTREE*        tree,               /**< expression tree */
+   SCIP_Real*            varvals,            /**< values of variables */
+   int**                 rowidxs,            /**< buffer to return array with row indices of nonzeros in lower triangle of Hessian */
+   int**                 colidxs,            /**< buffer to return array with column indices of nonzeros in lower triangle of Hessian */
+   int*                  nnz                 /**< buffer to return number of nonzeros in lower triangle of Hessian */
+   );
+
+/** computes value and lower triangle of Hessian of an expression tree
+ *
+ *  The values of the nonzeros are given in the order of SCIPexprintHessianSparsity(), which needs to be called before.
+ *  The array belongs to the interpreter data of the tree and is overwritten by the next call of this function.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPexprintHessian(
+   SCIP_EXPRINT*         exprint,            /**< interpreter data structure */
+   SCIP_EXPRTREE*        tree,               /**< expression tree */
+   SCIP_Real*            varvals,            /**< values of variables, can be NULL if new_varvals is FALSE */
+   SCIP_Bool             new_varvals,        /**< have variable values changed since last call to an evaluation routine? */
+   SCIP_Real*            val,                /**< buffer to store function value */
+   SCIP_Real**           hessianvals,        /**< buffer to return array with values of nonzeros in lower triangle of Hessian */
+   int*                  nnz                 /**< buffer to return number of nonzeros in lower triangle of Hessian */
+   );
+
 /** @} */
 
 #ifdef __cplusplus
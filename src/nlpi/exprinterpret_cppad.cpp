@@ -27,6 +27,7 @@
 #include "nlpi/exprinterpret.h"
 
 #include <cmath>
+#include <set>
 #include <vector>
 using std::vector;
 
@@ -324,7 +325,7 @@ struct SCIP_ExprIntData
 public:
    /** constructor */
    SCIP_ExprIntData()
-      : val(0.0), need_retape(true), int_need_retape(true), need_retape_always(false), userevalcapability(SCIP_EXPRINTCAPABILITY_ALL), blkmem(NULL), root(NULL)
+      : val(0.0), need_retape(true), int_need_retape(true), need_retape_always(false), userevalcapability(SCIP_EXPRINTCAPABILITY_ALL), blkmem(NULL), root(NULL), need_hessparsity(true)
    { }
 
    /** destructor */
@@ -352,6 +353,14 @@ public:
 
    BMS_BLKMEM*           blkmem;             /**< block memory used to allocate expresstion tree */
    SCIP_EXPR*            root;               /**< copy of expression tree; @todo we should not need to make a copy */
+
+   bool                  need_hessparsity;   /**< does the sparsity pattern of the Hessian need to be computed? */
+   vector<int>           hesrowidxs;         /**< row indices of nonzeros in lower triangle of Hessian */
+   vector<int>           hescolidxs;         /**< column indices of nonzeros in lower triangle of Hessian */
+   vector<SCIP_Real>     hesvalues;          /**< values of nonzeros in lower triangle of Hessian */
+   CppAD::sparse_rc< vector<size_t> > hespattern; /**< sparsity pattern of full Hessian */
+   CppAD::sparse_rcv< vector<size_t>, vector<double> > hessubset; /**< nonzeros of lower triangle of Hessian that are computed by sparse_hes */
+   CppAD::sparse_hes_work heswork;           /**< work data of sparse_hes, e.g., coloring */
 };
 
 #ifndef NO_CPPAD_USER_ATOMIC
@@ -2211,6 +2220,7 @@ SCIP_RETCODE SCIPexprintCompile(
    {
       data->need_retape     = true;
       data->int_need_retape = true;
+      data->need_hessparsity = true;
    }
 
    int n = SCIPexprtreeGetNVars(tree);
@@ -2294,6 +2304,8 @@ SCIP_RETCODE SCIPexprintNewParametrization(
    {
       data->need_retape     = true;
       data->int_need_retape = true;
+      /* the new tape may have a different Hessian sparsity, since CppAD folds operations with zero parameters */
+      data->need_hessparsity = true;
    }
 
    return SCIP_OKAY;
@@ -2367,6 +2379,72 @@ SCIP_RETCODE SCIPexprintEval(
    return SCIP_OKAY;
 }
 
+/** evaluates an expression tree at several points
+ *
+ *  The tape is recorded at most once and then reused by a zero order forward sweep for each point.
+ */
+SCIP_RETCODE SCIPexprintEvalBatch(
+   SCIP_EXPRINT*         exprint,            /**< interpreter data structure */
+   SCIP_EXPRTREE*        tree,               /**< expression tree */
+   int                   npoints,            /**< number of points */
+   SCIP_Real*            varvals,            /**< values of variables, one point after the other, length npoints * SCIPexprtreeGetNVars(tree) */
+   SCIP_Real*            vals                /**< buffer to store values of expression, length npoints */
+   )
+{
+   SCIP_EXPRINTDATA* data;
+
+   assert(exprint != NULL);
+   assert(tree    != NULL);
+   assert(npoints >= 0);
+   assert(varvals != NULL || npoints == 0);
+   assert(vals    != NULL || npoints == 0);
+
+   if( npoints == 0 )
+      return SCIP_OKAY;
+
+   data = SCIPexprtreeGetInterpreterData(tree);
+   assert(data != NULL);
+
+   int n = SCIPexprtreeGetNVars(tree);
+   int p = 0;
+
+   if( n == 0 )
+   {
+      SCIP_CALL( SCIPexprtreeEval(tree, NULL, &vals[0]) );
+      for( p = 1; p < npoints; ++p )
+         vals[p] = vals[0];
+      return SCIP_OKAY;
+   }
+
+   if( data->need_retape_always || data->need_retape )
+   {
+      /* evaluate at the first point, which records the tape */
+      SCIP_CALL( SCIPexprintEval(exprint, tree, varvals, &vals[0]) );
+      ++p;
+
+      /* if the tape depends on the point, then every point needs its own tape */
+      if( data->need_retape_always )
+      {
+         for( ; p < npoints; ++p )
+         {
+            SCIP_CALL( SCIPexprintEval(exprint, tree, &varvals[p * n], &vals[p]) );  /*lint !e679*/
+         }
+         return SCIP_OKAY;
+      }
+   }
+
+   for( ; p < npoints; ++p )
+   {
+      for( int i = 0; i < n; ++i )
+         data->x[i] = varvals[p * n + i];  /*lint !e679*/
+
+      data->val = data->f.Forward(0, data->x)[0];  /*lint !e1793*/
+      vals[p] = data->val;
+   }
+
+   return SCIP_OKAY;
+}
+
 /** evaluates an expression tree on intervals */
 SCIP_RETCODE SCIPexprintEvalInt(
    SCIP_EXPRINT*         exprint,            /**< interpreter data structure */
@@ -2480,6 +2558,76 @@ SCIP_RETCODE SCIPexprintGrad(
    return SCIP_OKAY;
 }
 
+/** computes values and gradients of an expression tree at several points
+ *
+ *  The tape is recorded at most once. For each point, a zero order forward sweep followed by a first order reverse
+ *  sweep is done on it, while SCIPexprintGrad() does one forward sweep for the value and another one for the Jacobian.
+ */
+SCIP_RETCODE SCIPexprintGradBatch(
+   SCIP_EXPRINT*         exprint,            /**< interpreter data structure */
+   SCIP_EXPRTREE*        tree,               /**< expression tree */
+   int                   npoints,            /**< number of points */
+   SCIP_Real*            varvals,            /**< values of variables, one point after the other, length npoints * SCIPexprtreeGetNVars(tree) */
+   SCIP_Real*            vals,               /**< buffer to store values of expression, length npoints */
+   SCIP_Real*            gradients           /**< buffer to store gradients of expression, one point after the other, length npoints * SCIPexprtreeGetNVars(tree) */
+   )
+{
+   SCIP_EXPRINTDATA* data;
+
+   assert(exprint   != NULL);
+   assert(tree      != NULL);
+   assert(npoints >= 0);
+   assert(varvals   != NULL || npoints == 0);
+   assert(vals      != NULL || npoints == 0);
+   assert(gradients != NULL || npoints == 0);
+
+   if( npoints == 0 )
+      return SCIP_OKAY;
+
+   data = SCIPexprtreeGetInterpreterData(tree);
+   assert(data != NULL);
+
+   int n = SCIPexprtreeGetNVars(tree);
+
+   if( n == 0 )
+   {
+      SCIP_CALL( SCIPexprintEvalBatch(exprint, tree, npoints, varvals, vals) );
+      return SCIP_OKAY;
+   }
+
+   if( data->need_retape_always )
+   {
+      for( int p = 0; p < npoints; ++p )
+      {
+         SCIP_CALL( SCIPexprintGrad(exprint, tree, &varvals[p * n], TRUE, &vals[p], &gradients[p * n]) );  /*lint !e679*/
+      }
+      return SCIP_OKAY;
+   }
+
+   if( data->need_retape )
+   {
+      SCIP_CALL( SCIPexprintEval(exprint, tree, varvals, &vals[0]) );
+   }
+   assert(!data->need_retape);
+
+   vector<double> w(1, 1.0);
+
+   for( int p = 0; p < npoints; ++p )
+   {
+      for( int i = 0; i < n; ++i )
+         data->x[i] = varvals[p * n + i];  /*lint !e679*/
+
+      data->val = data->f.Forward(0, data->x)[0];  /*lint !e1793*/
+      vals[p] = data->val;
+
+      vector<double> grad(data->f.Reverse(1, w));
+      for( int i = 0; i < n; ++i )
+         gradients[p * n + i] = grad[i];  /*lint !e679*/
+   }
+
+   return SCIP_OKAY;
+}
+
 /** computes interval value and interval gradient of an expression tree */
 SCIP_RETCODE SCIPexprintGradInt(
    SCIP_EXPRINT*         exprint,            /**< interpreter data structure */
@@ -2662,3 +2810,159 @@ SCIP_RETCODE SCIPexprintHessianDense(
 */
    return SCIP_OKAY;
 }
+
+/** gives sparsity pattern of lower triangle of Hessian
+ *
+ *  The sparsity pattern is computed by a forward Jacobian and a reverse Hessian sparsity sweep, using sets of indices
+ *  instead of dense n*n matrices, and stored in the interpreter data, together with the pattern for sparse_hes.
+ */
+SCIP_RETCODE SCIPexprintHessianSparsity(
+   SCIP_EXPRINT*         exprint,            /**< interpreter data structure */
+   SCIP_EXPRTREE*        tree,               /**< expression tree */
+   SCIP_Real*            varvals,            /**< values of variables */
+   int**                 rowidxs,            /**< buffer to return array with row indices of nonzeros in lower triangle of Hessian */
+   int**                 colidxs,            /**< buffer to return array with column indices of nonzeros in lower triangle of Hessian */
+   int*                  nnz                 /**< buffer to return number of nonzeros in lower triangle of Hessian */
+   )
+{
+   assert(exprint != NULL);
+   assert(tree    != NULL);
+   assert(varvals != NULL);
+   assert(rowidxs != NULL);
+   assert(colidxs != NULL);
+   assert(nnz     != NULL);
+
+   SCIP_EXPRINTDATA* data = SCIPexprtreeGetInterpreterData(tree);
+   assert(data != NULL);
+
+   int n = SCIPexprtreeGetNVars(tree);
+
+   if( data->need_hessparsity )
+   {
+      data->hesrowidxs.clear();
+      data->hescolidxs.clear();
+
+      if( n > 0 && data->need_retape_always )
+      {
+         // the tape depends on the point, so we assume that all entries of the lower triangle are nonzero
+         for( int i = 0; i < n; ++i )
+            for( int j = 0; j <= i; ++j )
+            {
+               data->hesrowidxs.push_back(i);
+               data->hescolidxs.push_back(j);
+            }
+      }
+      else if( n > 0 )
+      {
+         if( data->need_retape )
+         {
+            SCIP_Real val;
+            SCIP_CALL( SCIPexprintEval(exprint, tree, varvals, &val) );
+         }  /*lint !e438*/
+
+         vector< std::set<size_t> > r(n);
+         for( int i = 0; i < n; ++i )
+            r[i].insert((size_t)i);
+         (void) data->f.ForSparseJac((size_t)n, r); // need to compute sparsity for Jacobian first
+
+         vector< std::set<size_t> > s(1);
+         s[0].insert(0);
+         vector< std::set<size_t> > h(data->f.RevSparseHes((size_t)n, s));
+
+         size_t nfull = 0;
+         for( int i = 0; i < n; ++i )
+            nfull += h[i].size();
+
+         // store full pattern for sparse_hes and collect lower triangle
+         data->hespattern.resize((size_t)n, (size_t)n, nfull);
+         size_t k = 0;
+         for( int i = 0; i < n; ++i )
+            for( std::set<size_t>::const_iterator j = h[i].begin(); j != h[i].end(); ++j )
+            {
+               data->hespattern.set(k++, (size_t)i, *j);
+               if( (int)*j <= i )
+               {
+                  data->hesrowidxs.push_back(i);
+                  data->hescolidxs.push_back((int)*j);
+               }
+            }
+         assert(k == nfull);
+
+         CppAD::sparse_rc< vector<size_t> > lower((size_t)n, (size_t)n, data->hesrowidxs.size());
+         for( k = 0; k < data->hesrowidxs.size(); ++k )
+            lower.set(k, (size_t)data->hesrowidxs[k], (size_t)data->hescolidxs[k]);
+         data->hessubset = CppAD::sparse_rcv< vector<size_t>, vector<double> >(lower);
+         data->heswork.clear();
+      }
+
+      data->hesvalues.resize(data->hesrowidxs.size());
+      data->need_hessparsity = false;
+   }
+
+   *nnz = (int)data->hesrowidxs.size();
+   *rowidxs = *nnz > 0 ? &data->hesrowidxs[0] : NULL;
+   *colidxs = *nnz > 0 ? &data->hescolidxs[0] : NULL;
+
+   return SCIP_OKAY;
+}
+
+/** computes value and lower triangle of Hessian of an expression tree
+ *
+ *  Uses CppAD's sparse_hes, which computes the nonzeros by one forward and reverse sweep for each color of a symmetric
+ *  coloring of the sparsity pattern.
+ */
+SCIP_RETCODE SCIPexprintHessian(
+   SCIP_EXPRINT*         exprint,            /**< interpreter data structure */
+   SCIP_EXPRTREE*        tree,               /**< expression tree */
+   SCIP_Real*            varvals,            /**< values of variables, can be NULL if new_varvals is FALSE */
+   SCIP_Bool             new_varvals,        /**< have variable values changed since last call to an evaluation routine? */
+   SCIP_Real*            val,                /**< buffer to store function value */
+   SCIP_Real**           hessianvals,        /**< buffer to return array with values of nonzeros in lower triangle of Hessian */
+   int*                  nnz                 /**< buffer to return number of nonzeros in lower triangle of Hessian */
+   )
+{
+   assert(exprint     != NULL);
+   assert(tree        != NULL);
+   assert(varvals     != NULL || new_varvals == FALSE);
+   assert(val         != NULL);
+   assert(hessianvals != NULL);
+   assert(nnz         != NULL);
+
+   SCIP_EXPRINTDATA* data = SCIPexprtreeGetInterpreterData(tree);
+   assert(data != NULL);
+   assert(!data->need_hessparsity);
+
+   if( new_varvals )
+   {
+      SCIP_CALL( SCIPexprintEval(exprint, tree, varvals, val) );
+   }
+   else
+      *val = data->val;
+
+   *nnz = (int)data->hesvalues.size();
+   *hessianvals = *nnz > 0 ? &data->hesvalues[0] : NULL;
+
+   if( *nnz == 0 )
+      return SCIP_OKAY;
+
+   int n = SCIPexprtreeGetNVars(tree);
+
+   if( data->need_retape_always )
+   {
+      vector<double> hess(data->f.Hessian(data->x, 0));
+
+      for( int k = 0; k < *nnz; ++k )
+         data->hesvalues[k] = hess[data->hesrowidxs[k] * n + data->hescolidxs[k]];
+   }
+   else
+   {
+      vector<double> w(1, 1.0);
+
+      (void) data->f.sparse_hes(data->x, w, data->hessubset, data->hespattern, "cppad.symmetric", data->heswork);
+
+      for( int k = 0; k < *nnz; ++k )
+         data->hesvalues[k] = data->hessubset.val()[k];
+   }
+
+   return SCIP_OKAY;
+}
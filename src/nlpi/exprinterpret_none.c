@@ -132,6 +132,19 @@ SCIP_RETCODE SCIPexprintEval(
    return SCIP_PLUGINNOTFOUND;
 }
 
+/** evaluates an expression tree at several points */
+SCIP_RETCODE SCIPexprintEvalBatch(
+   SCIP_EXPRINT*         exprint,            /**< interpreter data structure */
+   SCIP_EXPRTREE*        tree,               /**< expression tree */
+   int                   npoints,            /**< number of points */
+   SCIP_Real*            varvals,            /**< values of variables, one point after the other, length npoints * SCIPexprtreeGetNVars(tree) */
+   SCIP_Real*            vals                /**< buffer to store values of expression, length npoints */
+   )
+{  /*lint --e{715}*/
+   SCIPerrorMessage("No expression interpreter linked to SCIP, try recompiling with EXPRINT=cppad.\n");
+   return SCIP_PLUGINNOTFOUND;
+}
+
 /** evaluates an expression tree on intervals */ /*lint -e{715}*/
 SCIP_RETCODE SCIPexprintEvalInt(
    SCIP_EXPRINT*         exprint,            /**< interpreter data structure */
@@ -159,6 +172,20 @@ SCIP_RETCODE SCIPexprintGrad(
    return SCIP_PLUGINNOTFOUND;
 }
 
+/** computes values and gradients of an expression tree at several points */
+SCIP_RETCODE SCIPexprintGradBatch(
+   SCIP_EXPRINT*         exprint,            /**< interpreter data structure */
+   SCIP_EXPRTREE*        tree,               /**< expression tree */
+   int                   npoints,            /**< number of points */
+   SCIP_Real*            varvals,            /**< values of variables, one point after the other, length npoints * SCIPexprtreeGetNVars(tree) */
+   SCIP_Real*            vals,               /**< buffer to store values of expression, length npoints */
+   SCIP_Real*            gradients           /**< buffer to store gradients of expression, one point after the other, length npoints * SCIPexprtreeGetNVars(tree) */
+   )
+{  /*lint --e{715}*/
+   SCIPerrorMessage("No expression interpreter linked to SCIP, try recompiling with EXPRINT=cppad.\n");
+   return SCIP_PLUGINNOTFOUND;
+}
+
 /** computes interval value and interval gradient of an expression tree */ /*lint -e{715}*/
 SCIP_RETCODE SCIPexprintGradInt(
    SCIP_EXPRINT*         exprint,            /**< interpreter data structure */
@@ -204,3 +231,32 @@ SCIP_RETCODE SCIPexprintHessianDense(
    SCIPerrorMessage("No expression interpreter linked to SCIP, try recompiling with EXPRINT=cppad.\n");
    return SCIP_PLUGINNOTFOUND;
 }
+
+/** gives sparsity pattern of lower triangle of Hessian */
+SCIP_RETCODE SCIPexprintHessianSparsity(
+   SCIP_EXPRINT*         exprint,            /**< interpreter data structure */
+   SCIP_EXPRTREE*        tree,               /**< expression tree */
+   SCIP_Real*            varvals,            /**< values of variables */
+   int**                 rowidxs,            /**< buffer to return array with row indices of nonzeros in lower triangle of Hessian */
+   int**                 colidxs,            /**< buffer to return array with column indices of nonzeros in lower triangle of Hessian */
+   int*                  nnz                 /**< buffer to return number of nonzeros in lower triangle of Hessian */
+   )
+{  /*lint --e{715}*/
+   SCIPerrorMessage("No expression interpreter linked to SCIP, try recompiling with EXPRINT=cppad.\n");
+   return SCIP_PLUGINNOTFOUND;
+}
+
+/** computes value and lower triangle of Hessian of an expression tree */
+SCIP_RETCODE SCIPexprintHessian(
+   SCIP_EXPRINT*         exprint,            /**< interpreter data structure */
+   SCIP_EXPRTREE*        tree,               /**< expression tree */
+   SCIP_Real*            varvals,            /**< values of variables, can be NULL if new_varvals is FALSE */
+   SCIP_Bool             new_varvals,        /**< have variable values changed since last call to an evaluation routine? */
+   SCIP_Real*            val,                /**< buffer to store function value */
+   SCIP_Real**           hessianvals,        /**< buffer to return array with values of nonzeros in lower triangle of Hessian */
+   int*                  nnz                 /**< buffer to return number of nonzeros in lower triangle of Hessian */
+   )
+{  /*lint --e{715}*/
+   SCIPerrorMessage("No expression interpreter linked to SCIP, try recompiling with EXPRINT=cppad.\n");
+   return SCIP_PLUGINNOTFOUND;
+}
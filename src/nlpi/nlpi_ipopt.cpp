@@ -19,7 +19,7 @@
  * @author  Stefan Vigerske
  * @author  Benjamin Müller
  *
- * @todo warm starts
+ * @todo warm starts from warmstart objects
  * @todo use new_x: Ipopt sets new_x = false if any function has been evaluated for the current x already, while oracle allows new_x to be false only if the current function has been evaluated for the current x before
  * @todo influence output by SCIP verblevel, too, e.g., print strong warnings if SCIP verblevel is full; but currently we have no access to SCIP verblevel
  * @todo if too few degrees of freedom, solve a slack-minimization problem instead?
@@ -146,6 +146,9 @@ public:
 
    SCIP_Bool                   firstrun;     /**< whether the next NLP solve will be the first one (with the current problem structure) */
    SCIP_Real*                  initguess;    /**< initial values for primal variables, or NULL if not known */
+   SCIP_Real*                  initguessdualcons; /**< initial values for dual variables of constraints, or NULL if not known */
+   SCIP_Real*                  initguessdualvarlb; /**< initial values for dual variables of variable lower bounds, or NULL if not known */
+   SCIP_Real*                  initguessdualvarub; /**< initial values for dual variables of variable upper bounds, or NULL if not known */
 
    SCIP_NLPSOLSTAT             lastsolstat;  /**< solution status from last run */
    SCIP_NLPTERMSTAT            lasttermstat; /**< termination status from last run */
@@ -161,7 +164,7 @@ public:
    SCIP_NlpiProblem()
       : oracle(NULL),
         storeintermediate(false), fastfail(false),
-        firstrun(TRUE), initguess(NULL),
+        firstrun(TRUE), initguess(NULL), initguessdualcons(NULL), initguessdualvarlb(NULL), initguessdualvarub(NULL),
         lastsolstat(SCIP_NLPSOLSTAT_UNKNOWN), lasttermstat(SCIP_NLPTERMSTAT_OTHER),
         lastsolprimals(NULL), lastsoldualcons(NULL), lastsoldualvarlb(NULL), lastsoldualvarub(NULL),
         lastniter(-1), lasttime(-1.0)
@@ -446,6 +449,19 @@ void invalidateSolution(
    problem->lastsolinfeas = SCIP_INVALID;
 }
 
+/** clears the initial values for dual variables */
+static
+void freeInitialGuessDuals(
+   SCIP_NLPIPROBLEM*     problem             /**< data structure of problem */
+   )
+{
+   assert(problem != NULL);
+
+   BMSfreeMemoryArrayNull(&problem->initguessdualcons);
+   BMSfreeMemoryArrayNull(&problem->initguessdualvarlb);
+   BMSfreeMemoryArrayNull(&problem->initguessdualvarub);
+}
+
 /** sets feasibility tolerance parameters in Ipopt
  *
  * Sets tol and constr_viol_tol to FEASTOLFACTOR*feastol and acceptable_tol and acceptable_viol_tol to feastol.
@@ -682,6 +698,7 @@ SCIP_DECL_NLPIFREEPROBLEM(nlpiFreeProblemIpopt)
    }
 
    BMSfreeMemoryArrayNull(&(*problem)->initguess);
+   freeInitialGuessDuals(*problem);
    BMSfreeMemoryArrayNull(&(*problem)->lastsolprimals);
    BMSfreeMemoryArrayNull(&(*problem)->lastsoldualcons);
    BMSfreeMemoryArrayNull(&(*problem)->lastsoldualvarlb);
@@ -731,6 +748,7 @@ SCIP_DECL_NLPIADDVARS(nlpiAddVarsIpopt)
 
    problem->firstrun = TRUE;
    BMSfreeMemoryArrayNull(&problem->initguess);
+   freeInitialGuessDuals(problem);
    invalidateSolution(problem);
 
    return SCIP_OKAY;
@@ -779,6 +797,7 @@ SCIP_DECL_NLPIADDCONSTRAINTS(nlpiAddConstraintsIpopt)
          exprvaridxs, exprtrees, names) );
 
    problem->firstrun = TRUE;
+   freeInitialGuessDuals(problem);
    invalidateSolution(problem);
 
    return SCIP_OKAY;
@@ -909,6 +928,7 @@ SCIP_DECL_NLPIDELVARSET(nlpiDelVarSetIpopt)
 
    problem->firstrun = TRUE;
    BMSfreeMemoryArrayNull(&problem->initguess); // @TODO keep initguess for remaining variables 
+   freeInitialGuessDuals(problem);
 
    invalidateSolution(problem);
 
@@ -935,6 +955,7 @@ SCIP_DECL_NLPIDELCONSSET(nlpiDelConstraintSetIpopt)
    SCIP_CALL( SCIPnlpiOracleDelConsSet(problem->oracle, dstats) );
 
    problem->firstrun = TRUE;
+   freeInitialGuessDuals(problem);
 
    invalidateSolution(problem);
 
@@ -1032,6 +1053,9 @@ SCIP_DECL_NLPICHGNONLINCOEF(nlpiChgNonlinCoefIpopt)
    SCIP_CALL( SCIPnlpiOracleChgExprParam(problem->oracle, idxcons, idxparam, value) );
    invalidateSolution(problem);
 
+   /* the sparsity of the Hessian may change with the parameter value */
+   problem->firstrun = TRUE;
+
    return SCIP_OKAY;
 }
 
@@ -1055,6 +1079,9 @@ SCIP_DECL_NLPICHGOBJCONSTANT( nlpiChgObjConstantIpopt )
 }
 
 /** sets initial guess for primal variables
+ *
+ *  If also dual values for all constraints and variable bounds are given, then Ipopt is warm started from the
+ *  primal-dual point in the next solve.
  *
  *  input:
  *  - nlpi datastructure for solver interface
@@ -1088,6 +1115,35 @@ SCIP_DECL_NLPISETINITIALGUESS(nlpiSetInitialGuessIpopt)
       BMSfreeMemoryArrayNull(&problem->initguess);
    }
 
+   if( primalvalues != NULL && varlbdualvalues != NULL && varubdualvalues != NULL
+      && (consdualvalues != NULL || SCIPnlpiOracleGetNConstraints(problem->oracle) == 0) )
+   {
+      int nvars = SCIPnlpiOracleGetNVars(problem->oracle);
+      int ncons = SCIPnlpiOracleGetNConstraints(problem->oracle);
+
+      if( problem->initguessdualvarlb == NULL )
+      {
+         if( BMSallocMemoryArray(&problem->initguessdualvarlb, nvars) == NULL ||
+            BMSallocMemoryArray(&problem->initguessdualvarub, nvars) == NULL ||
+            BMSallocMemoryArray(&problem->initguessdualcons, ncons) == NULL )
+         {
+            freeInitialGuessDuals(problem);
+            return SCIP_NOMEMORY;
+         }
+      }
+
+      BMScopyMemoryArray(problem->initguessdualvarlb, varlbdualvalues, nvars);
+      BMScopyMemoryArray(problem->initguessdualvarub, varubdualvalues, nvars);
+      if( ncons > 0 )
+      {
+         BMScopyMemoryArray(problem->initguessdualcons, consdualvalues, ncons);
+      }
+   }
+   else
+   {
+      freeInitialGuessDuals(problem);
+   }
+
    return SCIP_OKAY;
 }
 
@@ -1119,6 +1175,10 @@ SCIP_DECL_NLPISOLVE(nlpiSolveIpopt)
    {
       SmartPtr<SolveStatistics> stats;
 
+      /* start from the given primal-dual point if also dual values are known */
+      problem->ipopt->Options()->SetStringValue("warm_start_init_point",
+         problem->initguess != NULL && problem->initguessdualvarlb != NULL ? "yes" : "no");
+
       if( problem->firstrun )
       {
          SCIP_EXPRINTCAPABILITY cap;
@@ -2260,8 +2320,22 @@ bool ScipNLP::get_starting_point(
          }
       }
    }
-   if( init_z || init_lambda )
-      return false;
+   if( init_z )
+   {
+      if( nlpiproblem->initguessdualvarlb == NULL )
+         return false;
+
+      assert(nlpiproblem->initguessdualvarub != NULL);
+      BMScopyMemoryArray(z_L, nlpiproblem->initguessdualvarlb, n);
+      BMScopyMemoryArray(z_U, nlpiproblem->initguessdualvarub, n);
+   }
+   if( init_lambda )
+   {
+      if( nlpiproblem->initguessdualcons == NULL )
+         return false;
+
+      BMScopyMemoryArray(lambda, nlpiproblem->initguessdualcons, m);
+   }
 
    return true;
 }
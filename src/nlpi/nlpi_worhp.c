@@ -1465,6 +1465,9 @@ SCIP_DECL_NLPICHGNONLINCOEF( nlpiChgNonlinCoefWorhp )
 
    invalidateSolution(problem);
 
+   /* the sparsity of the Hessian may change with the parameter value */
+   problem->firstrun = TRUE;
+
    return SCIP_OKAY;  /*lint !e527*/
 }  /*lint !e715*/
 
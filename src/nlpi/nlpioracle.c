@@ -50,6 +50,12 @@ struct SCIP_NlpiOracleCons
 
    int*                  exprvaridxs;        /**< indices of variables in expression tree, or NULL if no exprtree */
    SCIP_EXPRTREE*        exprtree;           /**< expression tree for nonlinear part, or NULL if none */
+   int                   exprgrouppos;       /**< position of constraint in exprgroupconss of oracle, or -1 if not grouped; only valid if groups are up to date */
+   SCIP_Bool             exprtreestale;      /**< whether the interpreter data of the expression tree does not correspond to the last evaluated point,
+                                              *   because the tree has been evaluated by the interpreter data of an equal tree */
+   int                   nexprhesnz;         /**< number of nonzeros in lower triangle of Hessian of expression tree */
+   int*                  exprhesidxs;        /**< positions of nonzeros of Hessian of expression tree in the Hessian of the Lagrangian,
+                                              *   or NULL if Hessian sparsity of Lagrangian is not available */
 
    char*                 name;               /**< name of constraint */
 };
@@ -81,6 +87,11 @@ struct SCIP_NlpiOracle
    int*                  heslagoffsets;      /**< rowwise sparsity pattern of hessian matrix of Lagrangian: row offsets in heslagcol */
    int*                  heslagcols;         /**< rowwise sparsity pattern of hessian matrix of Lagrangian: column indices; sorted for each row */
 
+   int                   nexprgroups;        /**< number of groups of constraints with equal expression trees */
+   int*                  exprgroupbegs;      /**< start of each group in exprgroupconss, with an additional entry at the end */
+   int*                  exprgroupconss;     /**< indices of grouped constraints; the interpreter data of the last constraint of a group is used for the whole group */
+   int*                  exprgroupgradbegs;  /**< start of gradient of each grouped constraint in a buffer that stores all gradients of grouped expression trees */
+   SCIP_Bool             exprgroupsuptodate; /**< whether the groups of constraints with equal expression trees are up to date */
 
    SCIP_EXPRINT*         exprinterpreter;    /**< interpreter for expression trees: evaluation and derivatives */
 };
@@ -273,6 +284,8 @@ void invalidateHessianLagSparsity(
    SCIP_NLPIORACLE*      oracle              /**< pointer to store NLPIORACLE data structure */
    )
 {
+   int i;
+
    assert(oracle != NULL);
 
    SCIPdebugMessage("%p invalidate hessian lag sparsity\n", (void*)oracle);
@@ -286,6 +299,277 @@ void invalidateHessianLagSparsity(
    assert(oracle->heslagcols != NULL);
    BMSfreeBlockMemoryArray(oracle->blkmem, &oracle->heslagcols,    oracle->heslagoffsets[oracle->nvars]);
    BMSfreeBlockMemoryArray(oracle->blkmem, &oracle->heslagoffsets, oracle->nvars + 1);
+
+   /* positions of the Hessian nonzeros of expression trees refer to the sparsity pattern */
+   BMSfreeBlockMemoryArrayNull(oracle->blkmem, &oracle->objective->exprhesidxs, oracle->objective->nexprhesnz);
+   oracle->objective->nexprhesnz = 0;
+   for( i = 0; i < oracle->nconss; ++i )
+   {
+      BMSfreeBlockMemoryArrayNull(oracle->blkmem, &oracle->conss[i]->exprhesidxs, oracle->conss[i]->nexprhesnz);
+      oracle->conss[i]->nexprhesnz = 0;
+   }
+}
+
+/** Invalidates the groups of constraints with equal expression trees.
+ *  Should be called when constraints are added or deleted, variables are deleted, or expression trees or their
+ *  parameters are changed.
+ */
+static
+void invalidateExprtreeGroups(
+   SCIP_NLPIORACLE*      oracle              /**< pointer to store NLPIORACLE data structure */
+   )
+{
+   assert(oracle != NULL);
+
+   oracle->exprgroupsuptodate = FALSE;
+
+   if( oracle->exprgroupbegs == NULL )
+   { /* nothing to do */
+      assert(oracle->nexprgroups == 0);
+      return;
+   }
+
+   BMSfreeBlockMemoryArray(oracle->blkmem, &oracle->exprgroupgradbegs, oracle->exprgroupbegs[oracle->nexprgroups] + 1);
+   BMSfreeBlockMemoryArray(oracle->blkmem, &oracle->exprgroupconss,    oracle->exprgroupbegs[oracle->nexprgroups]);
+   BMSfreeBlockMemoryArray(oracle->blkmem, &oracle->exprgroupbegs,     oracle->nexprgroups + 1);
+   oracle->nexprgroups = 0;
+}
+
+/** gets the key of a hash table element, which is a pointer into the constraints array of the oracle */
+static
+SCIP_DECL_HASHGETKEY(hashGetKeyExprtree)
+{  /*lint --e{715}*/
+   return (void*)(*(SCIP_NLPIORACLECONS**)elem)->exprtree;
+}
+
+/** returns TRUE iff the expression trees have the same structure and parameter values */
+static
+SCIP_DECL_HASHKEYEQ(hashKeyEqExprtree)
+{  /*lint --e{715}*/
+   SCIP_EXPRTREE* tree1;
+   SCIP_EXPRTREE* tree2;
+   int i;
+
+   tree1 = (SCIP_EXPRTREE*)key1;
+   tree2 = (SCIP_EXPRTREE*)key2;
+
+   if( SCIPexprtreeGetNVars(tree1) != SCIPexprtreeGetNVars(tree2) )
+      return FALSE;
+
+   if( SCIPexprtreeGetNParams(tree1) != SCIPexprtreeGetNParams(tree2) )
+      return FALSE;
+
+   for( i = 0; i < SCIPexprtreeGetNParams(tree1); ++i )
+      if( SCIPexprtreeGetParamVals(tree1)[i] != SCIPexprtreeGetParamVals(tree2)[i] )  /*lint !e777*/
+         return FALSE;
+
+   return SCIPexprAreEqual(SCIPexprtreeGetRoot(tree1), SCIPexprtreeGetRoot(tree2), 0.0);
+}
+
+/** returns the hash value of an expression tree */
+static
+SCIP_DECL_HASHKEYVAL(hashKeyValExprtree)
+{  /*lint --e{715}*/
+   SCIP_EXPRTREE* tree;
+
+   tree = (SCIP_EXPRTREE*)key;
+
+   return SCIPhashFour(SCIPexprtreeGetNVars(tree), SCIPexprtreeGetNParams(tree),
+      SCIPexprGetOperator(SCIPexprtreeGetRoot(tree)), SCIPexprGetNChildren(SCIPexprtreeGetRoot(tree)));
+}
+
+/** groups constraints whose expression trees have the same structure and parameter values
+ *
+ *  Such expression trees are evaluated by the interpreter data of one of them, see evalExprtreeGroups().
+ */
+static
+SCIP_RETCODE updateExprtreeGroups(
+   SCIP_NLPIORACLE*      oracle              /**< pointer to NLPIORACLE data structure */
+   )
+{
+   SCIP_HASHTABLE* hashtable;
+   SCIP_NLPIORACLECONS* cons;
+   int* firstequal;
+   int* nequal;
+   int ngroupconss;
+   int i;
+
+   assert(oracle != NULL);
+
+   invalidateExprtreeGroups(oracle);
+   oracle->exprgroupsuptodate = TRUE;
+
+   if( oracle->nconss < 2 )
+   {
+      for( i = 0; i < oracle->nconss; ++i )
+         oracle->conss[i]->exprgrouppos = -1;
+      return SCIP_OKAY;
+   }
+
+   SCIPdebugMessage("%p update expression tree groups\n", (void*)oracle);
+
+   SCIP_ALLOC( BMSallocBlockMemoryArray(oracle->blkmem, &firstequal, oracle->nconss) );
+   SCIP_ALLOC( BMSallocClearBlockMemoryArray(oracle->blkmem, &nequal, oracle->nconss) );
+   SCIP_CALL( SCIPhashtableCreate(&hashtable, oracle->blkmem, SCIPcalcMultihashSize(oracle->nconss),
+         hashGetKeyExprtree, hashKeyEqExprtree, hashKeyValExprtree, NULL) );
+
+   /* assign each constraint to the first constraint with an equal expression tree */
+   for( i = 0; i < oracle->nconss; ++i )
+   {
+      SCIP_NLPIORACLECONS** first;
+
+      cons = oracle->conss[i];
+      cons->exprgrouppos = -1;
+      firstequal[i] = -1;
+
+      if( cons->exprtree == NULL || SCIPexprtreeGetNVars(cons->exprtree) == 0 )
+         continue;
+
+      first = (SCIP_NLPIORACLECONS**)SCIPhashtableRetrieve(hashtable, (void*)cons->exprtree);
+      if( first == NULL )
+      {
+         SCIP_CALL( SCIPhashtableInsert(hashtable, (void*)&oracle->conss[i]) );
+         firstequal[i] = i;
+      }
+      else
+         firstequal[i] = (int)(first - oracle->conss);
+
+      ++nequal[firstequal[i]];
+   }
+
+   SCIPhashtableFree(&hashtable);
+
+   /* count groups with at least two constraints */
+   ngroupconss = 0;
+   for( i = 0; i < oracle->nconss; ++i )
+   {
+      if( firstequal[i] == i && nequal[i] >= 2 )
+      {
+         ++oracle->nexprgroups;
+         ngroupconss += nequal[i];
+      }
+   }
+
+   if( oracle->nexprgroups > 0 )
+   {
+      int g;
+
+      SCIP_ALLOC( BMSallocBlockMemoryArray(oracle->blkmem, &oracle->exprgroupbegs, oracle->nexprgroups + 1) );
+      SCIP_ALLOC( BMSallocBlockMemoryArray(oracle->blkmem, &oracle->exprgroupconss, ngroupconss) );
+      SCIP_ALLOC( BMSallocBlockMemoryArray(oracle->blkmem, &oracle->exprgroupgradbegs, ngroupconss + 1) );
+
+      /* compute start of each group; nequal of the first constraint of a group becomes the next free position in the group */
+      g = 0;
+      oracle->exprgroupbegs[0] = 0;
+      for( i = 0; i < oracle->nconss; ++i )
+      {
+         if( firstequal[i] != i )
+            continue;
+
+         if( nequal[i] < 2 )
+         {
+            nequal[i] = -1;
+            continue;
+         }
+
+         oracle->exprgroupbegs[g+1] = oracle->exprgroupbegs[g] + nequal[i];
+         nequal[i] = oracle->exprgroupbegs[g];
+         ++g;
+      }
+      assert(g == oracle->nexprgroups);
+      assert(oracle->exprgroupbegs[g] == ngroupconss);
+
+      for( i = 0; i < oracle->nconss; ++i )
+      {
+         if( firstequal[i] < 0 || nequal[firstequal[i]] < 0 )
+            continue;
+
+         oracle->conss[i]->exprgrouppos = nequal[firstequal[i]]++;
+         oracle->exprgroupconss[oracle->conss[i]->exprgrouppos] = i;
+      }
+
+      oracle->exprgroupgradbegs[0] = 0;
+      for( i = 0; i < ngroupconss; ++i )
+         oracle->exprgroupgradbegs[i+1] = oracle->exprgroupgradbegs[i] + SCIPexprtreeGetNVars(oracle->conss[oracle->exprgroupconss[i]]->exprtree);
+
+      SCIPdebugMessage("%p found %d groups with %d constraints with equal expression trees\n", (void*)oracle, oracle->nexprgroups, ngroupconss);
+   }
+
+   BMSfreeBlockMemoryArray(oracle->blkmem, &nequal, oracle->nconss);
+   BMSfreeBlockMemoryArray(oracle->blkmem, &firstequal, oracle->nconss);
+
+   return SCIP_OKAY;
+}
+
+/** evaluates the expression trees of all grouped constraints in a given point
+ *
+ *  The expression trees of a group are evaluated at once by the interpreter data of the tree of the last constraint
+ *  in the group, so that a tape is recorded at most once per group. Since the point of the last constraint is
+ *  evaluated last, its interpreter data corresponds to x afterwards, while the trees of all other constraints in
+ *  the group are marked as stale.
+ */
+static
+SCIP_RETCODE evalExprtreeGroups(
+   SCIP_NLPIORACLE*      oracle,             /**< pointer to NLPIORACLE data structure */
+   const SCIP_Real*      x,                  /**< the point where to evaluate */
+   SCIP_Real*            vals,               /**< buffer to store values of expression trees of grouped constraints */
+   SCIP_Real*            grads               /**< buffer to store gradients of expression trees of grouped constraints, or NULL if not needed */
+   )
+{
+   SCIP_NLPIORACLECONS* cons;
+   SCIP_Real* points;
+   int ngroupconss;
+   int g;
+   int i;
+   int l;
+
+   assert(oracle != NULL);
+   assert(oracle->exprgroupsuptodate);
+   assert(oracle->nexprgroups > 0);
+   assert(x != NULL);
+   assert(vals != NULL);
+
+   ngroupconss = oracle->exprgroupbegs[oracle->nexprgroups];
+   SCIP_ALLOC( BMSallocBlockMemoryArray(oracle->blkmem, &points, oracle->exprgroupgradbegs[ngroupconss]) );
+
+   for( i = 0; i < ngroupconss; ++i )
+   {
+      cons = oracle->conss[oracle->exprgroupconss[i]];
+      assert(cons->exprgrouppos == i);
+
+      for( l = 0; l < SCIPexprtreeGetNVars(cons->exprtree); ++l )
+         points[oracle->exprgroupgradbegs[i] + l] = x[cons->exprvaridxs[l]];
+
+      cons->exprtreestale = TRUE;
+   }
+
+   for( g = 0; g < oracle->nexprgroups; ++g )
+   {
+      int beg;
+      int npoints;
+
+      beg = oracle->exprgroupbegs[g];
+      npoints = oracle->exprgroupbegs[g+1] - beg;
+
+      cons = oracle->conss[oracle->exprgroupconss[beg + npoints - 1]];
+
+      if( grads != NULL )
+      {
+         SCIP_CALL( SCIPexprintGradBatch(oracle->exprinterpreter, cons->exprtree, npoints, &points[oracle->exprgroupgradbegs[beg]],
+               &vals[beg], &grads[oracle->exprgroupgradbegs[beg]]) );
+      }
+      else
+      {
+         SCIP_CALL( SCIPexprintEvalBatch(oracle->exprinterpreter, cons->exprtree, npoints, &points[oracle->exprgroupgradbegs[beg]],
+               &vals[beg]) );
+      }
+
+      cons->exprtreestale = FALSE;
+   }
+
+   BMSfreeBlockMemoryArray(oracle->blkmem, &points, oracle->exprgroupgradbegs[ngroupconss]);
+
+   return SCIP_OKAY;
 }
 
 /** sorts a linear term, merges duplicate entries and removes entries with coefficient 0.0 */
@@ -367,6 +651,7 @@ SCIP_RETCODE createConstraint(
    SCIP_ALLOC( BMSallocBlockMemory(blkmem, cons) );
    assert(*cons != NULL);
    BMSclearMemory(*cons);
+   (*cons)->exprgrouppos = -1;
 
    if( nlinidxs > 0 )
    {
@@ -434,6 +719,8 @@ void freeConstraint(
 
    BMSfreeBlockMemoryArrayNull(blkmem, &(*cons)->quadelems, (*cons)->quadsize);
 
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*cons)->exprhesidxs, (*cons)->nexprhesnz);
+
    if( (*cons)->exprtree != NULL )
    {
       BMSfreeBlockMemoryArrayNull(blkmem, &(*cons)->exprvaridxs, SCIPexprtreeGetNVars((*cons)->exprtree));
@@ -741,6 +1028,7 @@ SCIP_RETCODE evalFunctionValue(
    SCIP_NLPIORACLE*      oracle,             /**< pointer to NLPIORACLE data structure */
    SCIP_NLPIORACLECONS*  cons,               /**< oracle constraint */
    const SCIP_Real*      x,                  /**< the point where to evaluate */
+   const SCIP_Real*      exprtreeval,        /**< value of expression tree in x, or NULL if it has to be evaluated */
    SCIP_Real*            val                 /**< pointer to store function value */
    )
 {  /*lint --e{715}*/
@@ -784,7 +1072,14 @@ SCIP_RETCODE evalFunctionValue(
          *val += quadelems->coef * x[quadelems->idx1] * x[quadelems->idx2];
    }
 
-   if( cons->exprtree != NULL )
+   if( cons->exprtree != NULL && exprtreeval != NULL )
+   {
+      if( *exprtreeval != *exprtreeval || ABS(*exprtreeval) >= oracle->infinity )  /*lint !e777*/
+         *val  = *exprtreeval;
+      else
+         *val += *exprtreeval;
+   }
+   else if( cons->exprtree != NULL )
    {
       SCIP_Real* xx;
       int        i;
@@ -802,6 +1097,8 @@ SCIP_RETCODE evalFunctionValue(
       }
 
       SCIP_CALL( SCIPexprintEval(oracle->exprinterpreter, cons->exprtree, xx, &nlval) );
+      cons->exprtreestale = FALSE;
+
       if( nlval != nlval || ABS(nlval) >= oracle->infinity )  /*lint !e777*/
          *val  = nlval;
       else
@@ -823,12 +1120,15 @@ SCIP_RETCODE evalFunctionGradient(
    SCIP_NLPIORACLECONS*  cons,               /**< oracle constraint */
    const SCIP_Real*      x,                  /**< the point where to evaluate */
    SCIP_Bool             isnewx,             /**< has the point x changed since the last call to some evaluation function? */
+   const SCIP_Real*      exprtreeval,        /**< value of expression tree in x, or NULL if it has to be evaluated */
+   const SCIP_Real*      exprtreegrad,       /**< gradient of expression tree in x, or NULL if it has to be evaluated */
    SCIP_Real* RESTRICT   val,                /**< pointer to store function value */
    SCIP_Real* RESTRICT   grad                /**< pointer to store function gradient */
    )
 {  /*lint --e{715}*/
    assert(oracle != NULL);
    assert(x != NULL || oracle->nvars == 0);
+   assert((exprtreeval != NULL) == (exprtreegrad != NULL));
    assert(val != NULL);
    assert(grad != NULL);
 
@@ -891,7 +1191,11 @@ SCIP_RETCODE evalFunctionGradient(
 
       SCIP_ALLOC( BMSallocBlockMemoryArray(oracle->blkmem, &g, nvars) );
 
-      if( isnewx )
+      /* if the tree has been evaluated via another tree, then its interpreter data is not at the last point */
+      if( cons->exprtreestale )
+         isnewx = TRUE;
+
+      if( isnewx && exprtreegrad == NULL )
       {
          SCIP_ALLOC( BMSallocBlockMemoryArray(oracle->blkmem, &xx, nvars) );
          for( i = 0; i < nvars; ++i )
@@ -903,9 +1207,18 @@ SCIP_RETCODE evalFunctionGradient(
       }
 
       SCIPdebugMessage("eval gradient of ");
-      SCIPdebug( if( isnewx ) {printf("\nx ="); for( i = 0; i < nvars; ++i) printf(" %g", xx[i]); /*lint !e613*/ printf("\n");} )
+      SCIPdebug( if( xx != NULL ) {printf("\nx ="); for( i = 0; i < nvars; ++i) printf(" %g", xx[i]); printf("\n");} )
 
-      SCIP_CALL( SCIPexprintGrad(oracle->exprinterpreter, cons->exprtree, xx, isnewx, &nlval, g) );  /*lint !e644*/
+      if( exprtreegrad != NULL )
+      {
+         nlval = *exprtreeval;
+         BMScopyMemoryArray(g, exprtreegrad, nvars);
+      }
+      else
+      {
+         SCIP_CALL( SCIPexprintGrad(oracle->exprinterpreter, cons->exprtree, xx, isnewx, &nlval, g) );  /*lint !e644*/
+         cons->exprtreestale = FALSE;
+      }
 
       SCIPdebug( printf("g ="); for( i = 0; i < nvars; ++i) printf(" %g", g[i]); printf("\n"); )
 
@@ -994,11 +1307,11 @@ SCIP_RETCODE hessLagSparsitySetNzFlagForExprtree(
    )
 {
    SCIP_Real*  x;
-   SCIP_Bool*  hesnz;
+   int*        rowidxs;
+   int*        colidxs;
+   int         nnz;
    int         i;
-   int         j;
    int         nvars;
-   int         nn;
    int         row;
    int         col;
    int         pos;
@@ -1015,38 +1328,91 @@ SCIP_RETCODE hessLagSparsitySetNzFlagForExprtree(
    SCIPdebugMessage("%p hess lag sparsity set nzflag for exprtree\n", (void*)oracle);
 
    nvars = SCIPexprtreeGetNVars(exprtree);
-   nn = nvars * nvars;
+   if( nvars == 0 )
+      return SCIP_OKAY;
 
-   SCIP_ALLOC( BMSallocBlockMemoryArray(oracle->blkmem, &x,     nvars) );
-   SCIP_ALLOC( BMSallocBlockMemoryArray(oracle->blkmem, &hesnz, nn) );
+   SCIP_ALLOC( BMSallocBlockMemoryArray(oracle->blkmem, &x, nvars) );
 
    for( i = 0; i < nvars; ++i )
       x[i] = 2.0; /* hope that this value does not make much trouble for the evaluation routines */  /*lint !e644*/
 
-   SCIP_CALL( SCIPexprintHessianSparsityDense(oracle->exprinterpreter, exprtree, x, hesnz) );  /*lint !e644*/
+   SCIP_CALL( SCIPexprintHessianSparsity(oracle->exprinterpreter, exprtree, x, &rowidxs, &colidxs, &nnz) );  /*lint !e644*/
+
+   for( i = 0; i < nnz; ++i )
+   {
+      row = MAX(exprvaridx[rowidxs[i]], exprvaridx[colidxs[i]]);
+      col = MIN(exprvaridx[rowidxs[i]], exprvaridx[colidxs[i]]);
 
-   for( i = 0; i < nvars; ++i ) /* rows */
-      for( j = 0; j <= i; ++j ) /* cols */
+      assert(row <  dim);
+      assert(col <= row);
+
+      if( colnz[row] == NULL || !SCIPsortedvecFindInt(colnz[row], col, colnnz[row], &pos) )
       {
-         if( !hesnz[i*nvars + j] )
-            continue;
+         SCIP_CALL( ensureIntArraySize(oracle->blkmem, &colnz[row], &collen[row], colnnz[row]+1) );
+         SCIPsortedvecInsertInt(colnz[row], col, &colnnz[row], NULL);
+         ++(*nzcount);
+      }
+   }
 
-         row = MAX(exprvaridx[i], exprvaridx[j]);
-         col = MIN(exprvaridx[i], exprvaridx[j]);
+   BMSfreeBlockMemoryArray(oracle->blkmem, &x, nvars);
 
-         assert(row <  dim);
-         assert(col <= row);
+   return SCIP_OKAY;
+}
 
-         if( colnz[row] == NULL || !SCIPsortedvecFindInt(colnz[row], col, colnnz[row], &pos) )
-         {
-            SCIP_CALL( ensureIntArraySize(oracle->blkmem, &colnz[row], &collen[row], colnnz[row]+1) );
-            SCIPsortedvecInsertInt(colnz[row], col, &colnnz[row], NULL);
-            ++(*nzcount);
-         }
-      }
+/** computes the positions of the nonzeros of the Hessian of an expression tree in the Hessian of the Lagrangian */
+static
+SCIP_RETCODE hessLagSetExprtreePositions(
+   SCIP_NLPIORACLE*      oracle,             /**< NLPI oracle */
+   SCIP_NLPIORACLECONS*  cons                /**< constraint or objective with expression tree */
+   )
+{
+   SCIP_Real*  x;
+   int*        rowidxs;
+   int*        colidxs;
+   int         i;
+   int         nvars;
+   int         row;
+   int         col;
+   int         pos;
+
+   assert(oracle != NULL);
+   assert(oracle->heslagoffsets != NULL);
+   assert(oracle->heslagcols != NULL);
+   assert(cons != NULL);
+   assert(cons->exprtree != NULL);
+   assert(cons->exprhesidxs == NULL);
+
+   nvars = SCIPexprtreeGetNVars(cons->exprtree);
+   if( nvars == 0 )
+      return SCIP_OKAY;
+
+   /* the sparsity pattern has been computed before, so x is not used here */
+   SCIP_ALLOC( BMSallocBlockMemoryArray(oracle->blkmem, &x, nvars) );
+   for( i = 0; i < nvars; ++i )
+      x[i] = 2.0;
+
+   SCIP_CALL( SCIPexprintHessianSparsity(oracle->exprinterpreter, cons->exprtree, x, &rowidxs, &colidxs, &cons->nexprhesnz) );
 
    BMSfreeBlockMemoryArray(oracle->blkmem, &x, nvars);
-   BMSfreeBlockMemoryArray(oracle->blkmem, &hesnz, nn);
+
+   if( cons->nexprhesnz == 0 )
+      return SCIP_OKAY;
+
+   SCIP_ALLOC( BMSallocBlockMemoryArray(oracle->blkmem, &cons->exprhesidxs, cons->nexprhesnz) );
+
+   for( i = 0; i < cons->nexprhesnz; ++i )
+   {
+      row = MAX(cons->exprvaridxs[rowidxs[i]], cons->exprvaridxs[colidxs[i]]);
+      col = MIN(cons->exprvaridxs[rowidxs[i]], cons->exprvaridxs[colidxs[i]]);
+
+      if( !SCIPsortedvecFindInt(&oracle->heslagcols[oracle->heslagoffsets[row]], col, oracle->heslagoffsets[row+1] - oracle->heslagoffsets[row], &pos) )
+      {
+         SCIPerrorMessage("Could not find entry (%d, %d) in hessian sparsity\n", row, col);
+         return SCIP_ERROR;
+      }
+
+      cons->exprhesidxs[i] = oracle->heslagoffsets[row] + pos;
+   }
 
    return SCIP_OKAY;
 }
@@ -1093,98 +1459,69 @@ SCIP_RETCODE hessLagAddExprtree(
    SCIP_Real             weight,             /**< weight of quadratic part */
    const SCIP_Real*      x,                  /**< point for which hessian should be returned */
    SCIP_Bool             new_x,              /**< whether point has been evaluated before */
-   int*                  exprvaridx,         /**< NLP indices for variables in expression tree */
-   SCIP_EXPRTREE*        exprtree,           /**< expression tree */
-   int*                  hesoffset,          /**< row offsets in sparse matrix that is to be filled */
-   int*                  hescol,             /**< column indices in sparse matrix that is to be filled */
+   SCIP_NLPIORACLECONS*  cons,               /**< constraint or objective */
    SCIP_Real*            values              /**< buffer for values of sparse matrix that is to be filled */
    )
 {
    SCIP_Real* xx;
    SCIP_Real* h;
-   SCIP_Real* hh;
    int        i;
-   int        j;
    int        nvars;
-   int        nn;
-   int        row;
-   int        col;
-   int        idx;
+   int        nnz;
    SCIP_Real  val;
 
    SCIPdebugMessage("%p hess lag add exprtree\n", (void*)oracle);
 
    assert(oracle != NULL);
    assert(x != NULL || new_x == FALSE);
+   assert(cons != NULL);
 
-   nvars = exprtree != NULL ? SCIPexprtreeGetNVars(exprtree) : 0;
+   nvars = cons->exprtree != NULL ? SCIPexprtreeGetNVars(cons->exprtree) : 0;
    if( nvars == 0 )
       return SCIP_OKAY;
 
-   assert(exprtree != NULL);
-   assert(exprvaridx != NULL);
-   assert(hesoffset != NULL);
-   assert(hescol != NULL);
+   /* the tree is evaluated even without nonzeros in its Hessian, to check whether it is defined at the given point */
+   assert(cons->exprvaridxs != NULL);
+   assert(cons->exprhesidxs != NULL || cons->nexprhesnz == 0);
    assert(values != NULL);
 
-   nn = nvars * nvars;
-
    xx = NULL;
-   SCIP_ALLOC( BMSallocBlockMemoryArray(oracle->blkmem, &h, nn) );
 
    if( new_x )
    {
       SCIP_ALLOC( BMSallocBlockMemoryArray(oracle->blkmem, &xx, nvars) );
       for( i = 0; i < nvars; ++i )
       {
-         assert(exprvaridx[i] >= 0);
-         xx[i] = x[exprvaridx[i]];  /*lint !e613*/
+         assert(cons->exprvaridxs[i] >= 0);
+         xx[i] = x[cons->exprvaridxs[i]];  /*lint !e613*/
       }
    }
 
-   SCIP_CALL( SCIPexprintHessianDense(oracle->exprinterpreter, exprtree, xx, new_x, &val, h) );  /*lint !e644*/
+   SCIP_CALL( SCIPexprintHessian(oracle->exprinterpreter, cons->exprtree, xx, new_x, &val, &h, &nnz) );  /*lint !e644*/
+   assert(nnz == cons->nexprhesnz);
+
+   BMSfreeBlockMemoryArrayNull(oracle->blkmem, &xx, nvars);
+
    if( val != val )  /*lint !e777*/
    {
       SCIPdebugMessage("hessian evaluation yield invalid function value %g\n", val);
-      BMSfreeBlockMemoryArrayNull(oracle->blkmem, &xx, nvars);
-      BMSfreeBlockMemoryArray(oracle->blkmem, &h, nn);
       return SCIP_INVALIDDATA; /* indicate that the function could not be evaluated at given point */
    }
 
-   hh = h;
-   for( i = 0; i < nvars; ++i ) /* rows */
+   /* add the nonzeros of the lower triangle directly at their positions in the Hessian of the Lagrangian */
+   for( i = 0; i < nnz; ++i )
    {
-      for( j = 0; j <= i; ++j, ++hh ) /* cols */
-      {
-         if( !*hh )
-            continue;
-
-         if( !SCIPisFinite(*hh) )  /*lint !e777*/
-         {
-            SCIPdebugMessage("hessian evaluation yield invalid hessian value %g\n", *hh);
-            BMSfreeBlockMemoryArrayNull(oracle->blkmem, &xx, nvars);
-            BMSfreeBlockMemoryArray(oracle->blkmem, &h, nn);
-            return SCIP_INVALIDDATA; /* indicate that the function could not be evaluated at given point */
-         }
-
-         row = MAX(exprvaridx[i], exprvaridx[j]);
-         col = MIN(exprvaridx[i], exprvaridx[j]);
-
-         if( !SCIPsortedvecFindInt(&hescol[hesoffset[row]], col, hesoffset[row+1] - hesoffset[row], &idx) )
-         {
-            SCIPerrorMessage("Could not find entry (%d, %d) in hessian sparsity\n", row, col);
-            BMSfreeBlockMemoryArrayNull(oracle->blkmem, &xx, nvars);
-            BMSfreeBlockMemoryArray(oracle->blkmem, &h, nn);
-            return SCIP_ERROR;
-         }
+      if( h[i] == 0.0 )
+         continue;
 
-         values[hesoffset[row] + idx] += weight * *hh;
+      if( !SCIPisFinite(h[i]) )  /*lint !e777*/
+      {
+         SCIPdebugMessage("hessian evaluation yield invalid hessian value %g\n", h[i]);
+         return SCIP_INVALIDDATA; /* indicate that the function could not be evaluated at given point */
       }
-      hh += nvars - j; /*lint !e679*/
-   }
 
-   BMSfreeBlockMemoryArrayNull(oracle->blkmem, &xx, nvars);
-   BMSfreeBlockMemoryArray(oracle->blkmem, &h, nn);
+      values[cons->exprhesidxs[i]] += weight * h[i];
+   }
 
    return SCIP_OKAY;
 }
@@ -1363,6 +1700,7 @@ SCIP_RETCODE SCIPnlpiOracleFree(
 
    invalidateJacobiSparsity(*oracle);
    invalidateHessianLagSparsity(*oracle);
+   invalidateExprtreeGroups(*oracle);
 
    freeConstraint((*oracle)->blkmem, &(*oracle)->objective);
    freeConstraints(*oracle);
@@ -1563,6 +1901,7 @@ SCIP_RETCODE SCIPnlpiOracleAddConstraints(
    addednlcon = FALSE;
 
    invalidateJacobiSparsity(oracle); /* @TODO we could also update (extend) the sparsity pattern */
+   invalidateExprtreeGroups(oracle);
 
    SCIP_CALL( ensureConssSize(oracle, oracle->nconss + nconss) );
    for( c = 0; c < nconss; ++c )
@@ -1731,6 +2070,9 @@ SCIP_RETCODE SCIPnlpiOracleDelVarSet(
    invalidateJacobiSparsity(oracle);
    invalidateHessianLagSparsity(oracle);
 
+   /* expression trees are freed and variable indices change */
+   invalidateExprtreeGroups(oracle);
+
    lastgood = oracle->nvars - 1;
    while( lastgood >= 0 && delstats[lastgood] == 1 )
       --lastgood;
@@ -1839,6 +2181,7 @@ SCIP_RETCODE SCIPnlpiOracleDelConsSet(
 
    invalidateJacobiSparsity(oracle);
    invalidateHessianLagSparsity(oracle);
+   invalidateExprtreeGroups(oracle);
    oracle->vardegreesuptodate = FALSE;
 
    lastgood = oracle->nconss - 1;
@@ -2116,6 +2459,7 @@ SCIP_RETCODE SCIPnlpiOracleChgExprtree(
 
    invalidateHessianLagSparsity(oracle);
    invalidateJacobiSparsity(oracle);
+   invalidateExprtreeGroups(oracle);
 
    cons = considx < 0 ? oracle->objective : oracle->conss[considx];
 
@@ -2161,6 +2505,8 @@ SCIP_RETCODE SCIPnlpiOracleChgExprParam(
    SCIP_Real             paramval            /**< new value of parameter */
    )
 {
+   SCIP_EXPRTREE* exprtree;
+
    SCIPdebugMessage("%p chg expr param\n", (void*)oracle);
 
    assert(oracle != NULL);
@@ -2172,7 +2518,16 @@ SCIP_RETCODE SCIPnlpiOracleChgExprParam(
    assert(considx == -1 || oracle->conss[considx]->exprtree != NULL);
    assert(considx == -1 || paramidx < SCIPexprtreeGetNParams(oracle->conss[considx]->exprtree));
 
-   SCIPexprtreeSetParamVal(considx >= 0 ? oracle->conss[considx]->exprtree : oracle->objective->exprtree, paramidx, paramval);
+   exprtree = considx >= 0 ? oracle->conss[considx]->exprtree : oracle->objective->exprtree;
+   SCIPexprtreeSetParamVal(exprtree, paramidx, paramval);
+
+   /* the tree is taped again, which may change the sparsity pattern of its Hessian */
+   SCIP_CALL( SCIPexprintNewParametrization(oracle->exprinterpreter, exprtree) );
+   invalidateHessianLagSparsity(oracle);
+
+   /* trees with equal parameter values may have become different */
+   if( considx >= 0 )
+      invalidateExprtreeGroups(oracle);
 
    return SCIP_OKAY;
 }
@@ -2407,7 +2762,7 @@ SCIP_RETCODE SCIPnlpiOracleEvalObjectiveValue(
 
    SCIPdebugMessage("%p eval obj value\n", (void*)oracle);
 
-   SCIP_CALL_QUIET( evalFunctionValue(oracle, oracle->objective, x, objval) );
+   SCIP_CALL_QUIET( evalFunctionValue(oracle, oracle->objective, x, NULL, objval) );
 
    assert(oracle->objective->lhs == oracle->objective->rhs);  /*lint !e777*/
    *objval += oracle->objective->lhs;
@@ -2429,7 +2784,7 @@ SCIP_RETCODE SCIPnlpiOracleEvalConstraintValue(
 
    SCIPdebugMessage("%p eval cons value\n", (void*)oracle);
 
-   SCIP_CALL_QUIET( evalFunctionValue(oracle, oracle->conss[considx], x, conval) );
+   SCIP_CALL_QUIET( evalFunctionValue(oracle, oracle->conss[considx], x, NULL, conval) );
 
    return SCIP_OKAY;
 }
@@ -2441,6 +2796,7 @@ SCIP_RETCODE SCIPnlpiOracleEvalConstraintValues(
    SCIP_Real*            convals             /**< buffer to store constraint values */  
    )
 {
+   SCIP_Real* groupvals;
    int i;
 
    SCIPdebugMessage("%p eval cons values\n", (void*)oracle);
@@ -2449,11 +2805,27 @@ SCIP_RETCODE SCIPnlpiOracleEvalConstraintValues(
    assert(x != NULL || oracle->nvars == 0);
    assert(convals != NULL);
 
+   if( !oracle->exprgroupsuptodate )
+   {
+      SCIP_CALL( updateExprtreeGroups(oracle) );
+   }
+
+   /* evaluate expression trees that are equal to other ones groupwise */
+   groupvals = NULL;
+   if( oracle->nexprgroups > 0 )
+   {
+      SCIP_ALLOC( BMSallocBlockMemoryArray(oracle->blkmem, &groupvals, oracle->exprgroupbegs[oracle->nexprgroups]) );
+      SCIP_CALL( evalExprtreeGroups(oracle, x, groupvals, NULL) );
+   }
+
    for( i = 0; i < oracle->nconss; ++i )
    {
-      SCIP_CALL_QUIET( evalFunctionValue(oracle, oracle->conss[i], x, &convals[i]) );
+      SCIP_CALL_QUIET( evalFunctionValue(oracle, oracle->conss[i], x,
+            oracle->conss[i]->exprgrouppos >= 0 ? &groupvals[oracle->conss[i]->exprgrouppos] : NULL, &convals[i]) );  /*lint !e613*/
    }
 
+   BMSfreeBlockMemoryArrayNull(oracle->blkmem, &groupvals, oracle->nexprgroups > 0 ? oracle->exprgroupbegs[oracle->nexprgroups] : 0);
+
    return SCIP_OKAY;
 }
 
@@ -2473,7 +2845,7 @@ SCIP_RETCODE SCIPnlpiOracleEvalObjectiveGradient(
 
    SCIPdebugMessage("%p eval obj grad\n", (void*)oracle);
 
-   SCIP_CALL_QUIET( evalFunctionGradient(oracle, oracle->objective, x, isnewx, objval, objgrad) );
+   SCIP_CALL_QUIET( evalFunctionGradient(oracle, oracle->objective, x, isnewx, NULL, NULL, objval, objgrad) );
 
    assert(oracle->objective->lhs == oracle->objective->rhs);  /*lint !e777*/
    *objval += oracle->objective->lhs;
@@ -2500,7 +2872,7 @@ SCIP_RETCODE SCIPnlpiOracleEvalConstraintGradient(
 
    SCIPdebugMessage("%p eval cons grad\n", (void*)oracle);
 
-   SCIP_CALL_QUIET( evalFunctionGradient(oracle, oracle->conss[considx], x, isnewx, conval, congrad) );
+   SCIP_CALL_QUIET( evalFunctionGradient(oracle, oracle->conss[considx], x, isnewx, NULL, NULL, conval, congrad) );
 
    return SCIP_OKAY;
 }
@@ -2663,7 +3035,10 @@ SCIP_RETCODE SCIPnlpiOracleEvalJacobian(
    SCIP_RETCODE retcode;
    SCIP_Real* grad;
    SCIP_Real* xx;
+   SCIP_Real* groupvals;
+   SCIP_Real* groupgrads;
    SCIP_Real nlval;
+   int ngroupconss;
    int i;
    int j;
    int k;
@@ -2677,9 +3052,26 @@ SCIP_RETCODE SCIPnlpiOracleEvalJacobian(
    assert(oracle->jacoffsets != NULL);
    assert(oracle->jaccols    != NULL);
 
+   if( !oracle->exprgroupsuptodate )
+   {
+      SCIP_CALL( updateExprtreeGroups(oracle) );
+   }
+
    SCIP_ALLOC( BMSallocBlockMemoryArray(oracle->blkmem, &grad, oracle->nvars) );
    xx = NULL;
 
+   /* evaluate expression trees that are equal to other ones groupwise */
+   groupvals = NULL;
+   groupgrads = NULL;
+   ngroupconss = 0;
+   if( oracle->nexprgroups > 0 )
+   {
+      ngroupconss = oracle->exprgroupbegs[oracle->nexprgroups];
+      SCIP_ALLOC( BMSallocBlockMemoryArray(oracle->blkmem, &groupvals, ngroupconss) );
+      SCIP_ALLOC( BMSallocBlockMemoryArray(oracle->blkmem, &groupgrads, oracle->exprgroupgradbegs[ngroupconss]) );
+      SCIP_CALL( evalExprtreeGroups(oracle, x, groupvals, groupgrads) );
+   }
+
    retcode = SCIP_OKAY;
 
    j = oracle->jacoffsets[0];
@@ -2715,21 +3107,36 @@ SCIP_RETCODE SCIPnlpiOracleEvalJacobian(
 
          if( nvars > 0 )
          {
-            if( isnewx )
+            if( cons->exprgrouppos >= 0 )
             {
-               if( xx == NULL )
+               /* expression tree has been evaluated with its group already */
+               assert(groupvals != NULL && groupgrads != NULL);
+
+               nlval = groupvals[cons->exprgrouppos];
+               BMScopyMemoryArray(grad, &groupgrads[oracle->exprgroupgradbegs[cons->exprgrouppos]], nvars);  /*lint !e866*/
+            }
+            else
+            {
+               /* a stale tree needs to be evaluated in x, even if x has been evaluated before */
+               SCIP_Bool newx = isnewx || cons->exprtreestale;
+
+               if( newx )
                {
-                  /* if no xx yet, alloc it; make it large enough in case we need it again */
-                  SCIP_ALLOC( BMSallocBlockMemoryArray(oracle->blkmem, &xx, oracle->nvars) );
+                  if( xx == NULL )
+                  {
+                     /* if no xx yet, alloc it; make it large enough in case we need it again */
+                     SCIP_ALLOC( BMSallocBlockMemoryArray(oracle->blkmem, &xx, oracle->nvars) );
+                  }
+                  for( l = 0; l < nvars; ++l )
+                     xx[l] = x[cons->exprvaridxs[l]];  /*lint !e613*/
                }
-               for( l = 0; l < nvars; ++l )
-                  xx[l] = x[cons->exprvaridxs[l]];  /*lint !e613*/
-            }
 
-            SCIPdebugMessage("eval gradient of ");
-            SCIPdebug( if( isnewx ) {printf("\nx ="); for( l = 0; l < nvars; ++l) printf(" %g", xx[l]); /*lint !e613*/ printf("\n");} )
+               SCIPdebugMessage("eval gradient of ");
+               SCIPdebug( if( newx ) {printf("\nx ="); for( l = 0; l < nvars; ++l) printf(" %g", xx[l]); /*lint !e613*/ printf("\n");} )
 
-            SCIP_CALL( SCIPexprintGrad(oracle->exprinterpreter, cons->exprtree, xx, isnewx, &nlval, grad) );  /*lint !e644*/
+               SCIP_CALL( SCIPexprintGrad(oracle->exprinterpreter, cons->exprtree, xx, newx, &nlval, grad) );  /*lint !e644*/
+               cons->exprtreestale = FALSE;
+            }
 
             SCIPdebug( printf("g ="); for( l = 0; l < nvars; ++l) printf(" %g", grad[l]); printf("\n"); )
 
@@ -2770,7 +3177,14 @@ SCIP_RETCODE SCIPnlpiOracleEvalJacobian(
       }
 
       /* do dense eval @todo could do it sparse */
-      retcode = SCIPnlpiOracleEvalConstraintGradient(oracle, i, x, isnewx, (convals ? &convals[i] : &nlval), grad); /*lint !e838*/
+      if( cons->exprgrouppos >= 0 )
+      {
+         assert(groupvals != NULL && groupgrads != NULL);
+         retcode = evalFunctionGradient(oracle, cons, x, isnewx, &groupvals[cons->exprgrouppos],
+            &groupgrads[oracle->exprgroupgradbegs[cons->exprgrouppos]], (convals ? &convals[i] : &nlval), grad); /*lint !e838*/
+      }
+      else
+         retcode = evalFunctionGradient(oracle, cons, x, isnewx, NULL, NULL, (convals ? &convals[i] : &nlval), grad); /*lint !e838*/
       if( retcode != SCIP_OKAY )
          break;
 
@@ -2778,6 +3192,8 @@ SCIP_RETCODE SCIPnlpiOracleEvalJacobian(
          jacobi[k++] = grad[oracle->jaccols[j++]];
    }
 
+   BMSfreeBlockMemoryArrayNull(oracle->blkmem, &groupgrads, ngroupconss > 0 ? oracle->exprgroupgradbegs[ngroupconss] : 0);
+   BMSfreeBlockMemoryArrayNull(oracle->blkmem, &groupvals, ngroupconss);
    BMSfreeBlockMemoryArrayNull(oracle->blkmem, &xx, oracle->nvars);
    BMSfreeBlockMemoryArray(oracle->blkmem, &grad, oracle->nvars);
 
@@ -2873,6 +3289,20 @@ SCIP_RETCODE SCIPnlpiOracleGetHessianLagSparsity(
    BMSfreeBlockMemoryArray(oracle->blkmem, &colnnz, oracle->nvars);
    BMSfreeBlockMemoryArray(oracle->blkmem, &collen, oracle->nvars);
 
+   /* remember where the Hessian nonzeros of the expression trees are added, so that no search is needed during evaluation */
+   if( oracle->objective->exprtree != NULL )
+   {
+      SCIP_CALL( hessLagSetExprtreePositions(oracle, oracle->objective) );
+   }
+
+   for( i = 0; i < oracle->nconss; ++i )
+   {
+      if( oracle->conss[i]->exprtree != NULL )
+      {
+         SCIP_CALL( hessLagSetExprtreePositions(oracle, oracle->conss[i]) );
+      }
+   }
+
    if( offset != NULL )
       *offset = oracle->heslagoffsets;
    if( col != NULL )
@@ -2916,7 +3346,7 @@ SCIP_RETCODE SCIPnlpiOracleEvalHessianLag(
    if( objfactor != 0.0 )
    {
       SCIP_CALL( hessLagAddQuad(objfactor, oracle->objective->nquadelems, oracle->objective->quadelems, oracle->heslagoffsets, oracle->heslagcols, hessian) );
-      SCIP_CALL_QUIET( hessLagAddExprtree(oracle, objfactor, x, isnewx, oracle->objective->exprvaridxs, oracle->objective->exprtree, oracle->heslagoffsets, oracle->heslagcols, hessian) );
+      SCIP_CALL_QUIET( hessLagAddExprtree(oracle, objfactor, x, isnewx, oracle->objective, hessian) );
    }
 
    for( i = 0; i < oracle->nconss; ++i )
@@ -2925,7 +3355,8 @@ SCIP_RETCODE SCIPnlpiOracleEvalHessianLag(
       if( lambda[i] == 0.0 )
          continue;
       SCIP_CALL( hessLagAddQuad(lambda[i], oracle->conss[i]->nquadelems, oracle->conss[i]->quadelems, oracle->heslagoffsets, oracle->heslagcols, hessian) );
-      SCIP_CALL_QUIET( hessLagAddExprtree(oracle, lambda[i], x, isnewx, oracle->conss[i]->exprvaridxs, oracle->conss[i]->exprtree, oracle->heslagoffsets, oracle->heslagcols, hessian) );
+      SCIP_CALL_QUIET( hessLagAddExprtree(oracle, lambda[i], x, isnewx || oracle->conss[i]->exprtreestale, oracle->conss[i], hessian) );
+      oracle->conss[i]->exprtreestale = FALSE;
    }
 
    return SCIP_OKAY;
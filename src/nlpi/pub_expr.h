@@ -1661,7 +1661,11 @@ SCIP_RETCODE SCIPexprgraphEval(
    SCIP_Real*            varvals             /**< values for variables */
    );
 
-/** propagates bound changes in variables forward through the expression graph */
+/** propagates bound changes in variables forward through the expression graph
+ *
+ *  If only variable bounds have been tightened since the previous call and the graph has not changed, then only those
+ *  nodes are reevaluated whose children changed their bounds or which have been tightened by a parent.
+ */
 SCIP_EXPORT
 SCIP_RETCODE SCIPexprgraphPropagateVarBounds(
    SCIP_EXPRGRAPH*       exprgraph,          /**< expression graph */
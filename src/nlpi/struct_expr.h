@@ -179,6 +179,10 @@ struct SCIP_ExprGraph
    void*                userdata;            /**< user data associated with callback methods */
 
    SCIP_Bool            needvarboundprop;    /**< whether variable bounds need be propagated, e.g., because new nodes have been added to the graph */
+   SCIP_EXPRGRAPHNODE** tightenednodes;      /**< nodes whose bounds have been tightened by a parent since the last propagation of variable bounds */
+   int                  tightenednodessize;  /**< length of tightenednodes array */
+   int                  ntightenednodes;     /**< number of nodes in tightenednodes array */
+   SCIP_Bool            tightenednodesvalid; /**< whether tightenednodes contains all nodes that have been tightened by a parent since the last propagation of variable bounds */
 
    int                  lastreplacechildpos; /**< last position where a child was found that was replaced, used to heuristically speed up consecutive calls to exprgraphNodeReplaceChild */
 };
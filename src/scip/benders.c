@@ -41,6 +41,7 @@
 #include "scip/cons_nonlinear.h"
 #include "scip/cons_quadratic.h"
 #include "scip/cons_abspower.h"
+#include "lpi/lpi.h"
 
 #include "scip/struct_benders.h"
 #include "scip/struct_benderscut.h"
@@ -67,6 +68,8 @@
 #define SCIP_DEFAULT_EXECFEASPHASE        FALSE  /** should a feasibility phase be executed during the root node processing */
 #define SCIP_DEFAULT_SLACKVARCOEF          1e+6  /** the objective coefficient of the slack variables in the subproblem */
 #define SCIP_DEFAULT_CHECKCONSCONVEXITY    TRUE  /** should the constraints of the subproblem be checked for convexity? */
+#define SCIP_DEFAULT_CUTDEDUP              TRUE  /** should cuts that were already generated in the same call be discarded? */
+#define SCIP_DEFAULT_WARMSTARTLP           TRUE  /** should the LP basis of convex subproblems be reused in the next solve? */
 
 #define BENDERS_MAXPSEUDOSOLS                 5  /** the maximum number of pseudo solutions checked before suggesting
                                                   *  merge candidates */
@@ -1178,6 +1181,16 @@ SCIP_RETCODE doBendersCreate(
          "should the constraints of the subproblems be checked for convexity?", &(*benders)->checkconsconvexity, FALSE,
          SCIP_DEFAULT_CHECKCONSCONVEXITY, NULL, NULL) ); /*lint !e740*/
 
+   (void) SCIPsnprintf(paramname, SCIP_MAXSTRLEN, "benders/%s/cutdedup", name);
+   SCIP_CALL( SCIPsetAddBoolParam(set, messagehdlr, blkmem, paramname,
+         "should cuts that were already generated in the same call of the Benders' decomposition be discarded?",
+         &(*benders)->cutdedup, TRUE, SCIP_DEFAULT_CUTDEDUP, NULL, NULL) ); /*lint !e740*/
+
+   (void) SCIPsnprintf(paramname, SCIP_MAXSTRLEN, "benders/%s/warmstartlp", name);
+   SCIP_CALL( SCIPsetAddBoolParam(set, messagehdlr, blkmem, paramname,
+         "should the LP basis of the last subproblem solve be used to warm start the LP of convex subproblems?",
+         &(*benders)->warmstartlp, TRUE, SCIP_DEFAULT_WARMSTARTLP, NULL, NULL) ); /*lint !e740*/
+
    return SCIP_OKAY;
 }
 
@@ -2036,9 +2049,16 @@ SCIP_RETCODE SCIPbendersInit(
       SCIPclockReset(benders->setuptime);
       SCIPclockReset(benders->bendersclock);
 
+      if( benders->active )
+      {
+         for( i = 0; i < benders->nsubproblems; i++ )
+            SCIPclockReset(benders->subprobclocks[i]);
+      }
+
       benders->ncalls = 0;
       benders->ncutsfound = 0;
       benders->ntransferred = 0;
+      benders->nduplicatecuts = 0;
    }
 
    /* start timing */
@@ -2258,6 +2278,87 @@ SCIP_RETCODE transferBendersCuts(
 }
 
 
+/** gets the key of the given element */
+static
+SCIP_DECL_HASHGETKEY(hashGetKeyBenderscutcut)
+{  /*lint --e{715}*/
+   /* the key is the element itself */
+   return elem;
+}
+
+/** returns TRUE iff both keys are equal; the variables of both cuts are sorted by their index */
+static
+SCIP_DECL_HASHKEYEQ(hashKeyEqBenderscutcut)
+{  /*lint --e{715}*/
+   SCIP_BENDERSCUTCUT* cut1;
+   SCIP_BENDERSCUTCUT* cut2;
+   SCIP_SET* set;
+   int i;
+
+   cut1 = (SCIP_BENDERSCUTCUT*)key1;
+   cut2 = (SCIP_BENDERSCUTCUT*)key2;
+   set = (SCIP_SET*)userptr;
+   assert(cut1 != NULL);
+   assert(cut2 != NULL);
+   assert(set != NULL);
+
+   if( cut1->nvars != cut2->nvars || !SCIPsetIsEQ(set, cut1->lhs, cut2->lhs) || !SCIPsetIsEQ(set, cut1->rhs, cut2->rhs) )
+      return FALSE;
+
+   for( i = 0; i < cut1->nvars; i++ )
+   {
+      if( cut1->vars[i] != cut2->vars[i] || !SCIPsetIsEQ(set, cut1->vals[i], cut2->vals[i]) )
+         return FALSE;
+   }
+
+   return TRUE;
+}
+
+/** returns the hash value of the key */
+static
+SCIP_DECL_HASHKEYVAL(hashKeyValBenderscutcut)
+{  /*lint --e{715}*/
+   SCIP_BENDERSCUTCUT* cut;
+   uint64_t hash;
+   int i;
+
+   cut = (SCIP_BENDERSCUTCUT*)key;
+   assert(cut != NULL);
+
+   hash = (uint64_t) (long) cut->nvars;
+
+   for( i = 0; i < cut->nvars; i++ )
+      hash += SCIPhashTwo(SCIPrealHashCode(cut->vals[i]), SCIPvarGetIndex(cut->vars[i]));
+
+   return hash;
+}
+
+/** frees the cuts that have been generated in the current call of the Benders' decomposition */
+static
+SCIP_RETCODE freeCallCuts(
+   SCIP_BENDERS*         benders,            /**< Benders' decomposition */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   int i;
+
+   assert(benders != NULL);
+   assert(set != NULL);
+
+   if( benders->cuttable != NULL )
+      SCIPhashtableRemoveAll(benders->cuttable);
+
+   for( i = benders->ncallcuts - 1; i >= 0; i-- )
+   {
+      SCIPfreeBlockMemoryArray(set->scip, &benders->callcuts[i]->vals, benders->callcuts[i]->nvars);
+      SCIPfreeBlockMemoryArray(set->scip, &benders->callcuts[i]->vars, benders->callcuts[i]->nvars);
+      SCIPfreeBlockMemory(set->scip, &benders->callcuts[i]); /*lint !e866*/
+   }
+   benders->ncallcuts = 0;
+
+   return SCIP_OKAY;
+}
+
 /** calls exit method of Benders' decomposition */
 SCIP_RETCODE SCIPbendersExit(
    SCIP_BENDERS*         benders,            /**< Benders' decomposition */
@@ -2304,6 +2405,15 @@ SCIP_RETCODE SCIPbendersExit(
    benders->storedcutssize = 0;
    benders->nstoredcuts = 0;
 
+   /* releasing the cuts of the last call */
+   SCIP_CALL( freeCallCuts(benders, set) );
+
+   if( benders->cuttable != NULL )
+      SCIPhashtableFree(&benders->cuttable);
+
+   BMSfreeBlockMemoryArrayNull(SCIPblkmem(set->scip), &benders->callcuts, benders->callcutssize);
+   benders->callcutssize = 0;
+
    /* releasing all of the auxiliary variables */
    nsubproblems = SCIPbendersGetNSubproblems(benders);
    for( i = 0; i < nsubproblems; i++ )
@@ -2503,6 +2613,40 @@ SCIP_RETCODE SCIPbendersInitsol(
    return SCIP_OKAY;
 }
 
+/** frees the LP state that is stored for warm starting the LP of the given subproblem */
+static
+SCIP_RETCODE freeSubproblemLPState(
+   SCIP_BENDERS*         benders,            /**< Benders' decomposition */
+   int                   probnumber          /**< the subproblem number */
+   )
+{
+   SCIP* subproblem;
+   SCIP_LPI* lpi;
+
+   assert(benders != NULL);
+   assert(probnumber >= 0 && probnumber < benders->nsubproblems);
+
+   if( benders->subproblpistates[probnumber] == NULL && benders->subproblpinorms[probnumber] == NULL )
+      return SCIP_OKAY;
+
+   subproblem = SCIPbendersSubproblem(benders, probnumber);
+   assert(subproblem != NULL);
+
+   SCIP_CALL( SCIPgetLPI(subproblem, &lpi) );
+
+   if( benders->subproblpinorms[probnumber] != NULL )
+   {
+      SCIP_CALL( SCIPlpiFreeNorms(lpi, SCIPblkmem(subproblem), &benders->subproblpinorms[probnumber]) );
+   }
+
+   if( benders->subproblpistates[probnumber] != NULL )
+   {
+      SCIP_CALL( SCIPlpiFreeState(lpi, SCIPblkmem(subproblem), &benders->subproblpistates[probnumber]) );
+   }
+
+   return SCIP_OKAY;
+}
+
 /** informs Benders' decomposition that the branch and bound process data is being freed */
 SCIP_RETCODE SCIPbendersExitsol(
    SCIP_BENDERS*         benders,            /**< Benders' decomposition */
@@ -2531,6 +2675,12 @@ SCIP_RETCODE SCIPbendersExitsol(
       }
    }
 
+   /* freeing the LP states that were stored for warm starting the subproblems */
+   for( i = 0; i < nsubproblems; i++ )
+   {
+      SCIP_CALL( freeSubproblemLPState(benders, i) );
+   }
+
    /* call solving process deinitialization method of Benders' decomposition */
    if( benders->bendersexitsol != NULL )
    {
@@ -2589,6 +2739,9 @@ SCIP_RETCODE SCIPbendersActivate(
       SCIP_ALLOC( BMSallocMemoryArray(&benders->subproblems, benders->nsubproblems) );
       SCIP_ALLOC( BMSallocMemoryArray(&benders->auxiliaryvars, benders->nsubproblems) );
       SCIP_ALLOC( BMSallocMemoryArray(&benders->solvestat, benders->nsubproblems) );
+      SCIP_ALLOC( BMSallocMemoryArray(&benders->subprobclocks, benders->nsubproblems) );
+      SCIP_ALLOC( BMSallocClearMemoryArray(&benders->subproblpistates, benders->nsubproblems) );
+      SCIP_ALLOC( BMSallocClearMemoryArray(&benders->subproblpinorms, benders->nsubproblems) );
       SCIP_ALLOC( BMSallocMemoryArray(&benders->subprobobjval, benders->nsubproblems) );
       SCIP_ALLOC( BMSallocMemoryArray(&benders->bestsubprobobjval, benders->nsubproblems) );
       SCIP_ALLOC( BMSallocMemoryArray(&benders->subproblowerbound, benders->nsubproblems) );
@@ -2628,6 +2781,9 @@ SCIP_RETCODE SCIPbendersActivate(
          solvestat->avgiter = 0;
          benders->solvestat[i] = solvestat;
 
+         SCIP_CALL( SCIPclockCreate(&benders->subprobclocks[i], SCIP_CLOCKTYPE_DEFAULT) );
+         SCIPclockEnableOrDisable(benders->subprobclocks[i], set->time_statistictiming);
+
          /* inserting the initial elements into the priority queue */
          SCIP_CALL( SCIPpqueueInsert(benders->subprobqueue, benders->solvestat[i]) );
       }
@@ -2687,7 +2843,10 @@ SCIP_RETCODE SCIPbendersDeactivate(
       SCIPpqueueFree(&benders->subprobqueue);
 
       for( i = nsubproblems - 1; i >= 0; i-- )
+      {
+         SCIPclockFree(&benders->subprobclocks[i]);
          BMSfreeMemory(&benders->solvestat[i]);
+      }
 
       /* freeing the memory allocated during the activation of the Benders' decomposition */
       BMSfreeMemoryArray(&benders->mastervarscont);
@@ -2701,6 +2860,14 @@ SCIP_RETCODE SCIPbendersDeactivate(
       BMSfreeMemoryArray(&benders->bestsubprobobjval);
       BMSfreeMemoryArray(&benders->subprobobjval);
       BMSfreeMemoryArray(&benders->auxiliaryvars);
+#ifndef NDEBUG
+      /* the LP states are freed at the end of the solving process, before the subproblems are freed */
+      for( i = 0; i < nsubproblems; i++ )
+         assert(benders->subproblpistates[i] == NULL && benders->subproblpinorms[i] == NULL);
+#endif
+      BMSfreeMemoryArray(&benders->subproblpinorms);
+      BMSfreeMemoryArray(&benders->subproblpistates);
+      BMSfreeMemoryArray(&benders->subprobclocks);
       BMSfreeMemoryArray(&benders->solvestat);
       BMSfreeMemoryArray(&benders->subproblems);
    }
@@ -3298,7 +3465,9 @@ SCIP_RETCODE solveBendersSubproblems(
          }
          else if( solvesub )
          {
+            SCIPclockStart(benders->subprobclocks[i], set);
             retcode = SCIPbendersExecSubproblemSolve(benders, set, sol, i, solveloop, FALSE, &solved, &subinfeas, type);
+            SCIPclockStop(benders->subprobclocks[i], set);
 
             /* the solution for the subproblem is only processed if the return code is SCIP_OKAY */
             if( retcode == SCIP_OKAY )
@@ -3727,6 +3896,12 @@ SCIP_RETCODE SCIPbendersExec(
    /* sets the stored objective function values of the subproblems to infinity */
    resetSubproblemObjectiveValue(benders, set);
 
+   /* the duplicate detection only considers the cuts of the current call, including its cut strengthening round */
+   if( !benders->strengthenround )
+   {
+      SCIP_CALL( freeCallCuts(benders, set) );
+   }
+
    *result = SCIP_DIDNOTRUN;
 
    if( benders->benderspresubsolve != NULL && !benders->strengthenround )
@@ -4877,6 +5052,22 @@ SCIP_RETCODE SCIPbendersSolveSubproblemLP(
    {
       SCIP_Bool lperror;
       SCIP_Bool cutoff;
+      SCIP_Bool warmstart;
+
+      /* the probing mode of convex continuous subproblems is ended after each solve, which discards the LP basis. Only
+       * the bounds of the master problem variables change between two solves, so the basis of the last optimal solve
+       * stays dual feasible and is loaded into the probing LP to warm start the dual simplex.
+       */
+      warmstart = benders->warmstartlp && SCIPbendersGetSubproblemType(benders, probnumber) == SCIP_BENDERSSUBTYPE_CONVEXCONT;
+
+      if( warmstart && benders->subproblpistates[probnumber] != NULL )
+      {
+         /* the ownership of the LP state and norms is passed to the current probing node */
+         SCIP_CALL( SCIPsetProbingLPState(subproblem, &benders->subproblpistates[probnumber],
+               &benders->subproblpinorms[probnumber], FALSE, TRUE) );
+         assert(benders->subproblpistates[probnumber] == NULL);
+         assert(benders->subproblpinorms[probnumber] == NULL);
+      }
 
       SCIP_CALL( SCIPsolveProbingLP(subproblem, -1, &lperror, &cutoff) );
 
@@ -4892,6 +5083,17 @@ SCIP_RETCODE SCIPbendersSolveSubproblemLP(
          {
             (*solvestatus) = SCIP_STATUS_OPTIMAL;
             (*objective) = SCIPgetSolOrigObj(subproblem, NULL)*(int)SCIPgetObjsense(scip);
+
+            /* storing the optimal basis for warm starting the next solve of the subproblem */
+            if( warmstart && !lperror )
+            {
+               SCIP_LPI* lpi;
+
+               SCIP_CALL( freeSubproblemLPState(benders, probnumber) );
+               SCIP_CALL( SCIPgetLPI(subproblem, &lpi) );
+               SCIP_CALL( SCIPlpiGetState(lpi, SCIPblkmem(subproblem), &benders->subproblpistates[probnumber]) );
+               SCIP_CALL( SCIPlpiGetNorms(lpi, SCIPblkmem(subproblem), &benders->subproblpinorms[probnumber]) );
+            }
             break;
          }
 
@@ -6067,6 +6269,42 @@ SCIP_Real SCIPbendersGetTime(
    return SCIPclockGetTime(benders->bendersclock);
 }
 
+/** gets the number of generated cuts that were discarded because they were already generated in the same call */
+int SCIPbendersGetNDuplicateCuts(
+   SCIP_BENDERS*         benders             /**< Benders' decomposition */
+   )
+{
+   assert(benders != NULL);
+
+   return benders->nduplicatecuts;
+}
+
+/** gets time in seconds used for solving the given subproblem */
+SCIP_Real SCIPbendersGetSubproblemTime(
+   SCIP_BENDERS*         benders,            /**< Benders' decomposition */
+   int                   probnumber          /**< the subproblem number */
+   )
+{
+   assert(benders != NULL);
+   assert(benders->active);
+   assert(probnumber >= 0 && probnumber < SCIPbendersGetNSubproblems(benders));
+
+   return SCIPclockGetTime(benders->subprobclocks[probnumber]);
+}
+
+/** gets the number of times the given subproblem has been solved */
+int SCIPbendersGetSubproblemNCalls(
+   SCIP_BENDERS*         benders,            /**< Benders' decomposition */
+   int                   probnumber          /**< the subproblem number */
+   )
+{
+   assert(benders != NULL);
+   assert(benders->active);
+   assert(probnumber >= 0 && probnumber < SCIPbendersGetNSubproblems(benders));
+
+   return benders->solvestat[probnumber]->ncalls;
+}
+
 /** enables or disables all clocks of the Benders' decomposition, depending on the value of the flag */
 void SCIPbendersEnableOrDisableClocks(
    SCIP_BENDERS*         benders,            /**< the Benders' decomposition for which all clocks should be enabled or disabled */
@@ -6077,6 +6315,14 @@ void SCIPbendersEnableOrDisableClocks(
 
    SCIPclockEnableOrDisable(benders->setuptime, enable);
    SCIPclockEnableOrDisable(benders->bendersclock, enable);
+
+   if( benders->active )
+   {
+      int i;
+
+      for( i = 0; i < benders->nsubproblems; i++ )
+         SCIPclockEnableOrDisable(benders->subprobclocks[i], enable);
+   }
 }
 
 /** is Benders' decomposition initialized? */
@@ -6888,6 +7134,85 @@ SCIP_RETCODE SCIPbendersStoreCut(
    return SCIP_OKAY;
 }
 
+/** registers a cut that has been generated in the current call of the Benders' decomposition and returns whether an
+ *  identical cut has already been generated in this call
+ *
+ *  If duplicate cuts are not discarded, as determined by the parameter benders/<name>/cutdedup, then the cut is not
+ *  registered and it is never reported as a duplicate.
+ */
+SCIP_RETCODE SCIPbendersRegisterCut(
+   SCIP_BENDERS*         benders,            /**< Benders' decomposition */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_VAR**            vars,               /**< the variables that have non-zero coefficients in the cut */
+   SCIP_Real*            vals,               /**< the coefficients of the variables in the cut */
+   SCIP_Real             lhs,                /**< the left hand side of the cut */
+   SCIP_Real             rhs,                /**< the right hand side of the cut */
+   int                   nvars,              /**< the number of variables with non-zero coefficients in the cut */
+   SCIP_Bool*            duplicate           /**< pointer to store whether the cut was already generated in this call */
+   )
+{
+   SCIP_BENDERSCUTCUT* cut;
+
+   assert(benders != NULL);
+   assert(set != NULL);
+   assert(vars != NULL || nvars == 0);
+   assert(vals != NULL || nvars == 0);
+   assert(duplicate != NULL);
+
+   (*duplicate) = FALSE;
+
+   if( !benders->cutdedup )
+      return SCIP_OKAY;
+
+   /* typically, at most one cut is generated for each subproblem in a call */
+   if( benders->cuttable == NULL )
+   {
+      SCIP_CALL( SCIPhashtableCreate(&benders->cuttable, SCIPblkmem(set->scip), benders->nsubproblems,
+            hashGetKeyBenderscutcut, hashKeyEqBenderscutcut, hashKeyValBenderscutcut, (void*)set) );
+   }
+
+   /* the cut is stored with its variables sorted by their index, such that equal cuts have equal arrays */
+   SCIP_CALL( SCIPallocBlockMemory(set->scip, &cut) );
+   SCIP_CALL( SCIPduplicateBlockMemoryArray(set->scip, &cut->vars, vars, nvars) );
+   SCIP_CALL( SCIPduplicateBlockMemoryArray(set->scip, &cut->vals, vals, nvars) );
+   cut->lhs = lhs;
+   cut->rhs = rhs;
+   cut->nvars = nvars;
+   SCIPsortPtrReal((void**)cut->vars, cut->vals, SCIPvarComp, nvars);
+
+   if( SCIPhashtableExists(benders->cuttable, (void*)cut) )
+   {
+      SCIPfreeBlockMemoryArray(set->scip, &cut->vals, nvars);
+      SCIPfreeBlockMemoryArray(set->scip, &cut->vars, nvars);
+      SCIPfreeBlockMemory(set->scip, &cut);
+
+      benders->nduplicatecuts++;
+      (*duplicate) = TRUE;
+
+      return SCIP_OKAY;
+   }
+
+   /* ensuring the required memory is available for the cuts of this call */
+   if( benders->callcutssize < benders->ncallcuts + 1 )
+   {
+      int newsize;
+
+      newsize = SCIPsetCalcMemGrowSize(set, benders->ncallcuts + 1);
+      SCIP_ALLOC( BMSreallocBlockMemoryArray(SCIPblkmem(set->scip), &benders->callcuts,
+            benders->callcutssize, newsize) );
+
+      benders->callcutssize = newsize;
+   }
+   assert(benders->callcutssize >= benders->ncallcuts + 1);
+
+   benders->callcuts[benders->ncallcuts] = cut;
+   benders->ncallcuts++;
+
+   SCIP_CALL( SCIPhashtableInsert(benders->cuttable, (void*)cut) );
+
+   return SCIP_OKAY;
+}
+
 /** sets the sorted flags in the Benders' decomposition */
 void SCIPbendersSetBenderscutsSorted(
    SCIP_BENDERS*         benders,            /**< Benders' decomposition structure */
@@ -415,6 +415,20 @@ SCIP_RETCODE SCIPbendersStoreCut(
    int                   nvars               /**< the number of variables with non-zero coefficients in the cut */
    );
 
+/** registers a cut that has been generated in the current call of the Benders' decomposition and returns whether an
+ *  identical cut has already been generated in this call
+ */
+SCIP_RETCODE SCIPbendersRegisterCut(
+   SCIP_BENDERS*         benders,            /**< Benders' decomposition */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_VAR**            vars,               /**< the variables that have non-zero coefficients in the cut */
+   SCIP_Real*            vals,               /**< the coefficients of the variables in the cut */
+   SCIP_Real             lhs,                /**< the left hand side of the cut */
+   SCIP_Real             rhs,                /**< the right hand side of the cut */
+   int                   nvars,              /**< the number of variables with non-zero coefficients in the cut */
+   SCIP_Bool*            duplicate           /**< pointer to store whether the cut was already generated in this call */
+   );
+
 /** inserts a Benders' cut algorithm plugin into the Benders' cuts plugin list */
 SCIP_RETCODE SCIPbendersIncludeBenderscut(
    SCIP_BENDERS*         benders,            /**< Benders' decomposition structure */
@@ -422,10 +422,19 @@ SCIP_RETCODE generateAndApplyBendersCuts(
 
       if( success )
       {
+         SCIP_Bool duplicate;
+
+         /* the same feasibility cut could have been generated for another subproblem in this call */
+         SCIP_CALL( SCIPregisterBendersCut(masterprob, benders, vars, vals, lhs, SCIPinfinity(masterprob), nvars,
+               &duplicate) );
+
          /* adding the constraint to the master problem */
-         SCIP_CALL( SCIPaddCons(masterprob, cut) );
+         if( !duplicate )
+         {
+            SCIP_CALL( SCIPaddCons(masterprob, cut) );
 
-         SCIPdebugPrintCons(masterprob, cut, NULL);
+            SCIPdebugPrintCons(masterprob, cut, NULL);
+         }
 
          (*result) = SCIP_CONSADDED;
       }
@@ -945,14 +945,26 @@ SCIP_RETCODE SCIPgenerateAndApplyBendersOptCut(
 
       if( success )
       {
+         SCIP_Bool duplicate;
+
          /* adding the auxiliary variable to the optimality cut */
          if( !feasibilitycut )
          {
             SCIP_CALL( addAuxiliaryVariableToCut(masterprob, benders, vars, vals, &nvars, probnumber) );
          }
 
+         /* an identical cut could have been generated for another subproblem in this call */
+         SCIP_CALL( SCIPregisterBendersCut(masterprob, benders, vars, vals, lhs, rhs, nvars, &duplicate) );
+
+         if( duplicate )
+         {
+            SCIPdebugMsg(masterprob, "Benders' cut <%s> has already been generated in this call.\n", cutname);
+
+            /* the identical cut has been added to the master problem already */
+            (*result) = addcut ? SCIP_SEPARATED : SCIP_CONSADDED;
+         }
          /* adding the constraint to the master problem */
-         if( addcut )
+         else if( addcut )
          {
             SCIP_Bool infeasible;
 
@@ -991,7 +1003,10 @@ SCIP_RETCODE SCIPgenerateAndApplyBendersOptCut(
          }
 
          /* storing the data that is used to create the cut */
-         SCIP_CALL( SCIPstoreBendersCut(masterprob, benders, vars, vals, lhs, rhs, nvars) );
+         if( !duplicate )
+         {
+            SCIP_CALL( SCIPstoreBendersCut(masterprob, benders, vars, vals, lhs, rhs, nvars) );
+         }
       }
       else
       {
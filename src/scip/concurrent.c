@@ -830,6 +830,10 @@ SCIP_RETCODE SCIPcopyConcurrentSolvingStats(
    tmptime += SCIPgetClockTime(source, source->stat->nlpsoltime);
    SCIP_CALL( SCIPsetClockTime(target, target->stat->nlpsoltime, tmptime) );
 
+   tmptime = SCIPgetClockTime(target, target->stat->divingnlpsoltime);
+   tmptime += SCIPgetClockTime(source, source->stat->divingnlpsoltime);
+   SCIP_CALL( SCIPsetClockTime(target, target->stat->divingnlpsoltime, tmptime) );
+
    tmptime = SCIPgetClockTime(target, target->stat->strongpropclock);
    tmptime += SCIPgetClockTime(source, source->stat->strongpropclock);
    SCIP_CALL( SCIPsetClockTime(target, target->stat->strongpropclock, tmptime) );
@@ -870,6 +874,9 @@ SCIP_RETCODE SCIPcopyConcurrentSolvingStats(
    target->stat->nrootstrongbranchs = source->stat->nrootstrongbranchs;
    target->stat->nconflictlps = source->stat->nconflictlps;
    target->stat->nnlps = source->stat->nnlps;
+   target->stat->nnlpiterations = source->stat->nnlpiterations;
+   target->stat->ndivingnlps = source->stat->ndivingnlps;
+   target->stat->ndivingnlpiterations = source->stat->ndivingnlpiterations;
    target->stat->nisstoppedcalls = source->stat->nisstoppedcalls;
    target->stat->totaldivesetdepth = source->stat->totaldivesetdepth;
    target->stat->ndivesetcalls = source->stat->ndivesetcalls;
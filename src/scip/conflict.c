@@ -3367,6 +3367,44 @@ SCIP_RETCODE conflictFlushProofset(
    return SCIP_OKAY;
 }
 
+/** computes the literal block distance of a conflict set, i.e., the number of distinct depth levels of its bound changes */
+static
+SCIP_RETCODE conflictsetCalcLbd(
+   SCIP_CONFLICTSET*     conflictset,        /**< conflict set */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int*                  lbd                 /**< pointer to store the literal block distance */
+   )
+{
+   int* depths;
+   int i;
+
+   assert(conflictset != NULL);
+   assert(lbd != NULL);
+
+   *lbd = 0;
+
+   if( conflictset->nbdchginfos == 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &depths, conflictset->nbdchginfos) );
+
+   for( i = 0; i < conflictset->nbdchginfos; ++i )
+      depths[i] = SCIPbdchginfoGetDepth(conflictset->bdchginfos[i]);
+
+   SCIPsortInt(depths, conflictset->nbdchginfos);
+
+   *lbd = 1;
+   for( i = 1; i < conflictset->nbdchginfos; ++i )
+   {
+      if( depths[i] != depths[i-1] )
+         ++(*lbd);
+   }
+
+   SCIPsetFreeBufferArray(set, &depths);
+
+   return SCIP_OKAY;
+}
+
 /** adds the given conflict set as conflict constraint to the problem */
 static
 SCIP_RETCODE conflictAddConflictCons(
@@ -3387,6 +3425,7 @@ SCIP_RETCODE conflictAddConflictCons(
    SCIP_Bool*            success             /**< pointer to store whether the addition was successful */
    )
 {
+   SCIP_RETCODE retcode;
    SCIP_Bool redundant;
    int h;
 
@@ -3491,26 +3530,37 @@ SCIP_RETCODE conflictAddConflictCons(
       /* sort conflict handlers by priority */
       SCIPsetSortConflicthdlrs(set);
 
-      /* call conflict handlers to create a conflict constraint */
-      for( h = 0; h < set->nconflicthdlrs; ++h )
+      /* the conflict store ranks the created conflict constraints by the literal block distance of the conflict set */
+      SCIP_CALL( conflictsetCalcLbd(conflictset, set, &conflict->conflictsetlbd) );
+
+      /* call conflict handlers to create a conflict constraint; the literal block distance is reset also on errors */
+      retcode = SCIP_OKAY;
+      for( h = 0; h < set->nconflicthdlrs && retcode == SCIP_OKAY; ++h )
       {
          SCIP_RESULT result;
 
          assert(conflictset->conflicttype != SCIP_CONFTYPE_UNKNOWN);
 
-         SCIP_CALL( SCIPconflicthdlrExec(set->conflicthdlrs[h], set, tree->path[insertdepth],
+         retcode = SCIPconflicthdlrExec(set->conflicthdlrs[h], set, tree->path[insertdepth],
                tree->path[conflictset->validdepth], conflictset->bdchginfos, conflictset->relaxedbds,
-               conflictset->nbdchginfos, conflictset->conflicttype, conflictset->usescutoffbound, *success, &result) );
+               conflictset->nbdchginfos, conflictset->conflicttype, conflictset->usescutoffbound, *success, &result);
+         if( retcode != SCIP_OKAY )
+            break;
+
          if( result == SCIP_CONSADDED )
          {
             *success = TRUE;
-            SCIP_CALL( updateStatistics(conflict, blkmem, set, stat, conflictset, insertdepth) );
+            retcode = updateStatistics(conflict, blkmem, set, stat, conflictset, insertdepth);
          }
 
          SCIPsetDebugMsg(set, " -> call conflict handler <%s> (prio=%d) to create conflict set with %d bounds returned result %d\n",
             SCIPconflicthdlrGetName(set->conflicthdlrs[h]), SCIPconflicthdlrGetPriority(set->conflicthdlrs[h]),
             conflictset->nbdchginfos, result);
       }
+
+      conflict->conflictsetlbd = -1;
+
+      SCIP_CALL( retcode );
    }
    else
    {
@@ -3743,6 +3793,18 @@ int SCIPconflictGetNConflicts(
    return conflict->nconflictsets;
 }
 
+/** returns the literal block distance of the conflict set that is currently passed to the conflict handlers, or -1 if
+ *  no conflict set is processed
+ */
+int SCIPconflictGetConflictsetLbd(
+   SCIP_CONFLICT*        conflict            /**< conflict analysis data */
+   )
+{
+   assert(conflict != NULL);
+
+   return conflict->conflictsetlbd;
+}
+
 /** returns the total number of conflict constraints that were added to the problem */
 SCIP_Longint SCIPconflictGetNAppliedConss(
    SCIP_CONFLICT*        conflict            /**< conflict analysis data */
@@ -3869,6 +3931,270 @@ SCIP_DECL_SORTPTRCOMP(conflictBdchginfoComp)
       return +1;
 }
 
+/** sets up the trail of the current path, on which binary conflict candidates are kept during conflict analysis;
+ *
+ *  each bound change on the path is identified by the timestamp (depth, pos), which is mapped to the flat trail
+ *  position trailstarts[depth] + pos; since resolving a bound change only adds bound changes with earlier timestamps,
+ *  the binary candidates can be processed by scanning a bitset downwards instead of maintaining a priority queue
+ */
+static
+SCIP_RETCODE conflictSetupTrail(
+   SCIP_CONFLICT*        conflict,           /**< conflict analysis data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_TREE*            tree                /**< branch and bound tree */
+   )
+{
+   int traillen;
+   int d;
+
+   assert(conflict != NULL);
+   assert(conflict->ntrailcands == 0);
+   assert(set != NULL);
+   assert(tree != NULL);
+
+   conflict->ntraildepths = 0;
+   conflict->trailtop = -1;
+
+   if( !set->conf_usetrail || tree->pathlen == 0 )
+      return SCIP_OKAY;
+
+   if( tree->pathlen + 1 > conflict->trailstartssize )
+   {
+      int newsize;
+
+      newsize = SCIPsetCalcMemGrowSize(set, tree->pathlen + 1);
+      SCIP_ALLOC( BMSreallocMemoryArray(&conflict->trailstarts, newsize) );
+      conflict->trailstartssize = newsize;
+   }
+
+   traillen = 0;
+   for( d = 0; d < tree->pathlen; ++d )
+   {
+      conflict->trailstarts[d] = traillen;
+      if( tree->path[d]->domchg != NULL )
+         traillen += (int)tree->path[d]->domchg->domchgbound.nboundchgs;
+   }
+   conflict->trailstarts[tree->pathlen] = traillen;
+
+   if( traillen > conflict->trailsize )
+   {
+      int oldnwords;
+      int newsize;
+
+      oldnwords = (conflict->trailsize + 63) / 64;
+      newsize = SCIPsetCalcMemGrowSize(set, traillen);
+      SCIP_ALLOC( BMSreallocMemoryArray(&conflict->trailbdchginfos, newsize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&conflict->trailseen, (newsize + 63) / 64) );
+      BMSclearMemoryArray(&conflict->trailseen[oldnwords], (newsize + 63) / 64 - oldnwords); /*lint !e866*/
+      conflict->trailsize = newsize;
+   }
+
+   conflict->ntraildepths = tree->pathlen;
+
+   return SCIP_OKAY;
+}
+
+/** marks a binary conflict candidate on the trail; returns FALSE if the bound change is not covered by the trail */
+static
+SCIP_Bool conflictTrailInsert(
+   SCIP_CONFLICT*        conflict,           /**< conflict analysis data */
+   SCIP_BDCHGINFO*       bdchginfo           /**< bound change information of a binary variable */
+   )
+{
+   uint64_t mask;
+   int depth;
+   int pos;
+   int trailpos;
+
+   assert(conflict != NULL);
+   assert(bdchginfo != NULL);
+   assert(SCIPvarIsBinary(SCIPbdchginfoGetVar(bdchginfo)));
+
+   depth = SCIPbdchginfoGetDepth(bdchginfo);
+   pos = SCIPbdchginfoGetPos(bdchginfo);
+
+   if( depth < 0 || depth >= conflict->ntraildepths || pos < 0
+      || pos >= conflict->trailstarts[depth+1] - conflict->trailstarts[depth] )
+      return FALSE;
+
+   trailpos = conflict->trailstarts[depth] + pos;
+   assert(trailpos < conflict->trailsize);
+
+   /* a multiple insertion of the same bound change only needs to be processed once */
+   mask = (uint64_t)1 << (trailpos & 63);
+   if( (conflict->trailseen[trailpos >> 6] & mask) != 0 )
+   {
+      assert(conflict->trailbdchginfos[trailpos] == bdchginfo);
+      return TRUE;
+   }
+
+   conflict->trailseen[trailpos >> 6] |= mask;
+   conflict->trailbdchginfos[trailpos] = bdchginfo;
+   conflict->ntrailcands++;
+   conflict->trailtop = MAX(conflict->trailtop, trailpos);
+
+   return TRUE;
+}
+
+/** returns the latest binary conflict candidate on the trail without removing it, or NULL if the trail is empty */
+static
+SCIP_BDCHGINFO* conflictTrailFirst(
+   SCIP_CONFLICT*        conflict            /**< conflict analysis data */
+   )
+{
+   uint64_t word;
+   int w;
+
+   assert(conflict != NULL);
+
+   if( conflict->ntrailcands == 0 )
+      return NULL;
+
+   assert(conflict->trailtop >= 0);
+
+   /* scan the bitset downwards, starting in the word of the last known top position */
+   w = conflict->trailtop >> 6;
+   word = conflict->trailseen[w] & (~(uint64_t)0 >> (63 - (conflict->trailtop & 63)));
+   while( word == 0 )
+   {
+      --w;
+      assert(w >= 0);
+      word = conflict->trailseen[w];
+   }
+
+   conflict->trailtop = 64 * w + 63;
+   while( (word & ((uint64_t)1 << 63)) == 0 )
+   {
+      word <<= 1;
+      conflict->trailtop--;
+   }
+
+   return conflict->trailbdchginfos[conflict->trailtop];
+}
+
+/** removes the latest binary conflict candidate from the trail; conflictTrailFirst() has to be called before */
+static
+void conflictTrailRemoveFirst(
+   SCIP_CONFLICT*        conflict            /**< conflict analysis data */
+   )
+{
+   assert(conflict != NULL);
+   assert(conflict->ntrailcands > 0);
+   assert(conflict->trailtop >= 0);
+   assert((conflict->trailseen[conflict->trailtop >> 6] & ((uint64_t)1 << (conflict->trailtop & 63))) != 0);
+
+   conflict->trailseen[conflict->trailtop >> 6] &= ~((uint64_t)1 << (conflict->trailtop & 63));
+   conflict->ntrailcands--;
+}
+
+/** returns whether the latest candidate of the trail is later than the first candidate of the (non-forced) queue */
+static
+SCIP_Bool conflictTrailIsFirst(
+   SCIP_CONFLICT*        conflict            /**< conflict analysis data */
+   )
+{
+   SCIP_BDCHGINFO* trailcand;
+   SCIP_BDCHGINFO* queuecand;
+
+   assert(conflict != NULL);
+
+   trailcand = conflictTrailFirst(conflict);
+   if( trailcand == NULL )
+      return FALSE;
+
+   queuecand = (SCIP_BDCHGINFO*)(SCIPpqueueFirst(conflict->bdchgqueue));
+
+   return (queuecand == NULL
+      || SCIPbdchgidxIsEarlierNonNull(SCIPbdchginfoGetIdx(queuecand), SCIPbdchginfoGetIdx(trailcand)));
+}
+
+/** unmarks all binary conflict candidates on the trail */
+static
+void conflictTrailClear(
+   SCIP_CONFLICT*        conflict            /**< conflict analysis data */
+   )
+{
+   assert(conflict != NULL);
+
+   if( conflict->ntrailcands > 0 )
+   {
+      assert(conflict->trailtop >= 0);
+      BMSclearMemoryArray(conflict->trailseen, (conflict->trailtop >> 6) + 1);
+      conflict->ntrailcands = 0;
+   }
+   conflict->trailtop = -1;
+}
+
+/** stores all binary conflict candidates of the trail in the given array, which must be large enough */
+static
+void conflictTrailGetCands(
+   SCIP_CONFLICT*        conflict,           /**< conflict analysis data */
+   SCIP_BDCHGINFO**      bdchginfos,         /**< array to store the candidates */
+   int*                  nbdchginfos         /**< pointer to the number of entries in the array, which is increased */
+   )
+{
+   int w;
+
+   assert(conflict != NULL);
+   assert(bdchginfos != NULL);
+   assert(nbdchginfos != NULL);
+
+   if( conflict->ntrailcands == 0 )
+      return;
+
+   for( w = (conflict->trailtop >> 6); w >= 0; --w )
+   {
+      uint64_t word;
+      int trailpos;
+
+      word = conflict->trailseen[w];
+      for( trailpos = 64 * w; word != 0; ++trailpos, word >>= 1 )
+      {
+         if( (word & 1) != 0 )
+         {
+            bdchginfos[*nbdchginfos] = conflict->trailbdchginfos[trailpos];
+            (*nbdchginfos)++;
+         }
+      }
+   }
+}
+
+#ifdef WITH_DEBUG_SOLUTION
+/** checks the conflict graph frontier, given by the conflict set, the candidate queues, and the trail, on the debugging
+ *  solution
+ */
+static
+SCIP_RETCODE conflictDebugCheckFrontier(
+   SCIP_CONFLICT*        conflict,           /**< conflict analysis data */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_NODE*            node,               /**< node where the conflict clause is added */
+   SCIP_BDCHGINFO*       bdchginfo           /**< bound change info which got resolved, or NULL */
+   )
+{
+   SCIP_BDCHGINFO** trailcands;
+   int ntrailcands;
+
+   assert(conflict != NULL);
+
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &trailcands, conflict->ntrailcands) );
+
+   ntrailcands = 0;
+   conflictTrailGetCands(conflict, trailcands, &ntrailcands);
+   assert(ntrailcands == conflict->ntrailcands);
+
+   SCIP_CALL( SCIPdebugCheckConflictFrontier(blkmem, set, node, bdchginfo, conflict->conflictset->bdchginfos,
+         conflict->conflictset->relaxedbds, conflict->conflictset->nbdchginfos, conflict->bdchgqueue,
+         conflict->forcedbdchgqueue, trailcands, ntrailcands) );
+
+   SCIPsetFreeBufferArray(set, &trailcands);
+
+   return SCIP_OKAY;
+}
+#else
+#define conflictDebugCheckFrontier(conflict,blkmem,set,node,bdchginfo) SCIP_OKAY
+#endif
+
 /** return TRUE if conflict analysis is applicable; In case the function return FALSE there is no need to initialize the
  *  conflict analysis since it will not be applied
  */
@@ -3916,6 +4242,14 @@ SCIP_RETCODE SCIPconflictCreate(
    (*conflict)->conflictsets = NULL;
    (*conflict)->conflictsetscores = NULL;
    (*conflict)->tmpbdchginfos = NULL;
+   (*conflict)->trailbdchginfos = NULL;
+   (*conflict)->trailseen = NULL;
+   (*conflict)->trailstarts = NULL;
+   (*conflict)->trailsize = 0;
+   (*conflict)->trailstartssize = 0;
+   (*conflict)->ntraildepths = 0;
+   (*conflict)->ntrailcands = 0;
+   (*conflict)->trailtop = -1;
    (*conflict)->conflictsetssize = 0;
    (*conflict)->nconflictsets = 0;
    (*conflict)->proofsets = NULL;
@@ -3924,6 +4258,7 @@ SCIP_RETCODE SCIPconflictCreate(
    (*conflict)->tmpbdchginfossize = 0;
    (*conflict)->ntmpbdchginfos = 0;
    (*conflict)->count = 0;
+   (*conflict)->conflictsetlbd = -1;
    (*conflict)->nglbchgbds = 0;
    (*conflict)->nappliedglbconss = 0;
    (*conflict)->nappliedglbliterals = 0;
@@ -4007,6 +4342,9 @@ SCIP_RETCODE SCIPconflictFree(
    BMSfreeMemoryArrayNull(&(*conflict)->conflictsetscores);
    BMSfreeMemoryArrayNull(&(*conflict)->proofsets);
    BMSfreeMemoryArrayNull(&(*conflict)->tmpbdchginfos);
+   BMSfreeMemoryArrayNull(&(*conflict)->trailbdchginfos);
+   BMSfreeMemoryArrayNull(&(*conflict)->trailseen);
+   BMSfreeMemoryArrayNull(&(*conflict)->trailstarts);
    BMSfreeMemory(conflict);
 
    return SCIP_OKAY;
@@ -4022,6 +4360,7 @@ void conflictClear(
 
    SCIPpqueueClear(conflict->bdchgqueue);
    SCIPpqueueClear(conflict->forcedbdchgqueue);
+   conflictTrailClear(conflict);
    conflictsetClear(conflict->conflictset);
 }
 
@@ -4031,6 +4370,7 @@ SCIP_RETCODE SCIPconflictInit(
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< problem statistics */
    SCIP_PROB*            prob,               /**< problem data */
+   SCIP_TREE*            tree,               /**< branch and bound tree */
    SCIP_CONFTYPE         conftype,           /**< type of the conflict */
    SCIP_Bool             usescutoffbound     /**< depends the conflict on a cutoff bound? */
    )
@@ -4039,12 +4379,16 @@ SCIP_RETCODE SCIPconflictInit(
    assert(set != NULL);
    assert(stat != NULL);
    assert(prob != NULL);
+   assert(tree != NULL);
 
    SCIPsetDebugMsg(set, "initializing conflict analysis\n");
 
    /* clear the conflict candidate queue and the conflict set */
    conflictClear(conflict);
 
+   /* map the bound changes of the current path to trail positions */
+   SCIP_CALL( conflictSetupTrail(conflict, set, tree) );
+
    /* set conflict type */
    assert(conftype == SCIP_CONFTYPE_BNDEXCEEDING || conftype == SCIP_CONFTYPE_INFEASLP
        || conftype == SCIP_CONFTYPE_PROPAGATION);
@@ -4272,7 +4616,11 @@ SCIP_RETCODE conflictQueueBound(
       if( (!set->conf_preferbinary || SCIPvarIsBinary(SCIPbdchginfoGetVar(bdchginfo)))
          && !isBoundchgUseless(set, bdchginfo) )
       {
-         SCIP_CALL( SCIPpqueueInsert(conflict->bdchgqueue, (void*)bdchginfo) );
+         /* binary candidates are kept on the trail if possible, all others go into the priority queue */
+         if( !SCIPvarIsBinary(SCIPbdchginfoGetVar(bdchginfo)) || !conflictTrailInsert(conflict, bdchginfo) )
+         {
+            SCIP_CALL( SCIPpqueueInsert(conflict->bdchgqueue, (void*)bdchginfo) );
+         }
       }
       else
       {
@@ -4713,6 +5061,11 @@ SCIP_BDCHGINFO* conflictRemoveCand(
 
    if( SCIPpqueueNElems(conflict->forcedbdchgqueue) > 0 )
       bdchginfo = (SCIP_BDCHGINFO*)(SCIPpqueueRemove(conflict->forcedbdchgqueue));
+   else if( conflictTrailIsFirst(conflict) )
+   {
+      bdchginfo = conflictTrailFirst(conflict);
+      conflictTrailRemoveFirst(conflict);
+   }
    else
       bdchginfo = (SCIP_BDCHGINFO*)(SCIPpqueueRemove(conflict->bdchgqueue));
 
@@ -4792,6 +5145,12 @@ SCIP_BDCHGINFO* conflictFirstCand(
          /* call method recursively to get next conflict analysis candidate */
          bdchginfo = conflictFirstCand(conflict);
       }
+      else if( conflictTrailIsFirst(conflict) )
+      {
+         /* binary candidates on the trail can never be invalid */
+         bdchginfo = conflictTrailFirst(conflict);
+         assert(!bdchginfoIsInvalid(conflict, bdchginfo));
+      }
    }
    assert(bdchginfo == NULL || !SCIPbdchginfoIsRedundant(bdchginfo));
 
@@ -4843,9 +5202,12 @@ SCIP_RETCODE conflictAddConflictset(
    assert(0 <= conflict->conflictset->validdepth && conflict->conflictset->validdepth <= currentdepth);
    assert(0 <= validdepth && validdepth <= currentdepth);
 
-   /* get the elements of the bound change queue */
-   bdchginfos = (SCIP_BDCHGINFO**)SCIPpqueueElems(conflict->bdchgqueue);
+   /* get the elements of the bound change queue and of the trail */
    nbdchginfos = SCIPpqueueNElems(conflict->bdchgqueue);
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &bdchginfos, nbdchginfos + conflict->ntrailcands) );
+   BMScopyMemoryArray(bdchginfos, (SCIP_BDCHGINFO**)SCIPpqueueElems(conflict->bdchgqueue), nbdchginfos);
+   conflictTrailGetCands(conflict, bdchginfos, &nbdchginfos);
+   assert(nbdchginfos == SCIPpqueueNElems(conflict->bdchgqueue) + conflict->ntrailcands);
 
    /* create a copy of the current conflict set, allocating memory for the additional elements of the queue */
    SCIP_CALL( conflictsetCopy(&conflictset, blkmem, conflict->conflictset, nbdchginfos) );
@@ -4856,6 +5218,8 @@ SCIP_RETCODE conflictAddConflictset(
    SCIPsetDebugMsg(set, "adding %d variables from the queue as temporary conflict variables\n", nbdchginfos);
    SCIP_CALL( conflictsetAddBounds(conflict, conflictset, blkmem, set, bdchginfos, nbdchginfos) );
 
+   SCIPsetFreeBufferArray(set, &bdchginfos);
+
    /* calculate the depth, at which the conflictset should be inserted */
    SCIP_CALL( conflictsetCalcInsertDepth(conflictset, set, tree) );
    assert(conflictset->validdepth <= conflictset->insertdepth && conflictset->insertdepth <= currentdepth);
@@ -4920,7 +5284,7 @@ SCIP_RETCODE conflictResolveBound(
    /* store the current size of the conflict queues */
    assert(conflict != NULL);
    nforcedbdchgqueue = SCIPpqueueNElems(conflict->forcedbdchgqueue);
-   nbdchgqueue = SCIPpqueueNElems(conflict->bdchgqueue);
+   nbdchgqueue = SCIPpqueueNElems(conflict->bdchgqueue) + conflict->ntrailcands;
 #else
    assert(conflict != NULL);
 #endif
@@ -5098,7 +5462,7 @@ SCIP_RETCODE conflictResolveBound(
 #ifndef NDEBUG
    /* subtract the size of the conflicq queues */
    nforcedbdchgqueue -= SCIPpqueueNElems(conflict->forcedbdchgqueue);
-   nbdchgqueue -= SCIPpqueueNElems(conflict->bdchgqueue);
+   nbdchgqueue -= SCIPpqueueNElems(conflict->bdchgqueue) + conflict->ntrailcands;
 
    /* in case the bound change was not resolved, the conflict queues should have the same size (contents) */
    assert((*resolved) || (nforcedbdchgqueue == 0 && nbdchgqueue == 0));
@@ -5176,7 +5540,7 @@ SCIP_RETCODE conflictCreateReconvergenceConss(
          SCIPbdchginfoGetNewbound(uip), SCIPbdchginfoGetDepth(uip), SCIPbdchginfoGetPos(uip));
 
       /* initialize conflict data */
-      SCIP_CALL( SCIPconflictInit(conflict, set, stat, prob, conftype, usescutoffbound) );
+      SCIP_CALL( SCIPconflictInit(conflict, set, stat, prob, tree, conftype, usescutoffbound) );
 
       conflict->conflictset->conflicttype = conftype;
       conflict->conflictset->usescutoffbound = usescutoffbound;
@@ -5315,9 +5679,7 @@ SCIP_RETCODE conflictCreateReconvergenceConss(
          assert(SCIPbdchginfoGetDepth(nextuip) == SCIPbdchginfoGetDepth(uip));
 
          /* check conflict graph frontier on debugging solution */
-         SCIP_CALL( SCIPdebugCheckConflictFrontier(blkmem, set, tree->path[validdepth], \
-               bdchginfo, conflict->conflictset->bdchginfos, conflict->conflictset->relaxedbds, \
-               conflict->conflictset->nbdchginfos, conflict->bdchgqueue, conflict->forcedbdchgqueue) ); /*lint !e506 !e774*/
+         SCIP_CALL( conflictDebugCheckFrontier(conflict, blkmem, set, tree->path[validdepth], bdchginfo) ); /*lint !e506 !e774*/
 
          SCIPsetDebugMsg(set, "creating reconvergence constraint from UIP <%s> to UIP <%s> in depth %d with %d literals after %d resolutions\n",
             SCIPvarGetName(SCIPbdchginfoGetVar(uip)), SCIPvarGetName(SCIPbdchginfoGetVar(nextuip)),
@@ -5430,9 +5792,7 @@ SCIP_RETCODE conflictAnalyze(
    nfirstuips = 0;
 
    /* check if the initial reason on debugging solution */
-   SCIP_CALL( SCIPdebugCheckConflictFrontier(blkmem, set, tree->path[validdepth], \
-         NULL, conflict->conflictset->bdchginfos, conflict->conflictset->relaxedbds, conflict->conflictset->nbdchginfos, \
-         conflict->bdchgqueue, conflict->forcedbdchgqueue) ); /*lint !e506 !e774*/
+   SCIP_CALL( conflictDebugCheckFrontier(conflict, blkmem, set, tree->path[validdepth], NULL) ); /*lint !e506 !e774*/
 
    while( bdchginfo != NULL && validdepth <= maxvaliddepth )
    {
@@ -5569,9 +5929,7 @@ SCIP_RETCODE conflictAnalyze(
       }
 
       /* check conflict graph frontier on debugging solution */
-      SCIP_CALL( SCIPdebugCheckConflictFrontier(blkmem, set, tree->path[validdepth], \
-            bdchginfo, conflict->conflictset->bdchginfos, conflict->conflictset->relaxedbds, conflict->conflictset->nbdchginfos, \
-            conflict->bdchgqueue, conflict->forcedbdchgqueue) ); /*lint !e506 !e774*/
+      SCIP_CALL( conflictDebugCheckFrontier(conflict, blkmem, set, tree->path[validdepth], bdchginfo) ); /*lint !e506 !e774*/
 
       /* get next conflicting bound from the conflict candidate queue (this needs not to be nextbdchginfo, because
        * due to resolving the bound changes, a bound change could be added to the queue which must be
@@ -5665,7 +6023,7 @@ SCIP_RETCODE SCIPconflictAnalyze(
       return SCIP_OKAY;
 
    /* check, if the conflict set will get too large with high probability */
-   if( conflict->conflictset->nbdchginfos + SCIPpqueueNElems(conflict->bdchgqueue)
+   if( conflict->conflictset->nbdchginfos + SCIPpqueueNElems(conflict->bdchgqueue) + conflict->ntrailcands
       + SCIPpqueueNElems(conflict->forcedbdchgqueue) >= 2*conflictCalcMaxsize(set, prob) )
       return SCIP_OKAY;
 
@@ -6556,7 +6914,7 @@ SCIP_RETCODE conflictAnalyzeRemainingBdchgs(
    conftype = conflict->conflictset->conflicttype;
    usescutoffbound = conflict->conflictset->usescutoffbound;
 
-   SCIP_CALL( SCIPconflictInit(conflict, set, stat, prob, conftype, usescutoffbound) );
+   SCIP_CALL( SCIPconflictInit(conflict, set, stat, prob, tree, conftype, usescutoffbound) );
 
    conflict->conflictset->conflicttype = conftype;
    conflict->conflictset->usescutoffbound = usescutoffbound;
@@ -7444,7 +7802,7 @@ SCIP_RETCODE separateAlternativeProofs(
    /* initialize with average solution */
    for( i = 0; i < nvars; i++ )
    {
-      SCIP_CALL( SCIPsolSetVal(refsol, set, stat, tree, vars[i], SCIPvarGetAvgSol(vars[i])) );
+      SCIP_CALL( SCIPsolSetVal(refsol, blkmem, set, stat, tree, vars[i], SCIPvarGetAvgSol(vars[i])) );
    }
 
    /* set all variables that are part of the proof to its active local bound */
@@ -7454,11 +7812,11 @@ SCIP_RETCODE separateAlternativeProofs(
 
       if( val > 0.0 )
       {
-         SCIP_CALL( SCIPsolSetVal(refsol, set, stat, tree, vars[inds[i]], curvarubs[inds[i]]) );
+         SCIP_CALL( SCIPsolSetVal(refsol, blkmem, set, stat, tree, vars[inds[i]], curvarubs[inds[i]]) );
       }
       else
       {
-         SCIP_CALL( SCIPsolSetVal(refsol, set, stat, tree, vars[inds[i]], curvarlbs[inds[i]]) );
+         SCIP_CALL( SCIPsolSetVal(refsol, blkmem, set, stat, tree, vars[inds[i]], curvarlbs[inds[i]]) );
       }
    }
 
@@ -201,6 +201,7 @@ SCIP_RETCODE SCIPconflictInit(
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< problem statistics */
    SCIP_PROB*            prob,               /**< problem data */
+   SCIP_TREE*            tree,               /**< branch and bound tree */
    SCIP_CONFTYPE         conftype,           /**< type of the conflict */
    SCIP_Bool             usescutoffbound     /**< depends the conflict on a cutoff bound? */
    );
@@ -295,6 +296,13 @@ int SCIPconflictGetNConflicts(
    SCIP_CONFLICT*        conflict            /**< conflict analysis data */
    );
 
+/** returns the literal block distance of the conflict set that is currently passed to the conflict handlers, or -1 if
+ *  no conflict set is processed
+ */
+int SCIPconflictGetConflictsetLbd(
+   SCIP_CONFLICT*        conflict            /**< conflict analysis data */
+   );
+
 /** returns the total number of conflict constraints that were added to the problem */
 SCIP_Longint SCIPconflictGetNAppliedConss(
    SCIP_CONFLICT*        conflict            /**< conflict analysis data */
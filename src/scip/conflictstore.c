@@ -43,7 +43,16 @@
 #define CONFLICTSTORE_MINSIZE     2000 /* default minimal size of a dynamic conflict store */
 #define CONFLICTSTORE_MAXSIZE    60000 /* maximal size of a dynamic conflict store (multiplied by 3) */
 #define CONFLICTSTORE_SIZE       10000 /* default size of conflict store */
-#define CONFLICTSTORE_SORTFREQ      20 /* frequency to resort the conflict array */
+#define CONFLICTSTORE_SORTFREQ      20 /* frequency to scan the complete conflict array during clean-up */
+#define CONFLICTSTORE_PROMOTEUSES    2 /* number of observed uses after which a conflict is promoted to the mid tier */
+#define CONFLICTSTORE_CONSBYTES    256 /* estimated memory of a conflict constraint without its variables */
+#define CONFLICTSTORE_VARBYTES      32 /* estimated memory per variable of a conflict constraint */
+#define CONFLICTSTORE_MEMTARGET    0.9 /* fraction of the memory limit to which conflicts are removed if it is exceeded */
+
+/* tiers of the conflict storage; conflicts of higher tiers are removed first */
+#define CONFLICTSTORE_TIER_CORE      0 /* conflicts with small LBD, only removed if nothing else is left */
+#define CONFLICTSTORE_TIER_MID       1 /* conflicts with moderate LBD or frequent use */
+#define CONFLICTSTORE_TIER_LOCAL     2 /* all remaining conflicts, removed by age */
 
 /* event handler properties */
 #define EVENTHDLR_NAME         "ConflictStore"
@@ -246,6 +255,10 @@ SCIP_RETCODE conflictstoreEnsureMem(
          newsize = MAX(newsize, num);
          SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &conflictstore->conflicts, newsize) );
          SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &conflictstore->confprimalbnds, newsize) );
+         SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &conflictstore->conflastages, newsize) );
+         SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &conflictstore->conflbds, newsize) );
+         SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &conflictstore->confnuses, newsize) );
+         SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &conflictstore->confnvars, newsize) );
       }
       else
       {
@@ -255,6 +268,14 @@ SCIP_RETCODE conflictstoreEnsureMem(
                newsize) );
          SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &conflictstore->confprimalbnds, conflictstore->conflictsize, \
                newsize) );
+         SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &conflictstore->conflastages, conflictstore->conflictsize, \
+               newsize) );
+         SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &conflictstore->conflbds, conflictstore->conflictsize, \
+               newsize) );
+         SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &conflictstore->confnuses, conflictstore->conflictsize, \
+               newsize) );
+         SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &conflictstore->confnvars, conflictstore->conflictsize, \
+               newsize) );
       }
 
 #ifndef NDEBUG
@@ -323,6 +344,10 @@ SCIP_RETCODE delPosConflict(
    /* decrease number of conflicts depending an a cutoff bound */
    conflictstore->ncbconflicts -= (SCIPsetIsInfinity(set, REALABS(conflictstore->confprimalbnds[pos])) ? 0 : 1);
 
+   /* release the estimated memory of the conflict */
+   conflictstore->storemem -= CONFLICTSTORE_CONSBYTES + (SCIP_Longint)CONFLICTSTORE_VARBYTES * conflictstore->confnvars[pos];
+   assert(conflictstore->storemem >= 0);
+
 #ifdef SCIP_PRINT_DETAILS
    SCIPsetDebugMsg(set, "-> remove conflict <%s> at pos=%d with age=%g\n", SCIPconsGetName(conflict), pos, SCIPconsGetAge(conflict));
 #endif
@@ -343,6 +368,10 @@ SCIP_RETCODE delPosConflict(
    {
       conflictstore->conflicts[pos] = conflictstore->conflicts[lastpos];
       conflictstore->confprimalbnds[pos] = conflictstore->confprimalbnds[lastpos];
+      conflictstore->conflastages[pos] = conflictstore->conflastages[lastpos];
+      conflictstore->conflbds[pos] = conflictstore->conflbds[lastpos];
+      conflictstore->confnuses[pos] = conflictstore->confnuses[lastpos];
+      conflictstore->confnvars[pos] = conflictstore->confnvars[lastpos];
    }
 
 #ifndef NDEBUG
@@ -599,6 +628,277 @@ SCIP_RETCODE cleanDeletedAndCheckedDualsolCons(
    return SCIP_OKAY;
 }
 
+/** updates the usage count of the conflict at the given position: a conflict whose age decreased since its last
+ *  inspection was reset by its constraint handler, i.e., it was useful in between
+ */
+static
+void conflictstoreUpdateUsage(
+   SCIP_CONFLICTSTORE*   conflictstore,      /**< conflict store */
+   int                   pos                 /**< position of the conflict */
+   )
+{
+   SCIP_Real age;
+
+   assert(conflictstore != NULL);
+   assert(0 <= pos && pos < conflictstore->nconflicts);
+
+   age = SCIPconsGetAge(conflictstore->conflicts[pos]);
+
+   if( age < conflictstore->conflastages[pos] )
+      ++conflictstore->confnuses[pos];
+
+   conflictstore->conflastages[pos] = age;
+}
+
+/** returns the tier of the conflict at the given position
+ *
+ *  conflicts with a literal block distance (LBD) of at most conflict/coretierlbd belong to the core tier, conflicts
+ *  with an LBD of at most conflict/midtierlbd or that were observed to be useful repeatedly belong to the mid tier,
+ *  all others are local
+ */
+static
+int conflictstoreGetTier(
+   SCIP_CONFLICTSTORE*   conflictstore,      /**< conflict store */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int                   pos                 /**< position of the conflict */
+   )
+{
+   assert(conflictstore != NULL);
+   assert(set != NULL);
+   assert(0 <= pos && pos < conflictstore->nconflicts);
+
+   /* without tiers, all conflicts are removed by age */
+   if( !set->conf_tieredstore )
+      return CONFLICTSTORE_TIER_LOCAL;
+
+   if( conflictstore->conflbds[pos] <= set->conf_coretierlbd )
+      return CONFLICTSTORE_TIER_CORE;
+
+   if( conflictstore->conflbds[pos] <= set->conf_midtierlbd || conflictstore->confnuses[pos] >= CONFLICTSTORE_PROMOTEUSES )
+      return CONFLICTSTORE_TIER_MID;
+
+   return CONFLICTSTORE_TIER_LOCAL;
+}
+
+/** returns the position of the oldest conflict of the highest tier among the first 10% of the storage
+ *
+ *  since the storage is sorted regularly by conflictstoreSortConflicts(), the first conflicts are most likely to be
+ *  removed anyway
+ */
+static
+int conflictstoreSelectConflict(
+   SCIP_CONFLICTSTORE*   conflictstore,      /**< conflict store */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   SCIP_Real maxage;
+   int maxtier;
+   int selectedpos;
+   int i;
+
+   assert(conflictstore != NULL);
+   assert(conflictstore->nconflicts > 0);
+
+   maxage = -1.0;
+   maxtier = -1;
+   selectedpos = -1;
+
+   for( i = 0; i < MAX(1, 0.1 * conflictstore->nconflicts); i++ )
+   {
+      SCIP_Real age;
+      int tier;
+
+      /* conflicts that are already deleted can be removed right away */
+      if( SCIPconsIsDeleted(conflictstore->conflicts[i]) )
+         return i;
+
+      conflictstoreUpdateUsage(conflictstore, i);
+
+      tier = conflictstoreGetTier(conflictstore, set, i);
+      age = SCIPconsGetAge(conflictstore->conflicts[i]);
+
+      if( tier > maxtier || (tier == maxtier && age > maxage) )
+      {
+         maxtier = tier;
+         maxage = age;
+         selectedpos = i;
+      }
+   }
+   assert(selectedpos >= 0);
+
+   return selectedpos;
+}
+
+/** sorts the conflicts in the order in which they should be removed from the storage, i.e., deleted conflicts first,
+ *  then by decreasing tier and by decreasing age within each tier
+ */
+static
+SCIP_RETCODE conflictstoreSortConflicts(
+   SCIP_CONFLICTSTORE*   conflictstore,      /**< conflict store */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   SCIP_CONS** conflicts;
+   SCIP_Real* confprimalbnds;
+   SCIP_Real* conflastages;
+   SCIP_Real* keys;
+   SCIP_Real maxage;
+   int* conflbds;
+   int* confnuses;
+   int* confnvars;
+   int* perm;
+   int nconflicts;
+   int i;
+
+   assert(conflictstore != NULL);
+   assert(set != NULL);
+
+   nconflicts = conflictstore->nconflicts;
+
+   if( nconflicts <= 1 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &keys, nconflicts) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &perm, nconflicts) );
+
+   /* the key of a conflict is its tier times a value larger than all ages plus its age */
+   maxage = 0.0;
+   for( i = 0; i < nconflicts; ++i )
+   {
+      if( !SCIPconsIsDeleted(conflictstore->conflicts[i]) )
+         conflictstoreUpdateUsage(conflictstore, i);
+      maxage = MAX(maxage, SCIPconsGetAge(conflictstore->conflicts[i]));
+   }
+
+   for( i = 0; i < nconflicts; ++i )
+   {
+      int tier;
+
+      tier = (SCIPconsIsDeleted(conflictstore->conflicts[i]) ? CONFLICTSTORE_TIER_LOCAL + 1
+         : conflictstoreGetTier(conflictstore, set, i));
+      keys[i] = tier * (maxage + 1.0) + MAX(0.0, SCIPconsGetAge(conflictstore->conflicts[i]));
+      perm[i] = i;
+   }
+
+   SCIPsortDownRealInt(keys, perm, nconflicts);
+
+   /* apply the permutation to all arrays of the conflicts */
+   SCIP_CALL( SCIPsetDuplicateBufferArray(set, &conflicts, conflictstore->conflicts, nconflicts) );
+   SCIP_CALL( SCIPsetDuplicateBufferArray(set, &confprimalbnds, conflictstore->confprimalbnds, nconflicts) );
+   SCIP_CALL( SCIPsetDuplicateBufferArray(set, &conflastages, conflictstore->conflastages, nconflicts) );
+   SCIP_CALL( SCIPsetDuplicateBufferArray(set, &conflbds, conflictstore->conflbds, nconflicts) );
+   SCIP_CALL( SCIPsetDuplicateBufferArray(set, &confnuses, conflictstore->confnuses, nconflicts) );
+   SCIP_CALL( SCIPsetDuplicateBufferArray(set, &confnvars, conflictstore->confnvars, nconflicts) );
+
+   for( i = 0; i < nconflicts; ++i )
+   {
+      conflictstore->conflicts[i] = conflicts[perm[i]];
+      conflictstore->confprimalbnds[i] = confprimalbnds[perm[i]];
+      conflictstore->conflastages[i] = conflastages[perm[i]];
+      conflictstore->conflbds[i] = conflbds[perm[i]];
+      conflictstore->confnuses[i] = confnuses[perm[i]];
+      conflictstore->confnvars[i] = confnvars[perm[i]];
+   }
+
+   SCIPsetFreeBufferArray(set, &confnvars);
+   SCIPsetFreeBufferArray(set, &confnuses);
+   SCIPsetFreeBufferArray(set, &conflbds);
+   SCIPsetFreeBufferArray(set, &conflastages);
+   SCIPsetFreeBufferArray(set, &confprimalbnds);
+   SCIPsetFreeBufferArray(set, &conflicts);
+   SCIPsetFreeBufferArray(set, &perm);
+   SCIPsetFreeBufferArray(set, &keys);
+
+   return SCIP_OKAY;
+}
+
+/** returns the number of variables of a conflict constraint, or 0 if the constraint handler does not provide them */
+static
+SCIP_RETCODE conflictstoreGetConsNVars(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_CONS*            cons,               /**< conflict constraint */
+   int*                  nvars               /**< pointer to store the number of variables */
+   )
+{
+   SCIP_Bool success;
+
+   assert(set != NULL);
+   assert(cons != NULL);
+   assert(nvars != NULL);
+
+   SCIP_CALL( SCIPconsGetNVars(cons, set, nvars, &success) );
+   if( !success )
+      *nvars = 0;
+
+   return SCIP_OKAY;
+}
+
+/** returns whether adding the given amount of memory would exceed the memory limit of the storage */
+static
+SCIP_Bool conflictstoreIsMemLimitExceeded(
+   SCIP_CONFLICTSTORE*   conflictstore,      /**< conflict store */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_Longint          addmem              /**< memory in bytes to be added */
+   )
+{
+   assert(conflictstore != NULL);
+   assert(set != NULL);
+
+   if( set->conf_maxstoremem < 0.0 )
+      return FALSE;
+
+   return ((SCIP_Real)(conflictstore->storemem + addmem) > set->conf_maxstoremem * 1048576.0);
+}
+
+/** removes conflicts, in the order given by conflictstoreSortConflicts(), until a conflict of the given memory fits
+ *  into CONFLICTSTORE_MEMTARGET times the memory limit
+ *
+ *  all conflicts to remove are selected at once, such that the storage is sorted only once
+ */
+static
+SCIP_RETCODE conflictstoreFreeMem(
+   SCIP_CONFLICTSTORE*   conflictstore,      /**< conflict store */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic SCIP statistics */
+   SCIP_PROB*            transprob,          /**< transformed problem */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_REOPT*           reopt,              /**< reoptimization data */
+   SCIP_Longint          addmem              /**< memory in bytes to be added */
+   )
+{
+   SCIP_Real targetmem;
+   SCIP_Longint storemem;
+   int ndelconfs;
+   int i;
+
+   assert(conflictstore != NULL);
+   assert(set != NULL);
+   assert(set->conf_maxstoremem >= 0.0);
+
+   SCIP_CALL( conflictstoreSortConflicts(conflictstore, set) );
+
+   targetmem = CONFLICTSTORE_MEMTARGET * set->conf_maxstoremem * 1048576.0 - addmem;
+
+   /* count the conflicts at the front of the storage that need to be removed */
+   storemem = conflictstore->storemem;
+   ndelconfs = 0;
+   while( ndelconfs < conflictstore->nconflicts && (SCIP_Real)storemem > targetmem )
+   {
+      storemem -= CONFLICTSTORE_CONSBYTES + (SCIP_Longint)CONFLICTSTORE_VARBYTES * conflictstore->confnvars[ndelconfs];
+      ++ndelconfs;
+   }
+
+   /* remove them from back to front: delPosConflict() moves the last conflict of the storage to the position of the
+    * removed one, which is never one of the remaining conflicts to remove
+    */
+   for( i = ndelconfs - 1; i >= 0; --i )
+   {
+      SCIP_CALL( delPosConflict(conflictstore, set, stat, transprob, blkmem, reopt, i, TRUE) );
+   }
+
+   return SCIP_OKAY;
+}
+
 /** cleans up the storage */
 static
 SCIP_RETCODE conflictstoreCleanUpStorage(
@@ -639,43 +939,16 @@ SCIP_RETCODE conflictstoreCleanUpStorage(
    /* resort the array regularly */
    if( conflictstore->ncleanups % CONFLICTSTORE_SORTFREQ == 0 )
    {
-      /* sort conflict */
-      SCIPsortPtrReal((void**)conflictstore->conflicts, conflictstore->confprimalbnds, compareConss, conflictstore->nconflicts);
-      assert(SCIPsetIsGE(set, SCIPconsGetAge(conflictstore->conflicts[0]),
-            SCIPconsGetAge(conflictstore->conflicts[conflictstore->nconflicts-1])));
-   }
-   assert(conflictstore->nconflicts > 0);
+      SCIP_CALL( conflictstoreSortConflicts(conflictstore, set) );
 
-   if( conflictstore->ncleanups % CONFLICTSTORE_SORTFREQ == 0 )
-   {
       /* remove conflict at first position (array is sorted) */
       SCIP_CALL( delPosConflict(conflictstore, set, stat, transprob, blkmem, reopt, 0, TRUE) );
    }
    else
    {
-      SCIP_Real maxage;
-      int oldest_i;
-      int i;
-
-      assert(!SCIPconsIsDeleted(conflictstore->conflicts[0]));
-
-      maxage = SCIPconsGetAge(conflictstore->conflicts[0]);
-      oldest_i = 0;
-
-      /* check the first 10% of conflicts and find the oldest */
-      for( i = 1; i < 0.1 * conflictstore->nconflicts; i++ )
-      {
-         assert(!SCIPconsIsDeleted(conflictstore->conflicts[i]));
-
-         if( SCIPconsGetAge(conflictstore->conflicts[i]) > maxage )
-         {
-            maxage = SCIPconsGetAge(conflictstore->conflicts[i]);
-            oldest_i = i;
-         }
-      }
-
-      /* remove conflict at position oldest_i */
-      SCIP_CALL( delPosConflict(conflictstore, set, stat, transprob, blkmem, reopt, oldest_i, TRUE) );
+      /* remove the oldest conflict of the highest tier among the first conflicts */
+      SCIP_CALL( delPosConflict(conflictstore, set, stat, transprob, blkmem, reopt,
+            conflictstoreSelectConflict(conflictstore, set), TRUE) );
    }
    ++ndelconfs;
 
@@ -744,6 +1017,10 @@ SCIP_RETCODE SCIPconflictstoreCreate(
 
    (*conflictstore)->conflicts = NULL;
    (*conflictstore)->confprimalbnds = NULL;
+   (*conflictstore)->conflastages = NULL;
+   (*conflictstore)->conflbds = NULL;
+   (*conflictstore)->confnuses = NULL;
+   (*conflictstore)->confnvars = NULL;
    (*conflictstore)->dualprimalbnds = NULL;
    (*conflictstore)->scalefactors = NULL;
    (*conflictstore)->updateside = NULL;
@@ -754,6 +1031,7 @@ SCIP_RETCODE SCIPconflictstoreCreate(
    (*conflictstore)->origconfs = NULL;
    (*conflictstore)->nnzdualrays = 0;
    (*conflictstore)->nnzdualsols = 0;
+   (*conflictstore)->storemem = 0;
    (*conflictstore)->conflictsize = 0;
    (*conflictstore)->origconflictsize = 0;
    (*conflictstore)->nconflicts = 0;
@@ -800,6 +1078,10 @@ SCIP_RETCODE SCIPconflictstoreFree(
    BMSfreeBlockMemoryArrayNull(blkmem, &(*conflictstore)->origconfs, (*conflictstore)->origconflictsize);
    BMSfreeBlockMemoryArrayNull(blkmem, &(*conflictstore)->conflicts, (*conflictstore)->conflictsize);
    BMSfreeBlockMemoryArrayNull(blkmem, &(*conflictstore)->confprimalbnds, (*conflictstore)->conflictsize);
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*conflictstore)->conflastages, (*conflictstore)->conflictsize);
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*conflictstore)->conflbds, (*conflictstore)->conflictsize);
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*conflictstore)->confnuses, (*conflictstore)->conflictsize);
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*conflictstore)->confnvars, (*conflictstore)->conflictsize);
    BMSfreeBlockMemoryArrayNull(blkmem, &(*conflictstore)->dualrayconfs, CONFLICTSTORE_DUALRAYSIZE);
    BMSfreeBlockMemoryArrayNull(blkmem, &(*conflictstore)->drayrelaxonly, CONFLICTSTORE_DUALRAYSIZE);
    BMSfreeBlockMemoryArrayNull(blkmem, &(*conflictstore)->dualsolconfs, CONFLICTSTORE_DUALSOLSIZE);
@@ -1143,11 +1425,14 @@ SCIP_RETCODE SCIPconflictstoreAddConflict(
    SCIP_CONS*            cons,               /**< constraint representing the conflict */
    SCIP_CONFTYPE         conftype,           /**< type of the conflict */
    SCIP_Bool             cutoffinvolved,     /**< is a cutoff bound involved in this conflict */
-   SCIP_Real             primalbound         /**< primal bound the conflict depend on (or -SCIPinfinity) */
+   SCIP_Real             primalbound,        /**< primal bound the conflict depend on (or -SCIPinfinity) */
+   int                   lbd                 /**< literal block distance of the conflict, or -1 if unknown */
    )
 {
    SCIP_Longint curnodenum;
+   SCIP_Longint consmem;
    int nconflicts;
+   int nvars;
 
    assert(conflictstore != NULL);
    assert(blkmem != NULL);
@@ -1205,10 +1490,28 @@ SCIP_RETCODE SCIPconflictstoreAddConflict(
    /* update the last seen node */
    conflictstore->lastnodenum = curnodenum;
 
+   SCIP_CALL( conflictstoreGetConsNVars(set, cons, &nvars) );
+   consmem = CONFLICTSTORE_CONSBYTES + (SCIP_Longint)CONFLICTSTORE_VARBYTES * nvars;
+
+   /* remove conflicts such that the new one fits into the memory limit */
+   if( conflictstore->nconflicts > 0 && conflictstoreIsMemLimitExceeded(conflictstore, set, consmem) )
+   {
+      SCIP_CALL( conflictstoreFreeMem(conflictstore, set, stat, transprob, blkmem, reopt, consmem) );
+   }
+
+   /* conflicts of unknown literal block distance are never kept in the core or mid tier */
+   if( lbd < 0 )
+      lbd = INT_MAX;
+
    SCIPconsCapture(cons);
    conflictstore->conflicts[conflictstore->nconflicts] = cons;
    conflictstore->confprimalbnds[conflictstore->nconflicts] = primalbound;
+   conflictstore->conflastages[conflictstore->nconflicts] = SCIPconsGetAge(cons);
+   conflictstore->conflbds[conflictstore->nconflicts] = lbd;
+   conflictstore->confnuses[conflictstore->nconflicts] = 0;
+   conflictstore->confnvars[conflictstore->nconflicts] = nvars;
    conflictstore->ncbconflicts += (SCIPsetIsInfinity(set, REALABS(primalbound)) ? 0 : 1);
+   conflictstore->storemem += consmem;
 
    ++conflictstore->nconflicts;
    ++conflictstore->nconflictsfound;
@@ -1218,7 +1521,7 @@ SCIP_RETCODE SCIPconflictstoreAddConflict(
 
 #ifdef SCIP_PRINT_DETAILS
    SCIPsetDebugMsg(set, "add conflict <%s> to conflict store at position %d\n", SCIPconsGetName(cons), conflictstore->nconflicts-1);
-   SCIPsetDebugMsg(set, " -> conflict type: %d, cutoff involved = %u\n", conftype, cutoffinvolved);
+   SCIPsetDebugMsg(set, " -> conflict type: %d, cutoff involved = %u, LBD = %d\n", conftype, cutoffinvolved, lbd);
    if( cutoffinvolved )
       SCIPsetDebugMsg(set, " -> current primal bound: %g\n", primalbound);
 #endif
@@ -1508,7 +1811,7 @@ SCIP_RETCODE SCIPconflictstoreTransform(
       if( transcons != NULL )
       {
          SCIP_CALL( SCIPconflictstoreAddConflict(conflictstore, blkmem, set, stat, tree, transprob, reopt, transcons, \
-               SCIP_CONFTYPE_UNKNOWN, FALSE, -SCIPsetInfinity(set)) );
+               SCIP_CONFTYPE_UNKNOWN, FALSE, -SCIPsetInfinity(set), -1) );
 
          ++ntransconss;
       }
@@ -125,7 +125,8 @@ SCIP_RETCODE SCIPconflictstoreAddConflict(
    SCIP_CONS*            cons,               /**< constraint representing the conflict */
    SCIP_CONFTYPE         conftype,           /**< type of the conflict */
    SCIP_Bool             cutoffinvolved,     /**< is a cutoff bound involved in this conflict */
-   SCIP_Real             primalbound         /**< primal bound the conflict depend on (or -SCIPinfinity) */
+   SCIP_Real             primalbound,        /**< primal bound the conflict depend on (or -SCIPinfinity) */
+   int                   lbd                 /**< literal block distance of the conflict, or -1 if unknown */
    );
 
 /** deletes all conflicts depending on a cutoff bound larger than the given bound */
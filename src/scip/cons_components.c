@@ -54,6 +54,7 @@
 #include "scip/scip_timing.h"
 #include "scip/scip_tree.h"
 #include "scip/scip_var.h"
+#include "tpi/tpi.h"
 #include <string.h>
 
 #define CONSHDLR_NAME          "components"
@@ -78,6 +79,7 @@
 #define DEFAULT_NODELIMIT       10000LL      /**< maximum number of nodes to be solved in subproblems during presolving */
 #define DEFAULT_INTFACTOR           1.0      /**< the weight of an integer variable compared to binary variables */
 #define DEFAULT_FEASTOLFACTOR       1.0      /**< default value for parameter to increase the feasibility tolerance in all sub-SCIPs */
+#define DEFAULT_NTHREADS              1      /**< number of threads to solve components concurrently (1: solve components sequentially) */
 
 /*
  * Data structures
@@ -148,6 +150,8 @@ struct SCIP_ConshdlrData
                                               *   individually during branch-and-bound */
    int                   subscipdepth;       /**< depth offset of the current (sub-)problem compared to the original
                                               *   problem */
+   int                   nthreads;           /**< number of threads to solve components concurrently (1: solve
+                                              *   components sequentially) */
 };
 
 
@@ -443,7 +447,9 @@ static
 SCIP_RETCODE createSubscip(
    SCIP*                 scip,               /**< main SCIP data structure */
    SCIP_CONSHDLRDATA*    conshdlrdata,       /**< constraint handler data */
-   SCIP**                subscip             /**< pointer to store created sub-SCIP */
+   SCIP**                subscip,            /**< pointer to store created sub-SCIP */
+   SCIP_Bool             passmessagehdlr     /**< should the message handler be passed? FALSE if the sub-SCIP is solved
+                                              *   on another thread */
    )
 {
    SCIP_Bool success;
@@ -456,10 +462,10 @@ SCIP_RETCODE createSubscip(
    /* copy plugins, we omit pricers (because we do not run if there are active pricers) and dialogs */
 #ifdef SCIP_MORE_DEBUG /* we print statistics later, so we need to copy statistics tables */
    SCIP_CALL( SCIPcopyPlugins(scip, *subscip, TRUE, FALSE, TRUE, TRUE, TRUE, TRUE, TRUE,
-         TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, TRUE, TRUE, TRUE, &success) );
+         TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, TRUE, TRUE, passmessagehdlr, &success) );
 #else
    SCIP_CALL( SCIPcopyPlugins(scip, *subscip, TRUE, FALSE, TRUE, TRUE, TRUE, TRUE, TRUE,
-         TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE, TRUE, TRUE, &success) );
+         TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE, TRUE, passmessagehdlr, &success) );
 #endif
 
    /* the plugins were successfully copied */
@@ -505,6 +511,9 @@ SCIP_RETCODE createSubscip(
       SCIP_CALL( SCIPsetIntParam(*subscip, "constraints/" CONSHDLR_NAME "/maxprerounds", 0) );
       SCIP_CALL( SCIPfixParam(*subscip, "constraints/" CONSHDLR_NAME "/maxprerounds") );
 
+      /* the sub-SCIP should not solve its components concurrently again */
+      SCIP_CALL( SCIPsetIntParam(*subscip, "constraints/" CONSHDLR_NAME "/nthreads", 1) );
+
       /* find the components constraint handler in the sub-SCIP and inform it about the actual depth in the tree */
       newconshdlr = SCIPfindConshdlr(*subscip, CONSHDLR_NAME);
       assert(newconshdlr != NULL);
@@ -513,6 +522,14 @@ SCIP_RETCODE createSubscip(
       assert(newconshdlrdata != NULL);
       newconshdlrdata->subscipdepth = conshdlrdata->subscipdepth + SCIPgetDepth(scip);
 
+      /* sub-SCIPs that are solved concurrently share the time limit of the main SCIP, which is measured in wall clock
+       * time then
+       */
+      if( conshdlrdata->nthreads > 1 )
+      {
+         SCIP_CALL( SCIPsetIntParam(*subscip, "timing/clocktype", (int)SCIP_CLOCKTYPE_WALL) );
+      }
+
       /* disable output, unless in extended debug mode */
 #ifndef SCIP_MORE_DEBUG
       SCIP_CALL( SCIPsetIntParam(*subscip, "display/verblevel", 0) );
@@ -623,7 +640,7 @@ SCIP_RETCODE componentCreateSubscip(
 
    (*success) = TRUE;
 
-   SCIP_CALL( createSubscip(scip, conshdlrdata, &component->subscip) );
+   SCIP_CALL( createSubscip(scip, conshdlrdata, &component->subscip, TRUE) );
 
    if( component->subscip != NULL )
    {
@@ -650,13 +667,18 @@ SCIP_RETCODE componentCreateSubscip(
    return SCIP_OKAY;
 }
 
-/** solve a given sub-SCIP up to the given limits */
+/** sets the limits of a sub-SCIP for the next solving call
+ *
+ *  The memory that is left is divided among the sub-SCIPs that are solved concurrently.
+ */
 static
-SCIP_RETCODE solveSubscip(
+SCIP_RETCODE setSubscipLimits(
    SCIP*                 scip,               /**< main SCIP */
    SCIP*                 subscip,            /**< sub-SCIP to solve */
    SCIP_Longint          nodelimit,          /**< node limit */
-   SCIP_Real             gaplimit            /**< gap limit */
+   SCIP_Real             gaplimit,           /**< gap limit */
+   int                   nconcurrent,        /**< number of sub-SCIPs that are solved concurrently */
+   SCIP_Bool*            success             /**< pointer to store whether there are enough resources left to solve */
    )
 {
    SCIP_Real timelimit;
@@ -664,6 +686,10 @@ SCIP_RETCODE solveSubscip(
 
    assert(scip != NULL);
    assert(subscip != NULL);
+   assert(nconcurrent >= 1);
+   assert(success != NULL);
+
+   *success = FALSE;
 
    /* set time limit */
    SCIP_CALL( SCIPgetRealParam(scip, "limits/time", &timelimit) );
@@ -680,6 +706,7 @@ SCIP_RETCODE solveSubscip(
    {
       memorylimit -= SCIPgetMemUsed(scip)/1048576.0;
       memorylimit -= SCIPgetMemExternEstim(scip)/1048576.0;
+      memorylimit /= nconcurrent;
    }
 
    /* abort if no time is left or not enough memory to create a copy of SCIP, including external memory usage */
@@ -696,6 +723,10 @@ SCIP_RETCODE solveSubscip(
 
    /* set time and memory limit for the subproblem */
    SCIP_CALL( SCIPsetRealParam(subscip, "limits/time", timelimit) );
+   if( nconcurrent > 1 && !SCIPisInfinity(scip, memorylimit) )
+   {
+      SCIP_CALL( SCIPsetRealParam(subscip, "limits/memory", memorylimit) );
+   }
 
    /* only set soft time limit if it exists */
    if( SCIPgetParam(scip, "limits/softtime") != NULL )
@@ -720,6 +751,22 @@ SCIP_RETCODE solveSubscip(
    /* set node limit */
    SCIP_CALL( SCIPsetLongintParam(subscip, "limits/nodes", nodelimit) );
 
+   *success = TRUE;
+
+   return SCIP_OKAY;
+}
+
+/** solves a sub-SCIP whose limits have already been set; used as job to solve several sub-SCIPs concurrently */
+static
+SCIP_RETCODE solveSubscipJob(
+   void*                 args                /**< sub-SCIP to solve */
+   )
+{
+   SCIP* subscip;
+
+   subscip = (SCIP*)args;
+   assert(subscip != NULL);
+
    /* solve the subproblem */
    SCIP_CALL( SCIPsolve(subscip) );
 
@@ -731,12 +778,85 @@ SCIP_RETCODE solveSubscip(
    return SCIP_OKAY;
 }
 
-/** solve a connected component during presolving and evaluate the result */
+/** solve a given sub-SCIP up to the given limits */
 static
-SCIP_RETCODE solveAndEvalSubscip(
+SCIP_RETCODE solveSubscip(
+   SCIP*                 scip,               /**< main SCIP */
+   SCIP*                 subscip,            /**< sub-SCIP to solve */
+   SCIP_Longint          nodelimit,          /**< node limit */
+   SCIP_Real             gaplimit            /**< gap limit */
+   )
+{
+   SCIP_Bool success;
+
+   SCIP_CALL( setSubscipLimits(scip, subscip, nodelimit, gaplimit, 1, &success) );
+
+   if( success )
+   {
+      SCIP_CALL( solveSubscipJob((void*)subscip) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** solves the given sub-SCIPs concurrently up to the given limits
+ *
+ *  The limits are set before and the main SCIP waits until all sub-SCIPs are solved. The sub-SCIPs share the remaining
+ *  time of the main SCIP.
+ */
+static
+SCIP_RETCODE solveSubscipsConcurrently(
+   SCIP*                 scip,               /**< main SCIP */
+   SCIP**                subscips,           /**< sub-SCIPs to solve */
+   SCIP_Longint*         nodelimits,         /**< node limit for each sub-SCIP */
+   SCIP_Real*            gaplimits,          /**< gap limit for each sub-SCIP */
+   int                   nsubscips,          /**< number of sub-SCIPs */
+   int                   nthreads            /**< number of threads to use */
+   )
+{
+   SCIP_JOBBATCH* jobbatch;
+   SCIP_RETCODE retcode;
+   void** jobargs;
+   int njobs;
+   int i;
+
+   assert(scip != NULL);
+   assert(subscips != NULL);
+   assert(nodelimits != NULL);
+   assert(gaplimits != NULL);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &jobargs, nsubscips) );
+
+   njobs = 0;
+   for( i = 0; i < nsubscips; ++i )
+   {
+      SCIP_Bool success;
+
+      SCIP_CALL( setSubscipLimits(scip, subscips[i], nodelimits[i], gaplimits[i], nsubscips, &success) );
+
+      if( success )
+         jobargs[njobs++] = (void*)subscips[i];
+   }
+
+   retcode = SCIP_OKAY;
+   if( njobs > 0 )
+   {
+      SCIP_CALL( SCIPtpiStartJobBatch(&jobbatch, solveSubscipJob, jobargs, njobs, MIN(nthreads, njobs)) );
+      retcode = SCIPtpiFinishJobBatch(&jobbatch);
+   }
+
+   SCIPfreeBufferArray(scip, &jobargs);
+
+   return retcode;
+}
+
+/** evaluates the result of solving a connected component during presolving, i.e., applies fixings of variables and
+ *  removes constraints
+ */
+static
+SCIP_RETCODE evalSubscip(
    SCIP*                 scip,               /**< SCIP main data structure */
-   SCIP_CONSHDLRDATA*    conshdlrdata,       /**< the components constraint handler data */
-   SCIP*                 subscip,            /**< sub-SCIP to be solved */
+   SCIP*                 subscip,            /**< sub-SCIP that was solved */
    SCIP_VAR**            vars,               /**< array of variables copied to this component */
    SCIP_VAR**            subvars,            /**< array of sub-SCIP variables corresponding to the vars array */
    SCIP_CONS**           conss,              /**< array of constraints copied to this component */
@@ -752,7 +872,6 @@ SCIP_RETCODE solveAndEvalSubscip(
    int i;
 
    assert(scip != NULL);
-   assert(conshdlrdata != NULL);
    assert(subscip != NULL);
    assert(vars != NULL);
    assert(conss != NULL);
@@ -763,8 +882,6 @@ SCIP_RETCODE solveAndEvalSubscip(
 
    *solved  = FALSE;
 
-   SCIP_CALL( solveSubscip(scip, subscip, conshdlrdata->nodelimit, 0.0) );
-
    if( SCIPgetStatus(subscip) == SCIP_STATUS_OPTIMAL )
    {
       SCIP_SOL* sol;
@@ -988,24 +1105,278 @@ SCIP_RETCODE solveAndEvalSubscip(
    return SCIP_OKAY;
 }
 
-/** (continues) solving a connected component */
+/** solve a connected component during presolving and evaluate the result */
 static
-SCIP_RETCODE solveComponent(
+SCIP_RETCODE solveAndEvalSubscip(
+   SCIP*                 scip,               /**< SCIP main data structure */
+   SCIP_CONSHDLRDATA*    conshdlrdata,       /**< the components constraint handler data */
+   SCIP*                 subscip,            /**< sub-SCIP to be solved */
+   SCIP_VAR**            vars,               /**< array of variables copied to this component */
+   SCIP_VAR**            subvars,            /**< array of sub-SCIP variables corresponding to the vars array */
+   SCIP_CONS**           conss,              /**< array of constraints copied to this component */
+   int                   nvars,              /**< number of variables copied to this component */
+   int                   nconss,             /**< number of constraints copied to this component */
+   int*                  ndeletedconss,      /**< pointer to store the number of deleted constraints */
+   int*                  nfixedvars,         /**< pointer to store the number of fixed variables */
+   int*                  ntightenedbounds,   /**< pointer to store the number of bound tightenings */
+   SCIP_RESULT*          result,             /**< pointer to store the result of the component solving */
+   SCIP_Bool*            solved              /**< pointer to store if the problem was solved to optimality */
+   )
+{
+   assert(conshdlrdata != NULL);
+
+   SCIP_CALL( solveSubscip(scip, subscip, conshdlrdata->nodelimit, 0.0) );
+
+   SCIP_CALL( evalSubscip(scip, subscip, vars, subvars, conss, nvars, nconss, ndeletedconss,
+         nfixedvars, ntightenedbounds, result, solved) );
+
+   return SCIP_OKAY;
+}
+
+#ifdef WITH_DEBUG_SOLUTION
+/** transfers the values of the debug solution to the sub-SCIP of a component */
+static
+SCIP_RETCODE setupDebugSol(
+   SCIP*                 scip,               /**< main SCIP data structure */
+   SCIP*                 subscip,            /**< sub-SCIP of the component */
+   SCIP_VAR**            compvars,           /**< variables of the component */
+   SCIP_VAR**            subvars,            /**< sub-SCIP variables corresponding to the compvars array */
+   int                   ncompvars           /**< number of variables of the component */
+   )
+{
+   if( SCIPdebugSolIsEnabled(scip) )
+   {
+      SCIP_SOL* debugsol;
+      SCIP_Real val;
+      int i;
+
+      SCIP_CALL( SCIPdebugGetSol(scip, &debugsol) );
+
+      /* set solution values in the debug solution if it is available */
+      if( debugsol != NULL )
+      {
+         SCIPdebugSolEnable(subscip);
+
+         for( i = 0; i < ncompvars; ++i )
+         {
+            if( subvars[i] != NULL )
+            {
+               SCIP_CALL( SCIPdebugGetSolVal(scip, compvars[i], &val) );
+               SCIP_CALL( SCIPdebugAddSolVal(subscip, subvars[i], val) );
+            }
+         }
+      }
+   }
+
+   return SCIP_OKAY;
+}
+#endif
+
+/** solves the small components found during presolving concurrently, each in a sub-SCIP of its own, and evaluates
+ *  the results in the order of the components
+ *
+ *  The components are solved in batches of at most nthreads sub-SCIPs; each batch is evaluated and freed before the
+ *  sub-SCIPs of the next batch are created, such that only nthreads sub-SCIPs are held in memory at the same time.
+ */
+static
+SCIP_RETCODE presolveComponentsConcurrently(
+   SCIP*                 scip,               /**< SCIP main data structure */
+   SCIP_CONSHDLRDATA*    conshdlrdata,       /**< the components constraint handler data */
+   SCIP_VAR**            sortedvars,         /**< variables sorted by components */
+   SCIP_CONS**           sortedconss,        /**< constraints sorted by components */
+   int*                  compstartsvars,     /**< start points of components in sortedvars array */
+   int*                  compstartsconss,    /**< start points of components in sortedconss array */
+   int                   nsortedvars,        /**< number of variables in sortedvars array */
+   int                   nsortedconss,       /**< number of constraints in sortedconss array */
+   int                   ncomponents,        /**< number of components */
+   int                   ncompsmaxsize,      /**< number of small components that should be solved in presolving */
+   int*                  ndeletedconss,      /**< pointer to store the number of deleted constraints */
+   int*                  nfixedvars,         /**< pointer to store the number of fixed variables */
+   int*                  ntightenedbounds,   /**< pointer to store the number of bound tightenings */
+   SCIP_RESULT*          result              /**< pointer to store the result of the component solving */
+   )
+{
+   char name[SCIP_MAXSTRLEN];
+   SCIP** subscips;
+   SCIP_HASHMAP* consmap;
+   SCIP_VAR** subvars;
+   SCIP_Longint* nodelimits;
+   SCIP_Real* gaplimits;
+   SCIP_Bool stop;
+   int* comps;
+   int nthreads;
+   int nsubscips;
+   int ntotalsubscips;
+   int comp;
+   int c;
+
+   assert(conshdlrdata != NULL);
+   assert(conshdlrdata->nthreads > 1);
+
+   nthreads = conshdlrdata->nthreads;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &subscips, nthreads) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &comps, nthreads) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &nodelimits, nthreads) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &gaplimits, nthreads) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &subvars, nsortedvars) );
+
+   /* hashmap mapping from original constraints to constraints in the sub-SCIPs (for performance reasons) */
+   SCIP_CALL( SCIPhashmapCreate(&consmap, SCIPblkmem(scip), nsortedconss) );
+
+   /* at least one component is left to the main SCIP */
+   comp = 0;
+   ntotalsubscips = 0;
+   stop = FALSE;
+   while( !stop && comp < ncompsmaxsize && ntotalsubscips < ncomponents - 1 && !SCIPisStopped(scip) )
+   {
+      /* copy the next components into sub-SCIPs of their own */
+      nsubscips = 0;
+      for( ; comp < ncompsmaxsize && nsubscips < nthreads && ntotalsubscips < ncomponents - 1; comp++ )
+      {
+         SCIP_HASHMAP* varmap;
+         SCIP_VAR** compvars;
+         SCIP_CONS** compconss;
+         SCIP* subscip;
+         SCIP_Bool success;
+         int ncompvars;
+         int ncompconss;
+
+         /* get component variables and constraints */
+         compvars = &(sortedvars[compstartsvars[comp]]);
+         ncompvars = compstartsvars[comp + 1] - compstartsvars[comp];
+         compconss = &(sortedconss[compstartsconss[comp]]);
+         ncompconss = compstartsconss[comp + 1] - compstartsconss[comp];
+
+         /* if we have an unlocked variable, let duality fixing do the job! */
+         if( ncompconss == 0 )
+         {
+            assert(ncompvars == 1);
+            continue;
+         }
+
+         /* the sub-SCIPs are presolved on other threads and must not share the message handler */
+         SCIP_CALL( createSubscip(scip, conshdlrdata, &subscip, FALSE) );
+
+         if( subscip == NULL )
+         {
+            stop = TRUE;
+            break;
+         }
+
+         /* set the limits before the problem is copied, such that the copy already respects the share of the memory
+          * of this sub-SCIP; the time limit is updated again before solving
+          */
+         SCIP_CALL( setSubscipLimits(scip, subscip, conshdlrdata->nodelimit, 0.0, nthreads, &success) );
+
+         if( !success )
+         {
+            SCIP_CALL( SCIPfree(&subscip) );
+            stop = TRUE;
+            break;
+         }
+
+         SCIP_CALL( SCIPsetBoolParam(subscip, "misc/usesmalltables", TRUE) );
+         SCIP_CALL( SCIPsetIntParam(subscip, "constraints/" CONSHDLR_NAME "/propfreq", -1) );
+
+         SCIP_CALL( SCIPhashmapCreate(&varmap, SCIPblkmem(scip), ncompvars) );
+
+         /* get name of the original problem and add "comp_nr" */
+         (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "%s_comp_%d", SCIPgetProbName(scip), comp);
+
+         SCIP_CALL( copyToSubscip(scip, subscip, name, compvars, &subvars[compstartsvars[comp]],
+               compconss, varmap, consmap, ncompvars, ncompconss, &success) );
+
+         SCIPhashmapFree(&varmap);
+
+         if( !success )
+         {
+            SCIP_CALL( SCIPfree(&subscip) );
+            continue;
+         }
+
+#ifdef WITH_DEBUG_SOLUTION
+         SCIP_CALL( setupDebugSol(scip, subscip, compvars, &subvars[compstartsvars[comp]], ncompvars) );
+#endif
+
+         subscips[nsubscips] = subscip;
+         comps[nsubscips] = comp;
+         nodelimits[nsubscips] = conshdlrdata->nodelimit;
+         gaplimits[nsubscips] = 0.0;
+         ++nsubscips;
+         ++ntotalsubscips;
+      }
+
+      SCIPdebugMsg(scip, "solve %d components concurrently with %d threads\n", nsubscips, nthreads);
+
+      if( nsubscips > 0 )
+      {
+         SCIP_CALL( solveSubscipsConcurrently(scip, subscips, nodelimits, gaplimits, nsubscips, nthreads) );
+      }
+
+      /* evaluate the components, i.e. apply fixings of variables and remove constraints */
+      for( c = 0; c < nsubscips; ++c )
+      {
+         SCIP_Bool solved;
+         int compidx;
+
+         compidx = comps[c];
+
+         SCIP_CALL( evalSubscip(scip, subscips[c], &(sortedvars[compstartsvars[compidx]]),
+               &subvars[compstartsvars[compidx]], &(sortedconss[compstartsconss[compidx]]),
+               compstartsvars[compidx + 1] - compstartsvars[compidx],
+               compstartsconss[compidx + 1] - compstartsconss[compidx], ndeletedconss, nfixedvars, ntightenedbounds,
+               result, &solved) );
+
+         /* if the component is unbounded or infeasible, this holds for the complete problem as well */
+         if( *result == SCIP_UNBOUNDED || *result == SCIP_CUTOFF )
+         {
+            stop = TRUE;
+            break;
+         }
+      }
+
+      /* free the sub-SCIPs of this batch before the next one is created */
+      for( c = nsubscips - 1; c >= 0; --c )
+      {
+         SCIP_CALL( SCIPfree(&subscips[c]) );
+      }
+
+      /* the constraints of the freed sub-SCIPs must not be found anymore */
+      SCIP_CALL( SCIPhashmapRemoveAll(consmap) );
+   }
+
+   SCIPhashmapFree(&consmap);
+   SCIPfreeBufferArray(scip, &subvars);
+   SCIPfreeBufferArray(scip, &gaplimits);
+   SCIPfreeBufferArray(scip, &nodelimits);
+   SCIPfreeBufferArray(scip, &comps);
+   SCIPfreeBufferArray(scip, &subscips);
+
+   return SCIP_OKAY;
+}
+
+/** prepares the next solving call for a connected component, i.e., transfers the best solution of the main problem
+ *  to the component and computes the limits of the call
+ */
+static
+SCIP_RETCODE prepareComponent(
    COMPONENT*            component,          /**< component structure */
    SCIP_Bool             lastcomponent,      /**< is this the last component to be solved? */
-   SCIP_RESULT*          result              /**< pointer to store the result of the solving process */
+   SCIP_Longint*         nodelimit,          /**< pointer to store the node limit of the call */
+   SCIP_Real*            gaplimit,           /**< pointer to store the gap limit of the call */
+   SCIP_Longint*         lastnnodes          /**< pointer to store the number of nodes of the component before the call */
    )
 {
    PROBLEM* problem;
    SCIP* scip;
    SCIP* subscip;
    SCIP_SOL* bestsol;
-   SCIP_Longint nodelimit;
-   SCIP_Longint lastnnodes;
-   SCIP_Real gaplimit;
-   SCIP_STATUS status;
 
    assert(component != NULL);
+   assert(nodelimit != NULL);
+   assert(gaplimit != NULL);
+   assert(lastnnodes != NULL);
 
    problem = component->problem;
    assert(problem != NULL);
@@ -1016,8 +1387,6 @@ SCIP_RETCODE solveComponent(
    subscip = component->subscip;
    assert(subscip != NULL);
 
-   *result = SCIP_DIDNOTRUN;
-
    SCIPdebugMessage("solve component <%s> (ncalls=%d, absgap=%.9g)\n",
       SCIPgetProbName(subscip), component->ncalls, component->lastprimalbound - component->lastdualbound);
 
@@ -1103,39 +1472,65 @@ SCIP_RETCODE solveComponent(
 
    if( component->ncalls == 0 )
    {
-      nodelimit = 1LL;
-      gaplimit = 0.0;
+      *nodelimit = 1LL;
+      *gaplimit = 0.0;
 
-      lastnnodes = 0;
+      *lastnnodes = 0;
    }
    else
    {
       SCIP_Longint mainnodelimit;
 
-      lastnnodes = SCIPgetNNodes(component->subscip);
+      *lastnnodes = SCIPgetNNodes(component->subscip);
 
       SCIP_CALL( SCIPgetLongintParam(scip, "limits/nodes", &mainnodelimit) );
 
-      nodelimit = 2 * lastnnodes;
-      nodelimit = MAX(nodelimit, 10LL);
+      *nodelimit = 2 * (*lastnnodes);
+      *nodelimit = MAX(*nodelimit, 10LL);
 
       if( mainnodelimit != -1 )
       {
-         assert(mainnodelimit >= lastnnodes);
-         nodelimit = MIN(nodelimit, mainnodelimit - lastnnodes);
+         assert(mainnodelimit >= *lastnnodes);
+         *nodelimit = MIN(*nodelimit, mainnodelimit - *lastnnodes);
       }
 
       /* set a gap limit of half the current gap (at most 10%) */
       if( SCIPgetGap(component->subscip) < 0.2 )
-         gaplimit = 0.5 * SCIPgetGap(component->subscip);
+         *gaplimit = 0.5 * SCIPgetGap(component->subscip);
       else
-         gaplimit = 0.1;
+         *gaplimit = 0.1;
 
       if( lastcomponent )
-         gaplimit = 0.0;
+         *gaplimit = 0.0;
    }
 
-   SCIP_CALL( solveSubscip(scip, subscip, nodelimit, gaplimit) );
+   return SCIP_OKAY;
+}
+
+/** evaluates the last solving call of a connected component and transfers its dual bound and solution to the problem */
+static
+SCIP_RETCODE evalComponent(
+   COMPONENT*            component,          /**< component structure */
+   SCIP_Longint          lastnnodes,         /**< number of nodes of the component before the call */
+   SCIP_RESULT*          result              /**< pointer to store the result of the solving process */
+   )
+{
+   PROBLEM* problem;
+   SCIP* scip;
+   SCIP* subscip;
+   SCIP_STATUS status;
+
+   assert(component != NULL);
+   assert(result != NULL);
+
+   problem = component->problem;
+   assert(problem != NULL);
+
+   scip = problem->scip;
+   assert(scip != NULL);
+
+   subscip = component->subscip;
+   assert(subscip != NULL);
 
    SCIPaddNNodes(scip, SCIPgetNNodes(subscip) - lastnnodes);
 
@@ -1316,6 +1711,32 @@ SCIP_RETCODE solveComponent(
    return SCIP_OKAY;
 }
 
+/** (continues) solving a connected component */
+static
+SCIP_RETCODE solveComponent(
+   COMPONENT*            component,          /**< component structure */
+   SCIP_Bool             lastcomponent,      /**< is this the last component to be solved? */
+   SCIP_RESULT*          result              /**< pointer to store the result of the solving process */
+   )
+{
+   SCIP_Longint nodelimit;
+   SCIP_Longint lastnnodes;
+   SCIP_Real gaplimit;
+
+   assert(component != NULL);
+   assert(result != NULL);
+
+   *result = SCIP_DIDNOTRUN;
+
+   SCIP_CALL( prepareComponent(component, lastcomponent, &nodelimit, &gaplimit, &lastnnodes) );
+
+   SCIP_CALL( solveSubscip(component->problem->scip, component->subscip, nodelimit, gaplimit) );
+
+   SCIP_CALL( evalComponent(component, lastnnodes, result) );
+
+   return SCIP_OKAY;
+}
+
 /** initialize subproblem structure */
 static
 SCIP_RETCODE initProblem(
@@ -1678,10 +2099,94 @@ SCIP_RETCODE createAndSplitProblem(
    return SCIP_OKAY;
 }
 
+/** continue solving a problem by solving the components with the highest priority concurrently */
+static
+SCIP_RETCODE solveProblemConcurrently(
+   PROBLEM*              problem,            /**< problem structure */
+   int                   nthreads,           /**< number of threads to solve components concurrently */
+   SCIP_RESULT*          result              /**< result pointer for the problem solve */
+   )
+{
+   SCIP* scip;
+   COMPONENT** components;
+   SCIP** subscips;
+   SCIP_Longint* nodelimits;
+   SCIP_Longint* lastnnodes;
+   SCIP_Real* gaplimits;
+   SCIP_Bool lastcomponents;
+   int ncomponents;
+   int c;
+
+   assert(problem != NULL);
+   assert(nthreads > 1);
+   assert(result != NULL);
+
+   scip = problem->scip;
+   assert(scip != NULL);
+
+   ncomponents = MIN(nthreads, SCIPpqueueNElems(problem->compqueue));
+   assert(ncomponents > 1);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &components, ncomponents) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &subscips, ncomponents) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &nodelimits, ncomponents) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lastnnodes, ncomponents) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &gaplimits, ncomponents) );
+
+   /* if all remaining components are solved in this call, they should be solved to optimality */
+   lastcomponents = (ncomponents == SCIPpqueueNElems(problem->compqueue));
+
+   for( c = 0; c < ncomponents; ++c )
+   {
+      components[c] = (COMPONENT*)SCIPpqueueRemove(problem->compqueue);
+      subscips[c] = components[c]->subscip;
+
+      SCIP_CALL( prepareComponent(components[c], lastcomponents, &nodelimits[c], &gaplimits[c], &lastnnodes[c]) );
+   }
+
+   SCIP_CALL( solveSubscipsConcurrently(scip, subscips, nodelimits, gaplimits, ncomponents, nthreads) );
+
+   /* evaluate the components in the order of their priority */
+   *result = SCIP_SUCCESS;
+   for( c = 0; c < ncomponents; ++c )
+   {
+      SCIP_RESULT subscipresult;
+
+      SCIP_CALL( evalComponent(components[c], lastnnodes[c], &subscipresult) );
+
+      /* if infeasibility or unboundedness was detected, return this */
+      if( subscipresult == SCIP_CUTOFF || subscipresult == SCIP_UNBOUNDED )
+      {
+         if( *result == SCIP_SUCCESS )
+            *result = subscipresult;
+      }
+      /* the component was not solved to optimality, so we need to re-insert it in the components queue */
+      else if( !components[c]->solved )
+      {
+         SCIP_CALL( SCIPpqueueInsert(problem->compqueue, components[c]) );
+      }
+   }
+
+   /* no unsolved components are left, so this problem has be completely evaluated and the node can be pruned;
+    * otherwise, we delay this node
+    */
+   if( *result == SCIP_SUCCESS )
+      *result = (SCIPpqueueNElems(problem->compqueue) == 0 ? SCIP_CUTOFF : SCIP_DELAYNODE);
+
+   SCIPfreeBufferArray(scip, &gaplimits);
+   SCIPfreeBufferArray(scip, &lastnnodes);
+   SCIPfreeBufferArray(scip, &nodelimits);
+   SCIPfreeBufferArray(scip, &subscips);
+   SCIPfreeBufferArray(scip, &components);
+
+   return SCIP_OKAY;
+}
+
 /** continue solving a problem  */
 static
 SCIP_RETCODE solveProblem(
    PROBLEM*              problem,            /**< problem structure */
+   int                   nthreads,           /**< number of threads to solve components concurrently */
    SCIP_RESULT*          result              /**< result pointer for the problem solve */
    )
 {
@@ -1690,6 +2195,13 @@ SCIP_RETCODE solveProblem(
 
    assert(problem != NULL);
 
+   /* solve several components at once if there are enough threads */
+   if( nthreads > 1 && SCIPpqueueNElems(problem->compqueue) > 1 )
+   {
+      SCIP_CALL( solveProblemConcurrently(problem, nthreads, result) );
+      return SCIP_OKAY;
+   }
+
    *result = SCIP_SUCCESS;
 
    component = (COMPONENT*)SCIPpqueueRemove(problem->compqueue);
@@ -2251,7 +2763,7 @@ SCIP_DECL_CONSPROP(consPropComponents)
    {
       if( problem != NULL )
       {
-         SCIP_CALL( solveProblem(problem, result) );
+         SCIP_CALL( solveProblem(problem, conshdlrdata->nthreads, result) );
       }
    } while( *result == SCIP_DELAYNODE && SCIPgetDepth(scip) == 0 && !SCIPisStopped(scip) && SCIPgetNNodes(scip) < nodelimit);
 
@@ -2324,7 +2836,16 @@ SCIP_DECL_CONSPRESOL(consPresolComponents)
    SCIP_CALL( findComponents(scip, conshdlrdata, NULL, sortedvars, sortedconss, compstartsvars,
          compstartsconss, &nsortedvars, &nsortedconss, &ncomponents, &ncompsminsize, &ncompsmaxsize) );
 
-   if( ncompsmaxsize > 0 )
+   /* solve the small components concurrently, each in a sub-SCIP of its own */
+   if( ncompsmaxsize > 1 && conshdlrdata->nthreads > 1 )
+   {
+      SCIPdebugMsg(scip, "found %d components (%d with small size) during presolving\n", ncomponents, ncompsmaxsize);
+
+      SCIP_CALL( presolveComponentsConcurrently(scip, conshdlrdata, sortedvars, sortedconss, compstartsvars,
+            compstartsconss, nsortedvars, nsortedconss, ncomponents, ncompsmaxsize, ndelconss, nfixedvars, nchgbds,
+            result) );
+   }
+   else if( ncompsmaxsize > 0 )
    {
       char name[SCIP_MAXSTRLEN];
       SCIP* subscip;
@@ -2344,7 +2865,7 @@ SCIP_DECL_CONSPRESOL(consPresolComponents)
          ncomponents, ncompsmaxsize, SCIPgetNVars(scip), SCIPgetNBinVars(scip), SCIPgetNIntVars(scip), SCIPgetNContVars(scip) + SCIPgetNImplVars(scip), SCIPgetNConss(scip));
 
       /* build subscip */
-      SCIP_CALL( createSubscip(scip, conshdlrdata, &subscip) );
+      SCIP_CALL( createSubscip(scip, conshdlrdata, &subscip, TRUE) );
 
       if( subscip == NULL )
          goto TERMINATE;
@@ -2364,7 +2885,7 @@ SCIP_DECL_CONSPRESOL(consPresolComponents)
          if( SCIPgetStage(subscip) > SCIP_STAGE_INIT )
          {
             SCIP_CALL( SCIPfree(&subscip) );
-            SCIP_CALL( createSubscip(scip, conshdlrdata, &subscip) );
+            SCIP_CALL( createSubscip(scip, conshdlrdata, &subscip, TRUE) );
          }
 #endif
          /* get component variables */
@@ -2423,31 +2944,9 @@ SCIP_DECL_CONSPRESOL(consPresolComponents)
             continue;
          }
 
-            /* set up debug solution */
+         /* set up debug solution */
 #ifdef WITH_DEBUG_SOLUTION
-         if( SCIPdebugSolIsEnabled(scip) )
-         {
-            SCIP_SOL* debugsol;
-            SCIP_Real val;
-            int i;
-
-            SCIP_CALL( SCIPdebugGetSol(scip, &debugsol) );
-
-            /* set solution values in the debug solution if it is available */
-            if( debugsol != NULL )
-            {
-               SCIPdebugSolEnable(subscip);
-
-               for( i = 0; i < ncompvars; ++i )
-               {
-                  if( subvars[i] != NULL )
-                  {
-                     SCIP_CALL( SCIPdebugGetSolVal(scip, compvars[i], &val) );
-                     SCIP_CALL( SCIPdebugAddSolVal(subscip, subvars[i], val) );
-                  }
-               }
-            }
-         }
+         SCIP_CALL( setupDebugSol(scip, subscip, compvars, subvars, ncompvars) );
 #endif
 
          /* solve the subproblem and evaluate the result, i.e. apply fixings of variables and remove constraints */
@@ -2596,6 +3095,10 @@ SCIP_RETCODE SCIPincludeConshdlrComponents(
          "constraints/" CONSHDLR_NAME "/feastolfactor",
          "factor to increase the feasibility tolerance of the main SCIP in all sub-SCIPs, default value 1.0",
          &conshdlrdata->feastolfactor, TRUE, DEFAULT_FEASTOLFACTOR, 0.0, 1000000.0, NULL, NULL) );
+   SCIP_CALL( SCIPaddIntParam(scip,
+         "constraints/" CONSHDLR_NAME "/nthreads",
+         "number of threads to solve independent components concurrently (1: solve components sequentially)",
+         &conshdlrdata->nthreads, FALSE, DEFAULT_NTHREADS, 1, 256, NULL, NULL) );
 
    return SCIP_OKAY;
 }
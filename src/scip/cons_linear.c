@@ -7493,6 +7493,46 @@ SCIP_RETCODE checkCons(
    return SCIP_OKAY;
 }
 
+/** checks whether the activity of a linear constraint w.r.t. a dense vector of solution values of the active problem
+ *  variables lies within its sides up to epsilon, such that the exact check would not report a violation; constraints
+ *  with nonactive variables, an absolute feasibility check, or infinite activity are never clearly feasible
+ */
+static
+SCIP_Bool consdataIsClearlyFeasible(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSDATA*        consdata,           /**< linear constraint data */
+   SCIP_Real*            solvals             /**< solution values of the active problem variables, indexed by problem index */
+   )
+{
+   SCIP_Real activity;
+   int probindex;
+   int v;
+
+   assert(scip != NULL);
+   assert(consdata != NULL);
+   assert(solvals != NULL);
+
+   if( consdata->checkabsolute )
+      return FALSE;
+
+   activity = 0.0;
+   for( v = 0; v < consdata->nvars; ++v )
+   {
+      probindex = SCIPvarGetProbindex(consdata->vars[v]);
+      if( probindex < 0 )
+         return FALSE;
+
+      activity += consdata->vals[v] * solvals[probindex];
+   }
+
+   /* infinite or unknown solution values are left to the exact check; a NaN activity fails the comparisons below */
+   if( SCIPisInfinity(scip, REALABS(activity)) )
+      return FALSE;
+
+   return (SCIPisInfinity(scip, -consdata->lhs) || SCIPisGE(scip, activity, consdata->lhs))
+      && (SCIPisInfinity(scip, consdata->rhs) || SCIPisLE(scip, activity, consdata->rhs));
+}
+
 /** creates an LP row in a linear constraint data */
 static
 SCIP_RETCODE createRow(
@@ -16029,6 +16069,7 @@ static
 SCIP_DECL_CONSCHECK(consCheckLinear)
 {  /*lint --e{715}*/
    SCIP_CONSHDLRDATA* conshdlrdata;
+   SCIP_Real* solvals;
    SCIP_Bool checkrelmaxabs;
    int c;
 
@@ -16046,10 +16087,35 @@ SCIP_DECL_CONSCHECK(consCheckLinear)
 
    /*debugMsg(scip, "Check method of linear constraints\n");*/
 
+   /* if the constraints have more nonzeros than there are problem variables, we gather the values of all active
+    * variables once and evaluate the activities on this dense vector; only the constraints that are not clearly
+    * feasible are passed to the exact check; if LP rows need not be checked, most constraints are skipped anyway
+    */
+   solvals = NULL;
+   if( sol != NULL && checklprows && nconss > 0 && SCIPconsIsTransformed(conss[0]) && SCIPgetStage(scip) <= SCIP_STAGE_SOLVED )
+   {
+      int nnonzeros = 0;
+      int nvars;
+
+      nvars = SCIPgetNVars(scip);
+      for( c = 0; c < nconss && nnonzeros < nvars; ++c )
+         nnonzeros += SCIPconsGetData(conss[c])->nvars;
+
+      if( nnonzeros >= nvars && nvars > 0 )
+      {
+         SCIP_CALL( SCIPallocBufferArray(scip, &solvals, nvars) );
+         SCIP_CALL( SCIPgetSolVals(scip, sol, nvars, SCIPgetVars(scip), solvals) );
+      }
+   }
+
    /* check all linear constraints for feasibility */
    for( c = 0; c < nconss && (*result == SCIP_FEASIBLE || completely); ++c )
    {
       SCIP_Bool violated = FALSE;
+
+      if( solvals != NULL && consdataIsClearlyFeasible(scip, SCIPconsGetData(conss[c]), solvals) )
+         continue;
+
       SCIP_CALL( checkCons(scip, conss[c], sol, checklprows, checkrelmaxabs, &violated) );
 
       if( violated )
@@ -16079,6 +16145,8 @@ SCIP_DECL_CONSCHECK(consCheckLinear)
       }
    }
 
+   SCIPfreeBufferArrayNull(scip, &solvals);
+
    return SCIP_OKAY;
 }
 
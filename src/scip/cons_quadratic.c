@@ -133,6 +133,9 @@
 /* scaling factor for gauge function */
 #define GAUGESCALE 0.99999
 
+/* maximal relative change of quadratic variable values such that a cached separation cut is reused */
+#define SEPACUTREUSE_MAXRELCHANGE 1e-3
+
 #define ROWPREP_SCALEUP_VIOLNONZERO    (10.0*SCIPepsilon(scip))    /**< minimal violation for considering up-scaling of rowprep (we want to avoid upscaling very small violations) */
 #define ROWPREP_SCALEUP_MINVIOLFACTOR  2.0                         /**< scale up will target a violation of ~MINVIOLFACTOR*minviol, where minviol is given by caller */
 #define ROWPREP_SCALEUP_MAXMINCOEF     (1.0 / SCIPfeastol(scip))   /**< scale up only if min. coef is below this number (before scaling) */
@@ -228,6 +231,10 @@ struct SCIP_ConsData
 
    SCIP_Bool             isdisaggregated;    /**< has the constraint already been disaggregated? if might happen that more disaggreation would be potentially
                                                   possible, but we reached the maximum number of sparsity components during presolveDisaggregate() */
+
+   SCIP_ROW*             sepacut;            /**< globally valid cut that was generated when separating an LP solution the last time, or NULL */
+   SCIP_Real*            sepacutpoint;       /**< values of quadratic variables in the LP solution for which sepacut was generated, allocated when sepacut is set */
+   SCIP_SIDETYPE         sepacutside;        /**< side of constraint for which sepacut was generated */
 };
 
 /** quadratic constraint update method */
@@ -305,6 +312,7 @@ struct SCIP_ConshdlrData
    SCIP_Real             minscorebilinterms; /**< minimal required score in order to use linear inequalities for tighter bilinear relaxations */
    SCIP_Real             mincurvcollectbilinterms;/**< minimal curvature of constraints to be considered when returning bilinear terms to other plugins */
    int                   bilinineqmaxseparounds; /**< maximum number of separation rounds to use linear inequalities for the bilinear term relaxation in a local node */
+   int                   maxsepacuts;        /**< maximal number of cuts added when separating a solution (-1: no limit) */
 };
 
 
@@ -1459,6 +1467,11 @@ SCIP_RETCODE consdataFree(
    /* free sepa arrays, may exists if constraint is deleted in solving stage */
    SCIPfreeBlockMemoryArrayNull(scip, &(*consdata)->sepaquadvars,     (*consdata)->nquadvars);
    SCIPfreeBlockMemoryArrayNull(scip, &(*consdata)->sepabilinvar2pos, (*consdata)->nbilinterms);
+   SCIPfreeBlockMemoryArrayNull(scip, &(*consdata)->sepacutpoint,     (*consdata)->nquadvars);
+   if( (*consdata)->sepacut != NULL )
+   {
+      SCIP_CALL( SCIPreleaseRow(scip, &(*consdata)->sepacut) );
+   }
 
    /* release linear variables and free linear part */
    if( (*consdata)->linvarssize > 0 )
@@ -9381,6 +9394,7 @@ SCIP_RETCODE processCut(
    SCIP_Real             minefficacy,        /**< minimal efficacy */
    SCIP_Bool             inenforcement,      /**< whether we are in constraint enforcement */
    SCIP_Real*            bestefficacy,       /**< buffer to store best efficacy of a cut that was added to the LP, if found; or NULL if not of interest */
+   SCIP_Bool*            added,              /**< buffer to store whether the cut was added to the sepastore */
    SCIP_RESULT*          result              /**< result of separation */
    )
 {
@@ -9390,9 +9404,12 @@ SCIP_RETCODE processCut(
    assert(scip != NULL);
    assert(row != NULL);
    assert(conshdlr != NULL);
+   assert(added != NULL);
    assert(result != NULL);
    assert(cons != NULL);
 
+   *added = FALSE;
+
    /* no cut to process */
    if( *row == NULL )
       return SCIP_OKAY;
@@ -9421,6 +9438,7 @@ SCIP_RETCODE processCut(
          *result = SCIP_SEPARATED;
       }
       SCIP_CALL( SCIPresetConsAge(scip, cons) );
+      *added = TRUE;
 
       /* mark row as not removable from LP for current node, if in enforcement */
       if( inenforcement && !conshdlrdata->enfocutsremovable )
@@ -9433,9 +9451,74 @@ SCIP_RETCODE processCut(
    return SCIP_OKAY;
 }
 
+/** checks whether the cut that was cached for a constraint has been generated for a point that is close to the current LP solution */
+static
+SCIP_Bool isSepacutReusable(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSDATA*        consdata            /**< constraint data */
+   )
+{
+   SCIP_Real val;
+   int j;
+
+   assert(scip != NULL);
+   assert(consdata != NULL);
+   assert(consdata->sepacut != NULL);
+   assert(consdata->sepacutpoint != NULL || consdata->nquadvars == 0);
+
+   for( j = 0; j < consdata->nquadvars; ++j )
+   {
+      val = SCIPgetSolVal(scip, NULL, consdata->quadvarterms[j].var);
+      if( REALABS(val - consdata->sepacutpoint[j]) > SEPACUTREUSE_MAXRELCHANGE * MAX(1.0, REALABS(consdata->sepacutpoint[j])) )
+         return FALSE;
+   }
+
+   return TRUE;
+}
+
+/** remembers a globally valid cut that has been generated for the LP solution, so that it can be reused if the LP solution changes only little */
+static
+SCIP_RETCODE storeSepacut(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSDATA*        consdata,           /**< constraint data */
+   SCIP_ROW*             row,                /**< cut to remember */
+   SCIP_SIDETYPE         violside            /**< side of constraint for which the cut was generated */
+   )
+{
+   int j;
+
+   assert(scip != NULL);
+   assert(consdata != NULL);
+   assert(row != NULL);
+   assert(!SCIProwIsLocal(row));
+
+   if( consdata->sepacut != NULL )
+   {
+      SCIP_CALL( SCIPreleaseRow(scip, &consdata->sepacut) );
+   }
+
+   if( consdata->sepacutpoint == NULL && consdata->nquadvars > 0 )
+   {
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->sepacutpoint, consdata->nquadvars) );
+   }
+
+   for( j = 0; j < consdata->nquadvars; ++j )
+      consdata->sepacutpoint[j] = SCIPgetSolVal(scip, NULL, consdata->quadvarterms[j].var);
+
+   consdata->sepacut = row;
+   consdata->sepacutside = violside;
+   SCIP_CALL( SCIPcaptureRow(scip, row) );
+
+   return SCIP_OKAY;
+}
+
 /** tries to separate solution or LP solution by a linear cut
  *
  *  assumes that constraint violations have been computed
+ *
+ *  If the number of cuts is limited, then the violated sides of constraints are processed in the order of decreasing violation.
+ *  For the LP solution, a globally valid cut that was generated for a constraint before is reused instead of computing
+ *  a new one if the quadratic variables have changed only little since then and the cut is still efficacious.
  */
 static
 SCIP_RETCODE separatePoint(
@@ -9455,8 +9538,15 @@ SCIP_RETCODE separatePoint(
    SCIP_CONSDATA*     consdata;
    SCIP_Real          efficacy;
    SCIP_SIDETYPE      violside;
+   SCIP_Real*         viols;
+   int*               violsides;
+   int                nviolsides;
+   int                ncuts;
    int                c;
+   int                i;
    SCIP_ROW*          row;
+   SCIP_Bool          added;
+   SCIP_Bool          sorted;
 
    assert(scip != NULL);
    assert(conshdlr != NULL);
@@ -9472,21 +9562,66 @@ SCIP_RETCODE separatePoint(
    if( bestefficacy != NULL )
       *bestefficacy = 0.0;
 
-   row = NULL;
-   /* loop over both sides of each constraint */
-   for( c = 0, violside = SCIP_SIDETYPE_LEFT; c < nconss; c = (violside == SCIP_SIDETYPE_LEFT ? c : c+1), violside = (violside == SCIP_SIDETYPE_LEFT ? SCIP_SIDETYPE_RIGHT : SCIP_SIDETYPE_LEFT) )
+   if( nconss == 0 )
+      return SCIP_OKAY;
+
+   /* collect violated sides of constraints; a side is encoded as 2*c for the left and 2*c+1 for the right side of constraint c */
+   SCIP_CALL( SCIPallocBufferArray(scip, &viols, 2*nconss) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &violsides, 2*nconss) );
+   nviolsides = 0;
+   for( c = 0; c < nconss; ++c )
    {
       assert(conss != NULL);
       consdata = SCIPconsGetData(conss[c]);
       assert(consdata != NULL);
 
-      /* if side not violated, then go on */
-      if( !SCIPisGT(scip, violside == SCIP_SIDETYPE_LEFT ? consdata->lhsviol : consdata->rhsviol, SCIPfeastol(scip)) )
-         continue;
+      if( SCIPisGT(scip, consdata->lhsviol, SCIPfeastol(scip)) )
+      {
+         viols[nviolsides] = consdata->lhsviol;
+         violsides[nviolsides] = 2*c;
+         ++nviolsides;
+      }
+      if( SCIPisGT(scip, consdata->rhsviol, SCIPfeastol(scip)) )
+      {
+         viols[nviolsides] = consdata->rhsviol;
+         violsides[nviolsides] = 2*c+1;
+         ++nviolsides;
+      }
+   }
+
+   /* we are not feasible anymore */
+   if( nviolsides > 0 )
+      *result = SCIP_DIDNOTFIND;
+
+   /* if the number of cuts is limited, then try the most violated sides first */
+   sorted = conshdlrdata->maxsepacuts >= 0 && nviolsides > conshdlrdata->maxsepacuts;
+   if( sorted )
+      SCIPsortDownRealInt(viols, violsides, nviolsides);
 
-      /* we are not feasible anymore */
-      if( *result == SCIP_FEASIBLE )
-         *result = SCIP_DIDNOTFIND;
+   row = NULL;
+   ncuts = 0;
+   for( i = 0; i < nviolsides; ++i )
+   {
+      if( conshdlrdata->maxsepacuts >= 0 && ncuts >= conshdlrdata->maxsepacuts )
+         break;
+
+      c = violsides[i] / 2;
+      violside = (violsides[i] % 2 == 0) ? SCIP_SIDETYPE_LEFT : SCIP_SIDETYPE_RIGHT;
+
+      /* enforce only useful constraints
+       * others are only checked and enforced if we are still feasible or have not found a separating cut yet;
+       * if the sides are sorted by violation, then useful constraints may still follow
+       */
+      if( c >= nusefulconss && *result == SCIP_SEPARATED )
+      {
+         if( sorted )
+            continue;
+         break;
+      }
+
+      assert(conss != NULL);
+      consdata = SCIPconsGetData(conss[c]);
+      assert(consdata != NULL);
 
       /* generate cut */
       if( sol == NULL && SCIPgetLPSolstat(scip) == SCIP_LPSOLSTAT_UNBOUNDEDRAY )
@@ -9511,28 +9646,50 @@ SCIP_RETCODE separatePoint(
             else
                efficacy = 0.0;
 
-            SCIP_CALL( processCut(scip, &row, conshdlr, conss[c], efficacy, minefficacy, inenforcement, bestefficacy, result) );
+            SCIP_CALL( processCut(scip, &row, conshdlr, conss[c], efficacy, minefficacy, inenforcement, bestefficacy, &added, result) );
+            if( added )
+               ++ncuts;
          }
          continue;
       }
       else
       {
-         SCIP_CALL( generateCutSol(scip, conshdlr, conss[c], sol, NULL, violside, &row, &efficacy,
-            conshdlrdata->checkcurvature, minefficacy, 'd') );
+         /* reuse the cut from a previous separation round if the LP solution moved only little and the cut still separates */
+         if( sol == NULL && consdata->sepacut != NULL && consdata->sepacutside == violside && !SCIProwIsInLP(consdata->sepacut)
+            && isSepacutReusable(scip, consdata) )
+         {
+            efficacy = -SCIPgetRowLPFeasibility(scip, consdata->sepacut);
+            if( SCIPisGT(scip, efficacy, minefficacy) )
+            {
+               row = consdata->sepacut;
+               SCIP_CALL( SCIPcaptureRow(scip, row) );
+            }
+         }
+
+         if( row == NULL )
+         {
+            SCIP_CALL( generateCutSol(scip, conshdlr, conss[c], sol, NULL, violside, &row, &efficacy,
+               conshdlrdata->checkcurvature, minefficacy, 'd') );
+
+            /* remember globally valid cuts for the LP solution */
+            if( sol == NULL && row != NULL && !SCIProwIsLocal(row) )
+            {
+               SCIP_CALL( storeSepacut(scip, consdata, row, violside) );
+            }
+         }
 
-         SCIP_CALL( processCut(scip, &row, conshdlr, conss[c], efficacy, minefficacy, inenforcement, bestefficacy, result) );
+         SCIP_CALL( processCut(scip, &row, conshdlr, conss[c], efficacy, minefficacy, inenforcement, bestefficacy, &added, result) );
+         if( added )
+            ++ncuts;
       }
 
       if( *result == SCIP_CUTOFF )
          break;
-
-      /* enforce only useful constraints
-       * others are only checked and enforced if we are still feasible or have not found a separating cut yet
-       */
-      if( c >= nusefulconss && *result == SCIP_SEPARATED )
-         break;
    }
 
+   SCIPfreeBufferArray(scip, &violsides);
+   SCIPfreeBufferArray(scip, &viols);
+
    return SCIP_OKAY;
 }
 
@@ -12441,6 +12598,13 @@ SCIP_DECL_CONSEXITSOL(consExitsolQuadratic)
       SCIPfreeBlockMemoryArrayNull(scip, &consdata->sepaquadvars,     consdata->nquadvars);
       SCIPfreeBlockMemoryArrayNull(scip, &consdata->sepabilinvar2pos, consdata->nbilinterms);
 
+      /* forget cached separation cut */
+      SCIPfreeBlockMemoryArrayNull(scip, &consdata->sepacutpoint, consdata->nquadvars);
+      if( consdata->sepacut != NULL )
+      {
+         SCIP_CALL( SCIPreleaseRow(scip, &consdata->sepacut) );
+      }
+
       SCIPfreeBlockMemoryArrayNull(scip, &consdata->factorleft,  consdata->nquadvars + 1);
       SCIPfreeBlockMemoryArrayNull(scip, &consdata->factorright, consdata->nquadvars + 1);
 
@@ -14302,6 +14466,10 @@ SCIP_RETCODE SCIPincludeConshdlrQuadratic(
          "maximum number of separation rounds to use linear inequalities for the bilinear term relaxation in a local node",
          &conshdlrdata->bilinineqmaxseparounds, TRUE, 3, 0, INT_MAX, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddIntParam(scip, "constraints/" CONSHDLR_NAME "/maxsepacuts",
+         "maximal number of cuts added when separating a solution, where most violated constraints are considered first (-1: no limit)",
+         &conshdlrdata->maxsepacuts, FALSE, -1, -1, INT_MAX, NULL, NULL) );
+
    conshdlrdata->eventhdlr = NULL;
    SCIP_CALL( SCIPincludeEventhdlrBasic(scip, &(conshdlrdata->eventhdlr),CONSHDLR_NAME"_boundchange", "signals a bound change to a quadratic constraint",
          processVarEvent, NULL) );
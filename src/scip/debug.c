@@ -1709,7 +1709,9 @@ SCIP_RETCODE SCIPdebugCheckConflictFrontier(
    SCIP_Real*            relaxedbds,         /**< array with relaxed bounds which are efficient to create a valid conflict */
    int                   nbdchginfos,        /**< number of bound changes in the conflict set */
    SCIP_PQUEUE*          bdchgqueue,         /**< unprocessed conflict bound changes */
-   SCIP_PQUEUE*          forcedbdchgqueue    /**< unprocessed conflict bound changes that must be resolved */
+   SCIP_PQUEUE*          forcedbdchgqueue,   /**< unprocessed conflict bound changes that must be resolved */
+   SCIP_BDCHGINFO**      trailbdchginfos,    /**< unprocessed binary conflict bound changes on the trail */
+   int                   ntrailbdchginfos    /**< number of unprocessed binary conflict bound changes on the trail */
    )
 {
    SCIP_BDCHGINFO** bdchgqueued;
@@ -1722,6 +1724,7 @@ SCIP_RETCODE SCIPdebugCheckConflictFrontier(
    assert(blkmem != NULL);
    assert(node != NULL);
    assert(nbdchginfos == 0 || bdchginfos != NULL);
+   assert(ntrailbdchginfos == 0 || trailbdchginfos != NULL);
 
    /* when debugging was disabled the solution is not defined to be not valid in the current subtree */
    if( !SCIPdebugSolIsEnabled(set->scip) )
@@ -1760,6 +1763,10 @@ SCIP_RETCODE SCIPdebugCheckConflictFrontier(
    if( debugCheckBdchginfos(set, forcedbdchgqueued, NULL, nforcedbdchgqueued) )
       return SCIP_OKAY;
 
+   /* check, whether one literals on the trail is TRUE in the debugging solution */
+   if( debugCheckBdchginfos(set, trailbdchginfos, NULL, ntrailbdchginfos) )
+      return SCIP_OKAY;
+
    SCIPerrorMessage("invalid conflict frontier");
 
    if( bdchginfo != NULL )
@@ -1779,6 +1786,9 @@ SCIP_RETCODE SCIPdebugCheckConflictFrontier(
    /* print bound changes which are queued in the force queue */
    SCIP_CALL( printBdchginfos(set, forcedbdchgqueued, NULL, nforcedbdchgqueued) );
 
+   /* print bound changes which are kept on the trail */
+   SCIP_CALL( printBdchginfos(set, trailbdchginfos, NULL, ntrailbdchginfos) );
+
    printf("\n");
    SCIPABORT();
 
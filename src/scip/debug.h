@@ -191,7 +191,9 @@ SCIP_RETCODE SCIPdebugCheckConflictFrontier(
    SCIP_Real*            relaxedbds,         /**< array with relaxed bounds which are efficient to create a valid conflict */
    int                   nbdchginfos,        /**< number of bound changes in the conflict set */
    SCIP_PQUEUE*          bdchgqueue,         /**< unprocessed conflict bound changes */
-   SCIP_PQUEUE*          forcedbdchgqueue    /**< unprocessed conflict bound changes that must be resolved */
+   SCIP_PQUEUE*          forcedbdchgqueue,   /**< unprocessed conflict bound changes that must be resolved */
+   SCIP_BDCHGINFO**      trailbdchginfos,    /**< unprocessed binary conflict bound changes on the trail */
+   int                   ntrailbdchginfos    /**< number of unprocessed binary conflict bound changes on the trail */
    );
 
 /** creates the debugging propagator and includes it in SCIP */
@@ -275,7 +277,7 @@ SCIP_Bool SCIPwithDebugSol(void);
 #define SCIPdebugCheckAggregation(set,var,aggrvars,scalars,constant,naggrvars) SCIP_OKAY
 #define SCIPdebugCheckClique(set,vars,values,nvars) SCIP_OKAY
 #define SCIPdebugCheckConflict(blkmem,set,node,bdchginfos,relaxedbds,nliterals) SCIP_OKAY
-#define SCIPdebugCheckConflictFrontier(blkmem,set,node,bdchginfo,bdchginfos,relaxedbds,nliterals,bdchgqueue,forcedbdchgqueue) SCIP_OKAY
+#define SCIPdebugCheckConflictFrontier(blkmem,set,node,bdchginfo,bdchginfos,relaxedbds,nliterals,bdchgqueue,forcedbdchgqueue,trailbdchginfos,ntrailbdchginfos) SCIP_OKAY
 #define SCIPdebugIncludeProp(scip) SCIP_OKAY
 #define SCIPdebugAddSolVal(scip,var,val) SCIP_OKAY
 #define SCIPdebugGetSolVal(scip,var,val) SCIP_OKAY
@@ -0,0 +1 @@
+#define SCIP_GITHASH "6e02a89-dirty"
@@ -37,6 +37,7 @@
 #include "scip/misc.h"
 
 #include "scip/struct_heur.h"
+#include "tpi/tpi.h"
 
 /** compares two heuristics w. r. to their delay positions and their priority */
 SCIP_DECL_SORTPTRCOMP(SCIPheurComp)
@@ -932,7 +933,13 @@ SCIP_RETCODE doHeurCreate(
    (*heur)->heurinitsol = heurinitsol;
    (*heur)->heurexitsol = heurexitsol;
    (*heur)->heurexec = heurexec;
+   (*heur)->heurasyncprepare = NULL;
+   (*heur)->heurasyncexec = NULL;
+   (*heur)->heurasynccollect = NULL;
    (*heur)->heurdata = heurdata;
+   (*heur)->snapshot = NULL;
+   (*heur)->jobbatch = NULL;
+   (*heur)->async = FALSE;
    SCIP_CALL( SCIPclockCreate(&(*heur)->setuptime, SCIP_CLOCKTYPE_DEFAULT) );
    SCIP_CALL( SCIPclockCreate(&(*heur)->heurclock, SCIP_CLOCKTYPE_DEFAULT) );
    (*heur)->ncalls = 0;
@@ -1017,6 +1024,7 @@ SCIP_RETCODE SCIPheurFree(
    assert(!(*heur)->initialized);
    assert(set != NULL);
    assert((*heur)->divesets != NULL || (*heur)->ndivesets == 0);
+   assert((*heur)->jobbatch == NULL);
 
    /* call destructor of primal heuristic */
    if( (*heur)->heurfree != NULL )
@@ -1158,6 +1166,12 @@ SCIP_RETCODE SCIPheurExitsol(
    assert(heur != NULL);
    assert(set != NULL);
 
+   /* interrupt and wait for a running asynchronous job; its results do not belong to the next run */
+   if( heur->jobbatch != NULL )
+   {
+      SCIP_CALL( SCIPheurCollectAsync(heur, set, NULL, TRUE) );
+   }
+
    /* call solving process deinitialization method of primal heuristic */
    if( heur->heurexitsol != NULL )
    {
@@ -1235,6 +1249,196 @@ SCIP_Bool SCIPheurShouldBeExecuted(
    return execute;
 }
 
+/** creates a snapshot of the problem variables, which are captured until the job of the heuristic is collected */
+static
+SCIP_RETCODE heurSnapshotCreate(
+   SCIP_HEURSNAPSHOT**   snapshot,           /**< pointer to store the snapshot */
+   SCIP_HEUR*            heur,               /**< primal heuristic taking the snapshot */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   SCIP_VAR** vars;
+   int nvars;
+   int v;
+
+   assert(snapshot != NULL);
+   assert(set != NULL);
+
+   SCIP_CALL( SCIPgetVarsData(set->scip, &vars, &nvars, NULL, NULL, NULL, NULL) );
+
+   SCIP_ALLOC( BMSallocMemory(snapshot) );
+   (*snapshot)->nvars = nvars;
+   (*snapshot)->data = NULL;
+   (*snapshot)->heur = heur;
+   (*snapshot)->interrupted = FALSE;
+   SCIP_ALLOC( BMSduplicateMemoryArray(&(*snapshot)->vars, vars, MAX(nvars, 1)) );
+   SCIP_CALL( SCIPtpiInitLock(&(*snapshot)->lock) );
+
+   for( v = 0; v < nvars; ++v )
+   {
+      SCIP_CALL( SCIPcaptureVar(set->scip, vars[v]) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** releases the variables of a snapshot and frees it */
+static
+SCIP_RETCODE heurSnapshotFree(
+   SCIP_HEURSNAPSHOT**   snapshot,           /**< pointer to the snapshot */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   int v;
+
+   assert(snapshot != NULL);
+   assert(*snapshot != NULL);
+   assert((*snapshot)->data == NULL);
+
+   for( v = 0; v < (*snapshot)->nvars; ++v )
+   {
+      SCIP_CALL( SCIPreleaseVar(set->scip, &(*snapshot)->vars[v]) );
+   }
+
+   SCIPtpiDestroyLock(&(*snapshot)->lock);
+   BMSfreeMemoryArray(&(*snapshot)->vars);
+   BMSfreeMemory(snapshot);
+
+   return SCIP_OKAY;
+}
+
+/** job function that runs the asynchronous execution method of a primal heuristic */
+static
+SCIP_RETCODE heurAsyncJob(
+   void*                 args                /**< snapshot of the primal heuristic */
+   )
+{
+   SCIP_HEURSNAPSHOT* snapshot = (SCIP_HEURSNAPSHOT*)args;
+
+   assert(snapshot != NULL);
+   assert(snapshot->heur != NULL);
+   assert(snapshot->heur->heurasyncexec != NULL);
+
+   return snapshot->heur->heurasyncexec(snapshot->heur, snapshot);
+}
+
+/** takes a snapshot, lets the heuristic prepare its job, and starts the job on a thread of its own */
+static
+SCIP_RETCODE heurStartAsync(
+   SCIP_HEUR*            heur,               /**< primal heuristic */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_RESULT*          result              /**< pointer to store the result */
+   )
+{
+   SCIP_RETCODE retcode;
+   SCIP_Bool run;
+
+   assert(heur->jobbatch == NULL);
+   assert(heur->snapshot == NULL);
+
+   *result = SCIP_DIDNOTRUN;
+
+   SCIP_CALL( heurSnapshotCreate(&heur->snapshot, heur, set) );
+
+   run = FALSE;
+   SCIP_CALL( heur->heurasyncprepare(set->scip, heur, heur->snapshot, &run) );
+
+   if( !run )
+   {
+      SCIP_CALL( heurSnapshotFree(&heur->snapshot, set) );
+      return SCIP_OKAY;
+   }
+
+   SCIPsetDebugMsg(set, "starting asynchronous job of primal heuristic <%s>\n", heur->name);
+
+   /* the snapshot pointer lives in the heuristic and stays valid until the job is collected */
+   retcode = SCIPtpiStartJobBatch(&heur->jobbatch, heurAsyncJob, (void**)&heur->snapshot, 1, 1);
+
+   /* if the job could not be started, the heuristic frees its job data and the snapshot is freed */
+   if( retcode != SCIP_OKAY )
+   {
+      heur->jobbatch = NULL;
+      SCIP_CALL( heur->heurasynccollect(set->scip, heur, heur->snapshot, TRUE) );
+      SCIP_CALL( heurSnapshotFree(&heur->snapshot, set) );
+
+      return retcode;
+   }
+
+   *result = SCIP_DIDNOTFIND;
+
+   return SCIP_OKAY;
+}
+
+/** returns whether the asynchronous job of the primal heuristic has finished and its results can be collected */
+SCIP_Bool SCIPheurIsAsyncJobFinished(
+   SCIP_HEUR*            heur                /**< primal heuristic */
+   )
+{
+   assert(heur != NULL);
+
+   return heur->jobbatch != NULL && SCIPtpiIsJobBatchFinished(heur->jobbatch);
+}
+
+/** waits for the asynchronous job of the primal heuristic, passes its results to SCIP unless they should be
+ *  discarded, and frees the job; a job whose results are discarded anyway is interrupted before waiting for it
+ */
+SCIP_RETCODE SCIPheurCollectAsync(
+   SCIP_HEUR*            heur,               /**< primal heuristic */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_PRIMAL*          primal,             /**< primal data, or NULL if the results are discarded */
+   SCIP_Bool             discard             /**< should the results of the job be discarded? */
+   )
+{
+   SCIP_Longint oldnsolsfound;
+   SCIP_Longint oldnbestsolsfound;
+   SCIP_RETCODE retcode;
+
+   assert(heur != NULL);
+   assert(heur->jobbatch != NULL);
+   assert(heur->snapshot != NULL);
+   assert(heur->heurasynccollect != NULL);
+   assert(primal != NULL || discard);
+
+   if( discard )
+   {
+      SCIP_CALL( SCIPtpiAcquireLock(&heur->snapshot->lock) );
+      heur->snapshot->interrupted = TRUE;
+      SCIP_CALL( SCIPtpiReleaseLock(&heur->snapshot->lock) );
+   }
+
+   retcode = SCIPtpiFinishJobBatch(&heur->jobbatch);
+
+   /* errors of the job should not kill the overall solving process */
+   if( retcode != SCIP_OKAY )
+   {
+      SCIPmessagePrintWarning(SCIPgetMessagehdlr(set->scip),
+         "asynchronous job of primal heuristic <%s> terminated with code <%d>\n", heur->name, retcode);
+      discard = TRUE;
+   }
+
+   /* the solutions of the job refer to the variables of the snapshot */
+   discard = discard || SCIPgetNVars(set->scip) != heur->snapshot->nvars;
+
+   oldnsolsfound = primal != NULL ? primal->nsolsfound : 0;
+   oldnbestsolsfound = primal != NULL ? primal->nbestsolsfound : 0;
+
+   SCIPclockStart(heur->heurclock, set);
+
+   SCIP_CALL( heur->heurasynccollect(set->scip, heur, heur->snapshot, discard) );
+
+   SCIPclockStop(heur->heurclock, set);
+
+   if( primal != NULL )
+   {
+      heur->nsolsfound += primal->nsolsfound - oldnsolsfound;
+      heur->nbestsolsfound += primal->nbestsolsfound - oldnbestsolsfound;
+   }
+
+   SCIP_CALL( heurSnapshotFree(&heur->snapshot, set) );
+
+   return SCIP_OKAY;
+}
+
 /** calls execution method of primal heuristic */
 SCIP_RETCODE SCIPheurExec(
    SCIP_HEUR*            heur,               /**< primal heuristic */
@@ -1287,8 +1491,18 @@ SCIP_RETCODE SCIPheurExec(
       /* start timing */
       SCIPclockStart(heur->heurclock, set);
 
-      /* call external method */
-      SCIP_CALL( heur->heurexec(set->scip, heur, heurtiming, nodeinfeasible, result) );
+      /* call external method, or start the asynchronous job of the heuristic during the tree search */
+      if( heur->async && heur->heurasyncexec != NULL && SCIPgetStage(set->scip) == SCIP_STAGE_SOLVING )
+      {
+         if( heur->jobbatch == NULL && !nodeinfeasible )
+         {
+            SCIP_CALL( heurStartAsync(heur, set, result) );
+         }
+      }
+      else
+      {
+         SCIP_CALL( heur->heurexec(set->scip, heur, heurtiming, nodeinfeasible, result) );
+      }
 
       /* stop timing */
       SCIPclockStop(heur->heurclock, set);
@@ -1591,6 +1805,100 @@ SCIP_Bool SCIPheurIsInitialized(
    return heur->initialized;
 }
 
+/** sets the callbacks of an asynchronous primal heuristic and adds the parameter to run it asynchronously */
+SCIP_RETCODE SCIPheurSetAsync(
+   SCIP_HEUR*            heur,               /**< primal heuristic */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
+   BMS_BLKMEM*           blkmem,             /**< block memory for parameter settings */
+   SCIP_DECL_HEURASYNCPREPARE((*heurasyncprepare)), /**< preparation method of asynchronous heuristic */
+   SCIP_DECL_HEURASYNCEXEC((*heurasyncexec)), /**< asynchronous execution method of heuristic */
+   SCIP_DECL_HEURASYNCCOLLECT((*heurasynccollect)) /**< collection method of asynchronous heuristic */
+   )
+{
+   char paramname[SCIP_MAXSTRLEN];
+   char paramdesc[SCIP_MAXSTRLEN];
+
+   assert(heur != NULL);
+   assert(heurasyncprepare != NULL);
+   assert(heurasyncexec != NULL);
+   assert(heurasynccollect != NULL);
+   assert(heur->heurasyncexec == NULL);
+
+   heur->heurasyncprepare = heurasyncprepare;
+   heur->heurasyncexec = heurasyncexec;
+   heur->heurasynccollect = heurasynccollect;
+
+   (void) SCIPsnprintf(paramname, SCIP_MAXSTRLEN, "heuristics/%s/async", heur->name);
+   (void) SCIPsnprintf(paramdesc, SCIP_MAXSTRLEN, "should primal heuristic <%s> run asynchronously on a thread of its "
+      "own during the tree search, on a job that is set up when it is called and collected in a later call?", heur->name);
+   SCIP_CALL( SCIPsetAddBoolParam(set, messagehdlr, blkmem, paramname, paramdesc,
+                  &heur->async, FALSE, FALSE, NULL, NULL) );
+
+   return SCIP_OKAY;
+}
+
+/** gets the number of variables of a heuristic snapshot */
+int SCIPheurSnapshotGetNVars(
+   SCIP_HEURSNAPSHOT*    snapshot            /**< snapshot of an asynchronous heuristic */
+   )
+{
+   assert(snapshot != NULL);
+
+   return snapshot->nvars;
+}
+
+/** gets the problem variables of a heuristic snapshot */
+SCIP_VAR** SCIPheurSnapshotGetVars(
+   SCIP_HEURSNAPSHOT*    snapshot            /**< snapshot of an asynchronous heuristic */
+   )
+{
+   assert(snapshot != NULL);
+
+   return snapshot->vars;
+}
+
+/** returns whether the job of a heuristic snapshot should stop as soon as possible, because its results will be
+ *  discarded; can be called from the thread of the job
+ */
+SCIP_Bool SCIPheurSnapshotIsInterrupted(
+   SCIP_HEURSNAPSHOT*    snapshot            /**< snapshot of an asynchronous heuristic */
+   )
+{
+   SCIP_Bool interrupted;
+
+   assert(snapshot != NULL);
+
+   SCIP_CALL_ABORT( SCIPtpiAcquireLock(&snapshot->lock) );
+   interrupted = snapshot->interrupted;
+   SCIP_CALL_ABORT( SCIPtpiReleaseLock(&snapshot->lock) );
+
+   return interrupted;
+}
+
+/** gets the job data of a heuristic snapshot */
+void* SCIPheurSnapshotGetData(
+   SCIP_HEURSNAPSHOT*    snapshot            /**< snapshot of an asynchronous heuristic */
+   )
+{
+   assert(snapshot != NULL);
+
+   return snapshot->data;
+}
+
+/** sets the job data of a heuristic snapshot; the heuristic has to free the data in its collection method and reset
+ *  it to NULL
+ */
+void SCIPheurSnapshotSetData(
+   SCIP_HEURSNAPSHOT*    snapshot,           /**< snapshot of an asynchronous heuristic */
+   void*                 data                /**< job data */
+   )
+{
+   assert(snapshot != NULL);
+
+   snapshot->data = data;
+}
+
 /** enables or disables all clocks of \p heur, depending on the value of the flag */
 void SCIPheurEnableOrDisableClocks(
    SCIP_HEUR*            heur,               /**< the heuristic for which all clocks should be enabled or disabled */
@@ -200,6 +200,21 @@ SCIP_RETCODE SCIPheurExec(
    SCIP_RESULT*          result              /**< pointer to store the result of the callback method */
    );
 
+/** returns whether the asynchronous job of the primal heuristic has finished and its results can be collected */
+SCIP_Bool SCIPheurIsAsyncJobFinished(
+   SCIP_HEUR*            heur                /**< primal heuristic */
+   );
+
+/** waits for the asynchronous job of the primal heuristic, passes its results to SCIP unless they should be
+ *  discarded, and frees the job
+ */
+SCIP_RETCODE SCIPheurCollectAsync(
+   SCIP_HEUR*            heur,               /**< primal heuristic */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_PRIMAL*          primal,             /**< primal data */
+   SCIP_Bool             discard             /**< should the results of the job be discarded? */
+   );
+
 /** sets priority of primal heuristic */
 void SCIPheurSetPriority(
    SCIP_HEUR*            heur,               /**< primal heuristic */
@@ -243,6 +258,17 @@ void SCIPheurSetExitsol(
    SCIP_DECL_HEUREXITSOL ((*heurexitsol))    /**< solving process deinitialization callback of primal heuristic */
    );
 
+/** sets the callbacks of an asynchronous primal heuristic and adds the parameter to run it asynchronously */
+SCIP_RETCODE SCIPheurSetAsync(
+   SCIP_HEUR*            heur,               /**< primal heuristic */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
+   BMS_BLKMEM*           blkmem,             /**< block memory for parameter settings */
+   SCIP_DECL_HEURASYNCPREPARE((*heurasyncprepare)), /**< preparation method of asynchronous heuristic */
+   SCIP_DECL_HEURASYNCEXEC((*heurasyncexec)), /**< asynchronous execution method of heuristic */
+   SCIP_DECL_HEURASYNCCOLLECT((*heurasynccollect)) /**< collection method of asynchronous heuristic */
+   );
+
 /** enables or disables all clocks of \p heur, depending on the value of the flag */
 void SCIPheurEnableOrDisableClocks(
    SCIP_HEUR*            heur,               /**< the heuristic for which all clocks should be enabled or disabled */
@@ -58,6 +58,7 @@
 #include "scip/scip_timing.h"
 #include "scip/scip_tree.h"
 #include "scip/scip_var.h"
+#include "tpi/tpi.h"
 #include <string.h>
 
 #if !defined(_WIN32) && !defined(_WIN64)
@@ -135,6 +136,8 @@
 #define DEFAULT_USESUBSCIPHEURS  FALSE /**< should the heuristic activate other sub-SCIP heuristics during its search?  */
 #define DEFAULT_COPYCUTS         FALSE /**< should cutting planes be copied to the sub-SCIP? */
 #define DEFAULT_REWARDFILENAME   "-"   /**< file name to store all rewards and the selection of the bandit */
+#define DEFAULT_MAXASYNCJOBS     0     /**< maximum number of neighborhoods that are solved asynchronously on threads of
+                                         *  their own while the tree search continues (0: solve synchronously) */
 
 /* individual random seeds */
 #define DEFAULT_SEED 113
@@ -196,6 +199,7 @@
 #define EVENTHDLR_NAME         "Alns"
 #define EVENTHDLR_DESC         "LP event handler for " HEUR_NAME " heuristic"
 #define SCIP_EVENTTYPE_ALNS (SCIP_EVENTTYPE_LPSOLVED | SCIP_EVENTTYPE_SOLFOUND | SCIP_EVENTTYPE_BESTSOLFOUND)
+#define SCIP_EVENTTYPE_ALNSASYNC (SCIP_EVENTTYPE_LPSOLVED | SCIP_EVENTTYPE_NODESOLVED | SCIP_EVENTTYPE_PRESOLVEROUND)
 
 /* properties of the ALNS neighborhood statistics table */
 #define TABLE_NAME_NEIGHBORHOOD                  "neighborhood"
@@ -232,6 +236,8 @@ typedef struct Nh NH;             /**< neighborhood data structure */
  */
 typedef struct VarPrio VARPRIO;
 
+typedef struct AlnsJob ALNS_JOB;  /**< neighborhood whose sub-SCIP is solved asynchronously */
+
 /** callback to collect variable fixings of neighborhood */
  #define DECL_VARFIXINGS(x) SCIP_RETCODE x ( \
    SCIP*                 scip,               /**< SCIP data structure */                     \
@@ -441,6 +447,16 @@ struct SCIP_HeurData
    SCIP_Bool             scalebyeffort;      /**< should the reward be scaled by the effort? */
    SCIP_Bool             copycuts;           /**< should cutting planes be copied to the sub-SCIP? */
    SCIP_Bool             uselocalredcost;    /**< should local reduced costs be used for generic (un)fixing? */
+   ALNS_JOB**            asyncjobs;          /**< neighborhoods of the running batch of asynchronous jobs */
+   SCIP_JOBBATCH*        jobbatch;           /**< running batch of asynchronous jobs, or NULL */
+   int                   nasyncjobs;         /**< number of neighborhoods in the running batch */
+   int                   asyncjobssize;      /**< size of the asyncjobs array */
+   int                   asyncnruns;         /**< run of the main SCIP in which the running batch was started */
+   int                   asyncnvars;         /**< number of variables of the main SCIP when the running batch was started */
+   SCIP_LOCK             asynclock;          /**< lock to protect the interruption flag of the running batch */
+   SCIP_Bool             asyncinterrupted;   /**< should the sub-SCIPs of the running batch stop as soon as possible? */
+   int                   maxasyncjobs;       /**< maximum number of neighborhoods that are solved asynchronously
+                                              *   (0: solve synchronously) */
 };
 
 /** event handler data */
@@ -453,6 +469,7 @@ struct SCIP_EventData
    SCIP_Real             lplimfac;           /**< limit fraction of LPs per node to interrupt sub-SCIP */
    NH_STATS*             runstats;           /**< run statistics for the current neighborhood */
    SCIP_Bool             allrewardsmode;     /**< true if solutions should only be checked for reward comparisons */
+   SCIP_Bool             async;              /**< is the sub-SCIP solved asynchronously on a thread of its own? */
 };
 
 /** represents limits for the sub-SCIP solving process */
@@ -466,6 +483,19 @@ struct SolveLimits
 
 typedef struct SolveLimits SOLVELIMITS;
 
+/** a neighborhood whose sub-SCIP is presolved and solved on a thread of its own */
+struct AlnsJob
+{
+   SCIP*                 subscip;            /**< sub-SCIP of the neighborhood */
+   SCIP_VAR**            subvars;            /**< sub-SCIP variables in the order of the main SCIP variables */
+   SCIP_EVENTDATA        eventdata;          /**< event data to interrupt the sub-SCIP and to transfer its solution */
+   NH_STATS              runstats;           /**< statistics of the run */
+   SCIP_Real             targetfixingrate;   /**< target fixing rate of the neighborhood when the job was started */
+   SCIP_RETCODE          retcode;            /**< return code of presolving and solving the sub-SCIP */
+   int                   nvars;              /**< length of the subvars array */
+   int                   neighborhoodidx;    /**< index of the neighborhood */
+};
+
 /** data structure that can be used for variable prioritization for additional fixings */
 struct VarPrio
 {
@@ -963,6 +993,23 @@ SCIP_RETCODE transferSolution(
 }
 
 
+/** returns whether the sub-SCIPs of the running batch of asynchronous jobs should stop; called from the jobs' threads */
+static
+SCIP_Bool isAsyncInterrupted(
+   SCIP_HEURDATA*        heurdata            /**< heuristic data of the ALNS heuristic */
+   )
+{
+   SCIP_Bool interrupted;
+
+   assert(heurdata != NULL);
+
+   SCIP_CALL_ABORT( SCIPtpiAcquireLock(&heurdata->asynclock) );
+   interrupted = heurdata->asyncinterrupted;
+   SCIP_CALL_ABORT( SCIPtpiReleaseLock(&heurdata->asynclock) );
+
+   return interrupted;
+}
+
 /* ---------------- Callback methods of event handler ---------------- */
 
 /** execution callback of the event handler
@@ -976,9 +1023,18 @@ SCIP_DECL_EVENTEXEC(eventExecAlns)
    assert(eventdata != NULL);
    assert(strcmp(SCIPeventhdlrGetName(eventhdlr), EVENTHDLR_NAME) == 0);
    assert(event != NULL);
-   assert(SCIPeventGetType(event) & SCIP_EVENTTYPE_ALNS);
+   assert(SCIPeventGetType(event) & (eventdata->async ? SCIP_EVENTTYPE_ALNSASYNC : SCIP_EVENTTYPE_ALNS));
    assert(eventdata != NULL);
 
+   /* an asynchronously solved sub-SCIP stops as soon as the main SCIP does not need its results anymore */
+   if( eventdata->async && isAsyncInterrupted(SCIPheurGetData(eventdata->heur)) )
+   {
+      SCIPdebugMsg(scip, "interrupt asynchronous sub-SCIP\n");
+      SCIP_CALL( SCIPinterruptSolve(scip) );
+
+      return SCIP_OKAY;
+   }
+
    /* treat the different atomic events */
    switch( SCIPeventGetType(event) )
    {
@@ -2271,6 +2327,321 @@ SCIP_RETCODE setupSubScip(
    return SCIP_OKAY;
 }
 
+/** job function that presolves and solves the sub-SCIP of an asynchronously solved neighborhood
+ *
+ *  The job only works on its own sub-SCIP; solutions are transferred into the main SCIP when the batch is collected.
+ */
+static
+SCIP_RETCODE solveAsyncJob(
+   void*                 args                /**< the ALNS job */
+   )
+{
+   ALNS_JOB* job;
+   SCIP_Real allfixingrate;
+
+   job = (ALNS_JOB*)args;
+   assert(job != NULL);
+
+   /* the results are not needed anymore; the interruption flag is checked again by the event handler, because
+    * presolving and solving reset the interruption of the sub-SCIP when they start
+    */
+   if( isAsyncInterrupted(SCIPheurGetData(job->eventdata.heur)) )
+      return SCIP_OKAY;
+
+   job->retcode = SCIPpresolve(job->subscip);
+   if( job->retcode != SCIP_OKAY )
+      return job->retcode;
+
+   if( isAsyncInterrupted(SCIPheurGetData(job->eventdata.heur)) )
+      return SCIP_OKAY;
+
+   /* was presolving successful enough regarding fixings? otherwise, do not solve the sub-SCIP */
+   allfixingrate = (SCIPgetNOrigVars(job->subscip) - SCIPgetNVars(job->subscip)) / (SCIP_Real)SCIPgetNOrigVars(job->subscip);
+   allfixingrate = MAX(allfixingrate, 0.0);
+
+   if( allfixingrate >= job->targetfixingrate / 2.0 )
+      job->retcode = SCIPsolve(job->subscip);
+
+   return job->retcode;
+}
+
+/** frees an asynchronous job together with its sub-SCIP */
+static
+SCIP_RETCODE freeAsyncJob(
+   SCIP*                 scip,               /**< SCIP data structure */
+   ALNS_JOB**            job                 /**< pointer to the job */
+   )
+{
+   assert(job != NULL);
+   assert(*job != NULL);
+
+   if( (*job)->subscip != NULL )
+   {
+      SCIP_CALL( SCIPfree(&(*job)->subscip) );
+   }
+   SCIPfreeBlockMemoryArray(scip, &(*job)->subvars, (*job)->nvars);
+   SCIPfreeBlockMemory(scip, job);
+
+   return SCIP_OKAY;
+}
+
+/** sets up the sub-SCIPs of several neighborhoods and starts solving them on threads of their own
+ *
+ *  The bandit algorithm selects the first neighborhood; the remaining slots are filled with the next active
+ *  neighborhoods in round robin order, such that one batch never contains the same neighborhood twice.
+ */
+static
+SCIP_RETCODE startAsyncJobs(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEUR*            heur,               /**< the ALNS heuristic */
+   SCIP_HEURDATA*        heurdata,           /**< heuristic data of the ALNS heuristic */
+   SOLVELIMITS*          solvelimits,        /**< limits for all sub-SCIPs */
+   SCIP_RESULT*          result              /**< pointer to store the result */
+   )
+{
+   SCIP_VAR** vars;
+   SCIP_VAR** varbuf;
+   SCIP_Real* valbuf;
+   SOLVELIMITS joblimits;
+   int nvars;
+   int banditidx;
+   int k;
+
+   assert(heurdata->jobbatch == NULL);
+   assert(heurdata->maxasyncjobs > 0);
+
+   SCIP_CALL( SCIPgetVarsData(scip, &vars, &nvars, NULL, NULL, NULL, NULL) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &varbuf, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &valbuf, nvars) );
+
+   heurdata->asyncjobssize = heurdata->maxasyncjobs;
+   heurdata->nasyncjobs = 0;
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &heurdata->asyncjobs, heurdata->asyncjobssize) );
+
+   /* the sub-SCIPs run at the same time and have to share the memory */
+   joblimits = *solvelimits;
+   joblimits.memorylimit /= heurdata->maxasyncjobs;
+
+   SCIP_CALL( selectNeighborhood(scip, heurdata, &banditidx) );
+
+   for( k = 0; k < heurdata->nactiveneighborhoods && heurdata->nasyncjobs < heurdata->maxasyncjobs; ++k )
+   {
+      SCIP_HASHMAP* varmapf;
+      SCIP_EVENTHDLR* eventhdlr;
+      ALNS_JOB* job;
+      NH* neighborhood;
+      char probnamesuffix[SCIP_MAXSTRLEN];
+      SCIP_RESULT fixresult;
+      SCIP_Bool success;
+      int neighborhoodidx;
+      int nfixings;
+      int ndomchgs;
+      int nchgobjs;
+      int naddedconss;
+
+      neighborhoodidx = (banditidx + k) % heurdata->nactiveneighborhoods;
+      neighborhood = heurdata->neighborhoods[neighborhoodidx];
+
+      SCIP_CALL( SCIPstartClock(scip, neighborhood->stats.setupclock) );
+
+      /* determine variable fixings and objective coefficients of this neighborhood */
+      SCIP_CALL( neighborhoodFixVariables(scip, heurdata, neighborhood, varbuf, valbuf, &nfixings, &fixresult) );
+
+      /* asynchronous neighborhoods are not delayed; a neighborhood that cannot run is penalized as in synchronous mode */
+      if( fixresult != SCIP_SUCCESS )
+      {
+         SCIP_CALL( SCIPstopClock(scip, neighborhood->stats.setupclock) );
+
+         if( fixresult == SCIP_DIDNOTRUN )
+         {
+            SCIP_CALL( updateBanditAlgorithm(scip, heurdata, 0.0, neighborhoodidx) );
+         }
+
+         continue;
+      }
+
+      SCIP_CALL( SCIPallocBlockMemory(scip, &job) );
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &job->subvars, nvars) );
+      job->nvars = nvars;
+      job->neighborhoodidx = neighborhoodidx;
+      job->targetfixingrate = neighborhood->fixingrate.targetfixingrate;
+      job->retcode = SCIP_OKAY;
+      initRunStats(scip, &job->runstats);
+      job->runstats.nfixings = nfixings;
+
+      SCIP_CALL( SCIPcreate(&job->subscip) );
+      SCIP_CALL( SCIPhashmapCreate(&varmapf, SCIPblkmem(scip), nvars) );
+      (void) SCIPsnprintf(probnamesuffix, SCIP_MAXSTRLEN, "alns_%s", neighborhood->name);
+
+      SCIP_CALL( SCIPcopyLargeNeighborhoodSearchAsync(scip, job->subscip, varmapf, probnamesuffix, varbuf, valbuf,
+            nfixings, FALSE, heurdata->copycuts, &success, NULL) );
+
+      SCIPhashmapGetImages(varmapf, (void**)vars, (void**)job->subvars, nvars);
+      SCIPhashmapFree(&varmapf);
+
+      /* let the neighborhood add additional constraints, or restrict domains */
+      if( success )
+      {
+         SCIP_CALL( neighborhoodChangeSubscip(scip, job->subscip, neighborhood, job->subvars, &ndomchgs, &nchgobjs,
+               &naddedconss, &success) );
+      }
+
+      if( ! success )
+      {
+         SCIP_CALL( SCIPstopClock(scip, neighborhood->stats.setupclock) );
+         SCIP_CALL( freeAsyncJob(scip, &job) );
+
+         continue;
+      }
+
+      neighborhood->stats.nfixings += nfixings;
+
+      SCIP_CALL( setupSubScip(scip, job->subscip, job->subvars, &joblimits, heur, nchgobjs > 0) );
+
+      /* CPU time of the process is not a meaningful limit for a sub-SCIP that runs on a thread of its own */
+      SCIP_CALL( SCIPsetIntParam(job->subscip, "timing/clocktype", (int)SCIP_CLOCKTYPE_WALL) );
+
+      job->eventdata.nodelimit = joblimits.nodelimit;
+      job->eventdata.lplimfac = heurdata->lplimfac;
+      job->eventdata.heur = heur;
+      job->eventdata.sourcescip = scip;
+      job->eventdata.subvars = job->subvars;
+      job->eventdata.runstats = &job->runstats;
+      job->eventdata.allrewardsmode = FALSE;
+      job->eventdata.async = TRUE;
+
+      /* the event handler only interrupts the sub-SCIP; solutions must not be transferred from the worker thread */
+      SCIP_CALL( SCIPincludeEventhdlrBasic(job->subscip, &eventhdlr, EVENTHDLR_NAME, EVENTHDLR_DESC, eventExecAlns, NULL) );
+      SCIP_CALL( SCIPtransformProb(job->subscip) );
+      SCIP_CALL( SCIPcatchEvent(job->subscip, SCIP_EVENTTYPE_ALNSASYNC, eventhdlr, &job->eventdata, NULL) );
+
+      SCIP_CALL( SCIPstopClock(scip, neighborhood->stats.setupclock) );
+
+      heurdata->asyncjobs[heurdata->nasyncjobs++] = job;
+   }
+
+   SCIPfreeBufferArray(scip, &valbuf);
+   SCIPfreeBufferArray(scip, &varbuf);
+
+   if( heurdata->nasyncjobs == 0 )
+   {
+      SCIPfreeBlockMemoryArray(scip, &heurdata->asyncjobs, heurdata->asyncjobssize);
+      heurdata->asyncjobssize = 0;
+
+      return SCIP_OKAY;
+   }
+
+   heurdata->asyncnruns = SCIPgetNRuns(scip);
+   heurdata->asyncnvars = nvars;
+   heurdata->asyncinterrupted = FALSE;
+   SCIP_CALL( SCIPtpiInitLock(&heurdata->asynclock) );
+
+   SCIPdebugMsg(scip, "Starting %d asynchronous neighborhoods\n", heurdata->nasyncjobs);
+
+   SCIP_CALL( SCIPtpiStartJobBatch(&heurdata->jobbatch, solveAsyncJob, (void**)heurdata->asyncjobs,
+         heurdata->nasyncjobs, heurdata->nasyncjobs) );
+
+   *result = SCIP_DIDNOTFIND;
+
+   return SCIP_OKAY;
+}
+
+/** waits for the running batch of asynchronous jobs, transfers the best solution of each sub-SCIP, and updates the
+ *  neighborhood statistics and the bandit algorithm
+ *
+ *  The results are discarded if requested, or if the variables of the main SCIP changed since the batch was started.
+ *  If they are discarded on request, the sub-SCIPs are interrupted before waiting for them.
+ */
+static
+SCIP_RETCODE collectAsyncJobs(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEUR*            heur,               /**< the ALNS heuristic */
+   SCIP_HEURDATA*        heurdata,           /**< heuristic data of the ALNS heuristic */
+   SCIP_Bool             discard,            /**< should the results be discarded? */
+   SCIP_RESULT*          result              /**< pointer to store the result, or NULL */
+   )
+{
+   SCIP_RETCODE retcode;
+   int j;
+
+   assert(heurdata->jobbatch != NULL);
+
+   /* results that are discarded anyway are not worth waiting for */
+   if( discard )
+   {
+      SCIP_CALL( SCIPtpiAcquireLock(&heurdata->asynclock) );
+      heurdata->asyncinterrupted = TRUE;
+      SCIP_CALL( SCIPtpiReleaseLock(&heurdata->asynclock) );
+   }
+
+   retcode = SCIPtpiFinishJobBatch(&heurdata->jobbatch);
+   if( retcode != SCIP_OKAY )
+   {
+      SCIPwarningMessage(scip, "Error while solving subproblems in ALNS heuristic; sub-SCIP terminated with code <%d>\n", retcode);
+   }
+   SCIPtpiDestroyLock(&heurdata->asynclock);
+
+   discard = discard || heurdata->asyncnruns != SCIPgetNRuns(scip) || heurdata->asyncnvars != SCIPgetNVars(scip);
+
+   for( j = 0; j < heurdata->nasyncjobs; ++j )
+   {
+      ALNS_JOB* job = heurdata->asyncjobs[j];
+
+      if( ! discard )
+      {
+         NH* neighborhood;
+         SCIP_STATUS subscipstatus;
+         SCIP_Real reward;
+
+         neighborhood = heurdata->neighborhoods[job->neighborhoodidx];
+         subscipstatus = SCIP_STATUS_UNKNOWN;
+
+         if( job->retcode == SCIP_OKAY )
+         {
+            if( SCIPgetNSols(job->subscip) > 0 )
+            {
+               SCIP_CALL( transferSolution(job->subscip, &job->eventdata) );
+            }
+
+            updateRunStats(&job->runstats, job->subscip);
+            subscipstatus = SCIPgetStatus(job->subscip);
+         }
+
+         if( result != NULL && job->runstats.nbestsolsfound > 0 )
+            *result = SCIP_FOUNDSOL;
+
+         SCIP_CALL( getReward(scip, heurdata, &job->runstats, &reward) );
+
+         /* decrease the number of neighborhoods that have not been initialized */
+         if( neighborhood->stats.nruns == 0 )
+            --heurdata->ninitneighborhoods;
+
+         heurdata->usednodes += job->runstats.usednodes;
+
+         updateNeighborhoodStats(&job->runstats, neighborhood, subscipstatus);
+
+         if( heurdata->adjustfixingrate )
+            updateFixingRate(neighborhood, subscipstatus, &job->runstats);
+
+         if( heurdata->adjustminimprove )
+            updateMinimumImprovement(heurdata, subscipstatus, &job->runstats);
+
+         if( heurdata->adjusttargetnodes && SCIPheurGetNCalls(heur) >= heurdata->nactiveneighborhoods )
+            updateTargetNodeLimit(heurdata, &job->runstats, subscipstatus);
+
+         SCIP_CALL( updateBanditAlgorithm(scip, heurdata, reward, job->neighborhoodidx) );
+      }
+
+      SCIP_CALL( freeAsyncJob(scip, &job) );
+   }
+
+   SCIPfreeBlockMemoryArray(scip, &heurdata->asyncjobs, heurdata->asyncjobssize);
+   heurdata->asyncjobssize = 0;
+   heurdata->nasyncjobs = 0;
+
+   return SCIP_OKAY;
+}
+
 /** execution method of primal heuristic */
 static
 SCIP_DECL_HEUREXEC(heurExecAlns)
@@ -2303,6 +2674,15 @@ SCIP_DECL_HEUREXEC(heurExecAlns)
 
    *result = SCIP_DIDNOTRUN;
 
+   /* the tree search continues while asynchronous neighborhoods are solved; collect them once all have finished */
+   if( heurdata->jobbatch != NULL )
+   {
+      if( ! SCIPtpiIsJobBatchFinished(heurdata->jobbatch) )
+         return SCIP_OKAY;
+
+      SCIP_CALL( collectAsyncJobs(scip, heur, heurdata, FALSE, result) );
+   }
+
    if( heurdata->nactiveneighborhoods == 0 )
       return SCIP_OKAY;
 
@@ -2332,6 +2712,19 @@ SCIP_DECL_HEUREXEC(heurExecAlns)
 
    allrewardsmode = heurdata->rewardfile != NULL;
 
+   /* in asynchronous mode, start a new batch of neighborhoods and return; the all rewards mode is always synchronous */
+   if( heurdata->maxasyncjobs > 0 && ! allrewardsmode )
+   {
+      SCIP_RESULT startresult = SCIP_DIDNOTRUN;
+
+      SCIP_CALL( startAsyncJobs(scip, heur, heurdata, &solvelimits, &startresult) );
+
+      if( *result != SCIP_FOUNDSOL )
+         *result = startresult;
+
+      return SCIP_OKAY;
+   }
+
    /* apply some other rules for a fair all rewards mode; in normal execution mode, neighborhoods are iterated through */
    if( allrewardsmode )
    {
@@ -2529,6 +2922,7 @@ SCIP_DECL_HEUREXEC(heurExecAlns)
       eventdata.subvars = subvars;
       eventdata.runstats = &runstats[neighborhoodidx];
       eventdata.allrewardsmode = allrewardsmode;
+      eventdata.async = FALSE;
 
       /* include an event handler to transfer solutions into the main SCIP */
       SCIP_CALL( SCIPincludeEventhdlrBasic(subscip, &eventhdlr, EVENTHDLR_NAME, EVENTHDLR_DESC, eventExecAlns, NULL) );
@@ -3825,6 +4219,27 @@ SCIP_DECL_HEUREXIT(heurExitAlns)
    return SCIP_OKAY;
 }
 
+/** solving process deinitialization method of primal heuristic (called before branch and bound process data is freed) */
+static
+SCIP_DECL_HEUREXITSOL(heurExitsolAlns)
+{  /*lint --e{715}*/
+   SCIP_HEURDATA* heurdata;
+
+   assert(scip != NULL);
+   assert(heur != NULL);
+
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+
+   /* interrupt asynchronous neighborhoods that are still running and discard their results */
+   if( heurdata->jobbatch != NULL )
+   {
+      SCIP_CALL( collectAsyncJobs(scip, heur, heurdata, TRUE, NULL) );
+   }
+
+   return SCIP_OKAY;
+}
+
 /** destructor of primal heuristic to free user data (called when SCIP is exiting) */
 static
 SCIP_DECL_HEURFREE(heurFreeAlns)
@@ -3912,6 +4327,7 @@ SCIP_RETCODE SCIPincludeHeurAlns(
    SCIP_CALL( SCIPsetHeurInit(scip, heur, heurInitAlns) );
    SCIP_CALL( SCIPsetHeurInitsol(scip, heur, heurInitsolAlns) );
    SCIP_CALL( SCIPsetHeurExit(scip, heur, heurExitAlns) );
+   SCIP_CALL( SCIPsetHeurExitsol(scip, heur, heurExitsolAlns) );
 
    /* add alns primal heuristic parameters */
    SCIP_CALL( SCIPaddLongintParam(scip, "heuristics/" HEUR_NAME "/maxnodes",
@@ -4050,6 +4466,11 @@ SCIP_RETCODE SCIPincludeHeurAlns(
             "should pseudo cost scores be used for variable priorization?",
             &heurdata->usepscost, TRUE, DEFAULT_USEPSCOST, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddIntParam(scip, "heuristics/" HEUR_NAME "/maxasyncjobs",
+         "maximum number of neighborhoods that are solved asynchronously on threads of their own while the tree search "
+         "continues (0: solve synchronously)",
+         &heurdata->maxasyncjobs, TRUE, DEFAULT_MAXASYNCJOBS, 0, NNEIGHBORHOODS, NULL, NULL) );
+
    assert(SCIPfindTable(scip, TABLE_NAME_NEIGHBORHOOD) == NULL);
    SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_NEIGHBORHOOD, TABLE_DESC_NEIGHBORHOOD, TRUE,
          NULL, NULL, NULL, NULL, NULL, NULL, tableOutputNeighborhood,
@@ -620,8 +620,7 @@ SCIP_RETCODE setupAndSolveSubscipCrossover(
 
    /* store copied variables in the order in which they appear in the main SCIP */
    SCIP_CALL( SCIPallocBufferArray(scip, &subvars, nvars) );
-   for( i = 0; i < nvars; i++ )
-     subvars[i] = (SCIP_VAR*) SCIPhashmapGetImage(varmapfw, vars[i]);
+   SCIPhashmapGetImages(varmapfw, (void**)vars, (void**)subvars, nvars);
 
    /* free hash map */
    SCIPhashmapFree(&varmapfw);
@@ -469,7 +469,6 @@ SCIP_RETCODE wrapperDins(
 
    SCIP_Bool success;
 
-   int i;
    int nsubsols;
 
    /* create the variable mapping hash map */
@@ -497,8 +496,7 @@ SCIP_RETCODE wrapperDins(
       SCIPgetNVars(subscip), SCIPgetNBinVars(subscip) , SCIPgetNIntVars(subscip) , SCIPgetNConss(subscip));
 
    /* store subproblem variables that correspond to original variables */
-   for( i = 0; i < nvars; i++ )
-      subvars[i] = (SCIP_VAR*) SCIPhashmapGetImage(varmapfw, vars[i]);
+   SCIPhashmapGetImages(varmapfw, (void**)vars, (void**)subvars, nvars);
 
    /* free hash map */
    SCIPhashmapFree(&varmapfw);
@@ -544,7 +544,6 @@ SCIP_RETCODE createNewSols(
    SCIP_VAR** vars;                          /* the original problem's variables                */
    int        nvars;
    SCIP_VAR** subvars;
-   int i;
 
    assert(scip != NULL);
    assert(subscip != NULL);
@@ -554,8 +553,7 @@ SCIP_RETCODE createNewSols(
 
    /* for copying a solution we need an explicit mapping */
    SCIP_CALL( SCIPallocBufferArray(scip, &subvars, nvars) );
-   for( i = 0; i < nvars; i++ )
-      subvars[i] = (SCIP_VAR*) SCIPhashmapGetImage(varmapfw, vars[i]);
+   SCIPhashmapGetImages(varmapfw, (void**)vars, (void**)subvars, nvars);
 
    SCIP_CALL( SCIPtranslateSubSols(scip, subscip, heur, subvars, success, NULL) );
 
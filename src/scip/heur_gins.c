@@ -2417,7 +2417,6 @@ SCIP_DECL_HEUREXEC(heurExecGins)
    SCIP_HASHMAP* varmapfw;                   /* mapping of SCIP variables to sub-SCIP variables */
 
    int nvars;                                /* number of original problem's variables */
-   int i;
    int nfixedvars;
    SOLVELIMITS solvelimits;
    SCIP_Bool runagain;
@@ -2520,8 +2519,7 @@ SCIP_DECL_HEUREXEC(heurExecGins)
       SCIP_CALL( SCIPcopyLargeNeighborhoodSearch(scip, subscip, varmapfw, "gins", fixedvars, fixedvals, nfixedvars,
             heurdata->uselprows, heurdata->copycuts, &success, NULL) );
 
-      for( i = 0; i < nvars; i++ )
-         subvars[i] = (SCIP_VAR*) SCIPhashmapGetImage(varmapfw, vars[i]);
+      SCIPhashmapGetImages(varmapfw, (void**)vars, (void**)subvars, nvars);
 
       /* free hash map */
       SCIPhashmapFree(&varmapfw);
@@ -333,7 +333,6 @@ SCIP_RETCODE setupAndSolveSubscipLocalbranching(
    SCIP_VAR** vars;
 
    int nvars;
-   int i;
 
    SCIP_Bool success;
 
@@ -377,8 +376,7 @@ SCIP_RETCODE setupAndSolveSubscipLocalbranching(
    }
 
    SCIP_CALL( SCIPallocBufferArray(scip, &subvars, nvars) );
-   for (i = 0; i < nvars; ++i)
-      subvars[i] = (SCIP_VAR*) SCIPhashmapGetImage(varmapfw, vars[i]);
+   SCIPhashmapGetImages(varmapfw, (void**)vars, (void**)subvars, nvars);
 
    /* free hash map */
    SCIPhashmapFree(&varmapfw);
@@ -23,6 +23,7 @@
 
 #include "blockmemshell/memory.h"
 #include "nlpi/exprinterpret.h"
+#include "nlpi/nlpioracle.h"
 #include "nlpi/pub_expr.h"
 #include "scip/heur_multistart.h"
 #include "scip/heur_subnlp.h"
@@ -43,6 +44,7 @@
 #include "scip/scip_randnumgen.h"
 #include "scip/scip_sol.h"
 #include "scip/scip_timing.h"
+#include "tpi/tpi.h"
 #include <string.h>
 
 
@@ -67,6 +69,8 @@
 #define DEFAULT_GRADLIMIT     5e+6           /**< default limit for gradient computations for all improvePoint() calls */
 #define DEFAULT_MAXNCLUSTER   3              /**< default maximum number of considered clusters per heuristic call */
 #define DEFAULT_ONLYNLPS      TRUE           /**< should the heuristic run only on continuous problems? */
+#define DEFAULT_NTHREADS      1              /**< default number of threads to improve points concurrently (1: improve
+                                              *   points sequentially) */
 
 #define MINFEAS               -1e+4          /**< minimum feasibility for a point; used for filtering and improving
                                               *   feasibility */
@@ -98,8 +102,34 @@ struct SCIP_HeurData
    SCIP_Real             gradlimit;          /**< limit for gradient computations for all improvePoint() calls (0 for no limit) */
    int                   maxncluster;        /**< maximum number of considered clusters per heuristic call */
    SCIP_Bool             onlynlps;           /**< should the heuristic run only on continuous problems? */
+   int                   nthreads;           /**< number of threads to improve points concurrently (1: improve points
+                                              *   sequentially) */
 };
 
+/** data of a worker that improves a subset of the random points on its own NLPI oracle */
+struct MultistartWorker
+{
+   SCIP*                 scip;               /**< SCIP data structure; only used for numerical comparisons */
+   SCIP_HEURDATA*        heurdata;           /**< heuristic data; only read */
+   BMS_BLKMEM*           blkmem;             /**< block memory of the oracle */
+   SCIP_NLPIORACLE*      oracle;             /**< NLPI oracle that contains the nonlinear rows as constraints */
+   SCIP_Real*            lbs;                /**< local lower bounds of the variables */
+   SCIP_Real*            ubs;                /**< local upper bounds of the variables */
+   SCIP_Real*            nlrowgradcosts;     /**< estimated costs for each gradient computation */
+   SCIP_Real*            points;             /**< values of the points of the worker, stored one after the other */
+   SCIP_Real*            feasibilities;      /**< array to store the minimum feasibility of each improved point */
+   SCIP_Real*            convals;            /**< buffer to store the constraint values in the current point */
+   SCIP_Real*            grad;               /**< buffer to store the gradient of a constraint */
+   SCIP_Real*            updatevec;          /**< buffer to store the update of the current point */
+   SCIP_Real             gradlimit;          /**< limit for gradient computations of the worker */
+   SCIP_CLOCK*           clock;              /**< wall clock that is started before the workers; only read */
+   SCIP_Real             deadline;           /**< time of the clock at which the worker stops improving points */
+   int                   nvars;              /**< number of variables */
+   int                   npoints;            /**< number of points of the worker */
+   int                   nimproved;          /**< number of points that have been improved by the worker */
+};
+typedef struct MultistartWorker MULTISTARTWORKER;
+
 
 /*
  * Local methods
@@ -489,6 +519,519 @@ TERMINATE:
    return SCIP_OKAY;
 }
 
+/** creates an NLPI oracle that contains the nonlinear rows as constraints; the i-th variable of the oracle corresponds
+ *  to the variable with index i w.r.t. the variable index mapping
+ */
+static
+SCIP_RETCODE createWorkerOracle(
+   SCIP*                 scip,               /**< SCIP data structure */
+   BMS_BLKMEM*           blkmem,             /**< block memory to use for the oracle */
+   SCIP_NLROW**          nlrows,             /**< array containing all nlrows */
+   int                   nnlrows,            /**< total number of nlrows */
+   SCIP_HASHMAP*         varindex,           /**< maps variables to indicies between 0,..,SCIPgetNVars(scip)-1 */
+   SCIP_NLPIORACLE**     oracle              /**< pointer to store the oracle */
+   )
+{
+   SCIP_QUADELEM** quadelems;
+   SCIP_EXPRTREE** exprtrees;
+   SCIP_Real** linvals;
+   SCIP_Real* lhss;
+   SCIP_Real* rhss;
+   int** exprvaridxs;
+   int** lininds;
+   int* nquadelems;
+   int* nlininds;
+   int i;
+   int j;
+
+   assert(scip != NULL);
+   assert(blkmem != NULL);
+   assert(nlrows != NULL);
+   assert(nnlrows > 0);
+   assert(varindex != NULL);
+   assert(oracle != NULL);
+
+   SCIP_CALL( SCIPnlpiOracleCreate(blkmem, oracle) );
+   SCIP_CALL( SCIPnlpiOracleSetInfinity(*oracle, SCIPinfinity(scip)) );
+   SCIP_CALL( SCIPnlpiOracleAddVars(*oracle, SCIPgetNVars(scip), NULL, NULL, NULL) );
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &lhss, nnlrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &rhss, nnlrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &nlininds, nnlrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lininds, nnlrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &linvals, nnlrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &nquadelems, nnlrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &quadelems, nnlrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &exprvaridxs, nnlrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &exprtrees, nnlrows) );
+
+   for( i = 0; i < nnlrows; ++i )
+   {
+      SCIP_NLROW* nlrow;
+      SCIP_Real constant;
+
+      nlrow = nlrows[i];
+      assert(nlrow != NULL);
+
+      /* the oracle does not know about constants, so move the constant of the nlrow into the sides */
+      constant = SCIPnlrowGetConstant(nlrow);
+      lhss[i] = SCIPisInfinity(scip, -SCIPnlrowGetLhs(nlrow)) ? -SCIPinfinity(scip) : SCIPnlrowGetLhs(nlrow) - constant;
+      rhss[i] = SCIPisInfinity(scip, SCIPnlrowGetRhs(nlrow)) ? SCIPinfinity(scip) : SCIPnlrowGetRhs(nlrow) - constant;
+
+      /* linear part */
+      nlininds[i] = SCIPnlrowGetNLinearVars(nlrow);
+      linvals[i] = SCIPnlrowGetLinearCoefs(nlrow);
+      lininds[i] = NULL;
+      if( nlininds[i] > 0 )
+      {
+         SCIP_CALL( SCIPallocBufferArray(scip, &lininds[i], nlininds[i]) ); /*lint !e866*/
+         for( j = 0; j < nlininds[i]; ++j )
+            lininds[i][j] = getVarIndex(varindex, SCIPnlrowGetLinearVars(nlrow)[j]);
+      }
+
+      /* quadratic part */
+      nquadelems[i] = SCIPnlrowGetNQuadElems(nlrow);
+      quadelems[i] = NULL;
+      if( nquadelems[i] > 0 )
+      {
+         SCIP_CALL( SCIPallocBufferArray(scip, &quadelems[i], nquadelems[i]) ); /*lint !e866*/
+         for( j = 0; j < nquadelems[i]; ++j )
+         {
+            SCIP_QUADELEM quadelem;
+            int idx1;
+            int idx2;
+
+            quadelem = SCIPnlrowGetQuadElems(nlrow)[j];
+            idx1 = getVarIndex(varindex, SCIPnlrowGetQuadVars(nlrow)[quadelem.idx1]);
+            idx2 = getVarIndex(varindex, SCIPnlrowGetQuadVars(nlrow)[quadelem.idx2]);
+
+            quadelems[i][j].idx1 = MIN(idx1, idx2);
+            quadelems[i][j].idx2 = MAX(idx1, idx2);
+            quadelems[i][j].coef = quadelem.coef;
+         }
+      }
+
+      /* tree part */
+      exprtrees[i] = SCIPnlrowGetExprtree(nlrow);
+      exprvaridxs[i] = NULL;
+      if( exprtrees[i] != NULL )
+      {
+         SCIP_CALL( SCIPallocBufferArray(scip, &exprvaridxs[i], SCIPexprtreeGetNVars(exprtrees[i])) ); /*lint !e866*/
+         for( j = 0; j < SCIPexprtreeGetNVars(exprtrees[i]); ++j )
+            exprvaridxs[i][j] = getVarIndex(varindex, SCIPexprtreeGetVars(exprtrees[i])[j]);
+      }
+   }
+
+   SCIP_CALL( SCIPnlpiOracleAddConstraints(*oracle, nnlrows, lhss, rhss, nlininds, lininds, linvals, nquadelems,
+         quadelems, exprvaridxs, exprtrees, NULL) );
+
+   for( i = nnlrows - 1; i >= 0; --i )
+   {
+      SCIPfreeBufferArrayNull(scip, &exprvaridxs[i]);
+      SCIPfreeBufferArrayNull(scip, &quadelems[i]);
+      SCIPfreeBufferArrayNull(scip, &lininds[i]);
+   }
+
+   SCIPfreeBufferArray(scip, &exprtrees);
+   SCIPfreeBufferArray(scip, &exprvaridxs);
+   SCIPfreeBufferArray(scip, &quadelems);
+   SCIPfreeBufferArray(scip, &nquadelems);
+   SCIPfreeBufferArray(scip, &linvals);
+   SCIPfreeBufferArray(scip, &lininds);
+   SCIPfreeBufferArray(scip, &nlininds);
+   SCIPfreeBufferArray(scip, &rhss);
+   SCIPfreeBufferArray(scip, &lhss);
+
+   return SCIP_OKAY;
+}
+
+/** computes the minimum feasibility of a given point w.r.t. the constraints of the oracle of a worker; all constraints
+ *  are evaluated at once and the constraint values are stored in the worker
+ *
+ *  A point at which some constraint cannot be evaluated gets a minimum feasibility of -infinity.
+ */
+static
+SCIP_RETCODE getWorkerMinFeas(
+   MULTISTARTWORKER*     worker,             /**< worker */
+   const SCIP_Real*      point,              /**< values of the point */
+   SCIP_Real*            minfeas             /**< buffer to store the minimum feasibility */
+   )
+{
+   int i;
+
+   assert(worker != NULL);
+   assert(point != NULL);
+   assert(minfeas != NULL);
+
+   SCIP_CALL( SCIPnlpiOracleEvalConstraintValues(worker->oracle, point, worker->convals) );
+
+   *minfeas = SCIPinfinity(worker->scip);
+
+   for( i = 0; i < SCIPnlpiOracleGetNConstraints(worker->oracle); ++i )
+   {
+      SCIP_Real feasibility;
+
+      /* the expression interpreter reports a domain error by a value that is not finite */
+      if( !SCIPisFinite(worker->convals[i]) )
+      {
+         *minfeas = -SCIPinfinity(worker->scip);
+         return SCIP_OKAY;
+      }
+
+      feasibility = MIN(SCIPnlpiOracleGetConstraintRhs(worker->oracle, i) - worker->convals[i],
+         worker->convals[i] - SCIPnlpiOracleGetConstraintLhs(worker->oracle, i)); /*lint !e666*/
+      *minfeas = MIN(*minfeas, feasibility);
+   }
+
+   return SCIP_OKAY;
+}
+
+/** checks whether the deadline of a worker has been reached; SCIPisStopped() must not be called by the workers, since it
+ *  updates the status of SCIP
+ */
+static
+SCIP_Bool isWorkerStopped(
+   MULTISTARTWORKER*     worker              /**< worker */
+   )
+{
+   assert(worker != NULL);
+
+   return worker->clock != NULL && SCIPgetClockTime(worker->scip, worker->clock) >= worker->deadline;
+}
+
+/** uses consensus vectors to improve feasibility for a given starting point; same as improvePoint(), but evaluates the
+ *  constraints via the NLPI oracle of a worker and works on an array of variable values instead of a solution
+ */
+static
+SCIP_RETCODE improveWorkerPoint(
+   MULTISTARTWORKER*     worker,             /**< worker */
+   SCIP_Real*            point,              /**< values of the random generated point */
+   SCIP_Real*            minfeas,            /**< pointer to store the minimum feasibility */
+   SCIP_Real*            gradcosts           /**< pointer to store the estimated gradient costs */
+   )
+{
+   SCIP* scip;
+   SCIP_Real lastminfeas;
+   int nvars;
+   int r;
+   int i;
+
+   assert(worker != NULL);
+   assert(point != NULL);
+   assert(minfeas != NULL);
+   assert(gradcosts != NULL);
+
+   scip = worker->scip;
+   nvars = worker->nvars;
+   *gradcosts = 0.0;
+
+   SCIP_CALL( getWorkerMinFeas(worker, point, minfeas) );
+
+   /* stop since start point is feasible */
+   if( !SCIPisFeasLT(scip, *minfeas, 0.0) )
+      return SCIP_OKAY;
+
+   lastminfeas = *minfeas;
+
+   /* main loop */
+   for( r = 0; r < worker->heurdata->maxiter && SCIPisFeasLT(scip, *minfeas, 0.0) && !SCIPisInfinity(scip, -*minfeas)
+      && !isWorkerStopped(worker); ++r )
+   {
+      SCIP_Real feasibility;
+      SCIP_Real activity;
+      SCIP_Real nlrownorm;
+      SCIP_Real scale;
+      int nviolnlrows;
+
+      BMSclearMemoryArray(worker->updatevec, nvars);
+      nviolnlrows = 0;
+
+      for( i = 0; i < SCIPnlpiOracleGetNConstraints(worker->oracle); ++i )
+      {
+         SCIP_RETCODE retcode;
+         SCIP_Real lhs;
+         SCIP_Real rhs;
+         int j;
+
+         lhs = SCIPnlpiOracleGetConstraintLhs(worker->oracle, i);
+         rhs = SCIPnlpiOracleGetConstraintRhs(worker->oracle, i);
+         feasibility = MIN(rhs - worker->convals[i], worker->convals[i] - lhs);
+
+         /* do not consider non-violated constraints */
+         if( SCIPisFeasGE(scip, feasibility, 0.0) )
+            continue;
+
+         /* increase number of violated nlrows */
+         ++nviolnlrows;
+
+         retcode = SCIPnlpiOracleEvalConstraintGradient(worker->oracle, i, point, TRUE, &activity, worker->grad);
+
+         /* stop if the gradient cannot be evaluated at the current point */
+         if( retcode == SCIP_INVALIDDATA )
+            return SCIP_OKAY;
+         SCIP_CALL( retcode );
+
+         /* update estimated costs for computing gradients */
+         *gradcosts += worker->nlrowgradcosts[i];
+
+         nlrownorm = 0.0;
+         for( j = 0; j < nvars; ++j )
+            nlrownorm += SQR(worker->grad[j]);
+
+         /* stop if the gradient disappears at the current point */
+         if( SCIPisZero(scip, nlrownorm) )
+            return SCIP_OKAY;
+
+         /* compute -g(x_k) / ||grad(g)(x_k)||^2 for a constraint g(x_k) <= 0 */
+         scale = -feasibility / nlrownorm;
+         if( !SCIPisInfinity(scip, rhs) && SCIPisGT(scip, activity, rhs) )
+            scale *= -1.0;
+
+         /* skip nonliner row if the scaler is too small or too large */
+         if( SCIPisEQ(scip, scale, 0.0) || SCIPisHugeValue(scip, REALABS(scale)) )
+            continue;
+
+         for( j = 0; j < nvars; ++j )
+            worker->updatevec[j] += scale * worker->grad[j];
+      }
+
+      /* if there are no violated rows, stop since start point is feasible */
+      if( nviolnlrows == 0 )
+         break;
+
+      /* adjust point */
+      for( i = 0; i < nvars; ++i )
+      {
+         point[i] += worker->updatevec[i] / nviolnlrows;
+         point[i] = MIN(point[i], worker->ubs[i]);
+         point[i] = MAX(point[i], worker->lbs[i]);
+      }
+
+      /* update feasibility */
+      SCIP_CALL( getWorkerMinFeas(worker, point, minfeas) );
+
+      /* check stopping criterion */
+      if( r % worker->heurdata->minimpriter == 0 && r > 0 )
+      {
+         if( *minfeas <= MINFEAS
+            || (*minfeas-lastminfeas) / MAX(REALABS(*minfeas), REALABS(lastminfeas)) < worker->heurdata->minimprfac ) /*lint !e666*/
+            break;
+         lastminfeas = *minfeas;
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** improves the points of a worker one after the other until its limit for gradient computations or its deadline is
+ *  reached; used as job to improve points concurrently
+ *
+ *  The job only works on the oracle and the memory of the worker and does not modify any data of SCIP.
+ */
+static
+SCIP_RETCODE improveWorkerPoints(
+   void*                 args                /**< worker data */
+   )
+{
+   MULTISTARTWORKER* worker;
+   SCIP_Real gradlimit;
+
+   worker = (MULTISTARTWORKER*)args;
+   assert(worker != NULL);
+   assert(worker->oracle != NULL);
+
+   gradlimit = worker->gradlimit;
+
+   for( worker->nimproved = 0; worker->nimproved < worker->npoints && gradlimit >= 0 && !isWorkerStopped(worker);
+        ++worker->nimproved )
+   {
+      SCIP_Real gradcosts;
+
+      SCIP_CALL( improveWorkerPoint(worker, &worker->points[worker->nimproved * worker->nvars],
+            &worker->feasibilities[worker->nimproved], &gradcosts) );
+
+      gradlimit -= gradcosts;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** improves the random points concurrently
+ *
+ *  The points are divided into consecutive parts, one for each worker. Each worker evaluates the nonlinear rows on an
+ *  NLPI oracle of its own, which computes the values of all constraints at once, and gets an equal share of the limit
+ *  for gradient computations. The workers stop when the time limit of SCIP is reached, which is measured by a wall clock
+ *  of their own. Afterwards, the improved points are moved to the beginning of the array of points.
+ */
+static
+SCIP_RETCODE improvePointsConcurrently(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEURDATA*        heurdata,           /**< heuristic data */
+   SCIP_NLROW**          nlrows,             /**< array containing all nlrows */
+   int                   nnlrows,            /**< total number of nlrows */
+   SCIP_HASHMAP*         varindex,           /**< maps variables to indicies between 0,..,SCIPgetNVars(scip)-1 */
+   SCIP_SOL**            points,             /**< array containing the random points */
+   int                   nrndpoints,         /**< total number of random points */
+   SCIP_Real*            nlrowgradcosts,     /**< estimated costs for each gradient computation */
+   SCIP_Real             gradlimit,          /**< limit for gradient computations of all workers */
+   int                   nworkers,           /**< number of workers */
+   SCIP_Real*            feasibilities,      /**< array to store the feasibility of each improved point */
+   int*                  npoints             /**< pointer to store the number of improved points */
+   )
+{
+   MULTISTARTWORKER* workers;
+   SCIP_JOBBATCH* jobbatch;
+   SCIP_RETCODE retcode;
+   SCIP_CLOCK* clock;
+   SCIP_VAR** vars;
+   SCIP_Real* pointvals;
+   SCIP_Real timelimit;
+   SCIP_Real* lbs;
+   SCIP_Real* ubs;
+   void** jobargs;
+   int nvars;
+   int begin;
+   int i;
+   int w;
+
+   assert(scip != NULL);
+   assert(heurdata != NULL);
+   assert(points != NULL);
+   assert(nrndpoints > 0);
+   assert(nworkers > 1 && nworkers <= nrndpoints);
+   assert(feasibilities != NULL);
+   assert(npoints != NULL);
+
+   vars = SCIPgetVars(scip);
+   nvars = SCIPgetNVars(scip);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &lbs, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &ubs, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &pointvals, nrndpoints * nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &workers, nworkers) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &jobargs, nworkers) );
+
+   for( i = 0; i < nvars; ++i )
+   {
+      lbs[i] = SCIPvarGetLbLocal(vars[i]);
+      ubs[i] = SCIPvarGetUbLocal(vars[i]);
+   }
+
+   for( i = 0; i < nrndpoints; ++i )
+   {
+      SCIP_CALL( SCIPgetSolVals(scip, points[i], nvars, vars, &pointvals[i * nvars]) );
+   }
+
+   /* the workers cannot check SCIPisStopped(), so they get the time that is left as deadline on a wall clock; if SCIP
+    * measures CPU time, the time of all workers counts
+    */
+   clock = NULL;
+   SCIP_CALL( SCIPgetRealParam(scip, "limits/time", &timelimit) );
+   if( !SCIPisInfinity(scip, timelimit) )
+   {
+      int clocktype;
+
+      timelimit -= SCIPgetSolvingTime(scip);
+
+      SCIP_CALL( SCIPgetIntParam(scip, "timing/clocktype", &clocktype) );
+      if( (SCIP_CLOCKTYPE)clocktype == SCIP_CLOCKTYPE_CPU )
+         timelimit /= nworkers;
+
+      SCIP_CALL( SCIPcreateWallClock(scip, &clock) );
+   }
+
+   /* create the workers */
+   begin = 0;
+   for( w = 0; w < nworkers; ++w )
+   {
+      MULTISTARTWORKER* worker = &workers[w];
+
+      worker->scip = scip;
+      worker->heurdata = heurdata;
+      worker->lbs = lbs;
+      worker->ubs = ubs;
+      worker->nlrowgradcosts = nlrowgradcosts;
+      worker->nvars = nvars;
+      worker->npoints = nrndpoints / nworkers + (w < nrndpoints % nworkers ? 1 : 0);
+      worker->nimproved = 0;
+      worker->points = &pointvals[begin * nvars];
+      worker->feasibilities = &feasibilities[begin];
+      worker->gradlimit = SCIPisInfinity(scip, gradlimit) ? gradlimit : gradlimit / nworkers;
+      worker->clock = clock;
+      worker->deadline = timelimit;
+
+      SCIP_ALLOC( worker->blkmem = BMScreateBlockMemory(1, 10) );
+      SCIP_CALL( createWorkerOracle(scip, worker->blkmem, nlrows, nnlrows, varindex, &worker->oracle) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &worker->convals, nnlrows) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &worker->grad, nvars) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &worker->updatevec, nvars) );
+
+      jobargs[w] = (void*) worker;
+      begin += worker->npoints;
+   }
+   assert(begin == nrndpoints);
+
+   SCIPdebugMsg(scip, "improve %d points with %d threads\n", nrndpoints, nworkers);
+
+   if( clock != NULL )
+   {
+      SCIP_CALL( SCIPstartClock(scip, clock) );
+   }
+
+   SCIP_CALL( SCIPtpiStartJobBatch(&jobbatch, improveWorkerPoints, jobargs, nworkers, nworkers) );
+   retcode = SCIPtpiFinishJobBatch(&jobbatch);
+
+   if( clock != NULL )
+   {
+      SCIP_CALL( SCIPfreeClock(scip, &clock) );
+   }
+
+   /* copy the improved points back and move them to the beginning of the array of points */
+   *npoints = 0;
+   if( retcode == SCIP_OKAY )
+   {
+      begin = 0;
+      for( w = 0; w < nworkers; ++w )
+      {
+         for( i = begin; i < begin + workers[w].nimproved; ++i )
+         {
+            SCIP_SOL* point;
+
+            assert(*npoints <= i);
+
+            SCIP_CALL( SCIPsetSolVals(scip, points[i], nvars, vars, &pointvals[i * nvars]) );
+
+            point = points[*npoints];
+            points[*npoints] = points[i];
+            points[i] = point;
+            feasibilities[*npoints] = feasibilities[i];
+            ++(*npoints);
+         }
+
+         SCIPdebugMsg(scip, "worker %d improved %d / %d points\n", w, workers[w].nimproved, workers[w].npoints);
+         begin += workers[w].npoints;
+      }
+   }
+
+   /* free the workers */
+   for( w = nworkers - 1; w >= 0; --w )
+   {
+      SCIPfreeBufferArray(scip, &workers[w].updatevec);
+      SCIPfreeBufferArray(scip, &workers[w].grad);
+      SCIPfreeBufferArray(scip, &workers[w].convals);
+      SCIP_CALL( SCIPnlpiOracleFree(&workers[w].oracle) );
+      BMSdestroyBlockMemory(&workers[w].blkmem);
+   }
+
+   SCIPfreeBufferArray(scip, &jobargs);
+   SCIPfreeBufferArray(scip, &workers);
+   SCIPfreeBufferArray(scip, &pointvals);
+   SCIPfreeBufferArray(scip, &ubs);
+   SCIPfreeBufferArray(scip, &lbs);
+
+   return retcode;
+}
+
 /** sorts points w.r.t their feasibilities; points with a feasibility which is too small (w.r.t. the geometric mean of
  *  all feasibilities) will be filtered out
  */
@@ -779,12 +1322,97 @@ int getExprtreeSize(
    return getExprSize(SCIPexprtreeGetRoot(tree));
 }
 
+/** recursive helper function to check whether an expression can be evaluated by several threads at the same time
+ *
+ *  The CppAD expression interpreter computes powers with integer exponents larger than one in absolute value, including
+ *  squares, as well as signpowers and user expressions by atomic functions, which are static objects with a state of
+ *  their own.
+ */
+static
+SCIP_Bool isExprThreadsafe(
+   SCIP_EXPR*            expr                /**< expression */
+   )
+{
+   int i;
+   int j;
+
+   assert(expr != NULL);
+
+   switch( SCIPexprGetOperator(expr) )
+   {
+   case SCIP_EXPR_SQUARE:
+   case SCIP_EXPR_SIGNPOWER:
+   case SCIP_EXPR_USER:
+      return FALSE;
+
+   case SCIP_EXPR_INTPOWER:
+      if( ABS(SCIPexprGetIntPowerExponent(expr)) > 1 )
+         return FALSE;
+      break;
+
+   case SCIP_EXPR_QUADRATIC:
+      for( i = 0; i < SCIPexprGetNQuadElements(expr); ++i )
+      {
+         if( SCIPexprGetQuadElements(expr)[i].idx1 == SCIPexprGetQuadElements(expr)[i].idx2 )
+            return FALSE;
+      }
+      break;
+
+   case SCIP_EXPR_POLYNOMIAL:
+      for( i = 0; i < SCIPexprGetNMonomials(expr); ++i )
+      {
+         SCIP_EXPRDATA_MONOMIAL* monomial = SCIPexprGetMonomials(expr)[i];
+
+         for( j = 0; j < SCIPexprGetMonomialNFactors(monomial); ++j )
+         {
+            SCIP_Real exponent = SCIPexprGetMonomialExponents(monomial)[j];
+
+            if( REALABS(exponent) > 1.0 && (int)exponent == exponent )  /*lint !e777*/
+               return FALSE;
+         }
+      }
+      break;
+
+   default:
+      break;
+   }
+
+   for( i = 0; i < SCIPexprGetNChildren(expr); ++i )
+   {
+      if( !isExprThreadsafe(SCIPexprGetChildren(expr)[i]) )
+         return FALSE;
+   }
+
+   return TRUE;
+}
+
+/** checks whether the expression trees of all nonlinear rows can be evaluated by several threads at the same time */
+static
+SCIP_Bool areNlrowsThreadsafe(
+   SCIP_NLROW**          nlrows,             /**< array containing all nlrows */
+   int                   nnlrows             /**< total number of nlrows */
+   )
+{
+   int i;
+
+   for( i = 0; i < nnlrows; ++i )
+   {
+      SCIP_EXPRTREE* tree = SCIPnlrowGetExprtree(nlrows[i]);
+
+      if( tree != NULL && !isExprThreadsafe(SCIPexprtreeGetRoot(tree)) )
+         return FALSE;
+   }
+
+   return TRUE;
+}
+
 /** main function of the multi-start heuristic (see @ref heur_multistart.h for more details); it consists of the
  *  following four steps:
  *
  *  1. sampling points in the current domain; for unbounded variables we use a bounded box
  *
- *  2. reduce infeasibility by using a gradient descent method
+ *  2. reduce infeasibility by using a gradient descent method; with more than one thread, the points are improved
+ *     concurrently if the expression interpreter is threadsafe for all nonlinear rows, see improvePointsConcurrently()
  *
  *  3. cluster points; filter points with a too large infeasibility
  *
@@ -810,6 +1438,7 @@ SCIP_RETCODE applyHeur(
    int nrndpoints;
    int ncluster;
    int nnlrows;
+   int nworkers;
    int npoints;
    int start;
    int i;
@@ -864,16 +1493,33 @@ SCIP_RETCODE applyHeur(
     * 2. improve points via consensus vectors
     */
    gradlimit = heurdata->gradlimit == 0.0 ? SCIPinfinity(scip) : heurdata->gradlimit;
-   for( npoints = 0; npoints < nrndpoints && gradlimit >= 0 && !SCIPisStopped(scip); ++npoints )
+   nworkers = MIN(heurdata->nthreads, nrndpoints);
+
+   /* the expression interpreter cannot evaluate all operators on several threads */
+   if( nworkers > 1 && !areNlrowsThreadsafe(nlrows, nnlrows) )
    {
-      SCIP_Real gradcosts;
+      SCIPdebugMsg(scip, "improve points sequentially, since the expression interpreter is not threadsafe for all nlrows\n");
+      nworkers = 1;
+   }
 
-      SCIP_CALL( improvePoint(scip, nlrows, nnlrows, varindex, heurdata->exprinterpreter, points[npoints],
-            heurdata->maxiter, heurdata->minimprfac, heurdata->minimpriter, &feasibilities[npoints], nlrowgradcosts,
-            &gradcosts) );
+   if( nworkers > 1 && !SCIPisStopped(scip) )
+   {
+      SCIP_CALL( improvePointsConcurrently(scip, heurdata, nlrows, nnlrows, varindex, points, nrndpoints,
+            nlrowgradcosts, gradlimit, nworkers, feasibilities, &npoints) );
+   }
+   else
+   {
+      for( npoints = 0; npoints < nrndpoints && gradlimit >= 0 && !SCIPisStopped(scip); ++npoints )
+      {
+         SCIP_Real gradcosts;
 
-      gradlimit -= gradcosts;
-      SCIPdebugMsg(scip, "improve point %d / %d gradlimit = %g\n", npoints, nrndpoints, gradlimit);
+         SCIP_CALL( improvePoint(scip, nlrows, nnlrows, varindex, heurdata->exprinterpreter, points[npoints],
+               heurdata->maxiter, heurdata->minimprfac, heurdata->minimpriter, &feasibilities[npoints], nlrowgradcosts,
+               &gradcosts) );
+
+         gradlimit -= gradcosts;
+         SCIPdebugMsg(scip, "improve point %d / %d gradlimit = %g\n", npoints, nrndpoints, gradlimit);
+      }
    }
    assert(npoints >= 0 && npoints <= nrndpoints);
 
@@ -1124,5 +1770,9 @@ SCIP_RETCODE SCIPincludeHeurMultistart(
          "should the heuristic run only on continuous problems?",
          &heurdata->onlynlps, FALSE, DEFAULT_ONLYNLPS, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddIntParam(scip, "heuristics/" HEUR_NAME "/nthreads",
+         "number of threads to improve points concurrently (1: improve points sequentially)",
+         &heurdata->nthreads, FALSE, DEFAULT_NTHREADS, 1, 256, NULL, NULL) );
+
    return SCIP_OKAY;
 }
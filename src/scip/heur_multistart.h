@@ -48,6 +48,9 @@
  *    Method and has been introduced by <a
  *    href="http://www.sce.carleton.ca/faculty/chinneck/docs/ConstraintConsensusJoC.pdf">here </a>.
  *
+ *    If the parameter heuristics/multistart/nthreads is larger than one, the points are improved concurrently. Each
+ *    thread evaluates the constraints on an NLPI oracle of its own.
+ *
  * 3. cluster points
  *
  *    We use a greedy algorithm to all of the resulting points of step 3. to find clusters which (hopefully) approximate
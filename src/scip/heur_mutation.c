@@ -201,7 +201,6 @@ SCIP_RETCODE setupAndSolveSubscipMutation(
    SCIP_Real cutoff;                         /* objective cutoff for the subproblem                 */
    SCIP_Real upperbound;
    int nvars;                                /* number of original problem's variables              */
-   int i;
    SCIP_Bool success;
 
    assert(scip != NULL);
@@ -225,8 +224,7 @@ SCIP_RETCODE setupAndSolveSubscipMutation(
    SCIP_CALL( SCIPcopyLargeNeighborhoodSearch(scip, subscip, varmapfw, "mutation", fixedvars, fixedvals, nfixedvars,
          heurdata->uselprows, heurdata->copycuts, &success, NULL) );
 
-   for( i = 0; i < nvars; i++ )
-      subvars[i] = (SCIP_VAR*) SCIPhashmapGetImage(varmapfw, vars[i]);
+   SCIPhashmapGetImages(varmapfw, (void**)vars, (void**)subvars, nvars);
 
    /* free hash map */
    SCIPhashmapFree(&varmapfw);
@@ -212,8 +212,7 @@ SCIP_RETCODE setupAndSolve(
    }
 
    SCIP_CALL( SCIPallocBufferArray(scip, &subvars, nvars) );
-   for( i = 0; i < nvars; i++ )
-     subvars[i] = (SCIP_VAR*) SCIPhashmapGetImage(varmapfw, vars[i]);
+   SCIPhashmapGetImages(varmapfw, (void**)vars, (void**)subvars, nvars);
 
    /* free hash map */
    SCIPhashmapFree(&varmapfw);
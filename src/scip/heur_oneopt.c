@@ -23,6 +23,7 @@
 
 #include "blockmemshell/memory.h"
 #include "scip/heur_oneopt.h"
+#include "scip/heuristics.h"
 #include "scip/pub_heur.h"
 #include "scip/pub_lp.h"
 #include "scip/pub_message.h"
@@ -71,6 +72,7 @@
 /** primal heuristic data */
 struct SCIP_HeurData
 {
+   SCIP_ROWACTIVITIES*   rowactivities;      /**< activities of the LP rows w.r.t. the working solution */
    int                   lastsolindex;       /**< index of the last solution for which oneopt was performed */
    SCIP_Bool             weightedobj;        /**< should the objective be weighted with the potential shifting value when sorting the shifting candidates? */
    SCIP_Bool             duringroot;         /**< should the heuristic be called before and during the root node? */
@@ -180,56 +182,6 @@ SCIP_Real calcShiftVal(
 }
 
 
-/** update row activities after a variable's solution value changed */
-static
-SCIP_RETCODE updateRowActivities(
-   SCIP*                 scip,               /**< SCIP data structure */
-   SCIP_Real*            activities,         /**< LP row activities */
-   SCIP_VAR*             var,                /**< variable that has been changed */
-   SCIP_Real             shiftval            /**< value that is added to variable */
-   )
-{
-   SCIP_Real* colvals;
-   SCIP_ROW** colrows;
-   SCIP_COL* col;
-
-   int ncolrows;
-   int i;
-
-   assert(activities != NULL);
-
-   /* get data of column associated to variable */
-   col = SCIPvarGetCol(var);
-   colrows = SCIPcolGetRows(col);
-   colvals = SCIPcolGetVals(col);
-   ncolrows = SCIPcolGetNLPNonz(col);
-   assert(ncolrows == 0 || (colrows != NULL && colvals != NULL));
-
-   /* enumerate all rows with nonzero entry in this column */
-   for( i = 0; i < ncolrows; ++i )
-   {
-      SCIP_ROW* row;
-      int rowpos;
-
-      row = colrows[i];
-      rowpos = SCIProwGetLPPos(row);
-      assert(-1 <= rowpos && rowpos < SCIPgetNLPRows(scip) );
-
-      /* update row activity, only regard global rows in the LP */
-      if( rowpos >= 0 && !SCIProwIsLocal(row) )
-      {
-         activities[rowpos] +=  shiftval * colvals[i];
-
-         if( SCIPisInfinity(scip, activities[rowpos]) )
-            activities[rowpos] = SCIPinfinity(scip);
-         else if( SCIPisInfinity(scip, -activities[rowpos]) )
-            activities[rowpos] = -SCIPinfinity(scip);
-      }
-   }
-
-   return SCIP_OKAY;
-}
-
 /** setup and solve oneopt sub-SCIP */
 static
 SCIP_RETCODE setupAndSolveSubscipOneopt(
@@ -438,6 +390,26 @@ SCIP_DECL_HEURINIT(heurInitOneopt)
    /* initialize last solution index */
    heurdata->lastsolindex = -1;
 
+   SCIP_CALL( SCIPcreateRowActivities(scip, &heurdata->rowactivities) );
+
+   return SCIP_OKAY;
+}
+
+/** deinitialization method of primal heuristic (called before transformed problem is freed) */
+static
+SCIP_DECL_HEUREXIT(heurExitOneopt)
+{  /*lint --e{715}*/
+   SCIP_HEURDATA* heurdata;
+
+   assert(heur != NULL);
+   assert(scip != NULL);
+
+   /* get heuristic data */
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+
+   SCIP_CALL( SCIPfreeRowActivities(scip, &heurdata->rowactivities) );
+
    return SCIP_OKAY;
 }
 
@@ -569,6 +541,11 @@ SCIP_DECL_HEUREXEC(heurExecOneopt)
    SCIP_CALL( SCIPcreateSolCopy(scip, &worksol, bestsol) );
    SCIPsolSetHeur(worksol,heur);
 
+   /* compute the LP row activities of the incumbent, which are updated along with the working solution */
+   SCIP_CALL( SCIPgetLPRowsData(scip, &lprows, &nlprows) );
+   SCIP_CALL( SCIPcomputeRowActivities(scip, heurdata->rowactivities, bestsol) );
+   activities = SCIPgetRowActivitiesVals(heurdata->rowactivities);
+
    SCIPdebugMsg(scip, "Starting bound adjustment in 1-opt heuristic\n");
 
    nchgbound = 0;
@@ -588,6 +565,8 @@ SCIP_DECL_HEUREXEC(heurExecOneopt)
       {
          /* set the solution value to the global lower bound */
          SCIP_CALL( SCIPsetSolVal(scip, worksol, var, lb) );
+         if( SCIPvarGetStatus(var) == SCIP_VARSTATUS_COLUMN )
+            SCIPupdateRowActivities(scip, heurdata->rowactivities, var, lb - solval);
          ++nchgbound;
          SCIPdebugMsg(scip, "var <%s> type %d, old solval %g now fixed to lb %g\n", SCIPvarGetName(var), SCIPvarGetType(var), solval, lb);
       }
@@ -596,6 +575,8 @@ SCIP_DECL_HEUREXEC(heurExecOneopt)
       {
          /* set the solution value to the global upper bound */
          SCIP_CALL( SCIPsetSolVal(scip, worksol, var, ub) );
+         if( SCIPvarGetStatus(var) == SCIP_VARSTATUS_COLUMN )
+            SCIPupdateRowActivities(scip, heurdata->rowactivities, var, ub - solval);
          ++nchgbound;
          SCIPdebugMsg(scip, "var <%s> type %d, old solval %g now fixed to ub %g\n", SCIPvarGetName(var), SCIPvarGetType(var), solval, ub);
       }
@@ -603,13 +584,10 @@ SCIP_DECL_HEUREXEC(heurExecOneopt)
 
    SCIPdebugMsg(scip, "number of bound changes (due to global bounds) = %d\n", nchgbound);
 
-   SCIP_CALL( SCIPgetLPRowsData(scip, &lprows, &nlprows) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &activities, nlprows) );
-
    localrows = FALSE;
    valid = TRUE;
 
-   /* initialize LP row activities */
+   /* check LP row activities */
    for( i = 0; i < nlprows; ++i )
    {
       SCIP_ROW* row;
@@ -619,7 +597,6 @@ SCIP_DECL_HEUREXEC(heurExecOneopt)
 
       if( !SCIProwIsLocal(row) )
       {
-         activities[i] = SCIPgetRowSolActivity(scip, row, worksol);
          SCIPdebugMsg(scip, "Row <%s> has activity %g\n", SCIProwGetName(row), activities[i]);
          if( SCIPisFeasLT(scip, activities[i], SCIProwGetLhs(row)) || SCIPisFeasGT(scip, activities[i], SCIProwGetRhs(row)) )
          {
@@ -638,7 +615,6 @@ SCIP_DECL_HEUREXEC(heurExecOneopt)
       /** @todo try to correct lp rows */
       SCIPdebugMsg(scip, "Some global bound changes were not valid in lp rows.\n");
 
-      SCIPfreeBufferArray(scip, &activities);
       SCIP_CALL( SCIPfreeSol(scip, &worksol) );
 
       return SCIP_OKAY;
@@ -709,7 +685,7 @@ SCIP_DECL_HEUREXEC(heurExecOneopt)
             SCIPdebugMsg(scip, " Only one shiftcand found, var <%s>, which is now shifted by<%1.1f> \n",
                SCIPvarGetName(var), shiftval);
             SCIP_CALL( SCIPsetSolVal(scip, worksol, var, solval+shiftval) );
-            SCIP_CALL( updateRowActivities(scip, activities, var, shiftval) );
+            SCIPupdateRowActivities(scip, heurdata->rowactivities, var, shiftval);
             ++nsuccessfulshifts;
          }
          else
@@ -750,7 +726,7 @@ SCIP_DECL_HEUREXEC(heurExecOneopt)
                {
                   SCIPdebugMsg(scip, " -> Variable <%s> is now shifted by <%1.1f> \n", SCIPvarGetName(vars[i]), shiftval);
                   SCIP_CALL( SCIPsetSolVal(scip, worksol, var, solval+shiftval) );
-                  SCIP_CALL( updateRowActivities(scip, activities, var, shiftval) );
+                  SCIPupdateRowActivities(scip, heurdata->rowactivities, var, shiftval);
                   ++nsuccessfulshifts;
                }
             }
@@ -867,7 +843,6 @@ SCIP_DECL_HEUREXEC(heurExecOneopt)
 
    SCIPfreeBufferArray(scip, &shiftvals);
    SCIPfreeBufferArray(scip, &shiftcands);
-   SCIPfreeBufferArray(scip, &activities);
 
    SCIP_CALL( SCIPfreeSol(scip, &worksol) );
 
@@ -904,6 +879,7 @@ SCIP_RETCODE SCIPincludeHeurOneopt(
    SCIP_CALL( SCIPsetHeurInitsol(scip, heur, heurInitsolOneopt) );
    SCIP_CALL( SCIPsetHeurExitsol(scip, heur, heurExitsolOneopt) );
    SCIP_CALL( SCIPsetHeurInit(scip, heur, heurInitOneopt) );
+   SCIP_CALL( SCIPsetHeurExit(scip, heur, heurExitOneopt) );
 
    /* add oneopt primal heuristic parameters */
    SCIP_CALL( SCIPaddBoolParam(scip, "heuristics/oneopt/weightedobj",
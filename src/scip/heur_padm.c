@@ -71,6 +71,7 @@
 #include "scip/scip_timing.h"
 #include "scip/scip_tree.h"
 #include "scip/scip_var.h"
+#include "tpi/tpi.h"
 
 #define HEUR_NAME             "padm"
 #define HEUR_DESC             "penalty alternating direction method primal heuristic"
@@ -89,6 +90,7 @@
 #define DEFAULT_ADMIT         4
 #define DEFAULT_PENALTYIT     100
 #define DEFAULT_GAP           2.0
+#define DEFAULT_NTHREADS      1
 
 /*
  * Data structures
@@ -185,8 +187,29 @@ struct SCIP_HeurData
    SCIP_Bool             scaling;            /**< enable sigmoid rescaling of penalty parameters */
    SCIP_Bool             assignlinking;      /**< should linking constraints be assigned? */
    SCIP_Bool             original;           /**< should the original problem be used? */
+   int                   nthreads;           /**< number of threads to solve the blocks of an ADM iteration concurrently
+                                              *   (1: solve the blocks sequentially) */
 };
 
+/** solving one block in an ADM iteration, potentially multiple times with increased penalties */
+typedef struct BlockJob
+{
+   SCIP*                 scip;               /**< the main SCIP instance, only read while the job runs */
+   SCIP_HEURDATA*        heurdata;           /**< heuristic data */
+   BLOCK*                block;              /**< the block to solve */
+   SET*                  blocktolinkvars;    /**< linking variables of each block */
+   SET*                  linkvartoblocks;    /**< blocks of each linking variable */
+   SCIP_HASHTABLE*       htable;             /**< hashtable with the linking information of the blocks */
+   SCIP_Real             gap;                /**< gap limit of the subproblem */
+   SCIP_Longint          nodesleft;          /**< number of nodes left when the job was started */
+   SCIP_Longint          nodesleftafter;     /**< number of nodes left after the job */
+   int                   piter;              /**< current penalty iteration */
+   int                   aiter;              /**< current ADM iteration */
+   SCIP_Bool             solutionsdiffer;    /**< did the values of the linking variables of the block change? */
+   SCIP_Bool             timelimit;          /**< did the block reach the time limit with a solution without slack? */
+   SCIP_Bool             terminate;          /**< should the heuristic terminate? */
+} BLOCKJOB;
+
 /*
  * Local methods
  */
@@ -746,6 +769,306 @@ SCIP_RETCODE scalePenalties(
    return SCIP_OKAY;
 }
 
+/** changes the sides of the coupling constraints of a block to the linking variable values of the other blocks and
+ *  sets the current penalty coefficients of its slack variables
+ */
+static
+SCIP_RETCODE updateBlockCoupling(
+   PROBLEM*              problem,            /**< problem structure */
+   int                   b,                  /**< index of the block */
+   SET*                  blocktolinkvars,    /**< linking variables of each block */
+   SET*                  linkvartoblocks,    /**< blocks of each linking variable */
+   SCIP_HASHTABLE*       htable              /**< hashtable with the linking information of the blocks */
+   )
+{
+   int i;
+   int k;
+
+   for( i = 0; i < blocktolinkvars[b].size; i++ )
+   {
+      int linkvaridx;
+      linkvaridx = blocktolinkvars[b].indexes[i];
+
+      for( k = 0; k < linkvartoblocks[linkvaridx].size; k++ )
+      {
+         int b2;
+         b2 = linkvartoblocks[linkvaridx].indexes[k];
+
+         if( b2 != b )
+         {
+            BLOCKINFO binfo;
+            BLOCKINFO* binfoout;
+            BLOCKINFO binfo2;
+            BLOCKINFO* binfo2out;
+
+            SCIP_CONS* couplingcons;
+            SCIP_Real newrhs;
+
+            binfo.block = b;
+            binfo.otherblock = b2;
+            binfo.linkvaridx = linkvaridx;
+
+            binfoout = (BLOCKINFO*) SCIPhashtableRetrieve(htable, (void *)&binfo);
+            assert(binfoout != NULL);
+            couplingcons = binfoout->couplingCons;
+
+            /* interchange blocks b and b2 for getting new right hand side */
+            binfo2.block = b2;
+            binfo2.otherblock = b;
+            binfo2.linkvaridx = linkvaridx;
+            binfo2out = (BLOCKINFO*) SCIPhashtableRetrieve(htable, (void*) &binfo2);
+            assert(binfo2out != NULL);
+            newrhs = binfo2out->linkvarval;
+
+            /* change side of coupling constraint equation with linking variable value of the other block */
+            SCIP_CALL( SCIPchgLhsLinear((problem->blocks[b]).subscip, couplingcons, newrhs) );
+            SCIP_CALL( SCIPchgRhsLinear((problem->blocks[b]).subscip, couplingcons, newrhs) );
+
+            /* change penalty coefficients of slack variables */
+            SCIP_CALL( SCIPchgVarObj((problem->blocks[b]).subscip, binfoout->slackposvar, binfoout->slackposobjcoeff) );
+            SCIP_CALL( SCIPchgVarObj((problem->blocks[b]).subscip, binfoout->slacknegvar, binfoout->slacknegobjcoeff) );
+         }
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** initializes the job to solve one block in the current ADM iteration */
+static
+void initBlockJob(
+   BLOCKJOB*             job,                /**< job to initialize */
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEURDATA*        heurdata,           /**< heuristic data */
+   PROBLEM*              problem,            /**< problem structure */
+   int                   b,                  /**< index of the block */
+   SET*                  blocktolinkvars,    /**< linking variables of each block */
+   SET*                  linkvartoblocks,    /**< blocks of each linking variable */
+   SCIP_HASHTABLE*       htable,             /**< hashtable with the linking information of the blocks */
+   SCIP_Real             gap,                /**< gap limit of the subproblem */
+   int                   piter,              /**< current penalty iteration */
+   int                   aiter,              /**< current ADM iteration */
+   SCIP_Longint          nodesleft           /**< number of nodes left */
+   )
+{
+   job->scip = scip;
+   job->heurdata = heurdata;
+   job->block = &problem->blocks[b];
+   job->blocktolinkvars = blocktolinkvars;
+   job->linkvartoblocks = linkvartoblocks;
+   job->htable = htable;
+   job->gap = gap;
+   job->piter = piter;
+   job->aiter = aiter;
+   job->nodesleft = nodesleft;
+   job->nodesleftafter = nodesleft;
+   job->solutionsdiffer = FALSE;
+   job->timelimit = FALSE;
+   job->terminate = FALSE;
+}
+
+/** solves the sub-SCIP of one block and increases the slack penalty coefficients until it can be solved to optimality
+ *
+ *  The job only modifies the sub-SCIP and the linking information of its own block, such that the jobs of different
+ *  blocks can run concurrently.
+ */
+static
+SCIP_RETCODE solveBlockJob(
+   void*                 args                /**< the block job */
+   )
+{
+   BLOCKJOB* job;
+   SCIP* scip;
+   PROBLEM* problem;
+   SET* blocktolinkvars;
+   SET* linkvartoblocks;
+   SCIP_HEURDATA* heurdata;
+   SCIP_HASHTABLE* htable;
+   SCIP_STATUS status;
+   SCIP_Longint nodesleft;
+   SCIP_Real gap;
+   int piter;
+   int aiter;
+   int b;
+   int i;
+   int k;
+#ifdef PADM_WRITE_PROBLEMS
+   char name[SCIP_MAXSTRLEN];
+#endif
+
+   job = (BLOCKJOB*)args;
+   assert(job != NULL);
+
+   scip = job->scip;
+   problem = job->block->problem;
+   b = job->block->number;
+   blocktolinkvars = job->blocktolinkvars;
+   linkvartoblocks = job->linkvartoblocks;
+   heurdata = job->heurdata;
+   htable = job->htable;
+   gap = job->gap;
+   piter = job->piter;
+   aiter = job->aiter;
+   nodesleft = job->nodesleft;
+
+   /* increase slack penalty coeffs until each subproblem can be solved to optimality */
+   do
+   {
+      SCIP_Longint nnodes;
+      int iteration;
+
+#ifdef PADM_WRITE_PROBLEMS
+      SCIPdebugMsg(scip, "write subscip of block %d in piter=%d and aiter=%d\n", b, piter, aiter);
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "blockproblem_%d_%d_%d.lp", b, piter, aiter);
+      SCIP_CALL( SCIPwriteOrigProblem((problem->blocks[b]).subscip, name, NULL, FALSE) );
+#endif
+
+      SCIP_CALL( SCIPsetRealParam((problem->blocks[b]).subscip, "limits/gap", gap) );
+
+      /* reuse old solution if available */
+      SCIP_CALL( reuseSolution((problem->blocks[b]).subscip, &problem->blocks[b]) );
+
+      /* update time and memory limit of subproblem */
+      SCIP_CALL( SCIPcopyLimits(scip, (problem->blocks[b]).subscip) );
+
+      /* stop if there are not enough nodes left */
+      if( nodesleft < heurdata->minnodes )
+      {
+         SCIPdebugMsg(scip, "Node limit reached.\n");
+         job->terminate = TRUE;
+         break;
+      }
+
+      /* update node limit of subproblem
+       * in the first iterations we have a smaller node limit
+       */
+      iteration = ((piter - 1) * heurdata->admiterations) + aiter;
+      nnodes = (SCIP_Longint)SCIPceil(scip, (problem->blocks[b]).size * nodesleft * ( 1 - pow(heurdata->nodefac, (double)iteration) ));
+      nnodes = MAX( heurdata->minnodes, nnodes );
+      SCIP_CALL( SCIPsetLongintParam((problem->blocks[b]).subscip, "limits/nodes", nnodes) );
+
+      /* solve block */
+      SCIP_CALL( SCIPsolve((problem->blocks[b]).subscip) );
+      status = SCIPgetStatus((problem->blocks[b]).subscip);
+
+      /* subtract used nodes from the total nodelimit */
+      nodesleft -= (SCIP_Longint)SCIPceil(scip, SCIPgetNNodes((problem->blocks[b]).subscip) * (problem->blocks[b]).size);
+
+      /* check solution if one of the four cases occurs
+       * - solution is optimal
+       * - solution reached gaplimit
+       * - node limit reached with at least one feasible solution
+       * - time limit is reached but best solution needs no slack variables (no dual solution available)
+       */
+      if( status == SCIP_STATUS_OPTIMAL || status == SCIP_STATUS_GAPLIMIT ||
+            (status == SCIP_STATUS_NODELIMIT && SCIPgetNSols((problem->blocks[b]).subscip) > 0) ||
+            (status == SCIP_STATUS_TIMELIMIT && SCIPgetNSols((problem->blocks[b]).subscip) > 0 && 
+            SCIPisEQ(scip, SCIPgetSolOrigObj((problem->blocks[b]).subscip, SCIPgetBestSol((problem->blocks[b]).subscip)), 0.0) ) )
+      {
+         SCIPdebugMsg(scip, "Block is optimal or reached gaplimit or nodelimit.\n");
+
+         if( status == SCIP_STATUS_TIMELIMIT )
+         {
+            SCIPdebugMsg(scip, "Block reached time limit with at least one feasible solution.\n");
+            job->timelimit = TRUE;
+         }
+
+         for( i = 0; i < blocktolinkvars[b].size; i++ )
+         {
+            int linkvaridx;
+            linkvaridx = blocktolinkvars[b].indexes[i];
+
+            for( k = 0; k < linkvartoblocks[linkvaridx].size; k++ )
+            {
+               int b2;
+               b2 = linkvartoblocks[linkvaridx].indexes[k];
+
+               if( b2 != b )
+               {
+                  SCIP_SOL* sol;
+                  BLOCKINFO binfo;
+                  BLOCKINFO* binfoout;
+                  SCIP_VAR* var;
+                  SCIP_Real val;
+
+                  binfo.block = b;
+                  binfo.otherblock = b2;
+                  binfo.linkvaridx = linkvaridx;
+                  binfoout = (BLOCKINFO *)SCIPhashtableRetrieve(htable, (void *)&binfo);
+                  assert(binfoout != NULL);
+
+                  sol = SCIPgetBestSol((problem->blocks[b]).subscip);
+                  assert(sol != NULL);
+                  var = binfoout->linkvar;
+                  val = SCIPgetSolVal((problem->blocks[b]).subscip, sol, var);
+
+                  if( !EPSEQ(binfoout->linkvarval, val, SCIP_DEFAULT_EPSILON) )
+                     job->solutionsdiffer = TRUE;
+
+                  binfoout->linkvarval = val;
+               }
+            }
+         }
+      }
+      else if( status == SCIP_STATUS_UNBOUNDED )
+      {
+         SCIPdebugMsg(scip, "Block is unbounded.\n");
+         for( i = 0; i < blocktolinkvars[b].size; i++ )
+         {
+            int linkvaridx;
+            linkvaridx = blocktolinkvars[b].indexes[i];
+
+            for( k = 0; k < linkvartoblocks[linkvaridx].size; k++ )
+            {
+               int b2;
+               b2 = linkvartoblocks[linkvaridx].indexes[k];
+
+               if( b2 != b )
+               {
+                  BLOCKINFO binfo;
+                  BLOCKINFO* binfoout;
+
+                  binfo.block = b;
+                  binfo.otherblock = b2;
+                  binfo.linkvaridx = linkvaridx;
+                  binfoout = (BLOCKINFO*) SCIPhashtableRetrieve(htable, (void*) &binfo);
+                  assert(binfoout != NULL);
+
+                  /* increase penalty coefficients to obtain a bounded subproblem */
+                  binfoout->slackposobjcoeff *= 10.0;
+                  binfoout->slacknegobjcoeff *= 10.0;
+                  SCIP_CALL( SCIPchgVarObj((problem->blocks[b]).subscip, binfoout->slackposvar, binfoout->slackposobjcoeff) );
+                  SCIP_CALL( SCIPchgVarObj((problem->blocks[b]).subscip, binfoout->slacknegvar, binfoout->slacknegobjcoeff) );
+               }
+            }
+         }
+      }
+      else if( status == SCIP_STATUS_TIMELIMIT )
+      {
+         SCIPdebugMsg(scip, "Block reached time limit. No optimal solution available.\n");
+         job->terminate = TRUE;
+         break;
+      }
+      else
+      {
+         SCIPdebugMsg(scip, "Block solving status %d not supported\n", status);
+         job->terminate = TRUE;
+         break;
+      }
+
+      /* free solving data in order to change problem */
+      SCIP_CALL( SCIPfreeTransform((problem->blocks[b]).subscip) );
+   }
+   while( status != SCIP_STATUS_OPTIMAL && status != SCIP_STATUS_GAPLIMIT &&
+          !(status == SCIP_STATUS_NODELIMIT && SCIPgetNSols((problem->blocks[b]).subscip) > 0) &&
+          !(status == SCIP_STATUS_TIMELIMIT && SCIPgetNSols((problem->blocks[b]).subscip) > 0 && 
+          SCIPisEQ(scip, SCIPgetSolOrigObj((problem->blocks[b]).subscip, SCIPgetBestSol((problem->blocks[b]).subscip)), 0.0) ) );
+
+   job->nodesleftafter = nodesleft;
+
+   return SCIP_OKAY;
+}
+
 /** returns the available time limit that is left */
 static
 SCIP_RETCODE getTimeLeft(
@@ -823,6 +1146,8 @@ static SCIP_DECL_HEUREXEC(heurExecPADM)
    SET* blocktolinkvars;
    BLOCKINFO* blockinfolist;
    SCIP_HASHTABLE* htable;
+   BLOCKJOB* blockjobs;
+   void** blockjobargs;
    int* varlabels;
    int* conslabels;
    int* blockstartsconss;
@@ -834,7 +1159,6 @@ static SCIP_DECL_HEUREXEC(heurExecPADM)
    SCIP_Real slackthreshold;
    SCIP_Real memory; /* in MB */
    SCIP_Real timeleft;
-   SCIP_STATUS status;
    SCIP_Bool solutionsdiffer;
    SCIP_Bool solved;
    SCIP_Bool doscaling;
@@ -850,6 +1174,7 @@ static SCIP_DECL_HEUREXEC(heurExecPADM)
    int piter;
    int increasedslacks;
    int blockinfolistfill;
+   int nthreads;
    SCIP_Longint nodesleft;
    int i;
    int b;
@@ -880,6 +1205,8 @@ static SCIP_DECL_HEUREXEC(heurExecPADM)
    varonlyobj = NULL;
    blockinfolist = NULL;
    htable = NULL;
+   blockjobs = NULL;
+   blockjobargs = NULL;
 
    nodesleft = heurdata->maxnodes;
    gap = heurdata->gap;
@@ -1292,6 +1619,21 @@ static SCIP_DECL_HEUREXEC(heurExecPADM)
       goto TERMINATE;
    }
 
+   SCIP_CALL( SCIPallocBufferArray(scip, &blockjobs, problem->nblocks) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &blockjobargs, problem->nblocks) );
+   for( b = 0; b < problem->nblocks; b++ )
+      blockjobargs[b] = (void*)&blockjobs[b];
+
+   /* the clocks of the sub-SCIPs have to measure wall clock time if the blocks are solved concurrently */
+   nthreads = MIN(heurdata->nthreads, problem->nblocks);
+   if( nthreads > 1 )
+   {
+      for( b = 0; b < problem->nblocks; b++ )
+      {
+         SCIP_CALL( SCIPsetIntParam((problem->blocks[b]).subscip, "timing/clocktype", (int)SCIP_CLOCKTYPE_WALL) );
+      }
+   }
+
    SCIPdebugMsg(scip, "Starting iterations\n");
    SCIPdebugMsg(scip, "PIt\tADMIt\tSlacks\tInfo\n");
 
@@ -1315,205 +1657,67 @@ static SCIP_DECL_HEUREXEC(heurExecPADM)
          solutionsdiffer = FALSE;
          SCIPdebugMsg(scip, "%d\t%d\t%d\t%s\n", piter, aiter, increasedslacks, info);
 
-         /* Loop through the blocks and solve each sub-SCIP, potentially multiple times */
-         for( b = 0; b < problem->nblocks; b++ )
+         /* in every ADM iteration, each block is solved once for fixed linking variable values of the other blocks */
+         if( nthreads > 1 )
          {
-            for( i = 0; i < blocktolinkvars[b].size; i++ )
-            {
-               int linkvaridx;
-               linkvaridx = blocktolinkvars[b].indexes[i];
-
-               for( k = 0; k < linkvartoblocks[linkvaridx].size; k++ )
-               {
-                  int b2;
-                  b2 = linkvartoblocks[linkvaridx].indexes[k];
+            SCIP_JOBBATCH* jobbatch;
+            SCIP_RETCODE retcode;
 
-                  if( b2 != b )
-                  {
-                     BLOCKINFO binfo;
-                     BLOCKINFO* binfoout;
-                     BLOCKINFO binfo2;
-                     BLOCKINFO* binfo2out;
-
-                     SCIP_CONS* couplingcons;
-                     SCIP_Real newrhs;
-
-                     binfo.block = b;
-                     binfo.otherblock = b2;
-                     binfo.linkvaridx = linkvaridx;
-
-                     binfoout = (BLOCKINFO*) SCIPhashtableRetrieve(htable, (void *)&binfo);
-                     assert(binfoout != NULL);
-                     couplingcons = binfoout->couplingCons;
-
-                     /* interchange blocks b and b2 for getting new right hand side */
-                     binfo2.block = b2;
-                     binfo2.otherblock = b;
-                     binfo2.linkvaridx = linkvaridx;
-                     binfo2out = (BLOCKINFO*) SCIPhashtableRetrieve(htable, (void*) &binfo2);
-                     assert(binfo2out != NULL);
-                     newrhs = binfo2out->linkvarval;
-
-                     /* change side of coupling constraint equation with linking variable value of the other block */
-                     SCIP_CALL( SCIPchgLhsLinear((problem->blocks[b]).subscip, couplingcons, newrhs) );
-                     SCIP_CALL( SCIPchgRhsLinear((problem->blocks[b]).subscip, couplingcons, newrhs) );
-
-                     /* change penalty coefficients of slack variables */
-                     SCIP_CALL( SCIPchgVarObj((problem->blocks[b]).subscip, binfoout->slackposvar, binfoout->slackposobjcoeff) );
-                     SCIP_CALL( SCIPchgVarObj((problem->blocks[b]).subscip, binfoout->slacknegvar, binfoout->slacknegobjcoeff) );
-                  }
-               }
+            /* stop if there are not enough nodes left */
+            if( nodesleft < heurdata->minnodes )
+            {
+               SCIPdebugMsg(scip, "Node limit reached.\n");
+               goto TERMINATE;
             }
 
-            /* increase slack penalty coeffs until each subproblem can be solved to optimality */
-            do
+            /* all blocks use the linking variable values of the previous iteration, such that they can be solved
+             * concurrently; each block may use the nodes that were left at the start of the iteration
+             */
+            for( b = 0; b < problem->nblocks; b++ )
             {
-               SCIP_Longint nnodes;
-               int iteration;
-
-#ifdef PADM_WRITE_PROBLEMS
-               SCIPdebugMsg(scip, "write subscip of block %d in piter=%d and aiter=%d\n", b, piter, aiter);
-               (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "blockproblem_%d_%d_%d.lp", b, piter, aiter);
-               SCIP_CALL( SCIPwriteOrigProblem((problem->blocks[b]).subscip, name, NULL, FALSE) );
-#endif
-
-               SCIP_CALL( SCIPsetRealParam((problem->blocks[b]).subscip, "limits/gap", gap) );
+               SCIP_CALL( updateBlockCoupling(problem, b, blocktolinkvars, linkvartoblocks, htable) );
+               initBlockJob(&blockjobs[b], scip, heurdata, problem, b, blocktolinkvars, linkvartoblocks, htable, gap,
+                  piter, aiter, nodesleft);
+            }
 
-               /* reuse old solution if available */
-               SCIP_CALL( reuseSolution((problem->blocks[b]).subscip, &problem->blocks[b]) );
+            /* the main SCIP is only read by the jobs while it waits for the batch to finish */
+            SCIP_CALL( SCIPtpiStartJobBatch(&jobbatch, solveBlockJob, blockjobargs, problem->nblocks, nthreads) );
+            retcode = SCIPtpiFinishJobBatch(&jobbatch);
+            SCIP_CALL( retcode );
 
-               /* update time and memory limit of subproblem */
-               SCIP_CALL( SCIPcopyLimits(scip, (problem->blocks[b]).subscip) );
+            for( b = 0; b < problem->nblocks; b++ )
+            {
+               nodesleft -= blockjobs[b].nodesleft - blockjobs[b].nodesleftafter;
+               solutionsdiffer = solutionsdiffer || blockjobs[b].solutionsdiffer;
+               istimeleft = istimeleft && !blockjobs[b].timelimit;
+            }
 
-               /* stop if there are not enough nodes left */
-               if( nodesleft < heurdata->minnodes )
-               {
-                  SCIPdebugMsg(scip, "Node limit reached.\n");
+            for( b = 0; b < problem->nblocks; b++ )
+            {
+               if( blockjobs[b].terminate )
                   goto TERMINATE;
-               }
+            }
+         }
+         else
+         {
+            /* Loop through the blocks and solve each sub-SCIP, potentially multiple times; later blocks already use
+             * the linking variable values of the blocks solved before in this iteration
+             */
+            for( b = 0; b < problem->nblocks; b++ )
+            {
+               SCIP_CALL( updateBlockCoupling(problem, b, blocktolinkvars, linkvartoblocks, htable) );
+               initBlockJob(&blockjobs[b], scip, heurdata, problem, b, blocktolinkvars, linkvartoblocks, htable, gap,
+                  piter, aiter, nodesleft);
 
-               /* update node limit of subproblem
-                * in the first iterations we have a smaller node limit
-                */
-               iteration = ((piter - 1) * heurdata->admiterations) + aiter;
-               nnodes = (SCIP_Longint)SCIPceil(scip, (problem->blocks[b]).size * nodesleft * ( 1 - pow(heurdata->nodefac, (double)iteration) ));
-               nnodes = MAX( heurdata->minnodes, nnodes );
-               SCIP_CALL( SCIPsetLongintParam((problem->blocks[b]).subscip, "limits/nodes", nnodes) );
-
-               /* solve block */
-               SCIP_CALL( SCIPsolve((problem->blocks[b]).subscip) );
-               status = SCIPgetStatus((problem->blocks[b]).subscip);
-
-               /* subtract used nodes from the total nodelimit */
-               nodesleft -= (SCIP_Longint)SCIPceil(scip, SCIPgetNNodes((problem->blocks[b]).subscip) * (problem->blocks[b]).size);
-
-               /* check solution if one of the four cases occurs
-                * - solution is optimal
-                * - solution reached gaplimit
-                * - node limit reached with at least one feasible solution
-                * - time limit is reached but best solution needs no slack variables (no dual solution available)
-                */
-               if( status == SCIP_STATUS_OPTIMAL || status == SCIP_STATUS_GAPLIMIT ||
-                     (status == SCIP_STATUS_NODELIMIT && SCIPgetNSols((problem->blocks[b]).subscip) > 0) ||
-                     (status == SCIP_STATUS_TIMELIMIT && SCIPgetNSols((problem->blocks[b]).subscip) > 0 && 
-                     SCIPisEQ(scip, SCIPgetSolOrigObj((problem->blocks[b]).subscip, SCIPgetBestSol((problem->blocks[b]).subscip)), 0.0) ) )
-               {
-                  SCIPdebugMsg(scip, "Block is optimal or reached gaplimit or nodelimit.\n");
+               SCIP_CALL( solveBlockJob((void*)&blockjobs[b]) );
 
-                  if( status == SCIP_STATUS_TIMELIMIT )
-                  {
-                     SCIPdebugMsg(scip, "Block reached time limit with at least one feasible solution.\n");
-                     istimeleft = FALSE;
-                  }
+               nodesleft = blockjobs[b].nodesleftafter;
+               solutionsdiffer = solutionsdiffer || blockjobs[b].solutionsdiffer;
+               istimeleft = istimeleft && !blockjobs[b].timelimit;
 
-                  for( i = 0; i < blocktolinkvars[b].size; i++ )
-                  {
-                     int linkvaridx;
-                     linkvaridx = blocktolinkvars[b].indexes[i];
-
-                     for( k = 0; k < linkvartoblocks[linkvaridx].size; k++ )
-                     {
-                        int b2;
-                        b2 = linkvartoblocks[linkvaridx].indexes[k];
-
-                        if( b2 != b )
-                        {
-                           SCIP_SOL* sol;
-                           BLOCKINFO binfo;
-                           BLOCKINFO* binfoout;
-                           SCIP_VAR* var;
-                           SCIP_Real val;
-
-                           binfo.block = b;
-                           binfo.otherblock = b2;
-                           binfo.linkvaridx = linkvaridx;
-                           binfoout = (BLOCKINFO *)SCIPhashtableRetrieve(htable, (void *)&binfo);
-                           assert(binfoout != NULL);
-
-                           sol = SCIPgetBestSol((problem->blocks[b]).subscip);
-                           assert(sol != NULL);
-                           var = binfoout->linkvar;
-                           val = SCIPgetSolVal((problem->blocks[b]).subscip, sol, var);
-
-                           if( !EPSEQ(binfoout->linkvarval, val, SCIP_DEFAULT_EPSILON) )
-                              solutionsdiffer = TRUE;
-
-                           binfoout->linkvarval = val;
-                        }
-                     }
-                  }
-               }
-               else if( status == SCIP_STATUS_UNBOUNDED )
-               {
-                  SCIPdebugMsg(scip, "Block is unbounded.\n");
-                  for( i = 0; i < blocktolinkvars[b].size; i++ )
-                  {
-                     int linkvaridx;
-                     linkvaridx = blocktolinkvars[b].indexes[i];
-
-                     for( k = 0; k < linkvartoblocks[linkvaridx].size; k++ )
-                     {
-                        int b2;
-                        b2 = linkvartoblocks[linkvaridx].indexes[k];
-
-                        if( b2 != b )
-                        {
-                           BLOCKINFO binfo;
-                           BLOCKINFO* binfoout;
-
-                           binfo.block = b;
-                           binfo.otherblock = b2;
-                           binfo.linkvaridx = linkvaridx;
-                           binfoout = (BLOCKINFO*) SCIPhashtableRetrieve(htable, (void*) &binfo);
-                           assert(binfoout != NULL);
-
-                           /* increase penalty coefficients to obtain a bounded subproblem */
-                           binfoout->slackposobjcoeff *= 10.0;
-                           binfoout->slacknegobjcoeff *= 10.0;
-                           SCIP_CALL( SCIPchgVarObj((problem->blocks[b]).subscip, binfoout->slackposvar, binfoout->slackposobjcoeff) );
-                           SCIP_CALL( SCIPchgVarObj((problem->blocks[b]).subscip, binfoout->slacknegvar, binfoout->slacknegobjcoeff) );
-                        }
-                     }
-                  }
-               }
-               else if( status == SCIP_STATUS_TIMELIMIT )
-               {
-                  SCIPdebugMsg(scip, "Block reached time limit. No optimal solution available.\n");
-                  goto TERMINATE;
-               }
-               else
-               {
-                  SCIPdebugMsg(scip, "Block solving status %d not supported\n", status);
+               if( blockjobs[b].terminate )
                   goto TERMINATE;
-               }
-
-               /* free solving data in order to change problem */
-               SCIP_CALL( SCIPfreeTransform((problem->blocks[b]).subscip) );
             }
-            while( status != SCIP_STATUS_OPTIMAL && status != SCIP_STATUS_GAPLIMIT &&
-                   !(status == SCIP_STATUS_NODELIMIT && SCIPgetNSols((problem->blocks[b]).subscip) > 0) &&
-                   !(status == SCIP_STATUS_TIMELIMIT && SCIPgetNSols((problem->blocks[b]).subscip) > 0 && 
-                   SCIPisEQ(scip, SCIPgetSolOrigObj((problem->blocks[b]).subscip, SCIPgetBestSol((problem->blocks[b]).subscip)), 0.0) ) );
          }
       }
 
@@ -1718,6 +1922,12 @@ TERMINATE:
       }
    }
 
+   if( blockjobargs != NULL )
+      SCIPfreeBufferArray(scip, &blockjobargs);
+
+   if( blockjobs != NULL )
+      SCIPfreeBufferArray(scip, &blockjobs);
+
    if( htable != NULL )
       SCIPhashtableFree(&htable);
 
@@ -1852,5 +2062,9 @@ SCIP_RETCODE SCIPincludeHeurPADM(
       "should the heuristic run before or after the processing of the node? (0: before, 1: after, 2: both)",
       &heurdata->timing, FALSE, 0, 0, 2, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddIntParam(scip, "heuristics/" HEUR_NAME "/nthreads",
+      "number of threads to solve the blocks of an ADM iteration concurrently (1: solve blocks sequentially)",
+      &heurdata->nthreads, FALSE, DEFAULT_NTHREADS, 1, 256, NULL, NULL) );
+
    return SCIP_OKAY;
 }
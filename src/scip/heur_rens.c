@@ -94,6 +94,7 @@
 /* event handler properties */
 #define EVENTHDLR_NAME         "Rens"
 #define EVENTHDLR_DESC         "LP event handler for " HEUR_NAME " heuristic"
+#define SCIP_EVENTTYPE_RENSASYNC (SCIP_EVENTTYPE_LPSOLVED | SCIP_EVENTTYPE_NODESOLVED) /* events of an asynchronous sub-SCIP */
 
 /*
  * Data structures
@@ -109,7 +110,6 @@ struct SCIP_HeurData
    SCIP_Real             minfixingrate;      /**< minimum percentage of integer variables that have to be fixed       */
    SCIP_Real             minimprove;         /**< factor by which RENS should at least improve the incumbent          */
    SCIP_Real             nodesquot;          /**< subproblem nodes in relation to nodes of the original problem       */
-   SCIP_Real             nodelimit;          /**< the nodelimit employed in the current sub-SCIP, for the event handler*/
    SCIP_Real             lplimfac;           /**< factor by which the limit on the number of LP depends on the node limit */
    char                  startsol;           /**< solution used for fixing values ('l'p relaxation, 'n'lp relaxation) */
    SCIP_Bool             binarybounds;       /**< should general integers get binary bounds [floor(.),ceil(.)] ?      */
@@ -126,6 +126,30 @@ struct SCIP_HeurData
    SCIP_Bool             useuct;             /**< should uct node selection be used at the beginning of the search?  */
 };
 
+/** event handler data; copied per sub-SCIP, such that an asynchronous sub-SCIP does not read the heuristic data */
+struct SCIP_EventData
+{
+   SCIP_HEURSNAPSHOT*    snapshot;           /**< snapshot of an asynchronous call, or NULL */
+   SCIP_Real             nodelimit;          /**< the nodelimit employed in the sub-SCIP */
+   SCIP_Real             lplimfac;           /**< factor by which the limit on the number of LP depends on the node limit */
+};
+
+/** sub-SCIP of an asynchronous RENS call */
+struct RensJob
+{
+   SCIP*                 subscip;            /**< the subproblem created by RENS */
+   SCIP_VAR**            subvars;            /**< subproblem's variables in the order of the snapshot variables */
+   SCIP_EVENTHDLR*       eventhdlr;          /**< event handler for LP events of the sub-SCIP */
+   SCIP_EVENTDATA        eventdata;          /**< data of the event handler */
+   SCIP_Real             intfixingrate;      /**< percentage of integer variables fixed */
+   SCIP_Real             minfixingrate;      /**< minimum percentage of integer variables that have to be fixed */
+   SCIP_Real             allfixingrate;      /**< percentage of all variables fixed after presolving */
+   SCIP_RETCODE          retcode;            /**< return code of presolving and solving the sub-SCIP */
+   SCIP_Bool             solved;             /**< was the sub-SCIP solved? */
+   int                   nvars;              /**< length of the subvars array */
+};
+typedef struct RensJob RENSJOB;
+
 
 /*
  * Local methods
@@ -315,19 +339,21 @@ SCIP_RETCODE restrictToBinaryBounds(
 static
 SCIP_DECL_EVENTEXEC(eventExecRens)
 {
-   SCIP_HEURDATA* heurdata;
-
    assert(eventhdlr != NULL);
    assert(eventdata != NULL);
    assert(strcmp(SCIPeventhdlrGetName(eventhdlr), EVENTHDLR_NAME) == 0);
    assert(event != NULL);
-   assert(SCIPeventGetType(event) & SCIP_EVENTTYPE_LPSOLVED);
-
-   heurdata = (SCIP_HEURDATA*)eventdata;
-   assert(heurdata != NULL);
+   assert(SCIPeventGetType(event) & (eventdata->snapshot != NULL ? SCIP_EVENTTYPE_RENSASYNC : SCIP_EVENTTYPE_LPSOLVED));
 
+   /* interrupt an asynchronous sub-SCIP whose results are not needed anymore */
+   if( eventdata->snapshot != NULL && SCIPheurSnapshotIsInterrupted(eventdata->snapshot) )
+   {
+      SCIPdebugMsg(scip, "interrupt asynchronous sub-SCIP\n");
+      SCIP_CALL( SCIPinterruptSolve(scip) );
+   }
    /* interrupt solution process of sub-SCIP */
-   if( SCIPgetNLPs(scip) > heurdata->lplimfac * heurdata->nodelimit )
+   else if( SCIPeventGetType(event) == SCIP_EVENTTYPE_LPSOLVED
+      && SCIPgetNLPs(scip) > eventdata->lplimfac * eventdata->nodelimit )
    {
       SCIPdebugMsg(scip, "interrupt after %" SCIP_LONGINT_FORMAT " LPs\n",SCIPgetNLPs(scip));
       SCIP_CALL( SCIPinterruptSolve(scip) );
@@ -336,42 +362,41 @@ SCIP_DECL_EVENTEXEC(eventExecRens)
    return SCIP_OKAY;
 }
 
-/** setup and solve the RENS sub-SCIP */
+/** sets up the RENS sub-SCIP: copies the problem with the given fixings, restricts general integers, sets the
+ *  sub-SCIP parameters and the objective limit
+ */
 static
-SCIP_RETCODE setupAndSolveSubscip(
+SCIP_RETCODE setupSubscip(
    SCIP*                 scip,               /**< SCIP data structure */
    SCIP*                 subscip,            /**< sub SCIP data structure */
-   SCIP_RESULT*          result,             /**< result pointer */
    SCIP_HEUR*            heur,               /**< heuristic data structure */
+   SCIP_VAR**            subvars,            /**< array to store the subproblem's variables in the order of the problem
+                                              *   variables */
+   SCIP_EVENTHDLR**      eventhdlr,          /**< pointer to store the event handler for LP events of the sub-SCIP */
    SCIP_VAR**            fixedvars,          /**< array of variables that should be fixed */
    SCIP_Real*            fixedvals,          /**< array of fixing values */
    int                   nfixedvars,         /**< number of variables that should be fixed */
-   SCIP_Real             intfixingrate,      /**< percentage of integer variables fixed           */
-   SCIP_Real             minfixingrate,      /**< minimum percentage of integer variables that have to be fixed       */
    SCIP_Real             minimprove,         /**< factor by which RENS should at least improve the incumbent          */
    SCIP_Longint          maxnodes,           /**< maximum number of  nodes for the subproblem                         */
    SCIP_Longint          nstallnodes,        /**< number of stalling nodes for the subproblem                         */
    char                  startsol,           /**< solution used for fixing values ('l'p relaxation, 'n'lp relaxation) */
    SCIP_Bool             binarybounds,       /**< should general integers get binary bounds [floor(.),ceil(.)]?       */
-   SCIP_Bool             uselprows           /**< should subproblem be created out of the rows in the LP rows? */
+   SCIP_Bool             uselprows,          /**< should subproblem be created out of the rows in the LP rows? */
+   SCIP_Bool             async               /**< is the sub-SCIP solved on another thread? */
    )
 {
    SCIP_VAR** vars;                          /* original problem's variables                    */
-   SCIP_VAR** subvars;                       /* subproblem's variables                          */
    SCIP_HEURDATA* heurdata;                  /* heuristic data */
-   SCIP_EVENTHDLR* eventhdlr;                /* event handler for LP events                     */
    SCIP_HASHMAP* varmapfw;                   /* mapping of SCIP variables to sub-SCIP variables */
    SCIP_Real cutoff;                         /* objective cutoff for the subproblem             */
-   SCIP_Real allfixingrate;                  /* percentage of all variables fixed               */
    SCIP_Bool success;
-   int i;
    int nvars;              /* number of original problem's variables */
-   SCIP_RETCODE retcode;
 
    assert(scip != NULL);
    assert(subscip != NULL);
    assert(heur != NULL);
-   assert(result != NULL);
+   assert(subvars != NULL);
+   assert(eventhdlr != NULL);
 
    heurdata = SCIPheurGetData(heur);
    assert(heurdata != NULL);
@@ -382,23 +407,29 @@ SCIP_RETCODE setupAndSolveSubscip(
    /* create the variable mapping hash map */
    SCIP_CALL( SCIPhashmapCreate(&varmapfw, SCIPblkmem(subscip), nvars) );
 
-   /* create a problem copy as sub SCIP */
-   SCIP_CALL( SCIPcopyLargeNeighborhoodSearch(scip, subscip, varmapfw, "rens", fixedvars, fixedvals, nfixedvars, uselprows,
-         heurdata->copycuts, &success, NULL) );
+   /* create a problem copy as sub SCIP; a sub-SCIP on another thread must not share the message handler */
+   if( async )
+   {
+      SCIP_CALL( SCIPcopyLargeNeighborhoodSearchAsync(scip, subscip, varmapfw, "rens", fixedvars, fixedvals, nfixedvars,
+            uselprows, heurdata->copycuts, &success, NULL) );
+   }
+   else
+   {
+      SCIP_CALL( SCIPcopyLargeNeighborhoodSearch(scip, subscip, varmapfw, "rens", fixedvars, fixedvals, nfixedvars,
+            uselprows, heurdata->copycuts, &success, NULL) );
+   }
 
-   eventhdlr = NULL;
+   *eventhdlr = NULL;
    /* create event handler for LP events */
-   SCIP_CALL( SCIPincludeEventhdlrBasic(subscip, &eventhdlr, EVENTHDLR_NAME, EVENTHDLR_DESC, eventExecRens, NULL) );
-   if( eventhdlr == NULL )
+   SCIP_CALL( SCIPincludeEventhdlrBasic(subscip, eventhdlr, EVENTHDLR_NAME, EVENTHDLR_DESC, eventExecRens, NULL) );
+   if( *eventhdlr == NULL )
    {
       SCIPerrorMessage("event handler for " HEUR_NAME " heuristic not found.\n");
       return SCIP_PLUGINNOTFOUND;
    }
 
    /* copy subproblem variables into the same order as the source SCIP variables */
-   SCIP_CALL( SCIPallocBufferArray(scip, &subvars, nvars) );
-   for( i = 0; i < nvars; i++ )
-      subvars[i] = (SCIP_VAR*) SCIPhashmapGetImage(varmapfw, vars[i]);
+   SCIPhashmapGetImages(varmapfw, (void**)vars, (void**)subvars, nvars);
 
    /* free hash map */
    SCIPhashmapFree(&varmapfw);
@@ -409,7 +440,7 @@ SCIP_RETCODE setupAndSolveSubscip(
       SCIP_CALL( restrictToBinaryBounds(scip, subscip, subvars, startsol) );
    }
 
-   SCIPdebugMsg(scip, "RENS subproblem: %d vars, %d cons\n", SCIPgetNVars(subscip), SCIPgetNConss(subscip));
+   SCIPdebugMsg(scip, "RENS subproblem: %d vars, %d cons, success=%u\n", SCIPgetNVars(subscip), SCIPgetNConss(subscip), success);
 
    /* do not abort subproblem on CTRL-C */
    SCIP_CALL( SCIPsetBoolParam(subscip, "misc/catchctrlc", FALSE) );
@@ -426,7 +457,6 @@ SCIP_RETCODE setupAndSolveSubscip(
 
    /* set limits for the subproblem */
    SCIP_CALL( SCIPcopyLimits(scip, subscip) );
-   heurdata->nodelimit = maxnodes;
    SCIP_CALL( SCIPsetLongintParam(subscip, "limits/stallnodes", nstallnodes) );
    SCIP_CALL( SCIPsetLongintParam(subscip, "limits/nodes", maxnodes) );
    SCIP_CALL( SCIPsetIntParam(subscip, "limits/bestsol", heurdata->bestsollimit) );
@@ -514,97 +544,237 @@ SCIP_RETCODE setupAndSolveSubscip(
       SCIP_CALL(SCIPsetObjlimit(subscip, cutoff));
    }
 
+   return SCIP_OKAY;
+}
+
+/** presolves the RENS sub-SCIP and solves it if presolving fixed enough variables
+ *
+ *  Only the sub-SCIP and the event handler data are accessed, such that this can run on a thread of its own. The
+ *  return code of presolving and solving is returned to the caller, which decides how to handle errors in the
+ *  subproblem. An asynchronous call stops as soon as its snapshot is interrupted.
+ */
+static
+SCIP_RETCODE solveSubscip(
+   SCIP*                 subscip,            /**< sub SCIP data structure */
+   SCIP_EVENTHDLR*       eventhdlr,          /**< event handler for LP events of the sub-SCIP */
+   SCIP_EVENTDATA*       eventdata,          /**< data of the event handler */
+   SCIP_Real             minfixingrate,      /**< minimum percentage of integer variables that have to be fixed       */
+   SCIP_Real*            allfixingrate,      /**< pointer to store the percentage of all variables fixed after presolving */
+   SCIP_Bool*            solved              /**< pointer to store whether the sub-SCIP was solved */
+   )
+{
+   SCIP_EVENTTYPE eventtype;
+   SCIP_RETCODE retcode;
+
+   assert(subscip != NULL);
+   assert(eventhdlr != NULL);
+   assert(eventdata != NULL);
+   assert(allfixingrate != NULL);
+   assert(solved != NULL);
+
+   *allfixingrate = 0.0;
+   *solved = FALSE;
+
+   if( eventdata->snapshot != NULL && SCIPheurSnapshotIsInterrupted(eventdata->snapshot) )
+      return SCIP_OKAY;
+
    /* presolve the subproblem */
    retcode = SCIPpresolve(subscip);
-
-   /* errors in solving the subproblem should not kill the overall solving process;
-    * hence, the return code is caught and a warning is printed, only in debug mode, SCIP will stop.
-    */
    if( retcode != SCIP_OKAY )
-   {
-      SCIPwarningMessage(scip, "Error while presolving subproblem in RENS heuristic; sub-SCIP terminated with code <%d>\n", retcode);
-      SCIPABORT();  /*lint --e{527}*/
-      goto TERMINATE;
-   }
+      return retcode;
 
-   SCIPdebugMsg(scip, "RENS presolved subproblem: %d vars, %d cons, success=%u\n", SCIPgetNVars(subscip), SCIPgetNConss(subscip), success);
+   SCIPdebugMsg(subscip, "RENS presolved subproblem: %d vars, %d cons\n", SCIPgetNVars(subscip), SCIPgetNConss(subscip));
 
-   allfixingrate = (SCIPgetNOrigVars(subscip) - SCIPgetNVars(subscip)) / (SCIP_Real)SCIPgetNOrigVars(subscip);
+   *allfixingrate = (SCIPgetNOrigVars(subscip) - SCIPgetNVars(subscip)) / (SCIP_Real)SCIPgetNOrigVars(subscip);
 
    /* additional variables added in presolving may lead to the subSCIP having more variables than the original */
-   allfixingrate = MAX(allfixingrate, 0.0);
+   *allfixingrate = MAX(*allfixingrate, 0.0);
 
    /* after presolving, we should have at least reached a certain fixing rate over ALL variables (including continuous)
     * to ensure that not only the MIP but also the LP relaxation is easy enough
     */
-   if( allfixingrate >= minfixingrate / 2.0 )
+   if( *allfixingrate < minfixingrate / 2.0 )
+      return SCIP_OKAY;
+
+   /* solving resets an interruption of the sub-SCIP, hence the interruption is checked again by the event handler */
+   if( eventdata->snapshot != NULL && SCIPheurSnapshotIsInterrupted(eventdata->snapshot) )
+      return SCIP_OKAY;
+
+   /* catch LP events of sub-SCIP, and node events of an asynchronous sub-SCIP to interrupt it */
+   eventtype = (eventdata->snapshot != NULL ? SCIP_EVENTTYPE_RENSASYNC : SCIP_EVENTTYPE_LPSOLVED);
+   SCIP_CALL( SCIPtransformProb(subscip) );
+   SCIP_CALL( SCIPcatchEvent(subscip, eventtype, eventhdlr, eventdata, NULL) );
+
+   /* solve the subproblem */
+   SCIPdebugMsg(subscip, "solving subproblem: nodelimit=%.0f\n", eventdata->nodelimit);
+   retcode = SCIPsolve(subscip);
+
+   /* drop LP events of sub-SCIP */
+   SCIP_CALL( SCIPdropEvent(subscip, eventtype, eventhdlr, eventdata, -1) );
+
+   *solved = (retcode == SCIP_OKAY);
+
+   return retcode;
+}
+
+/** transfers the variable statistics and the solutions of a solved RENS sub-SCIP to the main SCIP */
+static
+SCIP_RETCODE finishSubscip(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP*                 subscip,            /**< sub SCIP data structure */
+   SCIP_HEUR*            heur,               /**< heuristic data structure */
+   SCIP_VAR**            vars,               /**< problem variables the sub-SCIP was created from */
+   SCIP_VAR**            subvars,            /**< subproblem's variables in the order of the problem variables */
+   int                   nvars,              /**< number of problem variables */
+   SCIP_Real             intfixingrate,      /**< percentage of integer variables fixed           */
+   SCIP_Real             allfixingrate,      /**< percentage of all variables fixed after presolving */
+   SCIP_Bool             solved,             /**< was the sub-SCIP solved? */
+   SCIP_RESULT*          result              /**< result pointer */
+   )
+{
+   SCIP_HEURDATA* heurdata;
+   SCIP_SOL** subsols;
+   SCIP_Bool success;
+   int nsubsols;
+   int i;
+
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+
+   if( !solved )
+   {
+      SCIPstatisticPrintf("RENS statistic: fixed only %6.3f integer variables, %6.3f all variables --> abort \n", intfixingrate, allfixingrate);
+      return SCIP_OKAY;
+   }
+
+   /* transfer variable statistics from sub-SCIP */
+   SCIP_CALL( SCIPmergeVariableStatistics(subscip, scip, subvars, vars, nvars) );
+
+   /* print solving statistics of subproblem if we are in SCIP's debug mode */
+   SCIPdebug( SCIP_CALL( SCIPprintStatistics(subscip, NULL) ) );
+
+   /* check, whether a solution was found;
+    * due to numerics, it might happen that not all solutions are feasible -> try all solutions until one was accepted
+    */
+   nsubsols = SCIPgetNSols(subscip);
+   subsols = SCIPgetSols(subscip);
+   success = FALSE;
+   for( i = 0; i < nsubsols && (!success || heurdata->addallsols); ++i )
    {
-      SCIP_SOL** subsols;
-      int nsubsols;
+      SCIP_SOL* newsol;
 
-      /* catch LP events of sub-SCIP */
-      assert(eventhdlr != NULL);
-      SCIP_CALL( SCIPtransformProb(subscip) );
-      SCIP_CALL( SCIPcatchEvent(subscip, SCIP_EVENTTYPE_LPSOLVED, eventhdlr, (SCIP_EVENTDATA*) heurdata, NULL) );
+      SCIP_CALL( SCIPtranslateSubSol(scip, subscip, subsols[i], heur, subvars, &newsol) );
 
-      /* solve the subproblem */
-      SCIPdebugMsg(scip, "solving subproblem: nstallnodes=%" SCIP_LONGINT_FORMAT ", maxnodes=%" SCIP_LONGINT_FORMAT "\n", nstallnodes, maxnodes);
-      retcode = SCIPsolve(subscip);
+      SCIP_CALL( SCIPtrySolFree(scip, &newsol, FALSE, FALSE, TRUE, TRUE, TRUE, &success) );
+      if( success )
+         *result = SCIP_FOUNDSOL;
+   }
 
-      /* drop LP events of sub-SCIP */
-      SCIP_CALL( SCIPdropEvent(subscip, SCIP_EVENTTYPE_LPSOLVED, eventhdlr, (SCIP_EVENTDATA*) heurdata, -1) );
+   SCIPstatisticPrintf("RENS statistic: fixed %6.3f integer variables, %6.3f all variables, needed %6.1f seconds, %" SCIP_LONGINT_FORMAT " nodes, solution %10.4f found at node %" SCIP_LONGINT_FORMAT "\n",
+         intfixingrate, allfixingrate, SCIPgetSolvingTime(subscip), SCIPgetNNodes(subscip), success ? SCIPgetPrimalbound(scip) : SCIPinfinity(scip),
+               nsubsols > 0 ? SCIPsolGetNodenum(SCIPgetBestSol(subscip)) : -1 );
 
-      /* errors in solving the subproblem should not kill the overall solving process;
-       * hence, the return code is caught and a warning is printed, only in debug mode, SCIP will stop.
-       */
-      if( retcode != SCIP_OKAY )
-      {
-         SCIPwarningMessage(scip, "Error while solving subproblem in RENS heuristic; sub-SCIP terminated with code <%d>\n", retcode);
-         SCIPABORT();
-         goto TERMINATE;
-      }
-      else
-      {
-         /* transfer variable statistics from sub-SCIP */
-         SCIP_CALL( SCIPmergeVariableStatistics(subscip, scip, subvars, vars, nvars) );
-      }
+   return SCIP_OKAY;
+}
 
-      /* print solving statistics of subproblem if we are in SCIP's debug mode */
-      SCIPdebug( SCIP_CALL( SCIPprintStatistics(subscip, NULL) ) );
+/** setup and solve the RENS sub-SCIP */
+static
+SCIP_RETCODE setupAndSolveSubscip(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP*                 subscip,            /**< sub SCIP data structure */
+   SCIP_RESULT*          result,             /**< result pointer */
+   SCIP_HEUR*            heur,               /**< heuristic data structure */
+   SCIP_VAR**            fixedvars,          /**< array of variables that should be fixed */
+   SCIP_Real*            fixedvals,          /**< array of fixing values */
+   int                   nfixedvars,         /**< number of variables that should be fixed */
+   SCIP_Real             intfixingrate,      /**< percentage of integer variables fixed           */
+   SCIP_Real             minfixingrate,      /**< minimum percentage of integer variables that have to be fixed       */
+   SCIP_Real             minimprove,         /**< factor by which RENS should at least improve the incumbent          */
+   SCIP_Longint          maxnodes,           /**< maximum number of  nodes for the subproblem                         */
+   SCIP_Longint          nstallnodes,        /**< number of stalling nodes for the subproblem                         */
+   char                  startsol,           /**< solution used for fixing values ('l'p relaxation, 'n'lp relaxation) */
+   SCIP_Bool             binarybounds,       /**< should general integers get binary bounds [floor(.),ceil(.)]?       */
+   SCIP_Bool             uselprows           /**< should subproblem be created out of the rows in the LP rows? */
+   )
+{
+   SCIP_VAR** vars;                          /* original problem's variables                    */
+   SCIP_VAR** subvars;                       /* subproblem's variables                          */
+   SCIP_EVENTHDLR* eventhdlr;                /* event handler for LP events                     */
+   SCIP_EVENTDATA eventdata;                 /* data of the event handler                       */
+   SCIP_Real allfixingrate;                  /* percentage of all variables fixed               */
+   SCIP_Bool solved;
+   int nvars;              /* number of original problem's variables */
+   SCIP_RETCODE retcode;
 
-      /* check, whether a solution was found;
-       * due to numerics, it might happen that not all solutions are feasible -> try all solutions until one was accepted
-       */
-      nsubsols = SCIPgetNSols(subscip);
-      subsols = SCIPgetSols(subscip);
-      success = FALSE;
-      for( i = 0; i < nsubsols && (!success || heurdata->addallsols); ++i )
-      {
-         SCIP_SOL* newsol;
+   assert(scip != NULL);
+   assert(subscip != NULL);
+   assert(heur != NULL);
+   assert(result != NULL);
 
-         SCIP_CALL( SCIPtranslateSubSol(scip, subscip, subsols[i], heur, subvars, &newsol) );
+   /* get variable data */
+   SCIP_CALL( SCIPgetVarsData(scip, &vars, &nvars, NULL, NULL, NULL, NULL) );
 
-         SCIP_CALL( SCIPtrySolFree(scip, &newsol, FALSE, FALSE, TRUE, TRUE, TRUE, &success) );
-         if( success )
-            *result = SCIP_FOUNDSOL;
-      }
+   SCIP_CALL( SCIPallocBufferArray(scip, &subvars, nvars) );
+
+   SCIP_CALL( setupSubscip(scip, subscip, heur, subvars, &eventhdlr, fixedvars, fixedvals, nfixedvars, minimprove,
+         maxnodes, nstallnodes, startsol, binarybounds, uselprows, FALSE) );
+
+   eventdata.snapshot = NULL;
+   eventdata.nodelimit = (SCIP_Real)maxnodes;
+   eventdata.lplimfac = SCIPheurGetData(heur)->lplimfac;
+
+   retcode = solveSubscip(subscip, eventhdlr, &eventdata, minfixingrate, &allfixingrate, &solved);
 
-      SCIPstatisticPrintf("RENS statistic: fixed %6.3f integer variables, %6.3f all variables, needed %6.1f seconds, %" SCIP_LONGINT_FORMAT " nodes, solution %10.4f found at node %" SCIP_LONGINT_FORMAT "\n",
-            intfixingrate, allfixingrate, SCIPgetSolvingTime(subscip), SCIPgetNNodes(subscip), success ? SCIPgetPrimalbound(scip) : SCIPinfinity(scip),
-                  nsubsols > 0 ? SCIPsolGetNodenum(SCIPgetBestSol(subscip)) : -1 );
+   /* errors in solving the subproblem should not kill the overall solving process;
+    * hence, the return code is caught and a warning is printed, only in debug mode, SCIP will stop.
+    */
+   if( retcode != SCIP_OKAY )
+   {
+      SCIPwarningMessage(scip, "Error while solving subproblem in RENS heuristic; sub-SCIP terminated with code <%d>\n", retcode);
+      SCIPABORT();  /*lint --e{527}*/
    }
    else
    {
-      SCIPstatisticPrintf("RENS statistic: fixed only %6.3f integer variables, %6.3f all variables --> abort \n", intfixingrate, allfixingrate);
+      SCIP_CALL( finishSubscip(scip, subscip, heur, vars, subvars, nvars, intfixingrate, allfixingrate, solved, result) );
    }
 
-TERMINATE:
    /* free sub problem data */
    SCIPfreeBufferArray(scip, &subvars);
 
    return SCIP_OKAY;
 }
 
+/** collects the fixings of integer variables to their integral values in the start solution and checks whether
+ *  enough variables can be fixed and enough resources are left to set up the sub-SCIP
+ */
+static
+SCIP_RETCODE computeRensFixings(
+   SCIP*                 scip,               /**< original SCIP data structure                                        */
+   SCIP_VAR**            fixedvars,          /**< array to store the variables that should be fixed                   */
+   SCIP_Real*            fixedvals,          /**< array to store the fixing values                                    */
+   int*                  nfixedvars,         /**< pointer to store the number of variables that should be fixed       */
+   int                   fixedvarssize,      /**< size of the fixing arrays                                           */
+   SCIP_Real             minfixingrate,      /**< minimum percentage of integer variables that have to be fixed       */
+   char*                 startsol,           /**< pointer to solution used for fixing values                          */
+   SCIP_Real*            intfixingrate,      /**< pointer to store the percentage of integer variables fixed          */
+   SCIP_Bool*            success             /**< pointer to store whether the sub-SCIP should be set up              */
+   )
+{
+   /* compute the number of initial fixings and check if the fixing rate exceeds the minimum fixing rate */
+   SCIP_CALL( computeFixingrate(scip, fixedvars, fixedvals, nfixedvars, fixedvarssize, minfixingrate, startsol, intfixingrate, success) );
+
+   if( !(*success) )
+   {
+      SCIPstatisticPrintf("RENS statistic: fixed only %5.2f integer variables --> abort \n", *intfixingrate);
+      return SCIP_OKAY;
+   }
+
+   /* check whether there is enough time and memory left */
+   SCIP_CALL( SCIPcheckCopyLimits(scip, success) );
+
+   return SCIP_OKAY;
+}
+
 /* ---------------- external methods of RENS heuristic ---------------- */
 
 /** main procedure of the RENS heuristic, creates and solves a sub-SCIP */
@@ -657,17 +827,8 @@ SCIP_RETCODE SCIPapplyRens(
    SCIP_CALL( SCIPallocBufferArray(scip, &fixedvals, fixedvarssize) );
    nfixedvars = 0;
 
-   /* compute the number of initial fixings and check if the fixing rate exceeds the minimum fixing rate */
-   SCIP_CALL( computeFixingrate(scip, fixedvars, fixedvals, &nfixedvars, fixedvarssize, minfixingrate, &startsol, &intfixingrate, &success) );
-
-   if( !success )
-   {
-      SCIPstatisticPrintf("RENS statistic: fixed only %5.2f integer variables --> abort \n", intfixingrate);
-      goto TERMINATE;
-   }
-
-   /* check whether there is enough time and memory left */
-   SCIP_CALL( SCIPcheckCopyLimits(scip, &success) );
+   SCIP_CALL( computeRensFixings(scip, fixedvars, fixedvals, &nfixedvars, fixedvarssize, minfixingrate, &startsol,
+         &intfixingrate, &success) );
 
    if( !success )
       goto TERMINATE;
@@ -750,68 +911,206 @@ SCIP_DECL_HEURINIT(heurInitRens)
 }
 
 
-/** execution method of primal heuristic */
+/** checks whether RENS should run at the current node and computes the stall node limit for the sub-SCIP */
 static
-SCIP_DECL_HEUREXEC(heurExecRens)
-{  /*lint --e{715}*/
-   SCIP_HEURDATA* heurdata;                  /* heuristic's data                    */
-   SCIP_Longint nstallnodes;                 /* number of stalling nodes for the subproblem */
-
-   assert( heur != NULL );
-   assert( scip != NULL );
-   assert( result != NULL );
-   assert( SCIPhasCurrentNodeLP(scip) );
-
-   *result = SCIP_DELAYED;
-
-   /* do not call heuristic of node was already detected to be infeasible */
-   if( nodeinfeasible )
-      return SCIP_OKAY;
-
-   /* get heuristic data */
-   heurdata = SCIPheurGetData(heur);
-   assert( heurdata != NULL );
+SCIP_Bool shouldRunRens(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEUR*            heur,               /**< the RENS heuristic */
+   SCIP_HEURDATA*        heurdata,           /**< heuristic data */
+   SCIP_Longint*         nstallnodes,        /**< pointer to store the number of stalling nodes for the subproblem */
+   SCIP_Bool*            delayed             /**< pointer to store whether RENS should wait for a suitable relaxation solution */
+   )
+{
+   *delayed = TRUE;
 
    /* only call heuristic, if an optimal LP solution is at hand */
    if( heurdata->startsol == 'l' && SCIPgetLPSolstat(scip) != SCIP_LPSOLSTAT_OPTIMAL )
-      return SCIP_OKAY;
+      return FALSE;
 
    /* only call heuristic, if the LP objective value is smaller than the cutoff bound */
    if( heurdata->startsol == 'l' && SCIPisGE(scip, SCIPgetLPObjval(scip), SCIPgetCutoffbound(scip)) )
-      return SCIP_OKAY;
+      return FALSE;
 
    /* only continue with some fractional variables */
    if( heurdata->startsol == 'l' && SCIPgetNLPBranchCands(scip) == 0 )
-      return SCIP_OKAY;
+      return FALSE;
 
    /* do not proceed, when we should use the NLP relaxation, but there is no NLP solver included in SCIP */
    if( heurdata->startsol == 'n' && SCIPgetNNlpis(scip) == 0 )
-      return SCIP_OKAY;
+      return FALSE;
 
-   *result = SCIP_DIDNOTRUN;
+   *delayed = FALSE;
 
    /* calculate the maximal number of branching nodes until heuristic is aborted */
-   nstallnodes = (SCIP_Longint)(heurdata->nodesquot * SCIPgetNNodes(scip));
+   *nstallnodes = (SCIP_Longint)(heurdata->nodesquot * SCIPgetNNodes(scip));
 
    /* reward RENS if it succeeded often */
-   nstallnodes = (SCIP_Longint)(nstallnodes * 3.0 * (SCIPheurGetNBestSolsFound(heur)+1.0)/(SCIPheurGetNCalls(heur) + 1.0));
-   nstallnodes -= 100 * SCIPheurGetNCalls(heur);  /* count the setup costs for the sub-SCIP as 100 nodes */
-   nstallnodes += heurdata->nodesofs;
+   *nstallnodes = (SCIP_Longint)(*nstallnodes * 3.0 * (SCIPheurGetNBestSolsFound(heur)+1.0)/(SCIPheurGetNCalls(heur) + 1.0));
+   *nstallnodes -= 100 * SCIPheurGetNCalls(heur);  /* count the setup costs for the sub-SCIP as 100 nodes */
+   *nstallnodes += heurdata->nodesofs;
 
    /* determine the node limit for the current process */
-   nstallnodes -= heurdata->usednodes;
-   nstallnodes = MIN(nstallnodes, heurdata->maxnodes);
+   *nstallnodes -= heurdata->usednodes;
+   *nstallnodes = MIN(*nstallnodes, heurdata->maxnodes);
 
    /* check whether we have enough nodes left to call subproblem solving */
-   if( nstallnodes < heurdata->minnodes )
+   if( *nstallnodes < heurdata->minnodes )
    {
-      SCIPdebugMsg(scip, "skipping RENS: nstallnodes=%" SCIP_LONGINT_FORMAT ", minnodes=%" SCIP_LONGINT_FORMAT "\n", nstallnodes, heurdata->minnodes);
-      return SCIP_OKAY;
+      SCIPdebugMsg(scip, "skipping RENS: nstallnodes=%" SCIP_LONGINT_FORMAT ", minnodes=%" SCIP_LONGINT_FORMAT "\n", *nstallnodes, heurdata->minnodes);
+      return FALSE;
    }
 
    if( SCIPisStopped(scip) && !heurdata->extratime )
+      return FALSE;
+
+   return TRUE;
+}
+
+/** preparation method of asynchronous primal heuristic: determines the fixings and sets up the sub-SCIP */
+static
+SCIP_DECL_HEURASYNCPREPARE(heurAsyncPrepareRens)
+{  /*lint --e{715}*/
+   SCIP_HEURDATA* heurdata;
+   SCIP_VAR** fixedvars;
+   SCIP_Real* fixedvals;
+   RENSJOB* job;
+   SCIP_Longint nstallnodes;
+   SCIP_Real intfixingrate;
+   SCIP_Bool delayed;
+   SCIP_Bool success;
+   char startsol;
+   int fixedvarssize;
+   int nfixedvars;
+
+   assert(run != NULL);
+
+   *run = FALSE;
+
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+
+   if( !SCIPhasCurrentNodeLP(scip) || !shouldRunRens(scip, heur, heurdata, &nstallnodes, &delayed) )
+      return SCIP_OKAY;
+
+   fixedvarssize = SCIPgetNBinVars(scip) + SCIPgetNIntVars(scip);
+   SCIP_CALL( SCIPallocBufferArray(scip, &fixedvars, fixedvarssize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &fixedvals, fixedvarssize) );
+   nfixedvars = 0;
+   startsol = heurdata->startsol;
+
+   SCIP_CALL( computeRensFixings(scip, fixedvars, fixedvals, &nfixedvars, fixedvarssize, heurdata->minfixingrate,
+         &startsol, &intfixingrate, &success) );
+
+   if( success )
+   {
+      SCIP_CALL( SCIPallocBlockMemory(scip, &job) );
+      job->nvars = SCIPheurSnapshotGetNVars(snapshot);
+      job->intfixingrate = intfixingrate;
+      job->minfixingrate = heurdata->minfixingrate;
+      job->allfixingrate = 0.0;
+      job->retcode = SCIP_OKAY;
+      job->solved = FALSE;
+      assert(job->nvars == SCIPgetNVars(scip));
+
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &job->subvars, job->nvars) );
+      SCIP_CALL( SCIPcreate(&job->subscip) );
+
+      SCIP_CALL( setupSubscip(scip, job->subscip, heur, job->subvars, &job->eventhdlr, fixedvars, fixedvals, nfixedvars,
+            heurdata->minimprove, heurdata->maxnodes, nstallnodes, startsol, heurdata->binarybounds, heurdata->uselprows,
+            TRUE) );
+
+      /* the sub-SCIP runs on a thread of its own, where the CPU time of the process is not a meaningful limit */
+      SCIP_CALL( SCIPsetIntParam(job->subscip, "timing/clocktype", (int)SCIP_CLOCKTYPE_WALL) );
+
+      /* the job works on copies of the limits, since the heuristic data may change while it runs */
+      job->eventdata.snapshot = snapshot;
+      job->eventdata.nodelimit = (SCIP_Real)heurdata->maxnodes;
+      job->eventdata.lplimfac = heurdata->lplimfac;
+
+      SCIPheurSnapshotSetData(snapshot, (void*)job);
+      *run = TRUE;
+   }
+
+   SCIPfreeBufferArray(scip, &fixedvals);
+   SCIPfreeBufferArray(scip, &fixedvars);
+
+   return SCIP_OKAY;
+}
+
+/** asynchronous execution method of primal heuristic: presolves and solves the sub-SCIP */
+static
+SCIP_DECL_HEURASYNCEXEC(heurAsyncExecRens)
+{  /*lint --e{715}*/
+   RENSJOB* job;
+
+   job = (RENSJOB*)SCIPheurSnapshotGetData(snapshot);
+   assert(job != NULL);
+
+   job->retcode = solveSubscip(job->subscip, job->eventhdlr, &job->eventdata, job->minfixingrate,
+      &job->allfixingrate, &job->solved);
+
+   return job->retcode;
+}
+
+/** collection method of asynchronous primal heuristic: transfers the solutions and frees the sub-SCIP */
+static
+SCIP_DECL_HEURASYNCCOLLECT(heurAsyncCollectRens)
+{  /*lint --e{715}*/
+   RENSJOB* job;
+
+   job = (RENSJOB*)SCIPheurSnapshotGetData(snapshot);
+   assert(job != NULL);
+
+   if( !discard && job->retcode == SCIP_OKAY )
+   {
+      SCIP_RESULT result;
+
+      assert(job->nvars == SCIPheurSnapshotGetNVars(snapshot));
+
+      SCIP_CALL( finishSubscip(scip, job->subscip, heur, SCIPheurSnapshotGetVars(snapshot), job->subvars, job->nvars,
+            job->intfixingrate, job->allfixingrate, job->solved, &result) );
+   }
+
+   SCIP_CALL( SCIPfree(&job->subscip) );
+   SCIPfreeBlockMemoryArray(scip, &job->subvars, job->nvars);
+   SCIPfreeBlockMemory(scip, &job);
+   SCIPheurSnapshotSetData(snapshot, NULL);
+
+   return SCIP_OKAY;
+}
+
+/** execution method of primal heuristic */
+static
+SCIP_DECL_HEUREXEC(heurExecRens)
+{  /*lint --e{715}*/
+   SCIP_HEURDATA* heurdata;                  /* heuristic's data                    */
+   SCIP_Longint nstallnodes;                 /* number of stalling nodes for the subproblem */
+   SCIP_Bool delayed;
+
+   assert( heur != NULL );
+   assert( scip != NULL );
+   assert( result != NULL );
+   assert( SCIPhasCurrentNodeLP(scip) );
+
+   *result = SCIP_DELAYED;
+
+   /* do not call heuristic of node was already detected to be infeasible */
+   if( nodeinfeasible )
       return SCIP_OKAY;
 
+   /* get heuristic data */
+   heurdata = SCIPheurGetData(heur);
+   assert( heurdata != NULL );
+
+   if( !shouldRunRens(scip, heur, heurdata, &nstallnodes, &delayed) )
+   {
+      if( !delayed )
+         *result = SCIP_DIDNOTRUN;
+      return SCIP_OKAY;
+   }
+
+   *result = SCIP_DIDNOTRUN;
+
    SCIP_CALL( SCIPapplyRens(scip, heur, result, heurdata->minfixingrate, heurdata->minimprove,
          heurdata->maxnodes, nstallnodes, heurdata->startsol, heurdata->binarybounds, heurdata->uselprows) );
 
@@ -845,6 +1144,7 @@ SCIP_RETCODE SCIPincludeHeurRens(
    SCIP_CALL( SCIPsetHeurCopy(scip, heur, heurCopyRens) );
    SCIP_CALL( SCIPsetHeurFree(scip, heur, heurFreeRens) );
    SCIP_CALL( SCIPsetHeurInit(scip, heur, heurInitRens) );
+   SCIP_CALL( SCIPsetHeurAsync(scip, heur, heurAsyncPrepareRens, heurAsyncExecRens, heurAsyncCollectRens) );
 
    /* add rens primal heuristic parameters */
 
@@ -72,6 +72,8 @@
                                          * of the original scip be copied to constraints of the subscip
                                          */
 #define DEFAULT_USEUCT        FALSE     /* should uct node selection be used at the beginning of the search?     */
+#define DEFAULT_REUSESUBSCIP  FALSE     /* should the sub-SCIP be kept and re-armed between calls instead of copying
+                                         * the problem in every call? */
 
 /* event handler properties */
 #define EVENTHDLR_NAME         "Rins"
@@ -99,6 +101,8 @@ struct SCIP_HeurData
                                               *   to constraints in subproblem?
                                               */
    SCIP_Bool             useuct;             /**< should uct node selection be used at the beginning of the search?  */
+   SCIP_Bool             reusesubscip;       /**< should the sub-SCIP be kept and re-armed between calls?             */
+   SCIP_LNSTEMPLATE*     lnstemplate;        /**< reusable sub-SCIP, or NULL                                          */
 };
 
 /*
@@ -197,6 +201,7 @@ static
 SCIP_RETCODE wrapperRins(
    SCIP*                 scip,               /**< original SCIP data structure                        */
    SCIP*                 subscip,            /**< SCIP structure of the subproblem                    */
+   SCIP_VAR**            templatevars,       /**< variables of a re-armed sub-SCIP template, or NULL to copy the problem */
    SCIP_HEUR*            heur,               /**< Heuristic pointer                                   */
    SCIP_HEURDATA*        heurdata,           /**< Heuristic's data                                    */
    SCIP_VAR**            vars,               /**< original problem's variables                        */
@@ -216,32 +221,39 @@ SCIP_RETCODE wrapperRins(
 
    SCIP_Bool success;
 
-   int i;
+   if( templatevars == NULL )
+   {
+      /* create the variable mapping hash map */
+      SCIP_CALL( SCIPhashmapCreate(&varmapfw, SCIPblkmem(subscip), nvars) );
+
+      /* create a problem copy as sub SCIP */
+      SCIP_CALL( SCIPcopyLargeNeighborhoodSearch(scip, subscip, varmapfw, "rins", fixedvars, fixedvals, nfixedvars,
+         heurdata->uselprows, heurdata->copycuts, &success, NULL) );
 
-   /* create the variable mapping hash map */
-   SCIP_CALL( SCIPhashmapCreate(&varmapfw, SCIPblkmem(subscip), nvars) );
+      /* copy subproblem variables from map to obtain the same order */
+      SCIP_CALL( SCIPallocBufferArray(scip, &subvars, nvars) );
+      SCIPhashmapGetImages(varmapfw, (void**)vars, (void**)subvars, nvars);
 
-   /* create a problem copy as sub SCIP */
-   SCIP_CALL( SCIPcopyLargeNeighborhoodSearch(scip, subscip, varmapfw, "rins", fixedvars, fixedvals, nfixedvars,
-      heurdata->uselprows, heurdata->copycuts, &success, NULL) );
+      /* free hash map */
+      SCIPhashmapFree(&varmapfw);
+   }
+   else
+      subvars = templatevars;
 
-   eventhdlr = NULL;
-   /* create event handler for LP events */
-   SCIP_CALL( SCIPincludeEventhdlrBasic(subscip, &eventhdlr, EVENTHDLR_NAME, EVENTHDLR_DESC, eventExecRins, NULL) );
+   /* create event handler for LP events; a re-armed template already contains it from an earlier call */
+   eventhdlr = SCIPfindEventhdlr(subscip, EVENTHDLR_NAME);
+   if( eventhdlr == NULL )
+   {
+      SCIP_CALL( SCIPincludeEventhdlrBasic(subscip, &eventhdlr, EVENTHDLR_NAME, EVENTHDLR_DESC, eventExecRins, NULL) );
+   }
    if( eventhdlr == NULL )
    {
       SCIPerrorMessage("event handler for " HEUR_NAME " heuristic not found.\n");
+      if( templatevars == NULL )
+         SCIPfreeBufferArray(scip, &subvars);
       return SCIP_PLUGINNOTFOUND;
    }
 
-   /* copy subproblem variables from map to obtain the same order */
-   SCIP_CALL( SCIPallocBufferArray(scip, &subvars, nvars) );
-   for( i = 0; i < nvars; i++ )
-      subvars[i] = (SCIP_VAR*) SCIPhashmapGetImage(varmapfw, vars[i]);
-
-   /* free hash map */
-   SCIPhashmapFree(&varmapfw);
-
    /* do not abort subproblem on CTRL-C */
    SCIP_CALL( SCIPsetBoolParam(subscip, "misc/catchctrlc", FALSE) );
 
@@ -361,7 +373,8 @@ SCIP_RETCODE wrapperRins(
       *result = SCIP_FOUNDSOL;
 
    /* free subproblem */
-   SCIPfreeBufferArray(scip, &subvars);
+   if( templatevars == NULL )
+      SCIPfreeBufferArray(scip, &subvars);
 
    return SCIP_OKAY;
 }
@@ -451,6 +464,30 @@ SCIP_DECL_HEURINIT(heurInitRins)
 
    /* initialize data */
    heurdata->usednodes = 0;
+   heurdata->lnstemplate = NULL;
+
+   return SCIP_OKAY;
+}
+
+
+/** solving process deinitialization method of primal heuristic (called before branch and bound process data is freed) */
+static
+SCIP_DECL_HEUREXITSOL(heurExitsolRins)
+{  /*lint --e{715}*/
+   SCIP_HEURDATA* heurdata;
+
+   assert( heur != NULL );
+   assert( scip != NULL );
+
+   /* get heuristic's data */
+   heurdata = SCIPheurGetData(heur);
+   assert( heurdata != NULL );
+
+   /* free the reusable sub-SCIP */
+   if( heurdata->lnstemplate != NULL )
+   {
+      SCIP_CALL( SCIPfreeLnsTemplate(scip, &heurdata->lnstemplate) );
+   }
 
    return SCIP_OKAY;
 }
@@ -537,6 +574,8 @@ SCIP_DECL_HEUREXEC(heurExecRins)
       return SCIP_OKAY;
 
    /* allocate buffer storage to hold the RINS fixings */
+   retcode = SCIP_OKAY;
+
    SCIP_CALL( SCIPallocBufferArray(scip, &fixedvars, nbinvars + nintvars) );
    SCIP_CALL( SCIPallocBufferArray(scip, &fixedvals, nbinvars + nintvars) );
 
@@ -562,19 +601,48 @@ SCIP_DECL_HEUREXEC(heurExecRins)
    *result = SCIP_DIDNOTFIND;
 
    SCIPdebugMsg(scip, "RINS heuristic fixes %d out of %d binary+integer variables\n", nfixedvars, nbinvars + nintvars);
-   SCIP_CALL( SCIPcreate(&subscip) );
 
-   retcode = wrapperRins(scip, subscip, heur, heurdata, vars, fixedvars, fixedvals, result, nvars, nfixedvars, nnodes);
+   if( heurdata->reusesubscip )
+   {
+      /* the template has to be rebuilt if the problem changed since it was created */
+      if( heurdata->lnstemplate != NULL && !SCIPisLnsTemplateValid(scip, heurdata->lnstemplate) )
+      {
+         SCIP_CALL_TERMINATE( retcode, SCIPfreeLnsTemplate(scip, &heurdata->lnstemplate), TERMINATE );
+      }
+
+      if( heurdata->lnstemplate == NULL )
+      {
+         SCIP_CALL_TERMINATE( retcode, SCIPcreateLnsTemplate(scip, &heurdata->lnstemplate, "rins",
+               heurdata->uselprows, heurdata->copycuts, &success), TERMINATE );
+
+         if( !success )
+            goto TERMINATE;
+      }
+      assert(heurdata->lnstemplate != NULL);
 
-   SCIP_CALL( SCIPfree(&subscip) );
+      /* reset the sub-SCIP to the current global problem and apply the fixings */
+      SCIP_CALL_TERMINATE( retcode, SCIPprepareLnsTemplate(scip, heurdata->lnstemplate, fixedvars, fixedvals,
+            nfixedvars), TERMINATE );
 
-   SCIP_CALL( retcode );
+      retcode = wrapperRins(scip, SCIPgetLnsTemplateScip(heurdata->lnstemplate),
+         SCIPgetLnsTemplateVars(heurdata->lnstemplate), heur, heurdata, vars, fixedvars, fixedvals, result, nvars,
+         nfixedvars, nnodes);
+   }
+   else
+   {
+      SCIP_CALL_TERMINATE( retcode, SCIPcreate(&subscip), TERMINATE );
+
+      retcode = wrapperRins(scip, subscip, NULL, heur, heurdata, vars, fixedvars, fixedvals, result, nvars, nfixedvars,
+         nnodes);
+
+      SCIP_CALL( SCIPfree(&subscip) );
+   }
 
 TERMINATE:
    SCIPfreeBufferArray(scip, &fixedvals);
    SCIPfreeBufferArray(scip, &fixedvars);
 
-   return SCIP_OKAY;
+   return retcode;
 }
 
 /*
@@ -591,6 +659,7 @@ SCIP_RETCODE SCIPincludeHeurRins(
 
    /* create Rins primal heuristic data */
    SCIP_CALL( SCIPallocBlockMemory(scip, &heurdata) );
+   heurdata->lnstemplate = NULL;
 
    /* include primal heuristic */
    SCIP_CALL( SCIPincludeHeurBasic(scip, &heur,
@@ -603,6 +672,7 @@ SCIP_RETCODE SCIPincludeHeurRins(
    SCIP_CALL( SCIPsetHeurCopy(scip, heur, heurCopyRins) );
    SCIP_CALL( SCIPsetHeurFree(scip, heur, heurFreeRins) );
    SCIP_CALL( SCIPsetHeurInit(scip, heur, heurInitRins) );
+   SCIP_CALL( SCIPsetHeurExitsol(scip, heur, heurExitsolRins) );
 
    /* add RINS primal heuristic parameters */
    SCIP_CALL( SCIPaddIntParam(scip, "heuristics/" HEUR_NAME "/nodesofs",
@@ -649,5 +719,9 @@ SCIP_RETCODE SCIPincludeHeurRins(
          "should uct node selection be used at the beginning of the search?",
          &heurdata->useuct, TRUE, DEFAULT_USEUCT, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddBoolParam(scip, "heuristics/" HEUR_NAME "/reusesubscip",
+         "should the sub-SCIP be kept and re-armed between calls instead of copying the problem in every call?",
+         &heurdata->reusesubscip, TRUE, DEFAULT_REUSESUBSCIP, NULL, NULL) );
+
    return SCIP_OKAY;
 }
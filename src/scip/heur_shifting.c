@@ -23,6 +23,7 @@
 
 #include "blockmemshell/memory.h"
 #include "scip/heur_shifting.h"
+#include "scip/heuristics.h"
 #include "scip/pub_heur.h"
 #include "scip/pub_lp.h"
 #include "scip/pub_message.h"
@@ -60,6 +61,7 @@ struct SCIP_HeurData
 {
    SCIP_SOL*             sol;                /**< working solution */
    SCIP_RANDNUMGEN*      randnumgen;         /**< random number generator */
+   SCIP_ROWACTIVITIES*   rowactivities;      /**< activities of the LP rows w.r.t. the working solution */
    SCIP_Longint          lastlp;             /**< last LP number where the heuristic was applied */
 };
 
@@ -190,7 +192,7 @@ void updateViolations(
 static
 SCIP_RETCODE updateActivities(
    SCIP*                 scip,               /**< SCIP data structure */
-   SCIP_Real*            activities,         /**< LP row activities */
+   SCIP_ROWACTIVITIES*   rowactivities,      /**< LP row activities */
    SCIP_ROW**            violrows,           /**< array with currently violated rows */
    int*                  violrowpos,         /**< position of LP rows in violrows array */
    int*                  nviolrows,          /**< pointer to the number of currently violated rows */
@@ -205,14 +207,16 @@ SCIP_RETCODE updateActivities(
    SCIP_COL* col;
    SCIP_ROW** colrows;
    SCIP_Real* colvals;
+   SCIP_Real* activities;
    SCIP_Real delta;
    int ncolrows;
    int r;
 
-   assert(activities != NULL);
+   assert(rowactivities != NULL);
    assert(nviolrows != NULL);
    assert(0 <= *nviolrows && *nviolrows <= nlprows);
 
+   activities = SCIPgetRowActivitiesVals(rowactivities);
    delta = newsolval - oldsolval;
    col = SCIPvarGetCol(var);
    colrows = SCIPcolGetRows(col);
@@ -245,7 +249,7 @@ SCIP_RETCODE updateActivities(
                newactivity = SCIPinfinity(scip);
             else if( SCIPisInfinity(scip, -newactivity) )
                newactivity = -SCIPinfinity(scip);
-            activities[rowpos] = newactivity;
+            SCIPchgRowActivitiesVal(rowactivities, rowpos, newactivity);
 
             /* update row violation arrays */
             updateViolations(scip, row, violrows, violrowpos, nviolrows, nviolfracrows, nfracsinrow, oldactivity, newactivity);
@@ -608,6 +612,7 @@ SCIP_DECL_HEURINIT(heurInitShifting) /*lint --e{715}*/
    /* create heuristic data */
    SCIP_CALL( SCIPallocBlockMemory(scip, &heurdata) );
    SCIP_CALL( SCIPcreateSol(scip, &heurdata->sol, heur) );
+   SCIP_CALL( SCIPcreateRowActivities(scip, &heurdata->rowactivities) );
    heurdata->lastlp = -1;
 
    /* create random number generator */
@@ -631,6 +636,7 @@ SCIP_DECL_HEUREXIT(heurExitShifting) /*lint --e{715}*/
    heurdata = SCIPheurGetData(heur);
    assert(heurdata != NULL);
    SCIP_CALL( SCIPfreeSol(scip, &heurdata->sol) );
+   SCIP_CALL( SCIPfreeRowActivities(scip, &heurdata->rowactivities) );
 
    /* free random number generator */
    SCIPfreeRandom(scip, &heurdata->randnumgen);
@@ -740,9 +746,8 @@ SCIP_DECL_HEUREXEC(heurExecShifting) /*lint --e{715}*/
 
    SCIPdebugMsg(scip, "executing shifting heuristic: %d LP rows, %d fractionals\n", nlprows, nfrac);
 
-   /* get memory for activities, violated rows, and row violation positions */
+   /* get memory for violated rows and row violation positions */
    nvars = SCIPgetNVars(scip);
-   SCIP_CALL( SCIPallocBufferArray(scip, &activities, nlprows) );
    SCIP_CALL( SCIPallocBufferArray(scip, &violrows, nlprows) );
    SCIP_CALL( SCIPallocBufferArray(scip, &violrowpos, nlprows) );
    SCIP_CALL( SCIPallocBufferArray(scip, &nfracsinrow, nlprows) );
@@ -755,6 +760,8 @@ SCIP_DECL_HEUREXEC(heurExecShifting) /*lint --e{715}*/
    /* get the activities for all globally valid rows;
     * the rows should be feasible, but due to numerical inaccuracies in the LP solver, they can be violated
     */
+   SCIP_CALL( SCIPcomputeRowActivities(scip, heurdata->rowactivities, NULL) );
+   activities = SCIPgetRowActivitiesVals(heurdata->rowactivities);
    nviolrows = 0;
    for( r = 0; r < nlprows; ++r )
    {
@@ -765,7 +772,6 @@ SCIP_DECL_HEUREXEC(heurExecShifting) /*lint --e{715}*/
 
       if( !SCIProwIsLocal(row) )
       {
-         activities[r] = SCIPgetRowActivity(scip, row);
          if( SCIPisFeasLT(scip, activities[r], SCIProwGetLhs(row))
             || SCIPisFeasGT(scip, activities[r], SCIProwGetRhs(row)) )
          {
@@ -883,7 +889,7 @@ SCIP_DECL_HEUREXEC(heurExecShifting) /*lint --e{715}*/
          oldsolval, newsolval, SCIPvarGetObj(shiftvar));
 
       /* update row activities of globally valid rows */
-      SCIP_CALL( updateActivities(scip, activities, violrows, violrowpos, &nviolrows, &nviolfracrows, nfracsinrow, nlprows,
+      SCIP_CALL( updateActivities(scip, heurdata->rowactivities, violrows, violrowpos, &nviolrows, &nviolfracrows, nfracsinrow, nlprows,
             shiftvar, oldsolval, newsolval) );
       if( nviolrows >= nprevviolrows )
          nnonimprovingshifts++;
@@ -974,7 +980,6 @@ SCIP_DECL_HEUREXEC(heurExecShifting) /*lint --e{715}*/
    SCIPfreeBufferArray(scip, &nfracsinrow);
    SCIPfreeBufferArray(scip, &violrowpos);
    SCIPfreeBufferArray(scip, &violrows);
-   SCIPfreeBufferArray(scip, &activities);
 
    return SCIP_OKAY;
 }
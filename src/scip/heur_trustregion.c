@@ -323,7 +323,6 @@ SCIP_RETCODE setupAndSolveSubscipTrustregion(
    SCIP_VAR** vars;
 
    int nvars;
-   int i;
 
    SCIP_Bool success;
 
@@ -367,8 +366,7 @@ SCIP_RETCODE setupAndSolveSubscipTrustregion(
    }
 
    SCIP_CALL( SCIPallocBufferArray(scip, &subvars, nvars) );
-   for (i = 0; i < nvars; ++i)
-      subvars[i] = (SCIP_VAR*) SCIPhashmapGetImage(varmapfw, vars[i]);
+   SCIPhashmapGetImages(varmapfw, (void**)vars, (void**)subvars, nvars);
 
    /* free hash map */
    SCIPhashmapFree(&varmapfw);
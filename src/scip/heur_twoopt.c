@@ -24,6 +24,7 @@
 
 #include "blockmemshell/memory.h"
 #include "scip/heur_twoopt.h"
+#include "scip/heuristics.h"
 #include "scip/pub_heur.h"
 #include "scip/pub_lp.h"
 #include "scip/pub_message.h"
@@ -70,6 +71,7 @@
 /** primal heuristic data */
 struct SCIP_HeurData
 {
+   SCIP_ROWACTIVITIES*   rowactivities;      /**< activities of the LP rows w.r.t. the working solution */
    int                   lastsolindex;       /**< index of last solution for which heuristic was performed */
    SCIP_Real             matchingrate;       /**< percentage by which two variables have have to match in their LP-row
                                               *   set to be associated as pair by heuristic */
@@ -136,10 +138,7 @@ typedef enum Direction DIRECTION;
  * Local methods
  */
 
-/** Tries to switch the values of two binary or integer variables and checks feasibility with respect to the LP.
- *
- *  @todo Adapt method not to copy entire activities array, but only the relevant region.
- */
+/** Tries to switch the values of two binary or integer variables and checks feasibility with respect to the LP. */
 static
 SCIP_RETCODE shiftValues(
    SCIP*                 scip,               /**< scip instance */
@@ -150,25 +149,21 @@ SCIP_RETCODE shiftValues(
    SCIP_Real             slavesolval,        /**< current value of variable2 in solution */
    DIRECTION             slavedir,           /**< the direction into which the slave variable has to be shifted */
    SCIP_Real             shiftval,           /**< the value that variables should be shifted by */
-   SCIP_Real*            activities,         /**< the LP-row activities */
-   int                   nrows,              /**< size of activities array */
+   SCIP_ROWACTIVITIES*   rowactivities,      /**< the LP-row activities */
+   int                   nrows,              /**< number of LP rows */
    SCIP_Bool*            feasible            /**< set to true if method has successfully switched the variable values */
    )
 {  /*lint --e{715}*/
-   SCIP_COL* col;
-   SCIP_ROW** masterrows;
-   SCIP_ROW** slaverows;
-   SCIP_Real* mastercolvals;
-   SCIP_Real* slavecolvals;
-   int ncolmasterrows;
-   int ncolslaverows;
-   int i;
-   int j;
+#ifndef NDEBUG
+   SCIP_VAR* vars[2];
+   SCIP_Real* activities;
+   int v;
+#endif
 
    assert(scip != NULL);
    assert(master != NULL);
    assert(slave != NULL);
-   assert(activities != NULL);
+   assert(rowactivities != NULL);
    assert(SCIPisFeasGT(scip, shiftval, 0.0));
 
    assert(SCIPisFeasGE(scip, mastersolval + (int)masterdir * shiftval, SCIPvarGetLbGlobal(master)));
@@ -177,60 +172,36 @@ SCIP_RETCODE shiftValues(
    assert(SCIPisFeasGE(scip, slavesolval + (int)slavedir * shiftval, SCIPvarGetLbGlobal(slave)));
    assert(SCIPisFeasLE(scip, slavesolval + (int)slavedir * shiftval, SCIPvarGetUbGlobal(slave)));
 
-   /* get variable specific rows and coefficients for both master and slave. */
-   col = SCIPvarGetCol(master);
-   masterrows = SCIPcolGetRows(col);
-   mastercolvals = SCIPcolGetVals(col);
-   ncolmasterrows = SCIPcolGetNNonz(col);
-   assert(ncolmasterrows == 0 || masterrows != NULL);
-
-   col = SCIPvarGetCol(slave);
-   slaverows = SCIPcolGetRows(col);
-   slavecolvals = SCIPcolGetVals(col);
-   ncolslaverows = SCIPcolGetNNonz(col);
-   assert(ncolslaverows == 0 || slaverows != NULL);
-
-   /* update the activities of the LP rows of the master variable */
-   for( i = 0; i < ncolmasterrows && SCIProwGetLPPos(masterrows[i]) >= 0; ++i )
-   {
-      int rowpos;
-
-      rowpos = SCIProwGetLPPos(masterrows[i]);
-      assert(rowpos < nrows);
+   /* update the activities of the LP rows of the master and the slave variable */
+   SCIPupdateRowActivities(scip, rowactivities, master, (int)masterdir * shiftval);
+   SCIPupdateRowActivities(scip, rowactivities, slave, (int)slavedir * shiftval);
 
-      /* skip local rows */
-      if( rowpos >= 0 && ! SCIProwIsLocal(masterrows[i]) )
-         activities[rowpos] += mastercolvals[i] * (int)masterdir * shiftval;
-   }
+   /* in debug mode, the rows of both variables are checked for feasibility which should be granted by the
+    * decision for a shift value */
+#ifndef NDEBUG
+   activities = SCIPgetRowActivitiesVals(rowactivities);
+   vars[0] = master;
+   vars[1] = slave;
 
-   /* update the activities of the LP rows of the slave variable */
-   for( j = 0; j < ncolslaverows && SCIProwGetLPPos(slaverows[j]) >= 0; ++j )
+   for( v = 0; v < 2; ++v )
    {
-      int rowpos;
+      SCIP_ROW** colrows;
+      int ncolrows;
+      int i;
 
-      rowpos = SCIProwGetLPPos(slaverows[j]);
-      assert(rowpos < nrows);
+      colrows = SCIPcolGetRows(SCIPvarGetCol(vars[v]));
+      ncolrows = SCIPcolGetNLPNonz(SCIPvarGetCol(vars[v]));
 
-      /* skip local rows */
-      if( rowpos >= 0 && ! SCIProwIsLocal(slaverows[j]) )
+      for( i = 0; i < ncolrows; ++i )
       {
-         activities[rowpos] += slavecolvals[j] * (int)slavedir * shiftval;
-         assert(SCIPisFeasGE(scip, activities[rowpos], SCIProwGetLhs(slaverows[j])));
-         assert(SCIPisFeasLE(scip, activities[rowpos], SCIProwGetRhs(slaverows[j])));
-      }
-   }
-
-   /* in debug mode, the master rows are checked for feasibility which should be granted by the
-    * decision for a shift value */
-#ifndef NDEBUG
-   for( i = 0; i < ncolmasterrows && SCIProwGetLPPos(masterrows[i]) >= 0; ++i )
-   {
-      /* local rows can be skipped */
-      if( SCIProwIsLocal(masterrows[i]) )
-         continue;
+         /* local rows can be skipped */
+         if( SCIProwIsLocal(colrows[i]) )
+            continue;
 
-      assert(SCIPisFeasGE(scip, activities[SCIProwGetLPPos(masterrows[i])], SCIProwGetLhs(masterrows[i])));
-      assert(SCIPisFeasLE(scip, activities[SCIProwGetLPPos(masterrows[i])], SCIProwGetRhs(masterrows[i])));
+         assert(SCIProwGetLPPos(colrows[i]) < nrows);
+         assert(SCIPisFeasGE(scip, activities[SCIProwGetLPPos(colrows[i])], SCIProwGetLhs(colrows[i])));
+         assert(SCIPisFeasLE(scip, activities[SCIProwGetLPPos(colrows[i])], SCIProwGetRhs(colrows[i])));
+      }
    }
 #endif
 
@@ -872,6 +843,8 @@ SCIP_DECL_HEURINIT(heurInitTwoopt)
    SCIP_CALL( SCIPcreateRandom(scip, &heurdata->randnumgen,
          DEFAULT_RANDSEED, TRUE) );
 
+   SCIP_CALL( SCIPcreateRowActivities(scip, &heurdata->rowactivities) );
+
 #ifdef SCIP_STATISTIC
    /* initialize statistics */
    heurdata->binnexchanges = 0;
@@ -1236,7 +1209,7 @@ SCIP_RETCODE optimize(
          /* try to change the solution values of the variables */
          feasible = FALSE;
          SCIP_CALL( shiftValues(scip, master, slave, mastersolval, masterdir, slavesolval, slavedir, bound,
-               activities, nrows, &feasible) );
+               heurdata->rowactivities, nrows, &feasible) );
 
          if( feasible )
          {
@@ -1364,6 +1337,8 @@ SCIP_DECL_HEUREXIT(heurExitTwoopt)
    /* free random number generator */
    SCIPfreeRandom(scip, &heurdata->randnumgen);
 
+   SCIP_CALL( SCIPfreeRowActivities(scip, &heurdata->rowactivities) );
+
    SCIPheurSetData(heur, heurdata);
 
    return SCIP_OKAY;
@@ -1565,7 +1540,8 @@ SCIP_DECL_HEUREXEC(heurExecTwoopt)
 
    /* get the LP row activities from current incumbent bestsol */
    SCIP_CALL( SCIPgetLPRowsData(scip, &lprows, &nlprows) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &activities, nlprows) );
+   SCIP_CALL( SCIPcomputeRowActivities(scip, heurdata->rowactivities, bestsol) );
+   activities = SCIPgetRowActivitiesVals(heurdata->rowactivities);
 
    for( i = 0; i < nlprows; i++ )
    {
@@ -1576,7 +1552,6 @@ SCIP_DECL_HEUREXEC(heurExecTwoopt)
       assert(SCIProwGetLPPos(row) == i);
       SCIPdebugMsg(scip, "  Row <%d> is %sin LP: \n", i, SCIProwGetLPPos(row) >= 0 ? "" : "not ");
       SCIPdebug( SCIP_CALL( SCIPprintRow(scip, row, NULL) ) );
-      activities[i] = SCIPgetRowSolActivity(scip, row, bestsol);
 
       /* Heuristic does not provide infeasibility recovery, thus if any constraint is violated,
        * execution has to be terminated.
@@ -1754,7 +1729,6 @@ SCIP_DECL_HEUREXEC(heurExecTwoopt)
 
  TERMINATE:
    SCIPdebugMsg(scip, "Termination of Twoopt heuristic\n");
-   SCIPfreeBufferArray(scip, &activities);
    SCIP_CALL( SCIPfreeSol(scip, &worksol) );
 
    return SCIP_OKAY;
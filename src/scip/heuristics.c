@@ -912,8 +912,9 @@ SCIP_RETCODE createRows(
 }
 
 
-/** get a sub-SCIP copy of the transformed problem */
-SCIP_RETCODE SCIPcopyLargeNeighborhoodSearch(
+/** copies the transformed problem into a sub-SCIP and optionally passes the message handler */
+static
+SCIP_RETCODE copyLargeNeighborhoodSearch(
    SCIP*                 sourcescip,         /**< source SCIP data structure */
    SCIP*                 subscip,            /**< sub-SCIP used by the heuristic */
    SCIP_HASHMAP*         varmap,             /**< a hashmap to store the mapping of source variables to the corresponding
@@ -924,6 +925,7 @@ SCIP_RETCODE SCIPcopyLargeNeighborhoodSearch(
    int                   nfixedvars,         /**< number of source variables whose copies should be fixed in the target SCIP environment, or NULL */
    SCIP_Bool             uselprows,          /**< should the linear relaxation of the problem defined by LP rows be copied? */
    SCIP_Bool             copycuts,           /**< should cuts be copied (only if uselprows == FALSE) */
+   SCIP_Bool             passmessagehdlr,    /**< should the message handler be passed? */
    SCIP_Bool*            success,            /**< was the copying successful? */
    SCIP_Bool*            valid               /**< pointer to store whether the copying was valid, or NULL */
    )
@@ -959,7 +961,7 @@ SCIP_RETCODE SCIPcopyLargeNeighborhoodSearch(
    else
    {
       SCIP_CALL( SCIPcopyConsCompression(sourcescip, subscip, varmap, NULL, suffix, fixedvars, fixedvals, nfixedvars,
-            TRUE, FALSE, FALSE, TRUE, valid) );
+            TRUE, FALSE, FALSE, passmessagehdlr, valid) );
 
       if( copycuts )
       {
@@ -973,6 +975,338 @@ SCIP_RETCODE SCIPcopyLargeNeighborhoodSearch(
    return SCIP_OKAY;
 }
 
+/** get a sub-SCIP copy of the transformed problem */
+SCIP_RETCODE SCIPcopyLargeNeighborhoodSearch(
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP*                 subscip,            /**< sub-SCIP used by the heuristic */
+   SCIP_HASHMAP*         varmap,             /**< a hashmap to store the mapping of source variables to the corresponding
+                                              *   target variables */
+   const char*           suffix,             /**< suffix for the problem name */
+   SCIP_VAR**            fixedvars,          /**< source variables whose copies should be fixed in the target SCIP environment, or NULL */
+   SCIP_Real*            fixedvals,          /**< array of fixing values for target SCIP variables, or NULL */
+   int                   nfixedvars,         /**< number of source variables whose copies should be fixed in the target SCIP environment, or NULL */
+   SCIP_Bool             uselprows,          /**< should the linear relaxation of the problem defined by LP rows be copied? */
+   SCIP_Bool             copycuts,           /**< should cuts be copied (only if uselprows == FALSE) */
+   SCIP_Bool*            success,            /**< was the copying successful? */
+   SCIP_Bool*            valid               /**< pointer to store whether the copying was valid, or NULL */
+   )
+{
+   SCIP_CALL( copyLargeNeighborhoodSearch(sourcescip, subscip, varmap, suffix, fixedvars, fixedvals, nfixedvars, uselprows,
+         copycuts, TRUE, success, valid) );
+
+   return SCIP_OKAY;
+}
+
+/** get a sub-SCIP copy of the transformed problem that can be solved on another thread; same as
+ *  SCIPcopyLargeNeighborhoodSearch(), but the sub-SCIP does not share the message handler of the source SCIP, which is
+ *  not threadsafe
+ */
+SCIP_RETCODE SCIPcopyLargeNeighborhoodSearchAsync(
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP*                 subscip,            /**< sub-SCIP used by the heuristic */
+   SCIP_HASHMAP*         varmap,             /**< a hashmap to store the mapping of source variables to the corresponding
+                                              *   target variables */
+   const char*           suffix,             /**< suffix for the problem name */
+   SCIP_VAR**            fixedvars,          /**< source variables whose copies should be fixed in the target SCIP environment, or NULL */
+   SCIP_Real*            fixedvals,          /**< array of fixing values for target SCIP variables, or NULL */
+   int                   nfixedvars,         /**< number of source variables whose copies should be fixed in the target SCIP environment, or NULL */
+   SCIP_Bool             uselprows,          /**< should the linear relaxation of the problem defined by LP rows be copied? */
+   SCIP_Bool             copycuts,           /**< should cuts be copied (only if uselprows == FALSE) */
+   SCIP_Bool*            success,            /**< was the copying successful? */
+   SCIP_Bool*            valid               /**< pointer to store whether the copying was valid, or NULL */
+   )
+{
+   SCIP_CALL( copyLargeNeighborhoodSearch(sourcescip, subscip, varmap, suffix, fixedvars, fixedvals, nfixedvars, uselprows,
+         copycuts, FALSE, success, valid) );
+
+   return SCIP_OKAY;
+}
+
+/** reusable sub-SCIP for large neighborhood search */
+struct SCIP_LnsTemplate
+{
+   SCIP*                 subscip;            /**< sub-SCIP containing an unfixed copy of the transformed problem */
+   SCIP_VAR**            vars;               /**< source variables at creation in the order of SCIPgetVars() */
+   SCIP_VAR**            subvars;            /**< copies of the source variables in the order of SCIPgetVars() */
+   SCIP_CONS**           conss;              /**< captured source constraints at creation */
+   SCIP_HASHSET*         consset;            /**< set of the source constraints at creation */
+   int                   nvars;              /**< number of variables of the source SCIP at creation */
+   int                   nconss;             /**< number of constraints of the source SCIP at creation */
+   int                   nruns;              /**< run of the source SCIP in which the template was created */
+};
+
+/** changes the bounds of a variable of the sub-SCIP in problem stage such that the lower bound never exceeds the
+ *  upper bound in between
+ */
+static
+SCIP_RETCODE chgLnsTemplateVarBounds(
+   SCIP*                 subscip,            /**< sub-SCIP in problem stage */
+   SCIP_VAR*             subvar,             /**< variable of the sub-SCIP */
+   SCIP_Real             lb,                 /**< new lower bound */
+   SCIP_Real             ub                  /**< new upper bound */
+   )
+{
+   assert(SCIPgetStage(subscip) == SCIP_STAGE_PROBLEM);
+   assert(lb <= ub);
+
+   if( lb > SCIPvarGetUbGlobal(subvar) )
+   {
+      SCIP_CALL( SCIPchgVarUb(subscip, subvar, ub) );
+      SCIP_CALL( SCIPchgVarLb(subscip, subvar, lb) );
+   }
+   else
+   {
+      if( lb != SCIPvarGetLbGlobal(subvar) ) /*lint !e777*/
+      {
+         SCIP_CALL( SCIPchgVarLb(subscip, subvar, lb) );
+      }
+      if( ub != SCIPvarGetUbGlobal(subvar) ) /*lint !e777*/
+      {
+         SCIP_CALL( SCIPchgVarUb(subscip, subvar, ub) );
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** creates a reusable sub-SCIP template for large neighborhood search
+ *
+ *  The transformed problem of @p sourcescip is copied once without any fixings. Before each neighborhood is solved,
+ *  SCIPprepareLnsTemplate() resets the template to the current global bounds and objective of the source problem and
+ *  applies the fixings of the neighborhood, which avoids a full problem copy per heuristic call.
+ *
+ *  @note if @p uselprows is TRUE, the LP rows are copied only once, i.e., rows that are added to the LP of
+ *        @p sourcescip afterwards are not part of the template
+ */
+SCIP_RETCODE SCIPcreateLnsTemplate(
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP_LNSTEMPLATE**    lnstemplate,        /**< pointer to store the template, set to NULL if copying failed */
+   const char*           suffix,             /**< suffix for the problem name */
+   SCIP_Bool             uselprows,          /**< should the linear relaxation of the problem defined by LP rows be copied? */
+   SCIP_Bool             copycuts,           /**< should cuts be copied (only if uselprows == FALSE) */
+   SCIP_Bool*            success             /**< was the copying successful? */
+   )
+{
+   SCIP_HASHMAP* varmapfw;
+   SCIP_CONS** conss;
+   SCIP_VAR** vars;
+   int nconss;
+   int nvars;
+   int i;
+
+   assert(sourcescip != NULL);
+   assert(lnstemplate != NULL);
+   assert(suffix != NULL);
+   assert(success != NULL);
+
+   vars = SCIPgetVars(sourcescip);
+   nvars = SCIPgetNVars(sourcescip);
+   conss = SCIPgetConss(sourcescip);
+   nconss = SCIPgetNConss(sourcescip);
+
+   SCIP_CALL( SCIPallocBlockMemory(sourcescip, lnstemplate) );
+   SCIP_CALL( SCIPduplicateBlockMemoryArray(sourcescip, &(*lnstemplate)->vars, vars, nvars) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(sourcescip, &(*lnstemplate)->subvars, nvars) );
+   (*lnstemplate)->nvars = nvars;
+   (*lnstemplate)->nruns = SCIPgetNRuns(sourcescip);
+
+   /* remember the constraints of the source problem; they are captured, such that a new constraint never has the
+    * address of one of them
+    */
+   SCIP_CALL( SCIPduplicateBlockMemoryArray(sourcescip, &(*lnstemplate)->conss, conss, nconss) );
+   SCIP_CALL( SCIPhashsetCreate(&(*lnstemplate)->consset, SCIPblkmem(sourcescip), nconss) );
+   (*lnstemplate)->nconss = nconss;
+
+   for( i = 0; i < nconss; ++i )
+   {
+      SCIP_CALL( SCIPcaptureCons(sourcescip, conss[i]) );
+      SCIP_CALL( SCIPhashsetInsert((*lnstemplate)->consset, SCIPblkmem(sourcescip), (void*)conss[i]) );
+   }
+
+   SCIP_CALL( SCIPcreate(&(*lnstemplate)->subscip) );
+
+   /* create the variable mapping hash map and copy the problem without fixings */
+   SCIP_CALL( SCIPhashmapCreate(&varmapfw, SCIPblkmem((*lnstemplate)->subscip), nvars) );
+   SCIP_CALL( SCIPcopyLargeNeighborhoodSearch(sourcescip, (*lnstemplate)->subscip, varmapfw, suffix, NULL, NULL, 0,
+         uselprows, copycuts, success, NULL) );
+
+   /* copy subproblem variables from map to obtain the same order */
+   SCIPhashmapGetImages(varmapfw, (void**)vars, (void**)(*lnstemplate)->subvars, nvars);
+   SCIPhashmapFree(&varmapfw);
+
+   if( !(*success) )
+   {
+      SCIP_CALL( SCIPfreeLnsTemplate(sourcescip, lnstemplate) );
+      return SCIP_OKAY;
+   }
+
+   /* solutions of earlier neighborhoods must not be passed on as original solutions to later ones */
+   SCIP_CALL( SCIPsetIntParam((*lnstemplate)->subscip, "limits/maxorigsol", 0) );
+
+   return SCIP_OKAY;
+}
+
+/** frees a sub-SCIP template for large neighborhood search */
+SCIP_RETCODE SCIPfreeLnsTemplate(
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP_LNSTEMPLATE**    lnstemplate         /**< pointer to the template */
+   )
+{
+   int i;
+
+   assert(lnstemplate != NULL);
+   assert(*lnstemplate != NULL);
+
+   SCIP_CALL( SCIPfree(&(*lnstemplate)->subscip) );
+
+   for( i = 0; i < (*lnstemplate)->nconss; ++i )
+   {
+      SCIP_CALL( SCIPreleaseCons(sourcescip, &(*lnstemplate)->conss[i]) );
+   }
+   SCIPhashsetFree(&(*lnstemplate)->consset, SCIPblkmem(sourcescip));
+   SCIPfreeBlockMemoryArray(sourcescip, &(*lnstemplate)->conss, (*lnstemplate)->nconss);
+
+   SCIPfreeBlockMemoryArray(sourcescip, &(*lnstemplate)->subvars, (*lnstemplate)->nvars);
+   SCIPfreeBlockMemoryArray(sourcescip, &(*lnstemplate)->vars, (*lnstemplate)->nvars);
+   SCIPfreeBlockMemory(sourcescip, lnstemplate);
+
+   return SCIP_OKAY;
+}
+
+/** returns whether the template still matches the problem of the source SCIP, i.e., no restart happened, the
+ *  variables are the same, and no constraint was added since the template was created
+ *
+ *  Bounds and objective coefficients are not checked, since SCIPprepareLnsTemplate() resets them. Constraints that
+ *  were deleted from the source problem are still valid in the template.
+ */
+SCIP_Bool SCIPisLnsTemplateValid(
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP_LNSTEMPLATE*     lnstemplate         /**< sub-SCIP template */
+   )
+{
+   SCIP_CONS** conss;
+   SCIP_VAR** vars;
+   int nconss;
+   int i;
+
+   assert(lnstemplate != NULL);
+
+   if( lnstemplate->nruns != SCIPgetNRuns(sourcescip) || lnstemplate->nvars != SCIPgetNVars(sourcescip) )
+      return FALSE;
+
+   vars = SCIPgetVars(sourcescip);
+   for( i = 0; i < lnstemplate->nvars; ++i )
+   {
+      if( vars[i] != lnstemplate->vars[i] )
+         return FALSE;
+   }
+
+   conss = SCIPgetConss(sourcescip);
+   nconss = SCIPgetNConss(sourcescip);
+   if( nconss > lnstemplate->nconss )
+      return FALSE;
+
+   for( i = 0; i < nconss; ++i )
+   {
+      if( !SCIPhashsetExists(lnstemplate->consset, (void*)conss[i]) )
+         return FALSE;
+   }
+
+   return TRUE;
+}
+
+/** re-arms the template for the next neighborhood: frees the transformed problem of the sub-SCIP, resets the bounds
+ *  and objective coefficients of all copied variables to those of the source problem, and fixes the copies of the
+ *  given source variables
+ */
+SCIP_RETCODE SCIPprepareLnsTemplate(
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP_LNSTEMPLATE*     lnstemplate,        /**< sub-SCIP template */
+   SCIP_VAR**            fixedvars,          /**< source variables whose copies should be fixed, or NULL */
+   SCIP_Real*            fixedvals,          /**< array of fixing values for the copies, or NULL */
+   int                   nfixedvars          /**< number of source variables whose copies should be fixed */
+   )
+{
+   SCIP* subscip;
+   SCIP_VAR** vars;
+   int i;
+
+   assert(lnstemplate != NULL);
+   assert(SCIPisLnsTemplateValid(sourcescip, lnstemplate));
+   assert(nfixedvars == 0 || (fixedvars != NULL && fixedvals != NULL));
+
+   subscip = lnstemplate->subscip;
+
+   /* go back to the original problem of the sub-SCIP, which is the unfixed copy */
+   if( SCIPgetStage(subscip) > SCIP_STAGE_PROBLEM )
+   {
+      SCIP_CALL( SCIPfreeTransform(subscip) );
+   }
+   assert(SCIPgetStage(subscip) == SCIP_STAGE_PROBLEM);
+
+   vars = SCIPgetVars(sourcescip);
+
+   /* reset bounds and objective to the current global data of the source problem */
+   for( i = 0; i < lnstemplate->nvars; ++i )
+   {
+      SCIP_VAR* subvar = lnstemplate->subvars[i];
+
+      if( subvar == NULL )
+         continue;
+
+      SCIP_CALL( chgLnsTemplateVarBounds(subscip, subvar, SCIPvarGetLbGlobal(vars[i]), SCIPvarGetUbGlobal(vars[i])) );
+
+      if( SCIPvarGetObj(subvar) != SCIPvarGetObj(vars[i]) ) /*lint !e777*/
+      {
+         SCIP_CALL( SCIPchgVarObj(subscip, subvar, SCIPvarGetObj(vars[i])) );
+      }
+   }
+
+   /* apply the fixings of the neighborhood */
+   for( i = 0; i < nfixedvars; ++i )
+   {
+      SCIP_VAR* subvar;
+      int probindex;
+
+      probindex = SCIPvarGetProbindex(fixedvars[i]);
+      assert(probindex < lnstemplate->nvars);
+
+      if( probindex < 0 )
+         continue;
+
+      subvar = lnstemplate->subvars[probindex];
+
+      if( subvar != NULL )
+      {
+         SCIP_CALL( chgLnsTemplateVarBounds(subscip, subvar, fixedvals[i], fixedvals[i]) );
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** returns the sub-SCIP of the template */
+SCIP* SCIPgetLnsTemplateScip(
+   SCIP_LNSTEMPLATE*     lnstemplate         /**< sub-SCIP template */
+   )
+{
+   assert(lnstemplate != NULL);
+
+   return lnstemplate->subscip;
+}
+
+/** returns the copies of the source variables in the order of SCIPgetVars() of the source SCIP; entries of variables
+ *  that were not copied are NULL
+ */
+SCIP_VAR** SCIPgetLnsTemplateVars(
+   SCIP_LNSTEMPLATE*     lnstemplate         /**< sub-SCIP template */
+   )
+{
+   assert(lnstemplate != NULL);
+
+   return lnstemplate->subvars;
+}
+
 /** adds a trust region neighborhood constraint to the @p targetscip
  *
  *  a trust region constraint measures the deviation from the current incumbent solution \f$x^*\f$ by an auxiliary
@@ -1072,3 +1406,227 @@ SCIP_RETCODE SCIPaddTrustregionNeighborhoodConstraint(
 
    return SCIP_OKAY;
 }
+
+/** activities of the global LP rows w.r.t. a solution that are updated incrementally when solution values change */
+struct SCIP_RowActivities
+{
+   SCIP_Real*            activities;         /**< current activities of the global LP rows, indexed by LP position */
+   SCIP_Real*            baseactivities;     /**< activities of the global LP rows as computed for the solution */
+   int*                  changedrows;        /**< LP positions of the rows whose activity changed since the computation */
+   SCIP_Bool*            rowchanged;         /**< did the activity of the row at this LP position change? */
+   SCIP_Longint          nodenum;            /**< number of the node at which the activities were computed, or -1 */
+   SCIP_Longint          nlps;               /**< number of LPs solved when the activities were computed */
+   int                   solindex;           /**< index of the solution of the activities, or -1 for the LP solution */
+   int                   nrows;              /**< number of LP rows when the activities were computed */
+   int                   rowssize;           /**< size of the row arrays */
+   int                   nchangedrows;       /**< number of rows whose activity changed since the computation */
+};
+
+/** creates a data structure for the activities of the global LP rows w.r.t. a solution, which are updated
+ *  incrementally when solution values change
+ *
+ *  The activities are computed by SCIPcomputeRowActivities() and changed by SCIPupdateRowActivities() or
+ *  SCIPchgRowActivitiesVal() in time linear in the number of affected rows. If the activities are computed again for
+ *  the same solution at the same node and LP, only the rows changed in between are restored instead of recomputing
+ *  all activities, such that the data structure can be kept across heuristic calls.
+ */
+SCIP_RETCODE SCIPcreateRowActivities(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ROWACTIVITIES**  rowactivities       /**< pointer to store the row activities */
+   )
+{
+   assert(scip != NULL);
+   assert(rowactivities != NULL);
+
+   SCIP_CALL( SCIPallocBlockMemory(scip, rowactivities) );
+   BMSclearMemory(*rowactivities);
+   (*rowactivities)->nodenum = -1;
+
+   return SCIP_OKAY;
+}
+
+/** frees the row activities */
+SCIP_RETCODE SCIPfreeRowActivities(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ROWACTIVITIES**  rowactivities       /**< pointer to the row activities */
+   )
+{
+   assert(scip != NULL);
+   assert(rowactivities != NULL);
+   assert(*rowactivities != NULL);
+
+   SCIPfreeBlockMemoryArrayNull(scip, &(*rowactivities)->rowchanged, (*rowactivities)->rowssize);
+   SCIPfreeBlockMemoryArrayNull(scip, &(*rowactivities)->changedrows, (*rowactivities)->rowssize);
+   SCIPfreeBlockMemoryArrayNull(scip, &(*rowactivities)->baseactivities, (*rowactivities)->rowssize);
+   SCIPfreeBlockMemoryArrayNull(scip, &(*rowactivities)->activities, (*rowactivities)->rowssize);
+   SCIPfreeBlockMemory(scip, rowactivities);
+
+   return SCIP_OKAY;
+}
+
+/** computes the activities of all global LP rows w.r.t. the given solution, or the LP solution if @p sol is NULL;
+ *  the activities of local rows are not computed
+ *
+ *  @note the activities are only restored instead of recomputed if the solution was not modified in between
+ */
+SCIP_RETCODE SCIPcomputeRowActivities(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ROWACTIVITIES*   rowactivities,      /**< row activities */
+   SCIP_SOL*             sol                 /**< solution, or NULL for the LP solution */
+   )
+{
+   SCIP_ROW** lprows;
+   SCIP_Longint nodenum;
+   int solindex;
+   int nlprows;
+   int r;
+
+   assert(scip != NULL);
+   assert(rowactivities != NULL);
+
+   SCIP_CALL( SCIPgetLPRowsData(scip, &lprows, &nlprows) );
+
+   nodenum = SCIPnodeGetNumber(SCIPgetCurrentNode(scip));
+   solindex = (sol == NULL ? -1 : SCIPsolGetIndex(sol));
+
+   /* if the activities belong to the same solution and LP, only undo the changes since their computation */
+   if( rowactivities->nodenum == nodenum && rowactivities->nlps == SCIPgetNLPs(scip)
+      && rowactivities->solindex == solindex && rowactivities->nrows == nlprows )
+   {
+      for( r = 0; r < rowactivities->nchangedrows; ++r )
+      {
+         int rowpos = rowactivities->changedrows[r];
+
+         rowactivities->activities[rowpos] = rowactivities->baseactivities[rowpos];
+         rowactivities->rowchanged[rowpos] = FALSE;
+      }
+      rowactivities->nchangedrows = 0;
+
+      return SCIP_OKAY;
+   }
+
+   if( nlprows > rowactivities->rowssize )
+   {
+      int newsize = SCIPcalcMemGrowSize(scip, nlprows);
+
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &rowactivities->activities, rowactivities->rowssize, newsize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &rowactivities->baseactivities, rowactivities->rowssize, newsize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &rowactivities->changedrows, rowactivities->rowssize, newsize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &rowactivities->rowchanged, rowactivities->rowssize, newsize) );
+      rowactivities->rowssize = newsize;
+   }
+
+   for( r = 0; r < nlprows; ++r )
+   {
+      assert(SCIProwGetLPPos(lprows[r]) == r);
+
+      if( !SCIProwIsLocal(lprows[r]) )
+      {
+         if( sol == NULL )
+            rowactivities->activities[r] = SCIPgetRowActivity(scip, lprows[r]);
+         else
+            rowactivities->activities[r] = SCIPgetRowSolActivity(scip, lprows[r], sol);
+      }
+      else
+         rowactivities->activities[r] = SCIP_INVALID;
+   }
+
+   if( nlprows > 0 )
+   {
+      BMScopyMemoryArray(rowactivities->baseactivities, rowactivities->activities, nlprows);
+      BMSclearMemoryArray(rowactivities->rowchanged, nlprows);
+   }
+
+   rowactivities->nodenum = nodenum;
+   rowactivities->nlps = SCIPgetNLPs(scip);
+   rowactivities->solindex = solindex;
+   rowactivities->nrows = nlprows;
+   rowactivities->nchangedrows = 0;
+
+   return SCIP_OKAY;
+}
+
+/** returns the activities of the LP rows, indexed by their LP position; entries of local rows are undefined
+ *
+ *  @note the array must only be changed via SCIPupdateRowActivities() or SCIPchgRowActivitiesVal()
+ */
+SCIP_Real* SCIPgetRowActivitiesVals(
+   SCIP_ROWACTIVITIES*   rowactivities       /**< row activities */
+   )
+{
+   assert(rowactivities != NULL);
+
+   return rowactivities->activities;
+}
+
+/** sets the activity of the LP row at the given LP position */
+void SCIPchgRowActivitiesVal(
+   SCIP_ROWACTIVITIES*   rowactivities,      /**< row activities */
+   int                   rowpos,             /**< LP position of a global row */
+   SCIP_Real             activity            /**< new activity of the row */
+   )
+{
+   assert(rowactivities != NULL);
+   assert(0 <= rowpos && rowpos < rowactivities->nrows);
+
+   /* remember the row such that its activity can be restored */
+   if( !rowactivities->rowchanged[rowpos] )
+   {
+      rowactivities->rowchanged[rowpos] = TRUE;
+      rowactivities->changedrows[rowactivities->nchangedrows] = rowpos;
+      ++rowactivities->nchangedrows;
+   }
+
+   rowactivities->activities[rowpos] = activity;
+}
+
+/** updates the activities of the global LP rows in the column of a variable whose solution value changed by @p delta;
+ *  infinite activities are kept
+ */
+void SCIPupdateRowActivities(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ROWACTIVITIES*   rowactivities,      /**< row activities */
+   SCIP_VAR*             var,                /**< column variable whose solution value changed */
+   SCIP_Real             delta               /**< change of the solution value */
+   )
+{
+   SCIP_COL* col;
+   SCIP_ROW** colrows;
+   SCIP_Real* colvals;
+   int ncolrows;
+   int r;
+
+   assert(scip != NULL);
+   assert(rowactivities != NULL);
+   assert(SCIPvarGetStatus(var) == SCIP_VARSTATUS_COLUMN);
+
+   col = SCIPvarGetCol(var);
+   colrows = SCIPcolGetRows(col);
+   colvals = SCIPcolGetVals(col);
+   ncolrows = SCIPcolGetNLPNonz(col);
+   assert(ncolrows == 0 || (colrows != NULL && colvals != NULL));
+
+   for( r = 0; r < ncolrows; ++r )
+   {
+      SCIP_Real activity;
+      int rowpos;
+
+      rowpos = SCIProwGetLPPos(colrows[r]);
+      assert(-1 <= rowpos && rowpos < rowactivities->nrows);
+
+      if( rowpos < 0 || SCIProwIsLocal(colrows[r]) )
+         continue;
+
+      activity = rowactivities->activities[rowpos];
+      if( SCIPisInfinity(scip, REALABS(activity)) )
+         continue;
+
+      activity += delta * colvals[r];
+      if( SCIPisInfinity(scip, activity) )
+         activity = SCIPinfinity(scip);
+      else if( SCIPisInfinity(scip, -activity) )
+         activity = -SCIPinfinity(scip);
+
+      SCIPchgRowActivitiesVal(rowactivities, rowpos, activity);
+   }
+}
@@ -36,6 +36,9 @@
 extern "C" {
 #endif
 
+typedef struct SCIP_LnsTemplate SCIP_LNSTEMPLATE; /**< reusable sub-SCIP for large neighborhood search */
+typedef struct SCIP_RowActivities SCIP_ROWACTIVITIES; /**< incrementally updated activities of the global LP rows */
+
 /**@defgroup PublicSpecialHeuristicMethods Special Methods
  * @ingroup PublicHeuristicMethods
  * @brief  methods commonly used by primal heuristics
@@ -98,6 +101,91 @@ SCIP_RETCODE SCIPcopyLargeNeighborhoodSearch(
    SCIP_Bool*            valid               /**< pointer to store whether the copying was valid, or NULL */
    );
 
+/** get a sub-SCIP copy of the transformed problem that can be solved on another thread; same as
+ *  SCIPcopyLargeNeighborhoodSearch(), but the sub-SCIP does not share the message handler of the source SCIP, which is
+ *  not threadsafe
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPcopyLargeNeighborhoodSearchAsync(
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP*                 subscip,            /**< sub-SCIP used by the heuristic */
+   SCIP_HASHMAP*         varmap,             /**< a hashmap to store the mapping of source variables to the corresponding
+                                              *   target variables */
+   const char*           suffix,             /**< suffix for the problem name */
+   SCIP_VAR**            fixedvars,          /**< source variables whose copies should be fixed in the target SCIP environment, or NULL */
+   SCIP_Real*            fixedvals,          /**< array of fixing values for target SCIP variables, or NULL */
+   int                   nfixedvars,         /**< number of source variables whose copies should be fixed in the target SCIP environment, or NULL */
+   SCIP_Bool             uselprows,          /**< should the linear relaxation of the problem defined by LP rows be copied? */
+   SCIP_Bool             copycuts,           /**< should cuts be copied (only if uselprows == FALSE) */
+   SCIP_Bool*            success,            /**< was the copying successful? */
+   SCIP_Bool*            valid               /**< pointer to store whether the copying was valid, or NULL */
+   );
+
+/** creates a reusable sub-SCIP template for large neighborhood search
+ *
+ *  The transformed problem of @p sourcescip is copied once without any fixings. Before each neighborhood is solved,
+ *  SCIPprepareLnsTemplate() resets the template to the current global bounds and objective of the source problem and
+ *  applies the fixings of the neighborhood, which avoids a full problem copy per heuristic call.
+ *
+ *  @note if @p uselprows is TRUE, the LP rows are copied only once, i.e., rows that are added to the LP of
+ *        @p sourcescip afterwards are not part of the template
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPcreateLnsTemplate(
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP_LNSTEMPLATE**    lnstemplate,        /**< pointer to store the template, set to NULL if copying failed */
+   const char*           suffix,             /**< suffix for the problem name */
+   SCIP_Bool             uselprows,          /**< should the linear relaxation of the problem defined by LP rows be copied? */
+   SCIP_Bool             copycuts,           /**< should cuts be copied (only if uselprows == FALSE) */
+   SCIP_Bool*            success             /**< was the copying successful? */
+   );
+
+/** frees a sub-SCIP template for large neighborhood search */
+SCIP_EXPORT
+SCIP_RETCODE SCIPfreeLnsTemplate(
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP_LNSTEMPLATE**    lnstemplate         /**< pointer to the template */
+   );
+
+/** returns whether the template still matches the problem of the source SCIP, i.e., no restart happened, the
+ *  variables are the same, and no constraint was added since the template was created
+ *
+ *  Bounds and objective coefficients are not checked, since SCIPprepareLnsTemplate() resets them. Constraints that
+ *  were deleted from the source problem are still valid in the template.
+ */
+SCIP_EXPORT
+SCIP_Bool SCIPisLnsTemplateValid(
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP_LNSTEMPLATE*     lnstemplate         /**< sub-SCIP template */
+   );
+
+/** re-arms the template for the next neighborhood: frees the transformed problem of the sub-SCIP, resets the bounds
+ *  and objective coefficients of all copied variables to those of the source problem, and fixes the copies of the
+ *  given source variables
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPprepareLnsTemplate(
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP_LNSTEMPLATE*     lnstemplate,        /**< sub-SCIP template */
+   SCIP_VAR**            fixedvars,          /**< source variables whose copies should be fixed, or NULL */
+   SCIP_Real*            fixedvals,          /**< array of fixing values for the copies, or NULL */
+   int                   nfixedvars          /**< number of source variables whose copies should be fixed */
+   );
+
+/** returns the sub-SCIP of the template */
+SCIP_EXPORT
+SCIP* SCIPgetLnsTemplateScip(
+   SCIP_LNSTEMPLATE*     lnstemplate         /**< sub-SCIP template */
+   );
+
+/** returns the copies of the source variables in the order of SCIPgetVars() of the source SCIP; entries of variables
+ *  that were not copied are NULL
+ */
+SCIP_EXPORT
+SCIP_VAR** SCIPgetLnsTemplateVars(
+   SCIP_LNSTEMPLATE*     lnstemplate         /**< sub-SCIP template */
+   );
+
 /** adds a trust region neighborhood constraint to the @p targetscip
  *
  *  a trust region constraint measures the deviation from the current incumbent solution \f$x^*\f$ by an auxiliary
@@ -120,6 +208,67 @@ SCIP_RETCODE SCIPaddTrustregionNeighborhoodConstraint(
    SCIP_Real             violpenalty         /**< the penalty for violating the trust region */
    );
 
+/** creates a data structure for the activities of the global LP rows w.r.t. a solution, which are updated
+ *  incrementally when solution values change
+ *
+ *  The activities are computed by SCIPcomputeRowActivities() and changed by SCIPupdateRowActivities() or
+ *  SCIPchgRowActivitiesVal() in time linear in the number of affected rows. If the activities are computed again for
+ *  the same solution at the same node and LP, only the rows changed in between are restored instead of recomputing
+ *  all activities, such that the data structure can be kept across heuristic calls.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPcreateRowActivities(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ROWACTIVITIES**  rowactivities       /**< pointer to store the row activities */
+   );
+
+/** frees the row activities */
+SCIP_EXPORT
+SCIP_RETCODE SCIPfreeRowActivities(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ROWACTIVITIES**  rowactivities       /**< pointer to the row activities */
+   );
+
+/** computes the activities of all global LP rows w.r.t. the given solution, or the LP solution if @p sol is NULL;
+ *  the activities of local rows are not computed
+ *
+ *  @note the activities are only restored instead of recomputed if the solution was not modified in between
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPcomputeRowActivities(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ROWACTIVITIES*   rowactivities,      /**< row activities */
+   SCIP_SOL*             sol                 /**< solution, or NULL for the LP solution */
+   );
+
+/** returns the activities of the LP rows, indexed by their LP position; entries of local rows are undefined
+ *
+ *  @note the array must only be changed via SCIPupdateRowActivities() or SCIPchgRowActivitiesVal()
+ */
+SCIP_EXPORT
+SCIP_Real* SCIPgetRowActivitiesVals(
+   SCIP_ROWACTIVITIES*   rowactivities       /**< row activities */
+   );
+
+/** sets the activity of the LP row at the given LP position */
+SCIP_EXPORT
+void SCIPchgRowActivitiesVal(
+   SCIP_ROWACTIVITIES*   rowactivities,      /**< row activities */
+   int                   rowpos,             /**< LP position of a global row */
+   SCIP_Real             activity            /**< new activity of the row */
+   );
+
+/** updates the activities of the global LP rows in the column of a variable whose solution value changed by @p delta;
+ *  infinite activities are kept
+ */
+SCIP_EXPORT
+void SCIPupdateRowActivities(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ROWACTIVITIES*   rowactivities,      /**< row activities */
+   SCIP_VAR*             var,                /**< column variable whose solution value changed */
+   SCIP_Real             delta               /**< change of the solution value */
+   );
+
 /** @} */
 
 #ifdef __cplusplus
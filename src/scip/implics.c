@@ -1269,6 +1269,8 @@ void SCIPcliqueDelVar(
    assert(SCIPvarIsBinary(var));
    assert(cliquetable != NULL);
 
+   cliquetable->csrvalid = FALSE;
+
    /* if the clique is the leading clique during the cleanup step, we do not need to insert it again */
    if( cliquetable->incleanup && clique->index == 0 )
       return;
@@ -1778,6 +1780,10 @@ SCIP_RETCODE SCIPcliquetableCreate(
    (*cliquetable)->varidxtable = NULL;
    (*cliquetable)->djset = NULL;
    (*cliquetable)->cliques = NULL;
+   (*cliquetable)->csrlitbeg = NULL;
+   (*cliquetable)->csrlitcliques = NULL;
+   (*cliquetable)->csrcliquebeg = NULL;
+   (*cliquetable)->csrcliquelits = NULL;
    (*cliquetable)->ncliques = 0;
    (*cliquetable)->size = 0;
    (*cliquetable)->ncreatedcliques = 0;
@@ -1788,6 +1794,10 @@ SCIP_RETCODE SCIPcliquetableCreate(
    (*cliquetable)->incleanup = FALSE;
    (*cliquetable)->compsfromscratch = FALSE;
    (*cliquetable)->ncliquecomponents = -1;
+   (*cliquetable)->ncsrvars = 0;
+   (*cliquetable)->csrnvarindexchgs = -1;
+   (*cliquetable)->ncsrcliques = 0;
+   (*cliquetable)->csrvalid = FALSE;
 
    return SCIP_OKAY;
 }
@@ -1817,6 +1827,12 @@ SCIP_RETCODE SCIPcliquetableFree(
    if( (*cliquetable)->varidxtable != NULL )
       SCIPhashmapFree(&(*cliquetable)->varidxtable);
 
+   /* free frozen clique graph */
+   BMSfreeMemoryArrayNull(&(*cliquetable)->csrcliquelits);
+   BMSfreeMemoryArrayNull(&(*cliquetable)->csrcliquebeg);
+   BMSfreeMemoryArrayNull(&(*cliquetable)->csrlitcliques);
+   BMSfreeMemoryArrayNull(&(*cliquetable)->csrlitbeg);
+
    /* free clique table data */
    BMSfreeMemoryArrayNull(&(*cliquetable)->cliques);
 
@@ -2379,6 +2395,8 @@ SCIP_RETCODE SCIPcliquetableAdd(
    assert(cliquetable != NULL);
    assert(vars != NULL);
 
+   cliquetable->csrvalid = FALSE;
+
    SCIPsetDebugMsg(set, "trying to add clique %d with %d vars to clique table\n", cliquetable->ncliques, nvars);
 
    /* check clique on debugging solution */
@@ -2916,6 +2934,8 @@ SCIP_RETCODE SCIPcliquetableCleanup(
       && cliquetable->ndirtycliques == 0 )
       return SCIP_OKAY;
 
+   cliquetable->csrvalid = FALSE;
+
    SCIPsetDebugMsg(set, "cleaning up clique table with %d cliques (with %" SCIP_LONGINT_FORMAT " entries)\n", cliquetable->ncliques, cliquetable->nentries);
 
    /* delay events */
@@ -3095,6 +3115,120 @@ SCIP_RETCODE SCIPcliquetableCleanup(
    return SCIP_OKAY;
 }
 
+/** builds the frozen compressed sparse row representation of the clique graph, if it is not up to date
+ *
+ *  The literal of variable x with value v is 2*probindex(x)+v; variables that are not active in the problem are left
+ *  out. The representation stays valid until the clique table or the problem indices of the variables change.
+ */
+SCIP_RETCODE SCIPcliquetableBuildCsr(
+   SCIP_CLIQUETABLE*     cliquetable,        /**< clique table data structure */
+   int                   nvars,              /**< number of problem variables */
+   SCIP_Longint          nvarindexchgs,      /**< number of changes of the problem indices, see SCIPprobGetNVarIndexChgs() */
+   SCIP_Bool*            success             /**< pointer to store whether the representation is available */
+   )
+{
+   SCIP_Longint ncsrentries;
+   int* litbeg;
+   int* litcliques;
+   int* cliquebeg;
+   int* cliquelits;
+   int nlits;
+   int c;
+   int j;
+   int l;
+
+   assert(cliquetable != NULL);
+   assert(nvars >= 0);
+   assert(success != NULL);
+
+   *success = TRUE;
+
+   /* the literals depend on the problem indices, which change if variables are added, removed, or change their type */
+   if( cliquetable->csrvalid && cliquetable->ncsrvars == nvars && cliquetable->csrnvarindexchgs == nvarindexchgs )
+      return SCIP_OKAY;
+
+   BMSfreeMemoryArrayNull(&cliquetable->csrcliquelits);
+   BMSfreeMemoryArrayNull(&cliquetable->csrcliquebeg);
+   BMSfreeMemoryArrayNull(&cliquetable->csrlitcliques);
+   BMSfreeMemoryArrayNull(&cliquetable->csrlitbeg);
+   cliquetable->csrvalid = FALSE;
+
+   /* offsets are stored as ints */
+   if( cliquetable->nentries >= INT_MAX || nvars >= INT_MAX / 2 )
+   {
+      *success = FALSE;
+      return SCIP_OKAY;
+   }
+
+   nlits = 2 * nvars;
+   SCIP_ALLOC( BMSallocClearMemoryArray(&cliquetable->csrlitbeg, nlits + 1) );
+   SCIP_ALLOC( BMSallocMemoryArray(&cliquetable->csrcliquebeg, cliquetable->ncliques + 1) );
+   litbeg = cliquetable->csrlitbeg;
+   cliquebeg = cliquetable->csrcliquebeg;
+
+   /* count the literals of each clique and the cliques of each literal */
+   ncsrentries = 0;
+   for( c = 0; c < cliquetable->ncliques; ++c )
+   {
+      SCIP_CLIQUE* clique = cliquetable->cliques[c];
+
+      cliquebeg[c] = (int)ncsrentries;
+      for( j = 0; j < clique->nvars; ++j )
+      {
+         int probindex = SCIPvarGetProbindex(clique->vars[j]);
+
+         if( probindex < 0 || probindex >= nvars )
+            continue;
+
+         ++litbeg[2 * probindex + (int)clique->values[j]];
+         ++ncsrentries;
+      }
+   }
+   assert(ncsrentries <= INT_MAX);
+   cliquebeg[cliquetable->ncliques] = (int)ncsrentries;
+
+   SCIP_ALLOC( BMSallocMemoryArray(&cliquetable->csrlitcliques, MAX(ncsrentries, 1)) );
+   SCIP_ALLOC( BMSallocMemoryArray(&cliquetable->csrcliquelits, MAX(ncsrentries, 1)) );
+   litcliques = cliquetable->csrlitcliques;
+   cliquelits = cliquetable->csrcliquelits;
+
+   /* let litbeg point behind the last clique of each literal */
+   for( l = 1; l < nlits; ++l )
+      litbeg[l] += litbeg[l-1];
+   litbeg[nlits] = (int)ncsrentries;
+
+   /* fill both directions; going backwards through the cliques keeps the clique lists of the literals sorted */
+   for( c = cliquetable->ncliques - 1; c >= 0; --c )
+   {
+      SCIP_CLIQUE* clique = cliquetable->cliques[c];
+      int pos = cliquebeg[c+1];
+
+      for( j = clique->nvars - 1; j >= 0; --j )
+      {
+         int probindex = SCIPvarGetProbindex(clique->vars[j]);
+         int lit;
+
+         if( probindex < 0 || probindex >= nvars )
+            continue;
+
+         lit = 2 * probindex + (int)clique->values[j];
+         cliquelits[--pos] = lit;
+         litcliques[--litbeg[lit]] = c;
+      }
+      assert(pos == cliquebeg[c]);
+   }
+
+   cliquetable->ncsrvars = nvars;
+   cliquetable->csrnvarindexchgs = nvarindexchgs;
+   cliquetable->ncsrcliques = cliquetable->ncliques;
+   cliquetable->csrvalid = TRUE;
+
+   SCIPdebugMessage("built frozen clique graph with %d literals, %d cliques and %" SCIP_LONGINT_FORMAT " entries\n",
+      nlits, cliquetable->ncsrcliques, ncsrentries);
+
+   return SCIP_OKAY;
+}
+
 /** computes connected components of the clique table
  *
  *  an update becomes necessary if a clique gets added with variables from different components
@@ -3513,6 +3647,33 @@ SCIP_Longint SCIPcliquetableGetNEntries(
    return cliquetable->nentries;
 }
 
+/** gets the frozen compressed sparse row representation of the clique graph, which must have been built by
+ *  SCIPcliquetableBuildCsr() before
+ */
+void SCIPcliquetableGetCsr(
+   SCIP_CLIQUETABLE*     cliquetable,        /**< clique table data structure */
+   int**                 litbeg,             /**< pointer to store the start of each literal's cliques in litcliques, or NULL */
+   int**                 litcliques,         /**< pointer to store the clique positions of the literals, or NULL */
+   int**                 cliquebeg,          /**< pointer to store the start of each clique's literals in cliquelits, or NULL */
+   int**                 cliquelits,         /**< pointer to store the literals of the cliques, or NULL */
+   int*                  ncliques            /**< pointer to store the number of cliques, or NULL */
+   )
+{
+   assert(cliquetable != NULL);
+   assert(cliquetable->csrvalid);
+
+   if( litbeg != NULL )
+      *litbeg = cliquetable->csrlitbeg;
+   if( litcliques != NULL )
+      *litcliques = cliquetable->csrlitcliques;
+   if( cliquebeg != NULL )
+      *cliquebeg = cliquetable->csrcliquebeg;
+   if( cliquelits != NULL )
+      *cliquelits = cliquetable->csrcliquelits;
+   if( ncliques != NULL )
+      *ncliques = cliquetable->ncsrcliques;
+}
+
 /** returns the number of clique components, or -1 if update is necessary first */
 int SCIPcliquetableGetNCliqueComponents(
    SCIP_CLIQUETABLE*     cliquetable         /**< clique table data structure */
@@ -349,6 +349,30 @@ SCIP_RETCODE SCIPcliquetableCleanup(
    SCIP_Bool*            infeasible          /**< pointer to store whether an infeasibility was detected */
    );
 
+/** builds the frozen compressed sparse row representation of the clique graph, if it is not up to date
+ *
+ *  The literal of variable x with value v is 2*probindex(x)+v; variables that are not active in the problem are left
+ *  out. The representation stays valid until the clique table or the problem indices of the variables change.
+ */
+SCIP_RETCODE SCIPcliquetableBuildCsr(
+   SCIP_CLIQUETABLE*     cliquetable,        /**< clique table data structure */
+   int                   nvars,              /**< number of problem variables */
+   SCIP_Longint          nvarindexchgs,      /**< number of changes of the problem indices, see SCIPprobGetNVarIndexChgs() */
+   SCIP_Bool*            success             /**< pointer to store whether the representation is available */
+   );
+
+/** gets the frozen compressed sparse row representation of the clique graph, which must have been built by
+ *  SCIPcliquetableBuildCsr() before
+ */
+void SCIPcliquetableGetCsr(
+   SCIP_CLIQUETABLE*     cliquetable,        /**< clique table data structure */
+   int**                 litbeg,             /**< pointer to store the start of each literal's cliques in litcliques, or NULL */
+   int**                 litcliques,         /**< pointer to store the clique positions of the literals, or NULL */
+   int**                 cliquebeg,          /**< pointer to store the start of each clique's literals in cliquelits, or NULL */
+   int**                 cliquelits,         /**< pointer to store the literals of the cliques, or NULL */
+   int*                  ncliques            /**< pointer to store the number of cliques, or NULL */
+   );
+
 /** computes connected components of the clique graph
  *
  *  use depth-first search similarly to the components presolver/constraint handler, representing a clique as a
@@ -374,6 +374,50 @@ SCIP_Real SCIPintervalNegateReal(
    return negate((double)x);
 }
 
+/** switches to upwards rounding, if it is not active already, and returns the previous rounding mode
+ *
+ *  The basic operations below compute both bounds of their result while rounding upwards, obtaining the infimum
+ *  as the negated supremum of the operation on the negated operands. Thus, if the caller already rounds upwards,
+ *  a sequence of these operations does not change the rounding mode at all.
+ */
+static
+SCIP_ROUNDMODE intervalSetRoundingModeUpwardsIfNeeded(
+   void
+   )
+{
+   SCIP_ROUNDMODE roundmode;
+
+   roundmode = intervalGetRoundingMode();
+   if( roundmode != SCIP_ROUND_UPWARDS )
+      intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
+
+   return roundmode;
+}
+
+/** restores the rounding mode that was active before intervalSetRoundingModeUpwardsIfNeeded() was called */
+static
+void intervalRestoreRoundingMode(
+   SCIP_ROUNDMODE        roundmode           /**< rounding mode returned by intervalSetRoundingModeUpwardsIfNeeded() */
+   )
+{
+   if( roundmode != SCIP_ROUND_UPWARDS )
+      intervalSetRoundingMode(roundmode);
+}
+
+/** gets the negation [-b,-a] of an interval [a,b], which is exact for every rounding mode */
+static
+SCIP_INTERVAL intervalNegate(
+   SCIP_INTERVAL         operand             /**< interval to negate */
+   )
+{
+   SCIP_INTERVAL resultant;
+
+   resultant.inf = negate(operand.sup);
+   resultant.sup = negate(operand.inf);
+
+   return resultant;
+}
+
 /*
  * Interval arithmetic operations
  */
@@ -630,22 +674,22 @@ void SCIPintervalAdd(
    )
 {
    SCIP_ROUNDMODE roundmode;
+   SCIP_INTERVAL negresultant;
 
    assert(resultant != NULL);
    assert(!SCIPintervalIsEmpty(infinity, operand1));
    assert(!SCIPintervalIsEmpty(infinity, operand2));
 
-   roundmode = intervalGetRoundingMode();
+   roundmode = intervalSetRoundingModeUpwardsIfNeeded();
 
-   /* compute infimum of result */
-   intervalSetRoundingMode(SCIP_ROUND_DOWNWARDS);
-   SCIPintervalAddInf(infinity, resultant, operand1, operand2);
+   /* compute infimum of result as negated supremum of (-operand1) + (-operand2) */
+   SCIPintervalAddSup(infinity, &negresultant, intervalNegate(operand1), intervalNegate(operand2));
 
    /* compute supremum of result */
-   intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
    SCIPintervalAddSup(infinity, resultant, operand1, operand2);
+   resultant->inf = negate(negresultant.sup);
 
-   intervalSetRoundingMode(roundmode);
+   intervalRestoreRoundingMode(roundmode);
 }
 
 /** adds operand1 and scalar operand2 and stores result in resultant */
@@ -661,7 +705,7 @@ void SCIPintervalAddScalar(
    assert(resultant != NULL);
    assert(!SCIPintervalIsEmpty(infinity, operand1));
 
-   roundmode = intervalGetRoundingMode();
+   roundmode = intervalSetRoundingModeUpwardsIfNeeded();
 
    /* -inf + something >= -inf */
    if( operand1.inf <= -infinity || operand2 <= -infinity )
@@ -675,8 +719,7 @@ void SCIPintervalAddScalar(
    }
    else
    {
-      intervalSetRoundingMode(SCIP_ROUND_DOWNWARDS);
-      resultant->inf = operand1.inf + operand2;
+      resultant->inf = negate(negate(operand1.inf) - operand2);
    }
 
    /* inf + something <= inf */
@@ -691,11 +734,10 @@ void SCIPintervalAddScalar(
    }
    else
    {
-      intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
       resultant->sup = operand1.sup + operand2;
    }
 
-   intervalSetRoundingMode(roundmode);
+   intervalRestoreRoundingMode(roundmode);
 }
 
 /** adds vector operand1 and vector operand2 and stores result in vector resultant */
@@ -708,24 +750,20 @@ void SCIPintervalAddVectors(
    )
 {
    SCIP_ROUNDMODE roundmode;
+   SCIP_INTERVAL negresultant;
    int i;
 
-   roundmode = intervalGetRoundingMode();
+   roundmode = intervalSetRoundingModeUpwardsIfNeeded();
 
-   /* compute infimums of resultant array */
-   intervalSetRoundingMode(SCIP_ROUND_DOWNWARDS);
-   for( i = 0; i < length; ++i )
-   {
-      SCIPintervalAddInf(infinity, &resultant[i], operand1[i], operand2[i]);
-   }
-   /* compute supremums of result array */
-   intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
+   /* compute infimums and supremums of resultant array, infimums as negated supremums of the negated operands */
    for( i = 0; i < length; ++i )
    {
+      SCIPintervalAddSup(infinity, &negresultant, intervalNegate(operand1[i]), intervalNegate(operand2[i]));
       SCIPintervalAddSup(infinity, &resultant[i], operand1[i], operand2[i]);
+      resultant[i].inf = negate(negresultant.sup);
    }
 
-   intervalSetRoundingMode(roundmode);
+   intervalRestoreRoundingMode(roundmode);
 }
 
 /** subtracts operand2 from operand1 and stores result in resultant */
@@ -735,45 +773,13 @@ void SCIPintervalSub(
    SCIP_INTERVAL         operand1,           /**< first operand of operation */
    SCIP_INTERVAL         operand2            /**< second operand of operation */
    )
-{  /*lint --e{644}*/
-   SCIP_ROUNDMODE roundmode;
-
+{
    assert(resultant != NULL);
    assert(!SCIPintervalIsEmpty(infinity, operand1));
    assert(!SCIPintervalIsEmpty(infinity, operand2));
 
-   roundmode = intervalGetRoundingMode();
-
-   if( operand1.inf <= -infinity || operand2.sup >=  infinity )
-      resultant->inf = -infinity;
-   /* [a,b] - [-inf,-inf] = [+inf,+inf] */
-   else if( operand1.inf >= infinity || operand2.sup <= -infinity )
-   {
-      resultant->inf = infinity;
-      resultant->sup = infinity;
-      return;
-   }
-   else
-   {
-      intervalSetRoundingMode(SCIP_ROUND_DOWNWARDS);
-      resultant->inf = operand1.inf - operand2.sup;
-   }
-
-   if( operand1.sup >=  infinity || operand2.inf <= -infinity )
-      resultant->sup =  infinity;
-   /* [a,b] - [+inf,+inf] = [-inf,-inf] */
-   else if( operand1.sup <= -infinity || operand2.inf >= infinity )
-   {
-      assert(resultant->inf == -infinity);  /* should be set above, since operand1.inf <= operand1.sup <= -infinity */  /*lint !e777*/
-      resultant->sup = -infinity;
-   }
-   else
-   {
-      intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
-      resultant->sup = operand1.sup - operand2.inf;
-   }
-
-   intervalSetRoundingMode(roundmode);
+   /* [a,b] - [c,d] = [a,b] + [-d,-c], in particular, [a,b] - [-inf,-inf] = [+inf,+inf] and [a,b] - [+inf,+inf] = [-inf,-inf] */
+   SCIPintervalAdd(infinity, resultant, operand1, intervalNegate(operand2));
 }
 
 /** subtracts scalar operand2 from operand1 and stores result in resultant */
@@ -916,22 +922,22 @@ void SCIPintervalMul(
    )
 {
    SCIP_ROUNDMODE roundmode;
+   SCIP_INTERVAL negresultant;
 
    assert(resultant != NULL);
    assert(!SCIPintervalIsEmpty(infinity, operand1));
    assert(!SCIPintervalIsEmpty(infinity, operand2));
 
-   roundmode = intervalGetRoundingMode();
+   roundmode = intervalSetRoundingModeUpwardsIfNeeded();
 
-   /* compute infimum result */
-   intervalSetRoundingMode(SCIP_ROUND_DOWNWARDS);
-   SCIPintervalMulInf(infinity, resultant, operand1, operand2);
+   /* compute infimum of result as negated supremum of operand1 * (-operand2) */
+   SCIPintervalMulSup(infinity, &negresultant, operand1, intervalNegate(operand2));
 
    /* compute supremum of result */
-   intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
    SCIPintervalMulSup(infinity, resultant, operand1, operand2);
+   resultant->inf = negate(negresultant.sup);
 
-   intervalSetRoundingMode(roundmode);
+   intervalRestoreRoundingMode(roundmode);
 }
 
 /** multiplies operand1 with scalar operand2 and stores infimum of result in infimum of resultant */
@@ -1055,6 +1061,7 @@ void SCIPintervalMulScalar(
    )
 {
    SCIP_ROUNDMODE roundmode;
+   SCIP_INTERVAL negresultant;
 
    assert(resultant != NULL);
    assert(!SCIPintervalIsEmpty(infinity, operand1));
@@ -1072,17 +1079,16 @@ void SCIPintervalMulScalar(
       return;
    }
 
-   roundmode = intervalGetRoundingMode();
+   roundmode = intervalSetRoundingModeUpwardsIfNeeded();
 
-   /* compute infimum result */
-   intervalSetRoundingMode(SCIP_ROUND_DOWNWARDS);
-   SCIPintervalMulScalarInf(infinity, resultant, operand1, operand2);
+   /* compute infimum of result as negated supremum of (-operand1) * operand2 */
+   SCIPintervalMulScalarSup(infinity, &negresultant, intervalNegate(operand1), operand2);
 
    /* compute supremum of result */
-   intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
    SCIPintervalMulScalarSup(infinity, resultant, operand1, operand2);
+   resultant->inf = negate(negresultant.sup);
 
-   intervalSetRoundingMode(roundmode);
+   intervalRestoreRoundingMode(roundmode);
 }
 
 /** divides operand1 by operand2 and stores result in resultant */
@@ -1113,7 +1119,7 @@ void SCIPintervalDiv(
       return;
    }
 
-   roundmode = intervalGetRoundingMode();
+   roundmode = intervalSetRoundingModeUpwardsIfNeeded();
 
    /* division by nonzero: resultant = x * (1/y) */
    if( operand2.sup >=  infinity || operand2.sup <= -infinity )
@@ -1122,8 +1128,7 @@ void SCIPintervalDiv(
    }
    else
    {
-      intervalSetRoundingMode(SCIP_ROUND_DOWNWARDS);
-      intmed.inf = 1.0 / operand2.sup;
+      intmed.inf = negate(1.0 / negate(operand2.sup));
    }
    if( operand2.inf <= -infinity || operand2.inf >= infinity )
    {
@@ -1131,12 +1136,11 @@ void SCIPintervalDiv(
    }
    else
    {
-      intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
       intmed.sup = 1.0 / operand2.inf;
    }
    SCIPintervalMul(infinity, resultant, operand1, intmed);
 
-   intervalSetRoundingMode(roundmode);
+   intervalRestoreRoundingMode(roundmode);
 }
 
 /** divides operand1 by scalar operand2 and stores result in resultant */
@@ -1152,8 +1156,6 @@ void SCIPintervalDivScalar(
    assert(resultant != NULL);
    assert(!SCIPintervalIsEmpty(infinity, operand1));
 
-   roundmode = intervalGetRoundingMode();
-
    if( operand2 >= infinity || operand2 <= -infinity )
    {
       /* division by +/-infinity is 0.0 */
@@ -1162,6 +1164,8 @@ void SCIPintervalDivScalar(
    }
    else if( operand2 > 0.0 )
    {
+      roundmode = intervalSetRoundingModeUpwardsIfNeeded();
+
       if( operand1.inf <= -infinity )
          resultant->inf = -infinity;
       else if( operand1.inf >= infinity )
@@ -1171,8 +1175,7 @@ void SCIPintervalDivScalar(
       }
       else
       {
-         intervalSetRoundingMode(SCIP_ROUND_DOWNWARDS);
-         resultant->inf = operand1.inf / operand2;
+         resultant->inf = negate(negate(operand1.inf) / operand2);
       }
 
       if( operand1.sup >= infinity )
@@ -1184,12 +1187,15 @@ void SCIPintervalDivScalar(
       }
       else
       {
-         intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
          resultant->sup = operand1.sup / operand2;
       }
+
+      intervalRestoreRoundingMode(roundmode);
    }
    else if( operand2 < 0.0 )
    {
+      roundmode = intervalSetRoundingModeUpwardsIfNeeded();
+
       if( operand1.sup >=  infinity )
          resultant->inf = -infinity;
       else if( operand1.sup <= -infinity )
@@ -1199,8 +1205,7 @@ void SCIPintervalDivScalar(
       }
       else
       {
-         intervalSetRoundingMode(SCIP_ROUND_DOWNWARDS);
-         resultant->inf = operand1.sup / operand2;
+         resultant->inf = negate(negate(operand1.sup) / operand2);
       }
 
       if( operand1.inf <= -infinity )
@@ -1212,9 +1217,10 @@ void SCIPintervalDivScalar(
       }
       else
       {
-         intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
          resultant->sup = operand1.inf / operand2;
       }
+
+      intervalRestoreRoundingMode(roundmode);
    }
    else
    { /* division by 0.0 */
@@ -1236,10 +1242,7 @@ void SCIPintervalDivScalar(
          resultant->inf = -infinity;
          resultant->sup =  infinity;
       }
-      return;
    }
-
-   intervalSetRoundingMode(roundmode);
 }
 
 /** computes the scalar product of two vectors of intervals and stores result in resultant */
@@ -1252,26 +1255,26 @@ void SCIPintervalScalprod(
    )
 {
    SCIP_ROUNDMODE roundmode;
+   SCIP_INTERVAL negresultant;
    SCIP_INTERVAL prod;
    int i;
 
-   roundmode = intervalGetRoundingMode();
+   roundmode = intervalSetRoundingModeUpwardsIfNeeded();
 
    resultant->inf = 0.0;
    resultant->sup = 0.0;
 
-   /* compute infimum of resultant */
-   intervalSetRoundingMode(SCIP_ROUND_DOWNWARDS);
-   for( i = 0; i < length && resultant->inf > -infinity; ++i )
+   /* compute infimum of resultant as negated supremum of the scalar product of operand1 and -operand2 */
+   SCIPintervalSet(&negresultant, 0.0);
+   for( i = 0; i < length && negresultant.sup < infinity; ++i )
    {
       SCIPintervalSetEntire(infinity, &prod);
-      SCIPintervalMulInf(infinity, &prod, operand1[i], operand2[i]);
-      SCIPintervalAddInf(infinity, resultant, *resultant, prod); 
+      SCIPintervalMulSup(infinity, &prod, operand1[i], intervalNegate(operand2[i]));
+      SCIPintervalAddSup(infinity, &negresultant, negresultant, prod);
    }
-   assert(resultant->sup == 0.0);
+   resultant->inf = negate(negresultant.sup);
 
    /* compute supremum of resultant */
-   intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
    for( i = 0; i < length && resultant->sup < infinity ; ++i )
    {
       SCIPintervalSetEntire(infinity, &prod);
@@ -1279,7 +1282,7 @@ void SCIPintervalScalprod(
       SCIPintervalAddSup(infinity, resultant, *resultant, prod); 
    }
 
-   intervalSetRoundingMode(roundmode);
+   intervalRestoreRoundingMode(roundmode);
 }
 
 /** computes scalar product of a vector of intervals and a vector of scalars and stores infimum of result in infimum of 
@@ -1348,22 +1351,30 @@ void SCIPintervalScalprodScalars(
    )
 {
    SCIP_ROUNDMODE roundmode;
+   SCIP_INTERVAL negresultant;
+   SCIP_INTERVAL prod;
+   int i;
 
-   roundmode = intervalGetRoundingMode();
+   roundmode = intervalSetRoundingModeUpwardsIfNeeded();
 
    resultant->inf = 0.0;
    resultant->sup = 0.0;
 
-   /* compute infimum of resultant */
-   intervalSetRoundingMode(SCIP_ROUND_DOWNWARDS);
-   SCIPintervalScalprodScalarsInf(infinity, resultant, length, operand1, operand2);
-   assert(resultant->sup == 0.0);
+   /* compute infimum of resultant as negated supremum of the scalar product of -operand1 and operand2 */
+   SCIPintervalSet(&negresultant, 0.0);
+   SCIPintervalSetEntire(infinity, &prod);
+   for( i = 0; i < length && negresultant.sup < infinity; ++i )
+   {
+      SCIPintervalMulScalarSup(infinity, &prod, intervalNegate(operand1[i]), operand2[i]);
+      assert(prod.inf <= -infinity);
+      SCIPintervalAddSup(infinity, &negresultant, negresultant, prod);
+   }
+   resultant->inf = negate(negresultant.sup);
 
    /* compute supremum of resultant */
-   intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
    SCIPintervalScalprodScalarsSup(infinity, resultant, length, operand1, operand2);
 
-   intervalSetRoundingMode(roundmode);
+   intervalRestoreRoundingMode(roundmode);
 }
 
 /** squares operand and stores result in resultant */
@@ -1378,7 +1389,7 @@ void SCIPintervalSquare(
    assert(resultant != NULL);
    assert(!SCIPintervalIsEmpty(infinity, operand));
 
-   roundmode = intervalGetRoundingMode();
+   roundmode = intervalSetRoundingModeUpwardsIfNeeded();
 
    if( operand.sup <= 0.0 )
    {  /* operand is left of 0.0 */
@@ -1386,15 +1397,13 @@ void SCIPintervalSquare(
          resultant->inf =  infinity;
       else
       {
-         intervalSetRoundingMode(SCIP_ROUND_DOWNWARDS);
-         resultant->inf = operand.sup * operand.sup;
+         resultant->inf = negate(negate(operand.sup) * operand.sup);
       }
 
       if( operand.inf <= -infinity )
          resultant->sup = infinity;
       else
       {
-         intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
          resultant->sup = operand.inf * operand.inf;
       }
    }
@@ -1404,15 +1413,13 @@ void SCIPintervalSquare(
          resultant->inf = infinity;
       else
       {
-         intervalSetRoundingMode(SCIP_ROUND_DOWNWARDS);
-         resultant->inf = operand.inf * operand.inf;
+         resultant->inf = negate(negate(operand.inf) * operand.inf);
       }
 
       if( operand.sup >= infinity )
          resultant->sup = infinity;
       else
       {
-         intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
          resultant->sup = operand.sup * operand.sup;
       }
    }
@@ -1426,14 +1433,13 @@ void SCIPintervalSquare(
          SCIP_Real x;
          SCIP_Real y;
 
-         intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
          x = operand.inf * operand.inf;
          y = operand.sup * operand.sup;
          resultant->sup = MAX(x, y);
       }
    }
 
-   intervalSetRoundingMode(roundmode);
+   intervalRestoreRoundingMode(roundmode);
 }
 
 /** stores (positive part of) square root of operand in resultant
@@ -73,7 +73,12 @@ void SCIPintervalSetRoundingModeDownwards(
    void
    );
 
-/** sets rounding mode of floating point operations to upwards rounding */
+/** sets rounding mode of floating point operations to upwards rounding
+ *
+ *  SCIPintervalAdd(), SCIPintervalSub(), SCIPintervalMul(), SCIPintervalDiv(), SCIPintervalSquare(), their scalar and
+ *  vector variants, and the scalar products compute both bounds while rounding upwards and do not change the rounding
+ *  mode if it is upwards already. Thus, a sequence of these operations can be evaluated in one scope of upwards rounding.
+ */
 SCIP_EXPORT
 void SCIPintervalSetRoundingModeUpwards(
    void
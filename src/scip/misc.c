@@ -2958,6 +2958,55 @@ SCIP_Bool hashmapLookup(
    }
 }
 
+/** rebuilds the hashmap with the given number of slots, which must be a power of two */
+static
+SCIP_RETCODE hashmapRebuild(
+   SCIP_HASHMAP*         hashmap,            /**< hash table */
+   uint32_t              newshift            /**< new power such that 2^(32-newshift) is the new number of slots */
+   )
+{
+   SCIP_HASHMAPENTRY* slots;
+   uint32_t* hashes;
+   uint32_t nslots;
+   uint32_t newnslots;
+   uint32_t i;
+
+   assert(hashmap != NULL);
+   assert(newshift < hashmap->shift);
+
+   /* calculate new size (always power of two) */
+   nslots = hashmap->mask + 1;
+   hashmap->shift = newshift;
+   newnslots = 1u << (32 - newshift);
+   hashmap->mask = newnslots-1;
+
+   /* reallocate array */
+   SCIP_ALLOC( BMSallocBlockMemoryArray(hashmap->blkmem, &slots, newnslots) );
+   SCIP_ALLOC( BMSallocClearBlockMemoryArray(hashmap->blkmem, &hashes, newnslots) );
+
+   SCIPswapPointers((void**) &slots, (void**) &hashmap->slots);
+   SCIPswapPointers((void**) &hashes, (void**) &hashmap->hashes);
+   hashmap->nelements = 0;
+
+   /* reinsert all elements */
+   for( i = 0; i < nslots; ++i )
+   {
+      /* using SCIP_CALL_ABORT since there are no allocations or duplicates
+       * and thus no bad return codes when inserting the elements
+       */
+      if( hashes[i] != 0 )
+      {
+         SCIP_CALL_ABORT( hashmapInsert(hashmap, slots[i].origin, slots[i].image, hashes[i], FALSE) );
+      }
+   }
+
+   /* free old arrays */
+   BMSfreeBlockMemoryArray(hashmap->blkmem, &hashes, nslots);
+   BMSfreeBlockMemoryArray(hashmap->blkmem, &slots, nslots);
+
+   return SCIP_OKAY;
+}
+
 /** check if the load factor of the hashmap is too high and rebuild if necessary */
 static
 SCIP_RETCODE hashmapCheckLoad(
@@ -2970,41 +3019,37 @@ SCIP_RETCODE hashmapCheckLoad(
    /* use integer arithmetic to approximately check if load factor is above 90% */
    if( ((((uint64_t)hashmap->nelements)<<10)>>(32-hashmap->shift) > 921) )
    {
-      SCIP_HASHMAPENTRY* slots;
-      uint32_t* hashes;
-      uint32_t nslots;
-      uint32_t newnslots;
-      uint32_t i;
+      SCIP_CALL( hashmapRebuild(hashmap, hashmap->shift - 1) );
+   }
 
-      /* calculate new size (always power of two) */
-      nslots = hashmap->mask + 1;
-      --hashmap->shift;
-      newnslots = 2*nslots;
-      hashmap->mask = newnslots-1;
+   return SCIP_OKAY;
+}
 
-      /* reallocate array */
-      SCIP_ALLOC( BMSallocBlockMemoryArray(hashmap->blkmem, &slots, newnslots) );
-      SCIP_ALLOC( BMSallocClearBlockMemoryArray(hashmap->blkmem, &hashes, newnslots) );
+/** rebuilds the hashmap at most once such that the given number of additional elements can be inserted without
+ *  exceeding the load factor checked in hashmapCheckLoad()
+ */
+static
+SCIP_RETCODE hashmapEnsureSize(
+   SCIP_HASHMAP*         hashmap,            /**< hash table */
+   int                   nnewelements        /**< number of elements that will be inserted */
+   )
+{
+   uint64_t nelements;
+   uint32_t newshift;
 
-      SCIPswapPointers((void**) &slots, (void**) &hashmap->slots);
-      SCIPswapPointers((void**) &hashes, (void**) &hashmap->hashes);
-      hashmap->nelements = 0;
+   assert(hashmap != NULL);
+   assert(nnewelements >= 0);
 
-      /* reinsert all elements */
-      for( i = 0; i < nslots; ++i )
-      {
-         /* using SCIP_CALL_ABORT since there are no allocations or duplicates
-          * and thus no bad return codes when inserting the elements
-          */
-         if( hashes[i] != 0 )
-         {
-            SCIP_CALL_ABORT( hashmapInsert(hashmap, slots[i].origin, slots[i].image, hashes[i], FALSE) );
-         }
-      }
+   nelements = (uint64_t)hashmap->nelements + (uint64_t)nnewelements;
+   newshift = hashmap->shift;
+
+   /* keep the load factor at most 90%, see hashmapCheckLoad() */
+   while( newshift > 1 && ((nelements<<10)>>(32-newshift)) > 921 )
+      --newshift;
 
-      /* free old arrays */
-      BMSfreeBlockMemoryArray(hashmap->blkmem, &hashes, nslots);
-      BMSfreeBlockMemoryArray(hashmap->blkmem, &slots, nslots);
+   if( newshift < hashmap->shift )
+   {
+      SCIP_CALL( hashmapRebuild(hashmap, newshift) );
    }
 
    return SCIP_OKAY;
@@ -3197,6 +3242,85 @@ SCIP_RETCODE SCIPhashmapInsertReal(
    return SCIP_OKAY;
 }
 
+/** inserts new origin->image pairs for all given origins in the hash map; the hash map is resized at most once
+ *
+ *  @note multiple insertion of same element is checked and results in an error
+ */
+SCIP_RETCODE SCIPhashmapInsertArray(
+   SCIP_HASHMAP*         hashmap,            /**< hash map */
+   void**                origins,            /**< origins to set images for */
+   void**                images,             /**< new images for the origins */
+   int                   norigins            /**< number of origins */
+   )
+{
+   int i;
+
+   assert(hashmap != NULL);
+   assert(hashmap->slots != NULL);
+   assert(hashmap->hashes != NULL);
+   assert(hashmap->mask > 0);
+   assert(origins != NULL || norigins == 0);
+   assert(images != NULL || norigins == 0);
+   assert(hashmap->hashmaptype == SCIP_HASHMAPTYPE_UNKNOWN || hashmap->hashmaptype == SCIP_HASHMAPTYPE_POINTER);
+
+#ifndef NDEBUG
+   if( hashmap->hashmaptype == SCIP_HASHMAPTYPE_UNKNOWN )
+      hashmap->hashmaptype = SCIP_HASHMAPTYPE_POINTER;
+#endif
+
+   SCIP_CALL( hashmapEnsureSize(hashmap, norigins) );
+
+   for( i = 0; i < norigins; ++i )
+   {
+      SCIP_HASHMAPIMAGE img;
+
+      img.ptr = images[i];
+      SCIP_CALL( hashmapInsert(hashmap, origins[i], img, hashvalue((size_t)origins[i]), FALSE) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** inserts new origin->image pairs for all given origins in the hash map; the hash map is resized at most once
+ *
+ *  If no images are given, each origin is mapped to its position in the origins array.
+ *
+ *  @note multiple insertion of same element is checked and results in an error
+ */
+SCIP_RETCODE SCIPhashmapInsertArrayInt(
+   SCIP_HASHMAP*         hashmap,            /**< hash map */
+   void**                origins,            /**< origins to set images for */
+   int*                  images,             /**< new images for the origins, or NULL to use the positions */
+   int                   norigins            /**< number of origins */
+   )
+{
+   int i;
+
+   assert(hashmap != NULL);
+   assert(hashmap->slots != NULL);
+   assert(hashmap->hashes != NULL);
+   assert(hashmap->mask > 0);
+   assert(origins != NULL || norigins == 0);
+   assert(hashmap->hashmaptype == SCIP_HASHMAPTYPE_UNKNOWN || hashmap->hashmaptype == SCIP_HASHMAPTYPE_INT);
+
+#ifndef NDEBUG
+   if( hashmap->hashmaptype == SCIP_HASHMAPTYPE_UNKNOWN )
+      hashmap->hashmaptype = SCIP_HASHMAPTYPE_INT;
+#endif
+
+   SCIP_CALL( hashmapEnsureSize(hashmap, norigins) );
+
+   for( i = 0; i < norigins; ++i )
+   {
+      SCIP_HASHMAPIMAGE img;
+
+      img.integer = (images != NULL ? images[i] : i);
+      SCIP_CALL( hashmapInsert(hashmap, origins[i], img, hashvalue((size_t)origins[i]), FALSE) );
+   }
+
+   return SCIP_OKAY;
+}
+
 /** retrieves image of given origin from the hash map, or NULL if no image exists */
 void* SCIPhashmapGetImage(
    SCIP_HASHMAP*         hashmap,            /**< hash map */
@@ -3257,6 +3381,29 @@ SCIP_Real SCIPhashmapGetImageReal(
    return SCIP_INVALID;
 }
 
+/** retrieves the images of the given origins from the hash map, storing NULL for origins without image */
+void SCIPhashmapGetImages(
+   SCIP_HASHMAP*         hashmap,            /**< hash map */
+   void**                origins,            /**< origins to retrieve images for */
+   void**                images,             /**< array to store the images */
+   int                   norigins            /**< number of origins */
+   )
+{
+   uint32_t pos;
+   int i;
+
+   assert(hashmap != NULL);
+   assert(hashmap->slots != NULL);
+   assert(hashmap->hashes != NULL);
+   assert(hashmap->mask > 0);
+   assert(origins != NULL || norigins == 0);
+   assert(images != NULL || norigins == 0);
+   assert(hashmap->hashmaptype == SCIP_HASHMAPTYPE_UNKNOWN || hashmap->hashmaptype == SCIP_HASHMAPTYPE_POINTER);
+
+   for( i = 0; i < norigins; ++i )
+      images[i] = hashmapLookup(hashmap, origins[i], &pos) ? hashmap->slots[pos].image.ptr : NULL;
+}
+
 /** sets image for given origin in the hash map, either by modifying existing origin->image pair
  *  or by appending a new origin->image pair
  */
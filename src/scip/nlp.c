@@ -4691,6 +4691,7 @@ SCIP_RETCODE nlpSolve(
    SCIP_STAT*            stat                /**< problem statistics */
    )
 {
+   SCIP_NLPSTATISTICS* nlpstatistics;
    SCIP_Real sciptimelimit;
    SCIP_Real timeleft;
    int i;
@@ -4736,6 +4737,51 @@ SCIP_RETCODE nlpSolve(
 
       SCIPsetFreeBufferArray(set, &initialguess_solver);
    }
+   else if( set->nlp_warmstart && nlp->solstat <= SCIP_NLPSOLSTAT_LOCINFEASIBLE && nlp->nvars_solver > 0 )
+   {
+      /* warm start from the primal and dual values of the last NLP solution
+       * the NLPI problem is kept between solves and only updated, so the last solution is usually a good starting point
+       * variables and rows that have been added since then have primal value at best bound and dual value 0
+       */
+      SCIP_Real* primalvals_solver;
+      SCIP_Real* nlrowdualvals_solver;
+      SCIP_Real* varlbdualvals_solver;
+      SCIP_Real* varubdualvals_solver;
+      int nlpidx;
+
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &primalvals_solver, nlp->nvars_solver) );
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &varlbdualvals_solver, nlp->nvars_solver) );
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &varubdualvals_solver, nlp->nvars_solver) );
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &nlrowdualvals_solver, nlp->nnlrows_solver) );
+      BMSclearMemoryArray(nlrowdualvals_solver, nlp->nnlrows_solver);
+
+      for( i = 0; i < nlp->nvars_solver; ++i )
+      {
+         nlpidx = nlp->varmap_nlpi2nlp[i];
+         assert(nlpidx >= 0);
+         assert(nlpidx < nlp->nvars);
+
+         primalvals_solver[i] = SCIPvarGetNLPSol(nlp->vars[nlpidx]);
+         varlbdualvals_solver[i] = nlp->varlbdualvals[nlpidx];
+         varubdualvals_solver[i] = nlp->varubdualvals[nlpidx];
+      }
+
+      for( i = 0; i < nlp->nnlrows; ++i )
+      {
+         assert(nlp->nlrows[i]->nlpiindex >= 0); /* NLP was flushed before solve, so all nlrows should be in there */
+         assert(nlp->nlrows[i]->nlpiindex < nlp->nnlrows_solver);
+
+         nlrowdualvals_solver[nlp->nlrows[i]->nlpiindex] = nlp->nlrows[i]->dualsol;
+      }
+
+      SCIP_CALL( SCIPnlpiSetInitialGuess(nlp->solver, nlp->problem, primalvals_solver, nlrowdualvals_solver,
+            varlbdualvals_solver, varubdualvals_solver) );
+
+      SCIPsetFreeBufferArray(set, &nlrowdualvals_solver);
+      SCIPsetFreeBufferArray(set, &varubdualvals_solver);
+      SCIPsetFreeBufferArray(set, &varlbdualvals_solver);
+      SCIPsetFreeBufferArray(set, &primalvals_solver);
+   }
 
    /* set NLP tolerances to current SCIP primal and dual feasibility tolerance */
    SCIP_CALL( SCIPnlpiSetRealPar(nlp->solver, nlp->problem, SCIP_NLPPAR_FEASTOL, SCIPsetFeastol(set)) );
@@ -4748,12 +4794,29 @@ SCIP_RETCODE nlpSolve(
 
    /* let NLP solver do his work */
    SCIPclockStart(stat->nlpsoltime, set);
+   if( nlp->indiving )
+      SCIPclockStart(stat->divingnlpsoltime, set);
 
    SCIP_CALL( SCIPnlpiSolve(nlp->solver, nlp->problem) );
 
+   if( nlp->indiving )
+      SCIPclockStop(stat->divingnlpsoltime, set);
    SCIPclockStop(stat->nlpsoltime, set);
    ++stat->nnlps;
 
+   /* update iteration statistics */
+   SCIP_CALL( SCIPnlpStatisticsCreate(blkmem, &nlpstatistics) );
+   SCIP_CALL( SCIPnlpiGetStatistics(nlp->solver, nlp->problem, nlpstatistics) );
+   if( SCIPnlpStatisticsGetNIterations(nlpstatistics) > 0 )
+      stat->nnlpiterations += SCIPnlpStatisticsGetNIterations(nlpstatistics);
+   if( nlp->indiving )
+   {
+      ++stat->ndivingnlps;
+      if( SCIPnlpStatisticsGetNIterations(nlpstatistics) > 0 )
+         stat->ndivingnlpiterations += SCIPnlpStatisticsGetNIterations(nlpstatistics);
+   }
+   SCIPnlpStatisticsFree(blkmem, &nlpstatistics);
+
    nlp->termstat = SCIPnlpiGetTermstat(nlp->solver, nlp->problem);
    nlp->solstat  = SCIPnlpiGetSolstat(nlp->solver, nlp->problem);
    switch( nlp->solstat )
@@ -38,6 +38,7 @@
 #include "scip/disp.h"
 #include "scip/struct_event.h"
 #include "scip/pub_message.h"
+#include "scip/pub_misc.h"
 #include "scip/pub_var.h"
 #include "scip/scip_solvingstats.h"
 
@@ -130,6 +131,7 @@ SCIP_RETCODE SCIPprimalCreate(
    (*primal)->existingsols = NULL;
    (*primal)->currentsol = NULL;
    (*primal)->primalray = NULL;
+   (*primal)->solsink = NULL;
    (*primal)->solssize = 0;
    (*primal)->partialsolssize = 0;
    (*primal)->nsols = 0;
@@ -182,6 +184,10 @@ SCIP_RETCODE SCIPprimalFree(
    }
    assert((*primal)->nexistingsols == 0);
 
+   /* close file of solution sink */
+   if( (*primal)->solsink != NULL )
+      fclose((*primal)->solsink);
+
    BMSfreeMemoryArrayNull(&(*primal)->sols);
    BMSfreeMemoryArrayNull(&(*primal)->partialsols);
    BMSfreeMemoryArrayNull(&(*primal)->existingsols);
@@ -219,6 +225,13 @@ SCIP_RETCODE SCIPprimalClear(
       SCIP_CALL( SCIPsolFree(&(*primal)->sols[s], blkmem, *primal) );
    }
 
+   /* close file of solution sink */
+   if( (*primal)->solsink != NULL )
+   {
+      fclose((*primal)->solsink);
+      (*primal)->solsink = NULL;
+   }
+
    (*primal)->currentsol = NULL;
    (*primal)->primalray = NULL;
    (*primal)->nsols = 0;
@@ -260,6 +273,33 @@ void sortPrimalSols(
    return;
 }
 
+/** restores the compression of the stored solutions after the order of the solutions changed, i.e., expands the
+ *  incumbent if it was compressed and compresses all other solutions
+ */
+static
+SCIP_RETCODE primalUpdateCompressedSols(
+   SCIP_PRIMAL*          primal,             /**< primal data */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   int i;
+
+   assert(primal != NULL);
+
+   if( !set->misc_compresssols || primal->nsols == 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPsolDecompress(primal->sols[0], blkmem, set) );
+
+   for( i = 1; i < primal->nsols; ++i )
+   {
+      SCIP_CALL( SCIPsolCompress(primal->sols[i], blkmem, set) );
+   }
+
+   return SCIP_OKAY;
+}
+
 /** sets the cutoff bound in primal data and in LP solver */
 static
 SCIP_RETCODE primalSetCutoffbound(
@@ -503,6 +543,7 @@ SCIP_RETCODE SCIPprimalUpdateObjoffset(
 
    /* resort current primal solutions */
    sortPrimalSols(primal, set, origprob, transprob);
+   SCIP_CALL( primalUpdateCompressedSols(primal, blkmem, set) );
 
    /* compare objective limit to currently best solution */
    if( primal->nsols > 0 )
@@ -616,6 +657,60 @@ SCIP_RETCODE SCIPprimalUpdateRay(
    return SCIP_OKAY;
 }
 
+/** appends a new incumbent solution to the solution sink file given by parameter misc/solsinkfile */
+static
+SCIP_RETCODE primalWriteSolSink(
+   SCIP_PRIMAL*          primal,             /**< primal data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
+   SCIP_STAT*            stat,               /**< problem statistics data */
+   SCIP_PROB*            origprob,           /**< original problem */
+   SCIP_PROB*            transprob,          /**< transformed problem after presolve */
+   SCIP_SOL*             sol,                /**< new incumbent solution */
+   SCIP_Real             obj                 /**< internal objective value of the solution */
+   )
+{
+   SCIP_Bool oldquiet;
+
+   assert(primal != NULL);
+   assert(set != NULL);
+   assert(sol != NULL);
+
+   if( set->misc_solsinkfile[0] == '-' && set->misc_solsinkfile[1] == '\0' )
+      return SCIP_OKAY;
+
+   /* open the file lazily such that nothing is created if no solution is found */
+   if( primal->solsink == NULL )
+   {
+      primal->solsink = fopen(set->misc_solsinkfile, "a");
+      if( primal->solsink == NULL )
+      {
+         SCIPerrorMessage("cannot open solution sink file <%s> for writing\n", set->misc_solsinkfile);
+         SCIPprintSysError(set->misc_solsinkfile);
+         return SCIP_FILECREATEERROR;
+      }
+   }
+
+   oldquiet = messagehdlr != NULL && SCIPmessagehdlrIsQuiet(messagehdlr);
+   if( messagehdlr != NULL )
+      SCIPmessagehdlrSetQuiet(messagehdlr, FALSE);
+
+   SCIPmessageFPrintInfo(messagehdlr, primal->solsink, "# solution %" SCIP_LONGINT_FORMAT " found after %.2f seconds\n",
+      primal->nbestsolsfound, SCIPsolGetTime(sol));
+   SCIPmessageFPrintInfo(messagehdlr, primal->solsink, "objective value:                 %20.15g\n",
+      SCIPprobExternObjval(transprob, origprob, set, obj));
+   SCIP_CALL( SCIPsolPrint(sol, set, messagehdlr, stat, origprob, transprob, primal->solsink, FALSE, FALSE) );
+   SCIPmessageFPrintInfo(messagehdlr, primal->solsink, "\n");
+
+   if( messagehdlr != NULL )
+      SCIPmessagehdlrSetQuiet(messagehdlr, oldquiet);
+
+   /* flush such that the solution survives an abort of the solving process */
+   (void) fflush(primal->solsink);
+
+   return SCIP_OKAY;
+}
+
 /** adds primal solution to solution storage at given position */
 static
 SCIP_RETCODE primalAddSol(
@@ -703,7 +798,7 @@ SCIP_RETCODE primalAddSol(
 #endif
 
    /* completely fill the solution's own value array to unlink it from the LP or pseudo solution */
-   SCIP_CALL( SCIPsolUnlink(sol, set, transprob) );
+   SCIP_CALL( SCIPsolUnlink(sol, blkmem, set, transprob) );
 
    /* allocate memory for solution storage */
    SCIP_CALL( ensureSolsSize(primal, set, set->limit_maxsol) );
@@ -791,6 +886,9 @@ SCIP_RETCODE primalAddSol(
       SCIP_CALL( SCIPeventChgType(&event, SCIP_EVENTTYPE_BESTSOLFOUND) );
       primal->nbestsolsfound++;
       stat->bestsolnode = stat->nnodes;
+
+      /* stream the new incumbent to the solution sink */
+      SCIP_CALL( primalWriteSolSink(primal, set, messagehdlr, stat, origprob, transprob, sol, obj) );
    }
    else
    {
@@ -818,6 +916,25 @@ SCIP_RETCODE primalAddSol(
          (void*)sol);
    }  /*lint !e438*/
 
+   /* only the incumbent is kept in dense format, which is accessed most often; a new incumbent may be the copy of a
+    * compressed solution
+    */
+   if( insertpos == 0 )
+   {
+      SCIP_CALL( SCIPsolDecompress(sol, blkmem, set) );
+   }
+   if( set->misc_compresssols )
+   {
+      if( insertpos > 0 )
+      {
+         SCIP_CALL( SCIPsolCompress(sol, blkmem, set) );
+      }
+      else if( primal->nsols > 1 )
+      {
+         SCIP_CALL( SCIPsolCompress(primal->sols[1], blkmem, set) );
+      }
+   }
+
    return SCIP_OKAY;
 }
 
@@ -867,6 +984,25 @@ SCIP_RETCODE primalAddOrigSol(
    if( SCIPsetIsFeasLE(set, SCIPsolGetOrigObj(sol), SCIPprobGetObjlim(prob, set)) )
       primal->nlimsolsfound++;
 
+   /* only the incumbent is kept in dense format, which is accessed most often; a new incumbent may be the copy of a
+    * compressed solution
+    */
+   if( insertpos == 0 )
+   {
+      SCIP_CALL( SCIPsolDecompress(sol, blkmem, set) );
+   }
+   if( set->misc_compresssols )
+   {
+      if( insertpos > 0 )
+      {
+         SCIP_CALL( SCIPsolCompress(sol, blkmem, set) );
+      }
+      else if( primal->nsols > 1 )
+      {
+         SCIP_CALL( SCIPsolCompress(primal->sols[1], blkmem, set) );
+      }
+   }
+
    SCIPsetDebugMsg(set, " -> stored at position %d of %d solutions, found %" SCIP_LONGINT_FORMAT " solutions\n",
       insertpos, primal->nsols, primal->nsolsfound);
 
@@ -1438,7 +1574,7 @@ SCIP_RETCODE primalLinkCurrentSol(
    }
    else
    {
-      SCIP_CALL( SCIPsolLinkCurrentSol(primal->currentsol, set, stat, prob, tree, lp) );
+      SCIP_CALL( SCIPsolLinkCurrentSol(primal->currentsol, blkmem, set, stat, prob, tree, lp) );
       SCIPsolSetHeur(primal->currentsol, heur);
    }
 
@@ -1753,11 +1889,12 @@ SCIP_RETCODE SCIPprimalRetransformSolutions(
    {
       if( SCIPsolGetOrigin(primal->sols[i]) == SCIP_SOLORIGIN_ZERO )
       {
-         SCIP_CALL( SCIPsolRetransform(primal->sols[i], set, stat, origprob, transprob, &hasinfval) );
+         SCIP_CALL( SCIPsolRetransform(primal->sols[i], blkmem, set, stat, origprob, transprob, &hasinfval) );
       }
    }
 
    sortPrimalSols(primal, set, origprob, transprob);
+   SCIP_CALL( primalUpdateCompressedSols(primal, blkmem, set) );
 
    /* check if the global upper bound has to be updated
     * @todo we do not inform anybody about this change; if this leads to some
@@ -1930,7 +2067,7 @@ SCIP_RETCODE SCIPprimalTransformSol(
       {
          if( localsolvalset[v] )
          {
-            SCIP_CALL( SCIPsolSetVal(transsol, set, stat, tree, transvars[v], localsolvals[v]) );
+            SCIP_CALL( SCIPsolSetVal(transsol, blkmem, set, stat, tree, transvars[v], localsolvals[v]) );
          }
       }
 
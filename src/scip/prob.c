@@ -295,6 +295,7 @@ SCIP_RETCODE SCIPprobCreate(
    (*prob)->nimplvars = 0;
    (*prob)->ncontvars = 0;
    (*prob)->ncolvars = 0;
+   (*prob)->nvarindexchgs = 0;
    (*prob)->fixedvars = NULL;
    (*prob)->fixedvarssize = 0;
    (*prob)->nfixedvars = 0;
@@ -691,6 +692,7 @@ void SCIPprobResortVars(
       vars[v]->probindex = v;
       SCIPdebugMessage("Variable: Problem index <%d>, original index <%d> \n", vars[v]->probindex, vars[v]->index);
    }
+   ++prob->nvarindexchgs;
 }
 
 
@@ -791,6 +793,7 @@ void probInsertVar(
 
    prob->vars[insertpos] = var;
    SCIPvarSetProbindex(var, insertpos);
+   ++prob->nvarindexchgs;
 
    /* update number of column variables in problem */
    if( SCIPvarGetStatus(var) == SCIP_VARSTATUS_COLUMN )
@@ -880,6 +883,7 @@ SCIP_RETCODE probRemoveVar(
    assert(freepos == prob->nvars-1);
 
    prob->nvars--;
+   ++prob->nvarindexchgs;
    assert(prob->nvars == prob->nbinvars + prob->nintvars + prob->nimplvars + prob->ncontvars);
 
    /* update number of column variables in problem */
@@ -2244,6 +2248,7 @@ void SCIPprobPrintStatistics(
 #undef SCIPprobGetData
 #undef SCIPprobGetName
 #undef SCIPprobGetNVars
+#undef SCIPprobGetNVarIndexChgs
 #undef SCIPprobGetNBinVars
 #undef SCIPprobGetNIntVars
 #undef SCIPprobGetNImplVars
@@ -2348,6 +2353,17 @@ int SCIPprobGetNVars(
    return prob->nvars;
 }
 
+/** gets number of changes of the variable array that may have moved variables to other problem indices; as long as
+ *  this number and the number of variables stay the same, the problem indices of all variables are unchanged
+ */
+SCIP_Longint SCIPprobGetNVarIndexChgs(
+   SCIP_PROB*            prob                /**< problem data */
+   )
+{
+   assert(prob != NULL);
+   return prob->nvarindexchgs;
+}
+
 /** gets number of binary problem variables */
 int SCIPprobGetNBinVars(
    SCIP_PROB*            prob                /**< problem data */
@@ -565,6 +565,11 @@ int SCIPprobGetNVars(
    SCIP_PROB*            prob                /**< problem data */
    );
 
+/** gets number of changes of the variable array that may have moved variables to other problem indices */
+SCIP_Longint SCIPprobGetNVarIndexChgs(
+   SCIP_PROB*            prob                /**< problem data */
+   );
+
 /** gets number of binary problem variables */
 int SCIPprobGetNBinVars(
    SCIP_PROB*            prob                /**< problem data */
@@ -632,6 +637,7 @@ void SCIPprobEnableConsCompression(
 #define SCIPprobGetName(prob)           ((prob)->name)
 #define SCIPprobGetName(prob)           ((prob)->name)
 #define SCIPprobGetNVars(prob)          ((prob)->nvars)
+#define SCIPprobGetNVarIndexChgs(prob)  ((prob)->nvarindexchgs)
 #define SCIPprobGetNBinVars(prob)       ((prob)->nbinvars)
 #define SCIPprobGetNIntVars(prob)       ((prob)->nintvars)
 #define SCIPprobGetNImplVars(prob)      ((prob)->nimplvars)
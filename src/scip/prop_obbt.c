@@ -36,6 +36,7 @@
 /*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
 
 #include "blockmemshell/memory.h"
+#include "lpi/lpi.h"
 #include "nlpi/pub_expr.h"
 #include "scip/cons_abspower.h"
 #include "scip/cons_bivariate.h"
@@ -68,8 +69,10 @@
 #include "scip/scip_prop.h"
 #include "scip/scip_randnumgen.h"
 #include "scip/scip_solvingstats.h"
+#include "scip/scip_timing.h"
 #include "scip/scip_tree.h"
 #include "scip/scip_var.h"
+#include "tpi/tpi.h"
 #include <string.h>
 
 #define PROP_NAME                       "obbt"
@@ -119,6 +122,8 @@
 #define DEFAULT_ITLIMITFAC_BILININEQS    3.0 /**< multiple of OBBT LP limit used as total LP iteration limit for solving bilinear inequality LPs (< 0 for no limit) */
 #define DEFAULT_MINNONCONVEXITY         1e-1 /**< minimum nonconvexity for choosing a bilinear term */
 #define DEFAULT_RANDSEED                 149 /**< initial random seed */
+#define DEFAULT_NTHREADS                   1 /**< number of threads to solve OBBT LPs in parallel (1: solve OBBT LPs
+                                              *   sequentially) */
 
 
 /** translate from one value of infinity to another
@@ -171,6 +176,21 @@ struct BilinBound
 };
 typedef struct BilinBound BILINBOUND;
 
+/** data of a worker that solves OBBT LPs on its own copy of the probing LP */
+struct ObbtWorker
+{
+   SCIP_LPI*             lpi;                /**< copy of the probing LP */
+   SCIP_Real*            primsol;            /**< primal solution of the last OBBT LP */
+   BOUND*                bound;              /**< bound whose OBBT LP is solved */
+   SCIP_Real             objcoef;            /**< objective coefficient of the column of the bound's variable */
+   int                   col;                /**< position of the bound's variable in the LP */
+   int                   itlimit;            /**< iteration limit for the OBBT LP */
+   int                   niterations;        /**< number of iterations used for the OBBT LP */
+   SCIP_Bool             optimal;            /**< was the OBBT LP solved to optimality? */
+   SCIP_Bool             error;              /**< did an error occur while solving the OBBT LP? */
+};
+typedef struct ObbtWorker OBBTWORKER;
+
 /** propagator data */
 struct SCIP_PropData
 {
@@ -222,6 +242,8 @@ struct SCIP_PropData
    int                   propagatefreq;      /**< trigger a propagation round after that many bound tightenings
                                               *   (0: no propagation) */
    int                   propagatecounter;   /**< number of bound tightenings since the last propagation round */
+   int                   nthreads;           /**< number of threads to solve OBBT LPs in parallel (1: solve OBBT LPs
+                                              *   sequentially) */
 };
 
 
@@ -828,6 +850,84 @@ void getCorners(
    }
 }
 
+/** checks whether a bound is attained by a solution value, such that its OBBT LP does not need to be solved */
+static
+SCIP_Bool boundIsTight(
+   SCIP*                 scip,               /**< SCIP data structure */
+   BOUND*                bound,              /**< bound to check */
+   SCIP_Real             solval              /**< value of the bound's variable in the solution */
+   )
+{
+   SCIP_Real boundval;                       /* current local bound for the variable */
+
+   assert(scip != NULL);
+   assert(bound != NULL);
+
+   boundval = bound->boundtype == SCIP_BOUNDTYPE_UPPER ?
+      SCIPvarGetUbLocal(bound->var) : SCIPvarGetLbLocal(bound->var);
+
+   /* bound is tight; since this holds for all fixed variables, those are filtered here automatically; if the lp solution
+    * is infinity, then also the bound is tight */
+   return (bound->boundtype == SCIP_BOUNDTYPE_UPPER &&
+         (SCIPisInfinity(scip, solval) || SCIPisFeasGE(scip, solval, boundval)))
+      || (bound->boundtype == SCIP_BOUNDTYPE_LOWER &&
+         (SCIPisInfinity(scip, -solval) || SCIPisFeasLE(scip, solval, boundval)));
+}
+
+/** filters the corners of a bilinear term that are attained by a solution */
+static
+void filterBilinBound(
+   SCIP*                 scip,               /**< SCIP data structure */
+   BILINBOUND*           bilinbound,         /**< bilinear bound */
+   SCIP_Real             solx,               /**< value of the first variable in the solution */
+   SCIP_Real             soly                /**< value of the second variable in the solution */
+   )
+{
+   CORNER corners[4] = {LEFTTOP, LEFTBOTTOM, RIGHTTOP, RIGHTBOTTOM};
+   SCIPdebug(int oldfiltered;)
+   int j;
+
+   assert(scip != NULL);
+   assert(bilinbound != NULL);
+
+   SCIPdebug(oldfiltered = bilinbound->filtered;)
+
+   /* check cases of unbounded solution values */
+   if( SCIPisInfinity(scip, solx) )
+      bilinbound->filtered = bilinbound->filtered | RIGHTTOP | RIGHTBOTTOM; /*lint !e641*/
+   else if( SCIPisInfinity(scip, -solx) )
+      bilinbound->filtered = bilinbound->filtered | LEFTTOP | LEFTBOTTOM; /*lint !e641*/
+
+   if( SCIPisInfinity(scip, soly) )
+      bilinbound->filtered = bilinbound->filtered | RIGHTTOP | LEFTTOP; /*lint !e641*/
+   else if( SCIPisInfinity(scip, -soly) )
+      bilinbound->filtered = bilinbound->filtered | RIGHTBOTTOM | LEFTBOTTOM; /*lint !e641*/
+
+   /* check all corners */
+   for( j = 0; j < 4; ++j )
+   {
+      SCIP_Real xt = SCIP_INVALID;
+      SCIP_Real yt = SCIP_INVALID;
+
+      getCorner(bilinbound->x, bilinbound->y, corners[j], &xt, &yt);
+
+      if( (SCIPisInfinity(scip, REALABS(solx)) || SCIPisFeasEQ(scip, xt, solx))
+         && (SCIPisInfinity(scip, REALABS(soly)) || SCIPisFeasEQ(scip, yt, soly)) )
+         bilinbound->filtered = bilinbound->filtered | corners[j]; /*lint !e641*/
+   }
+
+#ifdef SCIP_DEBUG
+   if( oldfiltered != bilinbound->filtered )
+   {
+      SCIP_VAR* x = bilinbound->x;
+      SCIP_VAR* y = bilinbound->y;
+      SCIPdebugMessage("filtered corners %d for (%s,%s) = (%g,%g) in [%g,%g]x[%g,%g]\n",
+         bilinbound->filtered - oldfiltered, SCIPvarGetName(x), SCIPvarGetName(y), solx, soly,
+         SCIPvarGetLbGlobal(x), SCIPvarGetUbGlobal(x), SCIPvarGetLbGlobal(y), SCIPvarGetUbGlobal(y));
+   }
+#endif
+}
+
 /** trying to filter some bounds using the existing LP solution */
 static
 SCIP_RETCODE filterExistingLP(
@@ -858,28 +958,20 @@ SCIP_RETCODE filterExistingLP(
       BOUND* bound;                          /* shortcut for current bound */
 
       SCIP_Real solval;                      /* the variables value in the current solution */
-      SCIP_Real boundval;                    /* current local bound for the variable */
 
       bound = propdata->bounds[i];
       if( bound->filtered || bound->done )
          continue;
 
-      boundval = bound->boundtype == SCIP_BOUNDTYPE_UPPER ?
-         SCIPvarGetUbLocal(bound->var) : SCIPvarGetLbLocal(bound->var);
       solval = SCIPvarGetLPSol(bound->var);
 
-      /* bound is tight; since this holds for all fixed variables, those are filtered here automatically; if the lp solution
-       * is infinity, then also the bound is tight */
-      if( (bound->boundtype == SCIP_BOUNDTYPE_UPPER &&
-               (SCIPisInfinity(scip, solval) || SCIPisFeasGE(scip, solval, boundval)))
-            || (bound->boundtype == SCIP_BOUNDTYPE_LOWER &&
-               (SCIPisInfinity(scip, -solval) || SCIPisFeasLE(scip, solval, boundval))) )
+      if( boundIsTight(scip, bound, solval) )
       {
          SCIP_BASESTAT basestat;
 
          /* mark bound as filtered */
          bound->filtered = TRUE;
-         SCIPdebugMsg(scip, "trivial filtered var: %s boundval=%e solval=%e\n", SCIPvarGetName(bound->var), boundval, solval);
+         SCIPdebugMsg(scip, "trivial filtered var: %s solval=%e\n", SCIPvarGetName(bound->var), solval);
 
          /* get the basis status of the variable */
          basestat = SCIPcolGetBasisStatus(SCIPvarGetCol(bound->var));
@@ -940,55 +1032,13 @@ SCIP_RETCODE filterExistingLP(
    /* try to filter bilinear bounds */
    for( i = propdata->lastbilinidx; i < propdata->nbilinbounds; ++i )
    {
-      CORNER corners[4] = {LEFTTOP, LEFTBOTTOM, RIGHTTOP, RIGHTBOTTOM};
       BILINBOUND* bilinbound = propdata->bilinbounds[i];
-      SCIP_Real solx;
-      SCIP_Real soly;
-      SCIPdebug(int oldfiltered;)
-      int j;
 
       /* skip processed and filtered bounds */
       if( bilinbound->done || bilinbound->filtered == FILTERED ) /*lint !e641*/
          continue;
 
-      SCIPdebug(oldfiltered = bilinbound->filtered;)
-      solx = SCIPvarGetLPSol(bilinbound->x);
-      soly = SCIPvarGetLPSol(bilinbound->y);
-
-      /* check cases of unbounded solution values */
-      if( SCIPisInfinity(scip, solx) )
-         bilinbound->filtered = bilinbound->filtered | RIGHTTOP | RIGHTBOTTOM; /*lint !e641*/
-      else if( SCIPisInfinity(scip, -solx) )
-         bilinbound->filtered = bilinbound->filtered | LEFTTOP | LEFTBOTTOM; /*lint !e641*/
-
-      if( SCIPisInfinity(scip, soly) )
-         bilinbound->filtered = bilinbound->filtered | RIGHTTOP | LEFTTOP; /*lint !e641*/
-      else if( SCIPisInfinity(scip, -soly) )
-         bilinbound->filtered = bilinbound->filtered | RIGHTBOTTOM | LEFTBOTTOM; /*lint !e641*/
-
-      /* check all corners */
-      for( j = 0; j < 4; ++j )
-      {
-         SCIP_Real xt = SCIP_INVALID;
-         SCIP_Real yt = SCIP_INVALID;
-
-         getCorner(bilinbound->x, bilinbound->y, corners[j], &xt, &yt);
-
-         if( (SCIPisInfinity(scip, REALABS(solx)) || SCIPisFeasEQ(scip, xt, solx))
-            && (SCIPisInfinity(scip, REALABS(soly)) || SCIPisFeasEQ(scip, yt, soly)) )
-            bilinbound->filtered = bilinbound->filtered | corners[j]; /*lint !e641*/
-      }
-
-#ifdef SCIP_DEBUG
-      if( oldfiltered != bilinbound->filtered )
-      {
-         SCIP_VAR* x = bilinbound->x;
-         SCIP_VAR* y = bilinbound->y;
-         SCIPdebugMessage("filtered corners %d for (%s,%s) = (%g,%g) in [%g,%g]x[%g,%g]\n",
-            bilinbound->filtered - oldfiltered, SCIPvarGetName(x), SCIPvarGetName(y), solx, soly,
-            SCIPvarGetLbGlobal(x), SCIPvarGetUbGlobal(x), SCIPvarGetLbGlobal(y), SCIPvarGetUbGlobal(y));
-      }
-#endif
+      filterBilinBound(scip, bilinbound, SCIPvarGetLPSol(bilinbound->x), SCIPvarGetLPSol(bilinbound->y));
    }
 
    return SCIP_OKAY;
@@ -1853,6 +1903,477 @@ SCIP_RETCODE findNewBounds(
 }
 
 
+/** creates a copy of the current probing LP with zero objective function for a worker */
+static
+SCIP_RETCODE createWorkerLPI(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_LPI**            lpi                 /**< pointer to store the LP interface of the copy */
+   )
+{
+   SCIP_COL** cols;
+   SCIP_ROW** rows;
+   SCIP_Real* obj;
+   SCIP_Real* lbs;
+   SCIP_Real* ubs;
+   SCIP_Real* lhss;
+   SCIP_Real* rhss;
+   SCIP_Real* vals;
+   int* beg;
+   int* inds;
+   int ncols;
+   int nrows;
+   int nnonz;
+   int i;
+   int j;
+
+   assert(scip != NULL);
+   assert(lpi != NULL);
+
+   SCIP_CALL( SCIPgetLPColsData(scip, &cols, &ncols) );
+   SCIP_CALL( SCIPgetLPRowsData(scip, &rows, &nrows) );
+
+   /* the copy is solved in a worker thread, so it must not print to the message handler of SCIP */
+   SCIP_CALL( SCIPlpiCreate(lpi, NULL, "obbt", SCIP_OBJSEN_MINIMIZE) );
+
+   /* add the columns with their local bounds */
+   SCIP_CALL( SCIPallocBufferArray(scip, &obj, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lbs, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &ubs, ncols) );
+
+   for( i = 0; i < ncols; ++i )
+   {
+      assert(SCIPcolGetLPPos(cols[i]) == i);
+
+      obj[i] = 0.0;
+      lbs[i] = SCIPisInfinity(scip, -SCIPcolGetLb(cols[i])) ? -SCIPlpiInfinity(*lpi) : SCIPcolGetLb(cols[i]);
+      ubs[i] = SCIPisInfinity(scip, SCIPcolGetUb(cols[i])) ? SCIPlpiInfinity(*lpi) : SCIPcolGetUb(cols[i]);
+   }
+
+   SCIP_CALL( SCIPlpiAddCols(*lpi, ncols, obj, lbs, ubs, NULL, 0, NULL, NULL, NULL) );
+
+   SCIPfreeBufferArray(scip, &ubs);
+   SCIPfreeBufferArray(scip, &lbs);
+   SCIPfreeBufferArray(scip, &obj);
+
+   if( nrows == 0 )
+      return SCIP_OKAY;
+
+   /* add the rows, including the objective cutoff row */
+   nnonz = 0;
+   for( i = 0; i < nrows; ++i )
+      nnonz += SCIProwGetNNonz(rows[i]);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &lhss, nrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &rhss, nrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &beg, nrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &inds, nnonz) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &vals, nnonz) );
+
+   nnonz = 0;
+   for( i = 0; i < nrows; ++i )
+   {
+      SCIP_COL** rowcols;
+      SCIP_Real* rowvals;
+
+      rowcols = SCIProwGetCols(rows[i]);
+      rowvals = SCIProwGetVals(rows[i]);
+      beg[i] = nnonz;
+
+      for( j = 0; j < SCIProwGetNNonz(rows[i]); ++j )
+      {
+         if( SCIPcolGetLPPos(rowcols[j]) >= 0 )
+         {
+            inds[nnonz] = SCIPcolGetLPPos(rowcols[j]);
+            vals[nnonz] = rowvals[j];
+            ++nnonz;
+         }
+      }
+
+      lhss[i] = SCIPisInfinity(scip, -SCIProwGetLhs(rows[i])) ? -SCIPlpiInfinity(*lpi)
+         : SCIProwGetLhs(rows[i]) - SCIProwGetConstant(rows[i]);
+      rhss[i] = SCIPisInfinity(scip, SCIProwGetRhs(rows[i])) ? SCIPlpiInfinity(*lpi)
+         : SCIProwGetRhs(rows[i]) - SCIProwGetConstant(rows[i]);
+   }
+
+   SCIP_CALL( SCIPlpiAddRows(*lpi, nrows, lhss, rhss, NULL, nnonz, beg, inds, vals) );
+
+   SCIPfreeBufferArray(scip, &vals);
+   SCIPfreeBufferArray(scip, &inds);
+   SCIPfreeBufferArray(scip, &beg);
+   SCIPfreeBufferArray(scip, &rhss);
+   SCIPfreeBufferArray(scip, &lhss);
+
+   return SCIP_OKAY;
+}
+
+/** sets the tolerances and limits of a worker LP to the ones used for the probing LP */
+static
+SCIP_RETCODE setWorkerLPIParams(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< data of the obbt propagator */
+   SCIP_LPI*             lpi                 /**< LP interface of the worker */
+   )
+{
+   SCIP_RETCODE retcode;
+
+   assert(scip != NULL);
+   assert(propdata != NULL);
+   assert(lpi != NULL);
+
+   SCIP_CALL( SCIPlpiSetRealpar(lpi, SCIP_LPPAR_FEASTOL, SCIPgetLPFeastol(scip)) );
+   SCIP_CALL( SCIPlpiSetRealpar(lpi, SCIP_LPPAR_DUALFEASTOL, SCIPdualfeastol(scip)) );
+   SCIP_CALL( SCIPlpiSetIntpar(lpi, SCIP_LPPAR_FROMSCRATCH, FALSE) );
+   SCIP_CALL( SCIPlpiSetIntpar(lpi, SCIP_LPPAR_LPINFO, FALSE) );
+
+   /* the following parameters are not supported by all LP solvers */
+   retcode = SCIPlpiSetIntpar(lpi, SCIP_LPPAR_THREADS, 1);
+   if( retcode != SCIP_OKAY && retcode != SCIP_PARAMETERUNKNOWN )
+      return retcode;
+
+   if( propdata->conditionlimit > 0.0 )
+   {
+      retcode = SCIPlpiSetRealpar(lpi, SCIP_LPPAR_CONDITIONLIMIT, propdata->conditionlimit);
+      if( retcode != SCIP_OKAY && retcode != SCIP_PARAMETERUNKNOWN )
+         return retcode;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** solves the OBBT LP of the bound that is assigned to a worker; used as job to solve OBBT LPs in parallel
+ *
+ *  The job only works on the LP of the worker and does not call any method of SCIP.
+ */
+static
+SCIP_RETCODE solveWorkerLP(
+   void*                 args                /**< worker data */
+   )
+{
+   OBBTWORKER* worker;
+   SCIP_RETCODE retcode;
+   SCIP_Real zero;
+
+   worker = (OBBTWORKER*)args;
+   assert(worker != NULL);
+   assert(worker->lpi != NULL);
+   assert(worker->col >= 0);
+
+   worker->optimal = FALSE;
+   worker->error = FALSE;
+   worker->niterations = 0;
+   zero = 0.0;
+
+   SCIP_CALL( SCIPlpiChgObj(worker->lpi, 1, &worker->col, &worker->objcoef) );
+   SCIP_CALL( SCIPlpiSetIntpar(worker->lpi, SCIP_LPPAR_LPITLIM, worker->itlimit) );
+
+   /* only the objective changes between two OBBT LPs, so the basis of the last OBBT LP stays primal feasible */
+   retcode = SCIPlpiSolvePrimal(worker->lpi);
+
+   /* an error should not kill the overall solving process */
+   if( retcode == SCIP_OKAY && SCIPlpiIsOptimal(worker->lpi) )
+   {
+      retcode = SCIPlpiGetSol(worker->lpi, NULL, worker->primsol, NULL, NULL, NULL);
+      worker->optimal = (retcode == SCIP_OKAY);
+   }
+   worker->error = (retcode != SCIP_OKAY);
+
+   SCIP_CALL( SCIPlpiGetIterations(worker->lpi, &worker->niterations) );
+
+   /* reset the objective */
+   SCIP_CALL( SCIPlpiChgObj(worker->lpi, 1, &worker->col, &zero) );
+
+   return SCIP_OKAY;
+}
+
+/** gets the value of a variable in the solution of a worker LP; returns FALSE if the variable is not a column of the
+ *  LP
+ */
+static
+SCIP_Bool getWorkerSolVal(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_LPI*             lpi,                /**< LP interface of the worker */
+   SCIP_Real*            primsol,            /**< primal solution of the worker LP */
+   SCIP_VAR*             var,                /**< variable */
+   SCIP_Real*            solval              /**< pointer to store the value of the variable */
+   )
+{
+   int pos;
+
+   assert(primsol != NULL);
+   assert(solval != NULL);
+
+   if( SCIPvarGetStatus(var) != SCIP_VARSTATUS_COLUMN || SCIPcolGetLPPos(SCIPvarGetCol(var)) < 0 )
+      return FALSE;
+
+   pos = SCIPcolGetLPPos(SCIPvarGetCol(var));
+
+   if( primsol[pos] >= 0.0 )
+      *solval = infty2infty(SCIPlpiInfinity(lpi), SCIPinfinity(scip), primsol[pos]);
+   else
+      *solval = -infty2infty(SCIPlpiInfinity(lpi), SCIPinfinity(scip), -primsol[pos]);
+
+   return TRUE;
+}
+
+/** filters bounds and corners of bilinear terms with the solution of an OBBT LP that was solved by a worker */
+static
+void filterWorkerSol(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< data of the obbt propagator */
+   OBBTWORKER*           worker,             /**< worker that solved the OBBT LP */
+   int*                  nfiltered           /**< pointer to store how many bounds were filtered */
+   )
+{
+   int i;
+
+   assert(scip != NULL);
+   assert(propdata != NULL);
+   assert(worker != NULL);
+   assert(worker->optimal);
+   assert(nfiltered != NULL);
+
+   *nfiltered = 0;
+
+   for( i = 0; i < propdata->nbounds; ++i )
+   {
+      BOUND* bound;
+      SCIP_Real solval;
+
+      bound = propdata->bounds[i];
+      if( bound->filtered || bound->done )
+         continue;
+
+      if( getWorkerSolVal(scip, worker->lpi, worker->primsol, bound->var, &solval) && boundIsTight(scip, bound, solval) )
+      {
+         bound->filtered = TRUE;
+         (*nfiltered)++;
+      }
+   }
+
+   for( i = propdata->lastbilinidx; i < propdata->nbilinbounds; ++i )
+   {
+      BILINBOUND* bilinbound = propdata->bilinbounds[i];
+      SCIP_Real solx;
+      SCIP_Real soly;
+
+      /* skip processed and filtered bounds */
+      if( bilinbound->done || bilinbound->filtered == FILTERED ) /*lint !e641*/
+         continue;
+
+      if( getWorkerSolVal(scip, worker->lpi, worker->primsol, bilinbound->x, &solx)
+         && getWorkerSolVal(scip, worker->lpi, worker->primsol, bilinbound->y, &soly) )
+         filterBilinBound(scip, bilinbound, solx, soly);
+   }
+}
+
+/** finds new variable bounds by solving the OBBT LPs of several bounds in parallel
+ *
+ *  Each worker thread solves OBBT LPs on its own copy of the probing LP. The bounds are distributed in rounds: in each
+ *  round, every worker solves the OBBT LP of the next unprocessed bound. Afterwards, the results are evaluated in the
+ *  order of the workers and the solutions of all OBBT LPs are used to filter the remaining bounds and the corners of
+ *  the bilinear terms. Thus, the found bounds do not depend on the scheduling of the threads.
+ *
+ *  In contrast to findNewBounds(), no genvbounds are created, bounds are not tightened in probing mode, and OBBT LP
+ *  solutions are not separated, because all of these need the probing LP of SCIP. Bounds of variables that are not
+ *  columns of the LP are left to findNewBounds().
+ */
+static
+SCIP_RETCODE findNewBoundsParallel(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< data of the obbt propagator */
+   SCIP_Longint*         nleftiterations     /**< pointer to store the number of left iterations */
+   )
+{
+   OBBTWORKER* workers;
+   BOUND** cands;
+   void** jobargs;
+   SCIP_RETCODE retcode;
+   SCIP_Real timelimit;
+   int nworkers;
+   int nallocworkers;
+   int ncands;
+   int nextcand;
+   int ncols;
+   int i;
+   int k;
+
+   assert(scip != NULL);
+   assert(propdata != NULL);
+   assert(nleftiterations != NULL);
+   assert(propdata->nthreads > 1);
+   assert(SCIPinProbing(scip));
+
+   /* collect the unprocessed bounds of LP columns in the order of sortBounds(), nonconvex bounds first */
+   SCIP_CALL( sortBounds(scip, propdata) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &cands, propdata->nbounds) );
+
+   ncands = 0;
+   for( k = 0; k < 2; ++k )
+   {
+      SCIP_Bool convexphase = (k == 1);
+
+      for( i = 0; i < propdata->nbounds; ++i )
+      {
+         BOUND* bound = propdata->bounds[i];
+
+         if( bound->done || bound->filtered || bound->nonconvex != !convexphase )
+            continue;
+
+         if( SCIPvarGetStatus(bound->var) != SCIP_VARSTATUS_COLUMN || SCIPcolGetLPPos(SCIPvarGetCol(bound->var)) < 0 )
+            continue;
+
+         cands[ncands++] = bound;
+      }
+   }
+
+   nworkers = MIN(propdata->nthreads, ncands);
+
+   /* solving a single OBBT LP at a time is left to findNewBounds() */
+   if( nworkers <= 1 )
+   {
+      SCIPfreeBufferArray(scip, &cands);
+      return SCIP_OKAY;
+   }
+
+   SCIPdebugMsg(scip, "solve OBBT LPs of %d bounds with %d threads\n", ncands, nworkers);
+
+   /* create the copies of the probing LP */
+   ncols = SCIPgetNLPCols(scip);
+   SCIP_CALL( SCIPallocBufferArray(scip, &workers, nworkers) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &jobargs, nworkers) );
+
+   retcode = SCIP_OKAY;
+   nallocworkers = 0;
+
+   for( i = 0; i < nworkers; ++i )
+   {
+      SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &workers[i].primsol, ncols), TERMINATE );
+      workers[i].lpi = NULL;
+      workers[i].bound = NULL;
+      jobargs[i] = (void*) &workers[i];
+      ++nallocworkers;
+
+      SCIP_CALL_TERMINATE( retcode, createWorkerLPI(scip, &workers[i].lpi), TERMINATE );
+      SCIP_CALL_TERMINATE( retcode, setWorkerLPIParams(scip, propdata, workers[i].lpi), TERMINATE );
+   }
+
+   nextcand = 0;
+
+   /* main loop */
+   while( (*nleftiterations == -1 || *nleftiterations > 0) && !SCIPisStopped(scip) )
+   {
+      SCIP_JOBBATCH* jobbatch;
+      SCIP_Bool error;
+      int njobs;
+
+      /* assign the next unprocessed and unfiltered bounds to the workers */
+      njobs = 0;
+      while( njobs < nworkers && nextcand < ncands )
+      {
+         BOUND* bound = cands[nextcand++];
+
+         if( bound->done || bound->filtered )
+            continue;
+
+         /* do not visit bound more than once */
+         bound->done = TRUE;
+
+         workers[njobs].bound = bound;
+         workers[njobs].col = SCIPcolGetLPPos(SCIPvarGetCol(bound->var));
+         workers[njobs].objcoef = bound->boundtype == SCIP_BOUNDTYPE_LOWER ? 1.0 : -1.0;
+         ++njobs;
+      }
+
+      if( njobs == 0 )
+      {
+         SCIPdebugMsg(scip, "NO unvisited/unfiltered bound left!\n");
+         break;
+      }
+
+      /* the left iterations are divided among the workers, the time limit is shared */
+      SCIP_CALL_TERMINATE( retcode, SCIPgetRealParam(scip, "limits/time", &timelimit), TERMINATE );
+      if( !SCIPisInfinity(scip, timelimit) )
+         timelimit = MAX(timelimit - SCIPgetSolvingTime(scip), 0.0);
+
+      for( i = 0; i < njobs; ++i )
+      {
+         workers[i].itlimit = (*nleftiterations == -1) ? INT_MAX : (int) MAX(*nleftiterations / njobs, 1);
+
+         if( !SCIPisInfinity(scip, timelimit) )
+         {
+            SCIP_CALL_TERMINATE( retcode, SCIPlpiSetRealpar(workers[i].lpi, SCIP_LPPAR_LPTILIM, timelimit),
+               TERMINATE );
+         }
+      }
+
+      SCIP_CALL_TERMINATE( retcode, SCIPtpiStartJobBatch(&jobbatch, solveWorkerLP, jobargs, njobs, njobs), TERMINATE );
+      retcode = SCIPtpiFinishJobBatch(&jobbatch);
+
+      if( retcode != SCIP_OKAY )
+         break;
+
+      /* evaluate the OBBT LPs in the order of the workers */
+      error = FALSE;
+      for( i = 0; i < njobs; ++i )
+      {
+         OBBTWORKER* worker = &workers[i];
+
+         if( *nleftiterations != -1 )
+            *nleftiterations = MAX(*nleftiterations - worker->niterations, 0);
+
+         if( worker->error )
+         {
+            error = TRUE;
+            continue;
+         }
+
+         if( worker->optimal )
+         {
+            BOUND* bound = worker->bound;
+
+            bound->newval = worker->primsol[worker->col];
+            bound->found = TRUE;
+
+            SCIPdebugMsg(scip, "thread %d found new value %e for %s bound of <%s>\n", i, bound->newval,
+               bound->boundtype == SCIP_BOUNDTYPE_LOWER ? "lower" : "upper", SCIPvarGetName(bound->var));
+
+            /* filter bound candidates by using the solution of the OBBT LP */
+            if( propdata->applytrivialfilter )
+            {
+               int nfiltered;
+
+               filterWorkerSol(scip, propdata, worker, &nfiltered);
+               SCIPdebugMsg(scip, "filtered %d bounds via inspecting the solution of thread %d\n", nfiltered, i);
+            }
+         }
+      }
+
+      if( error )
+      {
+         SCIPwarningMessage(scip, "   error while solving LP in obbt propagator\n");
+         SCIPwarningMessage(scip, "   this does not affect the remaining solution procedure --> continue\n");
+         break;
+      }
+   }
+
+TERMINATE:
+   /* free the copies of the probing LP */
+   for( i = nallocworkers - 1; i >= 0; --i )
+   {
+      if( workers[i].lpi != NULL )
+      {
+         SCIP_CALL( SCIPlpiFree(&workers[i].lpi) );
+      }
+      SCIPfreeBufferArray(scip, &workers[i].primsol);
+   }
+
+   SCIPfreeBufferArray(scip, &jobargs);
+   SCIPfreeBufferArray(scip, &workers);
+   SCIPfreeBufferArray(scip, &cands);
+
+   return retcode;
+}
+
 /** main function of obbt */
 static
 SCIP_RETCODE applyObbt(
@@ -1997,6 +2518,12 @@ SCIP_RETCODE applyObbt(
       }
    }
 
+   /* solve the OBBT LPs of the bounds in parallel; the remaining bounds are handled sequentially below */
+   if( propdata->nthreads > 1 )
+   {
+      SCIP_CALL( findNewBoundsParallel(scip, propdata, &nleftiterations) );
+   }
+
    /* find new bounds for the variables */
    SCIP_CALL( findNewBounds(scip, propdata, &nleftiterations, FALSE) );
 
@@ -3297,5 +3824,9 @@ SCIP_RETCODE SCIPincludePropObbt(
         "trigger a propagation round after that many bound tightenings (0: no propagation)",
         &propdata->propagatefreq, TRUE, DEFAULT_PROPAGATEFREQ, 0, INT_MAX, NULL, NULL) );
 
+  SCIP_CALL( SCIPaddIntParam(scip, "propagating/" PROP_NAME "/nthreads",
+        "number of threads to solve OBBT LPs in parallel on copies of the probing LP (1: solve OBBT LPs sequentially)",
+        &propdata->nthreads, FALSE, DEFAULT_NTHREADS, 1, 256, NULL, NULL) );
+
    return SCIP_OKAY;
 }
@@ -61,6 +61,9 @@
                                          *   limit) */
 #define MAXDNOM                 10000LL /**< maximal denominator for simple rational fixed values */
 
+#define PROBING_CHGZERO              1U /**< flag for variables changed when probing on zero */
+#define PROBING_CHGONE               2U /**< flag for variables changed when probing on one */
+
 
 /* @todo check for restricting the maximal number of implications that can be added by probing */
 
@@ -329,6 +332,273 @@ SCIP_RETCODE sortVariables(
    return SCIP_OKAY;
 }
 
+/** stores the positions of the variables whose bounds were changed in the current probing node, starting with the
+ *  given bound change, in the list of changed positions and marks them with the given flag
+ */
+static
+void collectProbingChanges(
+   SCIP*                 scip,               /**< SCIP data structure */
+   int*                  varposs,            /**< position of each variable (by index) in the probing variable array, or -1 */
+   int                   nvarposs,           /**< length of varposs array */
+   int                   firstchg,           /**< first bound change of the probing node to consider */
+   unsigned int*         changedmarks,       /**< flags of the positions of changed variables */
+   unsigned int          flag,               /**< flag to use for the changed positions */
+   int*                  changedposs,        /**< list of changed positions */
+   int*                  nchangedposs        /**< pointer to number of changed positions */
+   )
+{
+   SCIP_DOMCHG* domchg;
+   int nboundchgs;
+   int k;
+
+   domchg = SCIPnodeGetDomchg(SCIPgetCurrentNode(scip));
+   nboundchgs = SCIPdomchgGetNBoundchgs(domchg);
+
+   for( k = firstchg; k < nboundchgs; ++k )
+   {
+      SCIP_VAR* var;
+      int idx;
+      int pos;
+
+      var = SCIPboundchgGetVar(SCIPdomchgGetBoundchg(domchg, k));
+      idx = SCIPvarGetIndex(var);
+      if( idx >= nvarposs )
+         continue;
+
+      pos = varposs[idx];
+      if( pos < 0 || (changedmarks[pos] & flag) != 0 )
+         continue;
+
+      changedmarks[pos] |= flag;
+      changedposs[*nchangedposs] = pos;
+      (*nchangedposs)++;
+   }
+}
+
+/** applies and evaluates probing of a single variable in the given direction and bound like SCIPapplyProbingVar(),
+ *  but only reads the bounds of the variables that have a bound change in the probing node
+ *
+ *  The positions of these variables are stored in changedposs and marked with the given flag; the bounds are only
+ *  stored at these positions of the bound arrays. The positions of the previous call with the same list are unmarked.
+ */
+static
+SCIP_RETCODE applyProbingVarSparse(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VAR**            vars,               /**< problem variables */
+   int                   nvars,              /**< number of problem variables */
+   int*                  varposs,            /**< position of each variable (by index) in vars, or -1 */
+   int                   nvarposs,           /**< length of varposs array */
+   int                   probingpos,         /**< variable number to apply probing on */
+   SCIP_BOUNDTYPE        boundtype,          /**< which bound should be changed */
+   SCIP_Real             bound,              /**< which bound should be set */
+   int                   maxproprounds,      /**< maximal number of propagation rounds (-1: no limit, 0: parameter settings) */
+   SCIP_Real*            impllbs,            /**< array to store lower bounds after applying implications and cliques */
+   SCIP_Real*            implubs,            /**< array to store upper bounds after applying implications and cliques */
+   SCIP_Real*            proplbs,            /**< array to store lower bounds after full propagation */
+   SCIP_Real*            propubs,            /**< array to store upper bounds after full propagation */
+   unsigned int*         changedmarks,       /**< flags of the positions of changed variables */
+   unsigned int          flag,               /**< flag to use for the changed positions */
+   int*                  changedposs,        /**< array to store the positions of changed variables */
+   int*                  nchangedposs,       /**< pointer to store the number of changed variables */
+   SCIP_Bool*            cutoff              /**< pointer to store whether the probing direction is infeasible */
+   )
+{
+   int nimplchanged;
+   int k;
+
+   assert(0 <= probingpos && probingpos < nvars);
+   assert(changedmarks != NULL);
+   assert(changedposs != NULL);
+   assert(nchangedposs != NULL);
+   assert(cutoff != NULL);
+
+   /* unmark the variables of the previous probing in this direction */
+   for( k = 0; k < *nchangedposs; ++k )
+      changedmarks[changedposs[k]] &= ~flag;
+   *nchangedposs = 0;
+
+   /* in debug mode we assert above that this trivial infeasibility does not occur (for performance reasons), but in
+    * optimized mode we return safely
+    */
+   if( SCIPisLT(scip, bound, SCIPvarGetLbLocal(vars[probingpos]))
+         || SCIPisGT(scip, bound, SCIPvarGetUbLocal(vars[probingpos])) )
+   {
+      SCIPdebugMsg(scip, " -> trivial infeasibility detected\n");
+      *cutoff = TRUE;
+      return SCIP_OKAY;
+   }
+
+   /* start probing mode */
+   SCIP_CALL( SCIPstartProbing(scip) );
+
+   /* enables collection of variable statistics during probing */
+   SCIPenableVarHistory(scip);
+
+   /* fix variable */
+   if( boundtype == SCIP_BOUNDTYPE_UPPER )
+   {
+      SCIP_CALL( SCIPchgVarUbProbing(scip, vars[probingpos], bound) );
+   }
+   else
+   {
+      assert(boundtype == SCIP_BOUNDTYPE_LOWER);
+      SCIP_CALL( SCIPchgVarLbProbing(scip, vars[probingpos], bound) );
+   }
+
+   /* apply propagation of implication graph and clique table */
+   SCIP_CALL( SCIPpropagateProbingImplications(scip, cutoff) );
+   nimplchanged = 0;
+   if( !(*cutoff) )
+   {
+      int firstpropchg;
+
+      /* store the bounds of the variables changed by implications and cliques */
+      collectProbingChanges(scip, varposs, nvarposs, 0, changedmarks, flag, changedposs, nchangedposs);
+      nimplchanged = *nchangedposs;
+      for( k = 0; k < nimplchanged; ++k )
+      {
+         int pos = changedposs[k];
+
+         impllbs[pos] = SCIPvarGetLbLocal(vars[pos]);
+         implubs[pos] = SCIPvarGetUbLocal(vars[pos]);
+      }
+      firstpropchg = SCIPdomchgGetNBoundchgs(SCIPnodeGetDomchg(SCIPgetCurrentNode(scip)));
+
+      /* apply propagation */
+      SCIP_CALL( SCIPpropagateProbing(scip, maxproprounds, cutoff, NULL) );
+
+      if( !(*cutoff) )
+      {
+         collectProbingChanges(scip, varposs, nvarposs, firstpropchg, changedmarks, flag, changedposs, nchangedposs);
+         for( k = 0; k < *nchangedposs; ++k )
+         {
+            int pos = changedposs[k];
+
+            proplbs[pos] = SCIPvarGetLbLocal(vars[pos]);
+            propubs[pos] = SCIPvarGetUbLocal(vars[pos]);
+         }
+      }
+   }
+   else
+   {
+      SCIPdebugMsg(scip, "propagating probing implications after <%s> to %g led to a cutoff\n",
+         SCIPvarGetName(vars[probingpos]), bound);
+   }
+
+   /* exit probing mode */
+   SCIP_CALL( SCIPendProbing(scip) );
+
+   /* variables that were only changed by full propagation had their current bounds after implications and cliques */
+   if( !(*cutoff) )
+   {
+      for( k = nimplchanged; k < *nchangedposs; ++k )
+      {
+         int pos = changedposs[k];
+
+         impllbs[pos] = SCIPvarGetLbLocal(vars[pos]);
+         implubs[pos] = SCIPvarGetUbLocal(vars[pos]);
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** merges the changed positions of both probing directions into a sorted list, completes the bounds of variables that
+ *  were changed in only one direction by their current bounds, and compacts the bound arrays and the variables to the
+ *  merged positions
+ */
+static
+void compactProbingChanges(
+   SCIP_VAR**            vars,               /**< problem variables */
+   unsigned int*         changedmarks,       /**< flags of the positions of changed variables */
+   int*                  zeroposs,           /**< positions changed when probing on zero */
+   int                   nzeroposs,          /**< number of positions changed when probing on zero */
+   int*                  oneposs,            /**< positions changed when probing on one */
+   int                   noneposs,           /**< number of positions changed when probing on one */
+   SCIP_Real**           bounds,             /**< the eight bound arrays: zero impl lb/ub, zero prop lb/ub, one impl lb/ub,
+                                              *   one prop lb/ub */
+   SCIP_VAR**            changedvars,        /**< array to store the variables at the merged positions */
+   int*                  changedposs,        /**< array to store the merged positions */
+   int*                  nchangedposs        /**< pointer to store the number of merged positions */
+   )
+{
+   int nchanged;
+   int k;
+   int b;
+
+   nchanged = 0;
+   for( k = 0; k < noneposs; ++k )
+      changedposs[nchanged++] = oneposs[k];
+   for( k = 0; k < nzeroposs; ++k )
+   {
+      if( (changedmarks[zeroposs[k]] & PROBING_CHGONE) == 0 )
+         changedposs[nchanged++] = zeroposs[k];
+   }
+
+   /* keep the order of the variables to deduce in the same order as for the complete arrays */
+   SCIPsortInt(changedposs, nchanged);
+
+   for( k = 0; k < nchanged; ++k )
+   {
+      int pos = changedposs[k];
+
+      /* in the direction without a bound change, the variable has its current bounds */
+      if( (changedmarks[pos] & PROBING_CHGZERO) == 0 )
+      {
+         bounds[0][pos] = bounds[2][pos] = SCIPvarGetLbLocal(vars[pos]);
+         bounds[1][pos] = bounds[3][pos] = SCIPvarGetUbLocal(vars[pos]);
+      }
+      if( (changedmarks[pos] & PROBING_CHGONE) == 0 )
+      {
+         bounds[4][pos] = bounds[6][pos] = SCIPvarGetLbLocal(vars[pos]);
+         bounds[5][pos] = bounds[7][pos] = SCIPvarGetUbLocal(vars[pos]);
+      }
+
+      /* since the positions are increasing, pos >= k and no entry is overwritten before it is moved */
+      assert(pos >= k);
+      changedvars[k] = vars[pos];
+      for( b = 0; b < 8; ++b )
+         bounds[b][k] = bounds[b][pos];
+   }
+
+   *nchangedposs = nchanged;
+}
+
+/** computes the position of each variable (by its index) in the probing variable array */
+static
+SCIP_RETCODE computeVarPositions(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VAR**            vars,               /**< problem variables */
+   int                   nvars,              /**< number of problem variables */
+   int**                 varposs,            /**< pointer to buffer array storing the positions */
+   int*                  nvarposs            /**< pointer to length of varposs array */
+   )
+{
+   int maxidx;
+   int v;
+
+   maxidx = -1;
+   for( v = 0; v < nvars; ++v )
+      maxidx = MAX(maxidx, SCIPvarGetIndex(vars[v]));
+
+   if( *varposs == NULL )
+   {
+      SCIP_CALL( SCIPallocBufferArray(scip, varposs, maxidx + 1) );
+   }
+   else
+   {
+      SCIP_CALL( SCIPreallocBufferArray(scip, varposs, maxidx + 1) );
+   }
+   *nvarposs = maxidx + 1;
+
+   for( v = 0; v <= maxidx; ++v )
+      (*varposs)[v] = -1;
+   for( v = 0; v < nvars; ++v )
+      (*varposs)[SCIPvarGetIndex(vars[v])] = v;
+
+   return SCIP_OKAY;
+}
+
 /** the main probing loop */
 static
 SCIP_RETCODE applyProbing(
@@ -355,6 +625,17 @@ SCIP_RETCODE applyProbing(
    SCIP_Real* oneimplubs;
    SCIP_Real* oneproplbs;
    SCIP_Real* onepropubs;
+   SCIP_Real* bounds[8];
+   SCIP_VAR** changedvars;
+   unsigned int* changedmarks;
+   int* varposs;
+   int* zeroposs;
+   int* oneposs;
+   int* changedposs;
+   int nvarposs;
+   int nzeroposs;
+   int noneposs;
+   int nchangedposs;
    int localnfixedvars;
    int localnaggrvars;
    int localnchgbds;
@@ -389,6 +670,17 @@ SCIP_RETCODE applyProbing(
    SCIP_CALL( SCIPallocBufferArray(scip, &oneimplubs, nvars) );
    SCIP_CALL( SCIPallocBufferArray(scip, &oneproplbs, nvars) );
    SCIP_CALL( SCIPallocBufferArray(scip, &onepropubs, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &changedvars, nvars) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &changedmarks, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &zeroposs, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &oneposs, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &changedposs, nvars) );
+   nzeroposs = 0;
+   noneposs = 0;
+
+   /* the probings only read the bounds of variables changed in the probing node, which are located by their index */
+   varposs = NULL;
+   SCIP_CALL( computeVarPositions(scip, vars, nvars, &varposs, &nvarposs) );
 
    /* for each binary variable, probe fixing the variable to zero and one */
    *delay = FALSE;
@@ -480,8 +772,9 @@ SCIP_RETCODE applyProbing(
          if( probingone )
          {
             /* apply probing for fixing the variable to one */
-            SCIP_CALL( SCIPapplyProbingVar(scip, vars, nvars, i, SCIP_BOUNDTYPE_LOWER, 1.0, propdata->proprounds,
-                  oneimpllbs, oneimplubs, oneproplbs, onepropubs, &localcutoff) );
+            SCIP_CALL( applyProbingVarSparse(scip, vars, nvars, varposs, nvarposs, i, SCIP_BOUNDTYPE_LOWER, 1.0,
+                  propdata->proprounds, oneimpllbs, oneimplubs, oneproplbs, onepropubs, changedmarks, PROBING_CHGONE,
+                  oneposs, &noneposs, &localcutoff) );
 
             if( localcutoff )
             {
@@ -532,8 +825,9 @@ SCIP_RETCODE applyProbing(
          if( probingzero )
          {
             /* apply probing for fixing the variable to zero */
-            SCIP_CALL( SCIPapplyProbingVar(scip, vars, nvars, i, SCIP_BOUNDTYPE_UPPER, 0.0, propdata->proprounds,
-                  zeroimpllbs, zeroimplubs, zeroproplbs, zeropropubs, &localcutoff) );
+            SCIP_CALL( applyProbingVarSparse(scip, vars, nvars, varposs, nvarposs, i, SCIP_BOUNDTYPE_UPPER, 0.0,
+                  propdata->proprounds, zeroimpllbs, zeroimplubs, zeroproplbs, zeropropubs, changedmarks, PROBING_CHGZERO,
+                  zeroposs, &nzeroposs, &localcutoff) );
 
             if( localcutoff )
             {
@@ -577,14 +871,28 @@ SCIP_RETCODE applyProbing(
          /* count number of probings on each variable */
          propdata->nprobed[SCIPvarGetIndex(vars[i])] += 1;
 
+         /* restrict the analysis to the variables changed in at least one direction; all other variables keep their
+          * bounds in both directions, such that nothing can be deduced for them
+          */
+         bounds[0] = zeroimpllbs;
+         bounds[1] = zeroimplubs;
+         bounds[2] = zeroproplbs;
+         bounds[3] = zeropropubs;
+         bounds[4] = oneimpllbs;
+         bounds[5] = oneimplubs;
+         bounds[6] = oneproplbs;
+         bounds[7] = onepropubs;
+         compactProbingChanges(vars, changedmarks, zeroposs, nzeroposs, oneposs, noneposs, bounds, changedvars,
+            changedposs, &nchangedposs);
+
          /* analyze probing deductions */
          localnfixedvars    = 0;
          localnaggrvars     = 0;
          localnimplications = 0;
          localnchgbds       = 0;
          SCIP_CALL( SCIPanalyzeDeductionsProbing(scip, vars[i], 0.0, 1.0,
-               nvars, vars, zeroimpllbs, zeroimplubs, zeroproplbs, zeropropubs, oneimpllbs, oneimplubs, oneproplbs, onepropubs,
-               &localnfixedvars, &localnaggrvars, &localnimplications, &localnchgbds, cutoff) );
+               nchangedposs, changedvars, zeroimpllbs, zeroimplubs, zeroproplbs, zeropropubs, oneimpllbs, oneimplubs,
+               oneproplbs, onepropubs, &localnfixedvars, &localnaggrvars, &localnimplications, &localnchgbds, cutoff) );
 
          *nfixedvars += localnfixedvars;
          *naggrvars  += localnaggrvars;
@@ -670,6 +978,15 @@ SCIP_RETCODE applyProbing(
             SCIP_CALL( SCIPreallocBufferArray(scip, &oneimplubs, nvars) );
             SCIP_CALL( SCIPreallocBufferArray(scip, &oneproplbs, nvars) );
             SCIP_CALL( SCIPreallocBufferArray(scip, &onepropubs, nvars) );
+            SCIP_CALL( SCIPreallocBufferArray(scip, &changedvars, nvars) );
+            SCIP_CALL( SCIPreallocBufferArray(scip, &changedmarks, nvars) );
+            SCIP_CALL( SCIPreallocBufferArray(scip, &zeroposs, nvars) );
+            SCIP_CALL( SCIPreallocBufferArray(scip, &oneposs, nvars) );
+            SCIP_CALL( SCIPreallocBufferArray(scip, &changedposs, nvars) );
+            BMSclearMemoryArray(changedmarks, nvars);
+            nzeroposs = 0;
+            noneposs = 0;
+            SCIP_CALL( computeVarPositions(scip, vars, nvars, &varposs, &nvarposs) );
 
             /* correct oldstartidx which is used for early termination */
             if( oldstartidx >= nbinvars )
@@ -703,6 +1020,12 @@ SCIP_RETCODE applyProbing(
 
  TERMINATE:
    /* free temporary memory */
+   SCIPfreeBufferArray(scip, &varposs);
+   SCIPfreeBufferArray(scip, &changedposs);
+   SCIPfreeBufferArray(scip, &oneposs);
+   SCIPfreeBufferArray(scip, &zeroposs);
+   SCIPfreeBufferArray(scip, &changedmarks);
+   SCIPfreeBufferArray(scip, &changedvars);
    SCIPfreeBufferArray(scip, &onepropubs);
    SCIPfreeBufferArray(scip, &oneproplbs);
    SCIPfreeBufferArray(scip, &oneimplubs);
@@ -1215,10 +1215,7 @@ SCIP_RETCODE initData(
    SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &propdata->vars, vars, nvars) );
    SCIP_CALL( SCIPhashmapCreate(&propdata->varhashmap, SCIPblkmem(scip), nvars) );
 
-   for( v = 0; v < nvars; ++v )
-   {
-      SCIP_CALL( SCIPhashmapInsertInt(propdata->varhashmap, propdata->vars[v], v) );
-   }
+   SCIP_CALL( SCIPhashmapInsertArrayInt(propdata->varhashmap, (void**)propdata->vars, NULL, nvars) );
 
    /* allocate memory for the arrays of the propdata */
    SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->topoorder, nbounds) );
@@ -136,6 +136,26 @@ SCIP_Real SCIPbendersGetTime(
    SCIP_BENDERS*         benders             /**< Benders' decomposition */
    );
 
+/** gets the number of generated cuts that were discarded because they were already generated in the same call */
+SCIP_EXPORT
+int SCIPbendersGetNDuplicateCuts(
+   SCIP_BENDERS*         benders             /**< Benders' decomposition */
+   );
+
+/** gets time in seconds used for solving the given subproblem */
+SCIP_EXPORT
+SCIP_Real SCIPbendersGetSubproblemTime(
+   SCIP_BENDERS*         benders,            /**< Benders' decomposition */
+   int                   probnumber          /**< the subproblem number */
+   );
+
+/** gets the number of times the given subproblem has been solved */
+SCIP_EXPORT
+int SCIPbendersGetSubproblemNCalls(
+   SCIP_BENDERS*         benders,            /**< Benders' decomposition */
+   int                   probnumber          /**< the subproblem number */
+   );
+
 /** Is Benders' decomposition initialized? */
 SCIP_EXPORT
 SCIP_Bool SCIPbendersIsInitialized(
@@ -181,6 +181,41 @@ int SCIPheurGetNDivesets(
    SCIP_HEUR*            heur                /**< primal heuristic */
    );
 
+/** gets the number of variables of a heuristic snapshot */
+SCIP_EXPORT
+int SCIPheurSnapshotGetNVars(
+   SCIP_HEURSNAPSHOT*    snapshot            /**< snapshot of an asynchronous heuristic */
+   );
+
+/** gets the problem variables of a heuristic snapshot */
+SCIP_EXPORT
+SCIP_VAR** SCIPheurSnapshotGetVars(
+   SCIP_HEURSNAPSHOT*    snapshot            /**< snapshot of an asynchronous heuristic */
+   );
+
+/** returns whether the job of a heuristic snapshot should stop as soon as possible, because its results will be
+ *  discarded; can be called from the thread of the job
+ */
+SCIP_EXPORT
+SCIP_Bool SCIPheurSnapshotIsInterrupted(
+   SCIP_HEURSNAPSHOT*    snapshot            /**< snapshot of an asynchronous heuristic */
+   );
+
+/** gets the job data of a heuristic snapshot */
+SCIP_EXPORT
+void* SCIPheurSnapshotGetData(
+   SCIP_HEURSNAPSHOT*    snapshot            /**< snapshot of an asynchronous heuristic */
+   );
+
+/** sets the job data of a heuristic snapshot; the heuristic has to free the data in its collection method and reset
+ *  it to NULL
+ */
+SCIP_EXPORT
+void SCIPheurSnapshotSetData(
+   SCIP_HEURSNAPSHOT*    snapshot,           /**< snapshot of an asynchronous heuristic */
+   void*                 data                /**< job data */
+   );
+
 /** @} */
 
 /** get the heuristic to which this diving setting belongs */
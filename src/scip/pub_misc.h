@@ -837,6 +837,30 @@ SCIP_RETCODE SCIPhashmapInsertReal(
    SCIP_Real             image               /**< new image for origin */
    );
 
+/** inserts new origin->image pairs for all given origins in the hash map; the hash map is resized at most once
+ *  (must not be called for already existing origins!)
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPhashmapInsertArray(
+   SCIP_HASHMAP*         hashmap,            /**< hash map */
+   void**                origins,            /**< origins to set images for */
+   void**                images,             /**< new images for the origins */
+   int                   norigins            /**< number of origins */
+   );
+
+/** inserts new origin->image pairs for all given origins in the hash map; the hash map is resized at most once
+ *  (must not be called for already existing origins!)
+ *
+ *  If no images are given, each origin is mapped to its position in the origins array.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPhashmapInsertArrayInt(
+   SCIP_HASHMAP*         hashmap,            /**< hash map */
+   void**                origins,            /**< origins to set images for */
+   int*                  images,             /**< new images for the origins, or NULL to use the positions */
+   int                   norigins            /**< number of origins */
+   );
+
 /** retrieves image of given origin from the hash map, or NULL if no image exists */
 SCIP_EXPORT
 void* SCIPhashmapGetImage(
@@ -858,6 +882,15 @@ SCIP_Real SCIPhashmapGetImageReal(
    void*                 origin              /**< origin to retrieve image for */
    );
 
+/** retrieves the images of the given origins from the hash map, storing NULL for origins without image */
+SCIP_EXPORT
+void SCIPhashmapGetImages(
+   SCIP_HASHMAP*         hashmap,            /**< hash map */
+   void**                origins,            /**< origins to retrieve images for */
+   void**                images,             /**< array to store the images */
+   int                   norigins            /**< number of origins */
+   );
+
 /** sets image for given origin in the hash map, either by modifying existing origin->image pair or by appending a
  *  new origin->image pair
  */
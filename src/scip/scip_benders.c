@@ -1376,6 +1376,42 @@ SCIP_RETCODE SCIPstoreBendersCut(
    return SCIP_OKAY;
 }
 
+/** registers a generated Benders' cut and returns whether an identical cut has already been generated in the current
+ *  call of the Benders' decomposition; duplicates need not be added to the master problem again
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if SCIP is in one of the following stages:
+ *       - \ref SCIP_STAGE_INITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVING
+ *       - \ref SCIP_STAGE_EXITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_INITSOLVE
+ *       - \ref SCIP_STAGE_SOLVING
+ */
+SCIP_RETCODE SCIPregisterBendersCut(
+   SCIP*                 scip,               /**< the SCIP data structure */
+   SCIP_BENDERS*         benders,            /**< Benders' decomposition */
+   SCIP_VAR**            vars,               /**< the variables that have non-zero coefficients in the cut */
+   SCIP_Real*            vals,               /**< the coefficients of the variables in the cut */
+   SCIP_Real             lhs,                /**< the left hand side of the cut */
+   SCIP_Real             rhs,                /**< the right hand side of the cut */
+   int                   nvars,              /**< the number of variables with non-zero coefficients in the cut */
+   SCIP_Bool*            duplicate           /**< pointer to store whether the cut was already generated in this call */
+   )
+{
+   assert(scip != NULL);
+   assert(benders != NULL);
+   assert(duplicate != NULL);
+
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPregisterBendersCut", FALSE, FALSE, FALSE, FALSE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE, FALSE, FALSE) );
+
+   SCIP_CALL( SCIPbendersRegisterCut(benders, scip->set, vars, vals, lhs, rhs, nvars, duplicate) );
+
+   return SCIP_OKAY;
+}
+
 /** creates a constraint in the input SCIP instance that corresponds to the given vars and vals arrays */
 static
 SCIP_RETCODE createAndApplyStoredBendersCut(
@@ -245,6 +245,32 @@ SCIP_RETCODE SCIPsetHeurExitsol(
    return SCIP_OKAY;
 }
 
+/** sets the callbacks that let the primal heuristic run asynchronously on a thread of its own and adds the
+ *  parameter "heuristics/<name>/async" to enable this
+ *
+ *  If the parameter is set, the heuristic takes a snapshot of the problem variables instead of calling its
+ *  execution method during the tree search; the preparation method sets up a job in the main thread, the asynchronous
+ *  execution method runs on a thread of its own, and the collection method passes the found solutions to SCIP at the
+ *  next point where primal heuristics are called after the job finished.
+ */
+SCIP_RETCODE SCIPsetHeurAsync(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEUR*            heur,               /**< primal heuristic */
+   SCIP_DECL_HEURASYNCPREPARE((*heurasyncprepare)), /**< preparation method of asynchronous heuristic */
+   SCIP_DECL_HEURASYNCEXEC((*heurasyncexec)), /**< asynchronous execution method of heuristic */
+   SCIP_DECL_HEURASYNCCOLLECT((*heurasynccollect)) /**< collection method of asynchronous heuristic */
+   )
+{
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPsetHeurAsync", TRUE, TRUE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE) );
+
+   assert(heur != NULL);
+
+   SCIP_CALL( SCIPheurSetAsync(heur, scip->set, scip->messagehdlr, scip->mem->setmem, heurasyncprepare, heurasyncexec,
+         heurasynccollect) );
+
+   return SCIP_OKAY;
+}
+
 /** returns the primal heuristic of the given name, or NULL if not existing */
 SCIP_HEUR* SCIPfindHeur(
    SCIP*                 scip,               /**< SCIP data structure */
@@ -159,6 +159,23 @@ SCIP_RETCODE SCIPsetHeurExitsol(
    SCIP_DECL_HEUREXITSOL ((*heurexitsol))    /**< solving process deinitialization method of primal heuristic */
    );
 
+/** sets the callbacks that let the primal heuristic run asynchronously on a thread of its own and adds the
+ *  parameter "heuristics/<name>/async" to enable this
+ *
+ *  If the parameter is set, the heuristic takes a snapshot of the problem variables instead of calling its
+ *  execution method during the tree search; the preparation method sets up a job in the main thread, the asynchronous
+ *  execution method runs on a thread of its own, and the collection method passes the found solutions to SCIP at the
+ *  next point where primal heuristics are called after the job finished.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPsetHeurAsync(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEUR*            heur,               /**< primal heuristic */
+   SCIP_DECL_HEURASYNCPREPARE((*heurasyncprepare)), /**< preparation method of asynchronous heuristic */
+   SCIP_DECL_HEURASYNCEXEC((*heurasyncexec)), /**< asynchronous execution method of heuristic */
+   SCIP_DECL_HEURASYNCCOLLECT((*heurasynccollect)) /**< collection method of asynchronous heuristic */
+   );
+
 /** returns the primal heuristic of the given name, or NULL if not existing */
 SCIP_EXPORT
 SCIP_HEUR* SCIPfindHeur(
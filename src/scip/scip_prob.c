@@ -37,6 +37,7 @@
 #include "scip/benders.h"
 #include "scip/clock.h"
 #include "scip/concurrent.h"
+#include "scip/conflict.h"
 #include "scip/conflictstore.h"
 #include "scip/cons.h"
 #include "scip/dcmp.h"
@@ -3257,7 +3258,8 @@ SCIP_RETCODE SCIPaddConflict(
    {
       /* add the conflict to the conflict store */
       SCIP_CALL( SCIPconflictstoreAddConflict(scip->conflictstore, scip->mem->probmem, scip->set, scip->stat, scip->tree,
-            scip->transprob, scip->reopt, cons, conftype, iscutoffinvolved, primalbound) );
+            scip->transprob, scip->reopt, cons, conftype, iscutoffinvolved, primalbound,
+            scip->conflict != NULL ? SCIPconflictGetConflictsetLbd(scip->conflict) : -1) );
    }
 
    /* mark constraint to be a conflict */
@@ -1028,7 +1028,7 @@ SCIP_RETCODE SCIPlinkLPSol(
       return SCIP_INVALIDCALL;
    }
 
-   SCIP_CALL( SCIPsolLinkLPSol(sol, scip->set, scip->stat, scip->transprob, scip->tree, scip->lp) );
+   SCIP_CALL( SCIPsolLinkLPSol(sol, scip->mem->probmem, scip->set, scip->stat, scip->transprob, scip->tree, scip->lp) );
 
    return SCIP_OKAY;
 }
@@ -1060,7 +1060,7 @@ SCIP_RETCODE SCIPlinkNLPSol(
       return SCIP_INVALIDCALL;
    }
 
-   SCIP_CALL( SCIPsolLinkNLPSol(sol, scip->stat, scip->tree, scip->nlp) );
+   SCIP_CALL( SCIPsolLinkNLPSol(sol, scip->mem->probmem, scip->stat, scip->tree, scip->nlp) );
 
    return SCIP_OKAY;
 }
@@ -1086,7 +1086,7 @@ SCIP_RETCODE SCIPlinkRelaxSol(
       return SCIP_INVALIDCALL;
    }
 
-   SCIP_CALL( SCIPsolLinkRelaxSol(sol, scip->set, scip->stat, scip->tree, scip->relaxation) );
+   SCIP_CALL( SCIPsolLinkRelaxSol(sol, scip->mem->probmem, scip->set, scip->stat, scip->tree, scip->relaxation) );
 
    return SCIP_OKAY;
 }
@@ -1107,7 +1107,8 @@ SCIP_RETCODE SCIPlinkPseudoSol(
 {
    SCIP_CALL( SCIPcheckStage(scip, "SCIPlinkPseudoSol", FALSE, FALSE, FALSE, FALSE, FALSE, TRUE, FALSE, FALSE, FALSE, TRUE, FALSE, FALSE, FALSE, FALSE) );
 
-   SCIP_CALL( SCIPsolLinkPseudoSol(sol, scip->set, scip->stat, scip->transprob, scip->tree, scip->lp) );
+   SCIP_CALL( SCIPsolLinkPseudoSol(sol, scip->mem->probmem, scip->set, scip->stat, scip->transprob, scip->tree,
+         scip->lp) );
 
    return SCIP_OKAY;
 }
@@ -1127,7 +1128,8 @@ SCIP_RETCODE SCIPlinkCurrentSol(
 {
    SCIP_CALL( SCIPcheckStage(scip, "SCIPlinkCurrentSol", FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, TRUE, FALSE, FALSE, FALSE, FALSE) );
 
-   SCIP_CALL( SCIPsolLinkCurrentSol(sol, scip->set, scip->stat, scip->transprob, scip->tree, scip->lp) );
+   SCIP_CALL( SCIPsolLinkCurrentSol(sol, scip->mem->probmem, scip->set, scip->stat, scip->transprob, scip->tree,
+         scip->lp) );
 
    return SCIP_OKAY;
 }
@@ -1158,7 +1160,7 @@ SCIP_RETCODE SCIPclearSol(
 {
    SCIP_CALL( SCIPcheckStage(scip, "SCIPclearSol", FALSE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE) );
 
-   SCIP_CALL( SCIPsolClear(sol, scip->stat, scip->tree) );
+   SCIP_CALL( SCIPsolClear(sol, scip->mem->probmem, scip->stat, scip->tree) );
 
    return SCIP_OKAY;
 }
@@ -1186,7 +1188,7 @@ SCIP_RETCODE SCIPunlinkSol(
 {
    SCIP_CALL( SCIPcheckStage(scip, "SCIPunlinkSol", FALSE, FALSE, TRUE, TRUE, FALSE, TRUE, FALSE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE) );
 
-   SCIP_CALL( SCIPsolUnlink(sol, scip->set, scip->transprob) );
+   SCIP_CALL( SCIPsolUnlink(sol, scip->mem->probmem, scip->set, scip->transprob) );
 
    return SCIP_OKAY;
 }
@@ -1228,7 +1230,7 @@ SCIP_RETCODE SCIPsetSolVal(
       return SCIP_INVALIDCALL;
    }
 
-   SCIP_CALL( SCIPsolSetVal(sol, scip->set, scip->stat, scip->tree, var, val) );
+   SCIP_CALL( SCIPsolSetVal(sol, scip->mem->probmem, scip->set, scip->stat, scip->tree, var, val) );
 
    return SCIP_OKAY;
 }
@@ -1282,7 +1284,7 @@ SCIP_RETCODE SCIPsetSolVals(
 
    for( v = 0; v < nvars; ++v )
    {
-      SCIP_CALL( SCIPsolSetVal(sol, scip->set, scip->stat, scip->tree, vars[v], vals[v]) );
+      SCIP_CALL( SCIPsolSetVal(sol, scip->mem->probmem, scip->set, scip->stat, scip->tree, vars[v], vals[v]) );
    }
 
    return SCIP_OKAY;
@@ -1325,7 +1327,7 @@ SCIP_RETCODE SCIPincSolVal(
       return SCIP_INVALIDCALL;
    }
 
-   SCIP_CALL( SCIPsolIncVal(sol, scip->set, scip->stat, scip->tree, var, incval) );
+   SCIP_CALL( SCIPsolIncVal(sol, scip->mem->probmem, scip->set, scip->stat, scip->tree, var, incval) );
 
    return SCIP_OKAY;
 }
@@ -1731,7 +1733,8 @@ SCIP_RETCODE SCIPadjustImplicitSolVals(
    SCIP_CALL( SCIPcheckStage(scip, "SCIPadjustImplicitSolVals", FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, TRUE, FALSE, FALSE, FALSE, FALSE) );
 
    assert(sol != NULL);
-   SCIP_CALL( SCIPsolAdjustImplicitSolVals(sol, scip->set, scip->stat, scip->transprob, scip->tree, uselprows) );
+   SCIP_CALL( SCIPsolAdjustImplicitSolVals(sol, scip->mem->probmem, scip->set, scip->stat, scip->transprob,
+         scip->tree, uselprows) );
 
    return SCIP_OKAY;
 }
@@ -2458,7 +2461,7 @@ SCIP_RETCODE SCIProundSol(
       return SCIP_INVALIDCALL;
    }
 
-   SCIP_CALL( SCIPsolRound(sol, scip->set, scip->stat, scip->transprob, scip->tree, success) );
+   SCIP_CALL( SCIPsolRound(sol, scip->mem->probmem, scip->set, scip->stat, scip->transprob, scip->tree, success) );
 
    return SCIP_OKAY;
 }
@@ -2506,7 +2509,8 @@ SCIP_RETCODE SCIPretransformSol(
    {
       SCIP_Bool hasinfval;
 
-      SCIP_CALL( SCIPsolRetransform(sol, scip->set, scip->stat, scip->origprob, scip->transprob, &hasinfval) );
+      SCIP_CALL( SCIPsolRetransform(sol, scip->mem->probmem, scip->set, scip->stat, scip->origprob, scip->transprob,
+            &hasinfval) );
       break;
    }
    case SCIP_SOLORIGIN_PARTIAL:
@@ -2696,7 +2700,8 @@ SCIP_RETCODE readSolFile(
    {
       if( SCIPgetStage(scip) == SCIP_STAGE_PROBLEM )
       {
-         SCIP_CALL( SCIPsolMarkPartial(sol, scip->set, scip->stat, scip->origprob->vars, scip->origprob->nvars) );
+         SCIP_CALL( SCIPsolMarkPartial(sol, scip->mem->probmem, scip->set, scip->stat, scip->origprob->vars,
+               scip->origprob->nvars) );
       }
       else
          *error = TRUE;
@@ -2856,7 +2861,8 @@ SCIP_RETCODE readXmlSolFile(
    {
       if( SCIPgetStage(scip) == SCIP_STAGE_PROBLEM )
       {
-         SCIP_CALL( SCIPsolMarkPartial(sol, scip->set, scip->stat, scip->origprob->vars, scip->origprob->nvars) );
+         SCIP_CALL( SCIPsolMarkPartial(sol, scip->mem->probmem, scip->set, scip->stat, scip->origprob->vars,
+               scip->origprob->nvars) );
       }
       else
          *error = TRUE;
@@ -2954,8 +2960,9 @@ SCIP_RETCODE SCIPaddSol(
 
          SCIP_CALL( SCIPcreateSolCopy(scip, &tmpsol, sol) );
 
-         SCIP_CALL( SCIPsolUnlink(tmpsol, scip->set, scip->transprob) );
-         SCIP_CALL( SCIPsolRetransform(tmpsol, scip->set, scip->stat, scip->origprob, scip->transprob, &hasinfval) );
+         SCIP_CALL( SCIPsolUnlink(tmpsol, scip->mem->probmem, scip->set, scip->transprob) );
+         SCIP_CALL( SCIPsolRetransform(tmpsol, scip->mem->probmem, scip->set, scip->stat, scip->origprob,
+               scip->transprob, &hasinfval) );
 
          SCIP_CALL( SCIPprimalAddSolFree(scip->primal, scip->mem->probmem, scip->set, scip->messagehdlr, scip->stat,
                scip->origprob, scip->transprob, scip->tree, scip->reopt, scip->lp, scip->eventqueue, scip->eventfilter,
@@ -3040,8 +3047,9 @@ SCIP_RETCODE SCIPaddSolFree(
       {
          SCIP_Bool hasinfval;
 
-         SCIP_CALL( SCIPsolUnlink(*sol, scip->set, scip->transprob) );
-         SCIP_CALL( SCIPsolRetransform(*sol, scip->set, scip->stat, scip->origprob, scip->transprob, &hasinfval) );
+         SCIP_CALL( SCIPsolUnlink(*sol, scip->mem->probmem, scip->set, scip->transprob) );
+         SCIP_CALL( SCIPsolRetransform(*sol, scip->mem->probmem, scip->set, scip->stat, scip->origprob,
+               scip->transprob, &hasinfval) );
       }
       /*lint -fallthrough*/
    case SCIP_STAGE_PRESOLVED:
@@ -3160,8 +3168,9 @@ SCIP_RETCODE SCIPtrySol(
    {
       SCIP_Bool hasinfval;
 
-      SCIP_CALL( SCIPsolUnlink(sol, scip->set, scip->transprob) );
-      SCIP_CALL( SCIPsolRetransform(sol, scip->set, scip->stat, scip->origprob, scip->transprob, &hasinfval) );
+      SCIP_CALL( SCIPsolUnlink(sol, scip->mem->probmem, scip->set, scip->transprob) );
+      SCIP_CALL( SCIPsolRetransform(sol, scip->mem->probmem, scip->set, scip->stat, scip->origprob, scip->transprob,
+            &hasinfval) );
    }
 
    if( SCIPsolIsOriginal(sol) )
@@ -3266,8 +3275,9 @@ SCIP_RETCODE SCIPtrySolFree(
    {
       SCIP_Bool hasinfval;
 
-      SCIP_CALL( SCIPsolUnlink(*sol, scip->set, scip->transprob) );
-      SCIP_CALL( SCIPsolRetransform(*sol, scip->set, scip->stat, scip->origprob, scip->transprob, &hasinfval) );
+      SCIP_CALL( SCIPsolUnlink(*sol, scip->mem->probmem, scip->set, scip->transprob) );
+      SCIP_CALL( SCIPsolRetransform(*sol, scip->mem->probmem, scip->set, scip->stat, scip->origprob, scip->transprob,
+            &hasinfval) );
    }
 
    if( SCIPsolIsOriginal(*sol) )
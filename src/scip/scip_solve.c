@@ -1995,7 +1995,8 @@ SCIP_RETCODE freeTransform(
          if( !SCIPsolIsOriginal(sol) )
          {
             /* retransform solution into the original problem space */
-            SCIP_CALL( SCIPsolRetransform(sol, scip->set, scip->stat, scip->origprob, scip->transprob, &hasinfval) );
+            SCIP_CALL( SCIPsolRetransform(sol, scip->mem->probmem, scip->set, scip->stat, scip->origprob,
+                  scip->transprob, &hasinfval) );
          }
          else
             hasinfval = FALSE;
@@ -2767,7 +2768,8 @@ SCIP_RETCODE SCIPsolve(
             SCIP_Bool hasinfval;
 
             /* retransform solution into the original problem space */
-            SCIP_CALL( SCIPsolRetransform(sol, scip->set, scip->stat, scip->origprob, scip->transprob, &hasinfval) );
+            SCIP_CALL( SCIPsolRetransform(sol, scip->mem->probmem, scip->set, scip->stat, scip->origprob,
+                  scip->transprob, &hasinfval) );
          }
 
          if( SCIPsolGetNodenum(sol) > 0 || SCIPsolGetHeur(sol) != NULL || (s == 0 && scip->set->reopt_sepabestsol) )
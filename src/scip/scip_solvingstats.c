@@ -3318,11 +3318,19 @@ void SCIPprintNLPStatistics(
    if( scip->nlp == NULL )
       return;
 
-   SCIPmessageFPrintInfo(scip->messagehdlr, file, "NLP                :       Time      Calls\n");
+   SCIPmessageFPrintInfo(scip->messagehdlr, file, "NLP                :       Time      Calls Iterations  Iter/call\n");
 
-   SCIPmessageFPrintInfo(scip->messagehdlr, file, "  all NLPs         : %10.2f %10" SCIP_LONGINT_FORMAT "\n",
+   SCIPmessageFPrintInfo(scip->messagehdlr, file, "  all NLPs         : %10.2f %10" SCIP_LONGINT_FORMAT " %10" SCIP_LONGINT_FORMAT " %10.2f\n",
       SCIPclockGetTime(scip->stat->nlpsoltime),
-      scip->stat->nnlps);
+      scip->stat->nnlps,
+      scip->stat->nnlpiterations,
+      scip->stat->nnlps > 0 ? (SCIP_Real)scip->stat->nnlpiterations/(SCIP_Real)scip->stat->nnlps : 0.0);
+
+   SCIPmessageFPrintInfo(scip->messagehdlr, file, "  diving NLPs      : %10.2f %10" SCIP_LONGINT_FORMAT " %10" SCIP_LONGINT_FORMAT " %10.2f\n",
+      SCIPclockGetTime(scip->stat->divingnlpsoltime),
+      scip->stat->ndivingnlps,
+      scip->stat->ndivingnlpiterations,
+      scip->stat->ndivingnlps > 0 ? (SCIP_Real)scip->stat->ndivingnlpiterations/(SCIP_Real)scip->stat->ndivingnlps : 0.0);
 }
 
 /** outputs relaxator statistics
@@ -3723,6 +3731,34 @@ void SCIPprintBendersStatistics(
          }
       }
    }
+
+   SCIPmessageFPrintInfo(scip->messagehdlr, file, "Benders Subprobs   :  SolveTime    MaxTime      Calls   DuplCuts\n");
+   for( i = 0; i < nbenders; ++i )
+   {
+      if( SCIPbendersIsActive(benders[i]) )
+      {
+         SCIP_Real solvetime;
+         SCIP_Real maxtime;
+         int ncalls;
+         int j;
+
+         solvetime = 0.0;
+         maxtime = 0.0;
+         ncalls = 0;
+
+         for( j = 0; j < SCIPbendersGetNSubproblems(benders[i]); j++ )
+         {
+            SCIP_Real subprobtime = SCIPbendersGetSubproblemTime(benders[i], j);
+
+            solvetime += subprobtime;
+            maxtime = MAX(maxtime, subprobtime);
+            ncalls += SCIPbendersGetSubproblemNCalls(benders[i], j);
+         }
+
+         SCIPmessageFPrintInfo(scip->messagehdlr, file, "  %-17.17s: %10.2f %10.2f %10d %10d\n",
+            SCIPbendersGetName(benders[i]), solvetime, maxtime, ncalls, SCIPbendersGetNDuplicateCuts(benders[i]));
+      }
+   }
 }
 
 /** outputs root statistics
@@ -7609,6 +7609,52 @@ SCIP_CLIQUE** SCIPgetCliques(
    return SCIPcliquetableGetCliques(scip->cliquetable);
 }
 
+/** gets a frozen compressed sparse row representation of the clique graph, which is (re)built if the clique table
+ *  changed since the last call
+ *
+ *  The literal of variable x with value v is 2*probindex(x)+v. The cliques of literal l are
+ *  litcliques[litbeg[l]], ..., litcliques[litbeg[l+1]-1] in increasing order, the literals of clique c are
+ *  cliquelits[cliquebeg[c]], ..., cliquelits[cliquebeg[c+1]-1]; clique c is the c-th clique of SCIPgetCliques().
+ *  The arrays must not be modified and stay valid until the clique table or the problem variables change.
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_TRANSFORMED
+ *       - \ref SCIP_STAGE_INITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVING
+ *       - \ref SCIP_STAGE_EXITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_INITSOLVE
+ *       - \ref SCIP_STAGE_SOLVING
+ *       - \ref SCIP_STAGE_SOLVED
+ *       - \ref SCIP_STAGE_EXITSOLVE
+ */
+SCIP_RETCODE SCIPgetCliqueGraphCsr(
+   SCIP*                 scip,               /**< SCIP data structure */
+   int**                 litbeg,             /**< pointer to store the start of each literal's cliques (length 2*nvars+1), or NULL */
+   int**                 litcliques,         /**< pointer to store the clique positions of the literals, or NULL */
+   int**                 cliquebeg,          /**< pointer to store the start of each clique's literals (length ncliques+1), or NULL */
+   int**                 cliquelits,         /**< pointer to store the literals of the cliques, or NULL */
+   int*                  ncliques,           /**< pointer to store the number of cliques, or NULL */
+   SCIP_Bool*            success             /**< pointer to store whether the representation is available; it is not if
+                                              *   the clique table is too large for int offsets */
+   )
+{
+   assert(success != NULL);
+
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPgetCliqueGraphCsr", FALSE, FALSE, FALSE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE) );
+
+   SCIP_CALL( SCIPcliquetableBuildCsr(scip->cliquetable, scip->transprob->nvars,
+         SCIPprobGetNVarIndexChgs(scip->transprob), success) );
+
+   if( *success )
+      SCIPcliquetableGetCsr(scip->cliquetable, litbeg, litcliques, cliquebeg, cliquelits, ncliques);
+
+   return SCIP_OKAY;
+}
+
 /** returns whether there is a clique that contains both given variable/value pairs;
  *  the variables must be active binary variables;
  *  if regardimplics is FALSE, only the cliques in the clique table are looked at;
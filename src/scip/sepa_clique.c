@@ -102,12 +102,18 @@ struct TCLIQUE_Graph
    int*                  adjnodesidxs;       /**< indices in adjnodes array of first adjacent nodes for each node */
    int*                  cliqueidsidxs;      /**< indices in cliqueids array of first clique the node is contained in */
    int*                  adjnodes;           /**< adjacent nodes of edges */
-   unsigned int*         cliqueids;          /**< unique ids of cliques */
+   unsigned int*         cliqueids;          /**< positions of cliques in the clique table (sorted for each node) */
    unsigned int*         cliquetable;        /**< dense bitvector clique table (array stored as a vector) */
+   int*                  cliquenodesidxs;    /**< indices in cliquenodes array of first node of each clique, or NULL if
+                                              *   the dense clique table is used */
+   int*                  cliquenodes;        /**< nodes of the cliques */
+   unsigned int*         adjmarks;           /**< bitvector of nodes sharing a clique with markednode */
    int                   adjnodessize;       /**< size of adjnodes array */
    int                   cliqueidssize;      /**< size of cliqueids array */
    int                   nnodes;             /**< number of nodes in graph */
    int                   tablewidth;         /**< number of unsigned ints per row in the table */
+   int                   ncliques;           /**< number of cliques in cliquenodesidxs */
+   int                   markednode;         /**< node whose clique neighborhood is stored in adjmarks, or -1 */
 
    int                   maxnnodes;           /**< allocated memory for some arrays */
 };
@@ -144,10 +150,15 @@ SCIP_RETCODE tcliquegraphCreate(
    (*tcliquegraph)->adjnodes = NULL;
    (*tcliquegraph)->cliqueids = NULL;
    (*tcliquegraph)->cliquetable = NULL;
+   (*tcliquegraph)->cliquenodesidxs = NULL;
+   (*tcliquegraph)->cliquenodes = NULL;
+   (*tcliquegraph)->adjmarks = NULL;
    (*tcliquegraph)->adjnodessize = 0;
    (*tcliquegraph)->cliqueidssize = 0;
    (*tcliquegraph)->nnodes = 0;
    (*tcliquegraph)->tablewidth = 0;
+   (*tcliquegraph)->ncliques = 0;
+   (*tcliquegraph)->markednode = -1;
    (*tcliquegraph)->maxnnodes = maxnnodes;  /* remember allocated memory */
 
    return SCIP_OKAY;
@@ -179,6 +190,9 @@ SCIP_RETCODE tcliquegraphFree(
    SCIPfreeMemoryArrayNull(scip, &(*tcliquegraph)->adjnodes);
    SCIPfreeMemoryArrayNull(scip, &(*tcliquegraph)->cliqueids);
    SCIPfreeMemoryArrayNull(scip, &(*tcliquegraph)->cliquetable);
+   SCIPfreeMemoryArrayNull(scip, &(*tcliquegraph)->cliquenodes);
+   SCIPfreeMemoryArrayNull(scip, &(*tcliquegraph)->cliquenodesidxs);
+   SCIPfreeMemoryArrayNull(scip, &(*tcliquegraph)->adjmarks);
    SCIPfreeBlockMemory(scip, tcliquegraph);
 
    return SCIP_OKAY;
@@ -206,7 +220,7 @@ SCIP_RETCODE tcliquegraphEnsureCliqueidsSize(
 }
 
 /** adds a node to the tclique graph defined as a variable-value pair; adds all cliques to the cliqueids array the
- *  variable is contained in with the given value
+ *  variable is contained in with the given value, as stored in the frozen clique graph
  */
 static
 SCIP_RETCODE tcliquegraphAddNode(
@@ -214,13 +228,13 @@ SCIP_RETCODE tcliquegraphAddNode(
    TCLIQUE_GRAPH**       tcliquegraph,       /**< pointer to tclique graph data */
    SCIP_VAR*             var,                /**< active binary problem variable */
    SCIP_Bool             value,              /**< value of the variable in the node */
+   int*                  cliques,            /**< positions of the cliques containing the variable-value pair (sorted) */
+   int                   ncliques,           /**< number of cliques containing the variable-value pair */
    int*                  nodeidx             /**< pointer to store the index of the new node */
    )
 {
    SCIP_VAR* nodevar;
    unsigned int* cliqueids;
-   SCIP_CLIQUE** cliques;
-   int ncliques;
    int nadjnodes;
    int ncliqueids;
    int i;
@@ -257,15 +271,13 @@ SCIP_RETCODE tcliquegraphAddNode(
    (*tcliquegraph)->weights[*nodeidx] = 0;
    (*tcliquegraph)->nnodes++;
 
-   /* store the ids of the variable's cliques in the cliqueids array */
-   ncliques = SCIPvarGetNCliques(var, value);
-   cliques = SCIPvarGetCliques(var, value);
+   /* store the positions of the variable's cliques in the cliqueids array */
    SCIP_CALL( tcliquegraphEnsureCliqueidsSize(scip, *tcliquegraph, ncliqueids + ncliques) );
    cliqueids = (*tcliquegraph)->cliqueids;
    for( i = 0; i < ncliques; ++i )
    {
       assert(ncliqueids < (*tcliquegraph)->cliqueidssize);
-      cliqueids[ncliqueids] = SCIPcliqueGetId(cliques[i]);
+      cliqueids[ncliqueids] = (unsigned int)cliques[i];
       assert(i == 0 || cliqueids[ncliqueids-1] <= cliqueids[ncliqueids]);
       ncliqueids++;
    }
@@ -282,6 +294,8 @@ static
 SCIP_RETCODE tcliquegraphAddCliqueVars(
    SCIP*                 scip,               /**< SCIP data structure */
    TCLIQUE_GRAPH**       tcliquegraph,       /**< pointer to tclique graph data */
+   int*                  litbeg,             /**< start of each literal's cliques in litcliques (frozen clique graph) */
+   int*                  litcliques,         /**< clique positions of the literals (frozen clique graph) */
    int**                 cliquegraphidx      /**< array to store tclique graph node index of variable/value pairs */
    )
 {
@@ -290,6 +304,8 @@ SCIP_RETCODE tcliquegraphAddCliqueVars(
    int i;
 
    assert(tcliquegraph != NULL);
+   assert(litbeg != NULL);
+   assert(litcliques != NULL);
    assert(cliquegraphidx != NULL);
    assert(cliquegraphidx[0] != NULL);
    assert(cliquegraphidx[1] != NULL);
@@ -305,14 +321,20 @@ SCIP_RETCODE tcliquegraphAddCliqueVars(
 
       var = vars[i];
 
+      assert(SCIPvarGetProbindex(var) == i);
+
       for( value = 0; value < 2; ++value )
       {
+         int lit;
+
          assert(cliquegraphidx[value][i] == -1);
 
-         if( SCIPvarGetNCliques(var, (SCIP_Bool)value) >= 1 )
+         lit = 2*i + value;
+         if( litbeg[lit+1] > litbeg[lit] )
          {
             /* all cliques stored in the clique table are at least 3-cliques */
-            SCIP_CALL( tcliquegraphAddNode(scip, tcliquegraph, var, (SCIP_Bool)value, &cliquegraphidx[value][i]) );
+            SCIP_CALL( tcliquegraphAddNode(scip, tcliquegraph, var, (SCIP_Bool)value, &litcliques[litbeg[lit]],
+                  litbeg[lit+1] - litbeg[lit], &cliquegraphidx[value][i]) );
          }
       }
    }
@@ -328,23 +350,24 @@ static
 SCIP_RETCODE tcliquegraphConstructCliqueTable(
    SCIP*                 scip,               /**< SCIP data structure */
    TCLIQUE_GRAPH*        tcliquegraph,       /**< tclique graph data */
+   int*                  cliquebeg,          /**< start of each clique's literals in cliquelits (frozen clique graph) */
+   int*                  cliquelits,         /**< literals of the cliques (frozen clique graph) */
+   int                   ncliques,           /**< number of cliques in the frozen clique graph */
+   int**                 cliquegraphidx,     /**< tclique graph node index of variable/value pairs */
    SCIP_Real             cliquetablemem,     /**< maximal memory size of dense clique table (in kb) */
    SCIP_Real             cliquedensity       /**< minimal density of cliques to store as dense table */
    )
 {
-   SCIP_CLIQUE** cliques;
    int* varids;
    unsigned int* cliquetable;
    SCIP_Real density;
    int nbits;
    int tablesize;
    int tablewidth;
-   int ncliques;
+   int nbinlits;
    int nelems;
    int i;
 
-   cliques = SCIPgetCliques(scip);
-   ncliques = SCIPgetNCliques(scip);
    if( ncliques == 0 )
       return SCIP_OKAY;
 
@@ -352,16 +375,14 @@ SCIP_RETCODE tcliquegraphConstructCliqueTable(
 
    /* calculate size of dense clique table */
    nbits = 8*sizeof(unsigned int);
-   tcliquegraph->tablewidth = (tcliquegraph->nnodes + nbits-1) / nbits; /* number of ints needed */
+   assert(tcliquegraph->tablewidth == (tcliquegraph->nnodes + nbits-1) / nbits);
 
    /* check if dense clique table is too large (calculate as Reals to avoid overflow) */
    if( (SCIP_Real)tcliquegraph->nnodes * (SCIP_Real)tcliquegraph->tablewidth/1024.0 > cliquetablemem )
       return SCIP_OKAY;
 
    /* calculate clique entry density */
-   nelems = 0;
-   for( i = 0; i < ncliques; ++i )
-      nelems += SCIPcliqueGetNVars(cliques[i]);
+   nelems = cliquebeg[ncliques];
    density = (SCIP_Real)nelems / ((SCIP_Real)ncliques * (SCIP_Real)tcliquegraph->nnodes);
    if( density < cliquedensity )
       return SCIP_OKAY;
@@ -369,7 +390,7 @@ SCIP_RETCODE tcliquegraphConstructCliqueTable(
    /* allocate memory */
    tablesize = tcliquegraph->nnodes * tcliquegraph->tablewidth;
    SCIPdebugMsg(scip, "clique separator: constructing dense clique table (%d kb, %d cliques, %d nodes, density: %.2f)\n",
-      tablesize/1024, SCIPgetNCliques(scip), tcliquegraph->nnodes, density);
+      tablesize/1024, ncliques, tcliquegraph->nnodes, density);
 
    SCIP_CALL( SCIPallocMemoryArray(scip, &tcliquegraph->cliquetable, tablesize) );
    BMSclearMemoryArray(tcliquegraph->cliquetable, tablesize);
@@ -378,47 +399,37 @@ SCIP_RETCODE tcliquegraphConstructCliqueTable(
    SCIP_CALL( SCIPallocBufferArray(scip, &varids, tcliquegraph->nnodes) );
    cliquetable = tcliquegraph->cliquetable;
    tablewidth = tcliquegraph->tablewidth;
+   nbinlits = 2*SCIPgetNBinVars(scip);
    for( i = 0; i < ncliques && !SCIPisStopped(scip); ++i )
    {
-      SCIP_VAR** vars;
-      SCIP_Bool* vals;
       int nvars;
       int u;
       int v;
 
-      vars = SCIPcliqueGetVars(cliques[i]);
-      vals = SCIPcliqueGetValues(cliques[i]);
-      nvars = SCIPcliqueGetNVars(cliques[i]);
-
-      /* get the node numbers of the variables */
-      for( u = 0; u < nvars && !SCIPisStopped(scip); ++u )
+      /* get the node numbers of the literals; implicit integer and integer variables are currently not present in the
+       * constructed tclique graph
+       */
+      nvars = 0;
+      for( u = cliquebeg[i]; u < cliquebeg[i+1]; ++u )
       {
-         SCIP_VAR* var;
+         int lit = cliquelits[u];
 
-         /* implicit integer and integer variables are currently not present in the constructed tclique graph */
-         if( SCIPvarGetType(vars[u]) != SCIP_VARTYPE_BINARY )
+         if( lit >= nbinlits )
             continue;
 
-         var = (vals[u] ? vars[u] : SCIPvarGetNegatedVar(vars[u]));
-         assert(var != NULL); /* var must exist even if negated, since it is stored in the tcliquegraph */
-         for( v = 0; v < tcliquegraph->nnodes && var != tcliquegraph->vars[v]; ++v )
-         {}
-         assert(v < tcliquegraph->nnodes);
-         varids[u] = v;
+         assert(0 <= cliquegraphidx[lit % 2][lit / 2] && cliquegraphidx[lit % 2][lit / 2] < tcliquegraph->nnodes);
+         varids[nvars] = cliquegraphidx[lit % 2][lit / 2];
+         nvars++;
       }
 
       /* flag the edges in the incidence matrix (excluding diagonal entries) */
-      for( u = 0; u < nvars-1 && !SCIPisStopped(scip); ++u )
+      for( u = 0; u < nvars-1; ++u )
       {
          int nu;
          int rowstart;
          int colofs;
          unsigned int colmask;
 
-         /* implicit integer and integer variables are currently not present in the constructed tclique graph */
-         if( SCIPvarGetType(vars[u]) != SCIP_VARTYPE_BINARY )
-            continue;
-
          nu = varids[u];
          rowstart = nu*tablewidth;
          colofs = nu/nbits;
@@ -428,10 +439,6 @@ SCIP_RETCODE tcliquegraphConstructCliqueTable(
             int nv;
             unsigned int mask;
 
-            /* implicit integer and integer variables are currently not present in the constructed tclique graph */
-            if( SCIPvarGetType(vars[v]) != SCIP_VARTYPE_BINARY )
-               continue;
-
             nv = varids[v];
             mask = 1U << (nv % nbits); /*lint !e701*/
             cliquetable[rowstart+nv/nbits] |= mask;
@@ -446,6 +453,130 @@ SCIP_RETCODE tcliquegraphConstructCliqueTable(
    return SCIP_OKAY;
 }
 
+/** constructs the sparse clique-to-node incidence lists and the bitvector used for neighborhood queries; this is the
+ *  counterpart of the cliqueids lists if no dense clique table is available
+ */
+static
+SCIP_RETCODE tcliquegraphConstructCliqueNodes(
+   SCIP*                 scip,               /**< SCIP data structure */
+   TCLIQUE_GRAPH*        tcliquegraph,       /**< tclique graph data */
+   int*                  cliquebeg,          /**< start of each clique's literals in cliquelits (frozen clique graph) */
+   int*                  cliquelits,         /**< literals of the cliques (frozen clique graph) */
+   int                   ncliques,           /**< number of cliques in the frozen clique graph */
+   int**                 cliquegraphidx      /**< tclique graph node index of variable/value pairs */
+   )
+{
+   int nbinlits;
+   int nentries;
+   int i;
+
+   assert(tcliquegraph != NULL);
+   assert(tcliquegraph->cliquetable == NULL);
+
+   SCIP_CALL( SCIPallocMemoryArray(scip, &tcliquegraph->cliquenodesidxs, ncliques + 1) );
+   SCIP_CALL( SCIPallocMemoryArray(scip, &tcliquegraph->cliquenodes, MAX(cliquebeg[ncliques], 1)) );
+   SCIP_CALL( SCIPallocMemoryArray(scip, &tcliquegraph->adjmarks, MAX(tcliquegraph->tablewidth, 1)) );
+   tcliquegraph->ncliques = ncliques;
+
+   /* map the literals of the cliques to tclique graph nodes, skipping integer and implicit integer variables */
+   nbinlits = 2*SCIPgetNBinVars(scip);
+   nentries = 0;
+   for( i = 0; i < ncliques; ++i )
+   {
+      int u;
+
+      tcliquegraph->cliquenodesidxs[i] = nentries;
+      for( u = cliquebeg[i]; u < cliquebeg[i+1]; ++u )
+      {
+         int lit = cliquelits[u];
+
+         if( lit >= nbinlits )
+            continue;
+
+         assert(0 <= cliquegraphidx[lit % 2][lit / 2] && cliquegraphidx[lit % 2][lit / 2] < tcliquegraph->nnodes);
+         tcliquegraph->cliquenodes[nentries] = cliquegraphidx[lit % 2][lit / 2];
+         nentries++;
+      }
+   }
+   tcliquegraph->cliquenodesidxs[ncliques] = nentries;
+
+   return SCIP_OKAY;
+}
+
+/** stores the nodes sharing a clique with the given node in the adjmarks bitvector */
+static
+void tcliquegraphMarkCliqueNeighbors(
+   TCLIQUE_GRAPH*        tcliquegraph,       /**< tclique graph data */
+   int                   node                /**< node whose clique neighborhood should be marked */
+   )
+{
+   unsigned int* adjmarks;
+   int nbits;
+   int i;
+
+   assert(tcliquegraph != NULL);
+   assert(tcliquegraph->cliquenodesidxs != NULL);
+
+   if( tcliquegraph->markednode == node )
+      return;
+
+   adjmarks = tcliquegraph->adjmarks;
+   nbits = 8*sizeof(unsigned int);
+   BMSclearMemoryArray(adjmarks, tcliquegraph->tablewidth);
+
+   for( i = tcliquegraph->cliqueidsidxs[node]; i < tcliquegraph->cliqueidsidxs[node+1]; ++i )
+   {
+      int clique;
+      int k;
+
+      clique = (int)tcliquegraph->cliqueids[i];
+      assert(0 <= clique && clique < tcliquegraph->ncliques);
+
+      for( k = tcliquegraph->cliquenodesidxs[clique]; k < tcliquegraph->cliquenodesidxs[clique+1]; ++k )
+      {
+         int nk = tcliquegraph->cliquenodes[k];
+
+         adjmarks[nk/nbits] |= (1U << (nk % nbits)); /*lint !e701*/
+      }
+   }
+
+   tcliquegraph->markednode = node;
+}
+
+/** returns whether marking the clique neighborhood of the node is cheaper than merging its clique list with the clique
+ *  lists of the given number of other nodes
+ */
+static
+SCIP_Bool tcliquegraphPreferMarking(
+   TCLIQUE_GRAPH*        tcliquegraph,       /**< tclique graph data */
+   int                   node,               /**< node whose clique neighborhood would be marked */
+   int                   nnodes              /**< number of nodes to check against node */
+   )
+{
+   SCIP_Longint markcost;
+   int ncliques;
+   int i;
+
+   assert(tcliquegraph != NULL);
+
+   if( tcliquegraph->cliquenodesidxs == NULL )
+      return FALSE;
+
+   if( tcliquegraph->markednode == node )
+      return TRUE;
+
+   ncliques = tcliquegraph->cliqueidsidxs[node+1] - tcliquegraph->cliqueidsidxs[node];
+   markcost = tcliquegraph->tablewidth;
+   for( i = tcliquegraph->cliqueidsidxs[node]; i < tcliquegraph->cliqueidsidxs[node+1]; ++i )
+   {
+      int clique = (int)tcliquegraph->cliqueids[i];
+
+      markcost += tcliquegraph->cliquenodesidxs[clique+1] - tcliquegraph->cliquenodesidxs[clique];
+   }
+
+   return markcost <= (SCIP_Longint)nnodes * (ncliques + 1);
+}
+
 /** creates tclique data structure using the implication graph;
  *  only variables that are contained in a 3-clique are added as nodes to the clique graph
  */
@@ -456,6 +587,12 @@ SCIP_RETCODE loadTcliquegraph(
    )
 {
    int* cliquegraphidx[2];
+   int* litbeg;
+   int* litcliques;
+   int* cliquebeg;
+   int* cliquelits;
+   SCIP_Bool success;
+   int ncliques;
    int nvars;
    int i;
 
@@ -467,6 +604,14 @@ SCIP_RETCODE loadTcliquegraph(
    if( nvars == 0 )
       return SCIP_OKAY;
 
+   /* get the frozen clique graph in compressed sparse row format */
+   SCIP_CALL( SCIPgetCliqueGraphCsr(scip, &litbeg, &litcliques, &cliquebeg, &cliquelits, &ncliques, &success) );
+   if( !success )
+   {
+      SCIPdebugMsg(scip, "clique separator: clique table too large, no clique graph constructed\n");
+      return SCIP_OKAY;
+   }
+
    /* get temporary memory for mapping variable/value pairs to clique graph nodes */
    SCIP_CALL( SCIPallocBufferArray(scip, &cliquegraphidx[0], nvars) );
    SCIP_CALL( SCIPallocBufferArray(scip, &cliquegraphidx[1], nvars) );
@@ -477,15 +622,26 @@ SCIP_RETCODE loadTcliquegraph(
    }
 
    /* insert all variable/value pairs that are contained in an existing 3-clique */
-   SCIP_CALL( tcliquegraphAddCliqueVars(scip, &sepadata->tcliquegraph, cliquegraphidx) );
+   SCIP_CALL( tcliquegraphAddCliqueVars(scip, &sepadata->tcliquegraph, litbeg, litcliques, cliquegraphidx) );
 
    /* it occurs that it might be that some cliques were not yet removed from the global clique array, so SCIPgetNClique
     * can be greater than 0, even if there is no clique with some variables left */
    /** @todo clean up empty cliques */
    if( sepadata->tcliquegraph != NULL )
    {
+      TCLIQUE_GRAPH* tcliquegraph = sepadata->tcliquegraph;
+
+      tcliquegraph->tablewidth = (tcliquegraph->nnodes + 8*(int)sizeof(unsigned int) - 1) / (8*(int)sizeof(unsigned int));
+
       /* construct the dense clique table */
-      SCIP_CALL( tcliquegraphConstructCliqueTable(scip, sepadata->tcliquegraph, sepadata->cliquetablemem, sepadata->cliquedensity) );
+      SCIP_CALL( tcliquegraphConstructCliqueTable(scip, tcliquegraph, cliquebeg, cliquelits, ncliques, cliquegraphidx,
+            sepadata->cliquetablemem, sepadata->cliquedensity) );
+
+      /* otherwise construct the sparse clique incidence lists */
+      if( tcliquegraph->cliquetable == NULL && !SCIPisStopped(scip) )
+      {
+         SCIP_CALL( tcliquegraphConstructCliqueNodes(scip, tcliquegraph, cliquebeg, cliquelits, ncliques, cliquegraphidx) );
+      }
    }
 
    /* free temporary memory */
@@ -574,6 +730,16 @@ SCIP_Bool nodesHaveCommonClique(
          == ((tcliquegraph->cliquetable[node2*tcliquegraph->tablewidth + node1/nbits] & (1U << (node1 % nbits))) != 0)); /*lint !e701*/
       return ((tcliquegraph->cliquetable[node1*tcliquegraph->tablewidth + colofs] & mask) != 0);
    }
+   else if( tcliquegraph->markednode == node1 || tcliquegraph->markednode == node2 )
+   {
+      int nbits;
+      int other;
+
+      /* check entry in the bitvector of the marked clique neighborhood */
+      nbits = 8*sizeof(unsigned int);
+      other = (tcliquegraph->markednode == node1 ? node2 : node1);
+      return ((tcliquegraph->adjmarks[other / nbits] & (1U << (other % nbits))) != 0); /*lint !e701*/
+   }
    else
    {
       unsigned int* cliqueids;
@@ -659,6 +825,12 @@ TCLIQUE_SELECTADJNODES(tcliqueSelectadjnodesClique)
 
    nadjnodes = 0;
 
+   /* if no dense clique table is available, mark the clique neighborhood of the node in a bitvector if this is cheaper
+    * than intersecting its clique list with the clique lists of all given nodes
+    */
+   if( tcliquegraph->cliquetable == NULL && tcliquegraphPreferMarking(tcliquegraph, node, nnodes) )
+      tcliquegraphMarkCliqueNeighbors(tcliquegraph, node);
+
    /* check for each node in given nodes set, if it is adjacent to the given node or shares a common clique */
    graphadjnodes = tcliquegraph->adjnodes;
    nodeadjindex = tcliquegraph->adjnodesidxs[node];
@@ -66,6 +66,7 @@
 #define DEFAULT_MAXDEPTH             -1      /* maximum depth at which the separator is applied; -1 means no limit */
 #define DEFAULT_NLPTIMELIMIT        0.0      /**< default time limit of NLP solver; 0.0 for no limit */
 #define DEFAULT_NLPITERLIM          250      /**< default NLP iteration limit */
+#define DEFAULT_LINEARIZEFIRST     TRUE      /**< default for trying gradient cuts at the point to separate before projecting it */
 
 #define VIOLATIONFAC                100      /* points regarded violated if max violation > VIOLATIONFAC*SCIPfeastol */
 
@@ -109,6 +110,7 @@ struct SCIP_SepaData
    SCIP_Real             nlptimelimit;       /**< time limit of NLP solver; 0.0 for no limit */
    int                   nlpiterlimit;       /**< iteration limit of NLP solver; 0 for no limit */
    int                   maxdepth;           /**< maximal depth at which the separator is applied */
+   SCIP_Bool             linearizefirst;     /**< should gradient cuts at the point to separate be tried before projecting it? */
 
    int                   ncuts;              /**< number of cuts generated */
 };
@@ -204,7 +206,7 @@ SCIP_RETCODE computeGradient(
    return SCIP_OKAY;
 }
 
-/** computes gradient cut (linearization) of nlrow at projection */
+/** computes gradient cut (linearization) of nlrow at projection; no cut is generated if the gradient is not finite */
 static
 SCIP_RETCODE generateCut(
    SCIP*                 scip,               /**< SCIP data structure */
@@ -214,11 +216,13 @@ SCIP_RETCODE generateCut(
    SCIP_NLROW*           nlrow,              /**< constraint for which we generate gradient cut */
    CONVEXSIDE            convexside,         /**< which side makes the nlrow convex */
    SCIP_Real             activity,           /**< activity of constraint at projection */
-   SCIP_ROW**            row                 /**< storage for cut */
+   SCIP_ROW**            row                 /**< storage for cut, or NULL if no cut was generated */
    )
 {
    char rowname[SCIP_MAXSTRLEN];
    SCIP_SEPADATA* sepadata;
+   SCIP_EXPRTREE* tree;
+   SCIP_Real* grad;
    SCIP_Real gradx0; /* <grad f(x_0), x_0> */
    int i;
 
@@ -232,8 +236,30 @@ SCIP_RETCODE generateCut(
 
    assert(sepadata != NULL);
 
+   *row = NULL;
    gradx0 = 0.0;
 
+   /* compute the gradient of the expression tree first, since it may not be finite at projection */
+   tree = SCIPnlrowGetExprtree(nlrow);
+   grad = NULL;
+
+   if( tree != NULL && SCIPexprtreeGetNVars(tree) > 0 )
+   {
+      SCIP_CALL( SCIPallocBufferArray(scip, &grad, SCIPexprtreeGetNVars(tree)) );
+
+      SCIP_CALL( computeGradient(scip, sepadata->exprinterpreter, projection, tree, grad) );
+
+      for( i = 0; i < SCIPexprtreeGetNVars(tree); i++ )
+      {
+         if( !SCIPisFinite(grad[i]) || SCIPisInfinity(scip, REALABS(grad[i])) )
+         {
+            SCIPdebugMsg(scip, "gradient of <%s> is not finite, skip cut\n", SCIPnlrowGetName(nlrow));
+            SCIPfreeBufferArray(scip, &grad);
+            return SCIP_OKAY;
+         }
+      }
+   }
+
    /* an nlrow has a linear part, quadratic part and expression tree; ideally one would just build the gradient but we
     * do not know if the different parts share variables or not, so we can't just build the gradient; for this reason
     * we create the row right away and compute the gradients of each part independently and add them to the row; the
@@ -274,26 +300,17 @@ SCIP_RETCODE generateCut(
    }
 
    /* expression tree part */
+   if( grad != NULL )
    {
-      SCIP_Real* grad;
-      SCIP_EXPRTREE* tree;
-
-      tree = SCIPnlrowGetExprtree(nlrow);
+      assert(tree != NULL);
 
-      if( tree != NULL && SCIPexprtreeGetNVars(tree) > 0 )
+      for( i = 0; i < SCIPexprtreeGetNVars(tree); i++ )
       {
-         SCIP_CALL( SCIPallocBufferArray(scip, &grad, SCIPexprtreeGetNVars(tree)) );
-
-         SCIP_CALL( computeGradient(scip, sepadata->exprinterpreter, projection, tree, grad) );
-
-         for( i = 0; i < SCIPexprtreeGetNVars(tree); i++ )
-         {
-            gradx0 +=  grad[i] * SCIPgetSolVal(scip, projection, SCIPexprtreeGetVars(tree)[i]);
-            SCIP_CALL( SCIPaddVarToRow(scip, *row, SCIPexprtreeGetVars(tree)[i], grad[i]) );
-         }
-
-         SCIPfreeBufferArray(scip, &grad);
+         gradx0 +=  grad[i] * SCIPgetSolVal(scip, projection, SCIPexprtreeGetVars(tree)[i]);
+         SCIP_CALL( SCIPaddVarToRow(scip, *row, SCIPexprtreeGetVars(tree)[i], grad[i]) );
       }
+
+      SCIPfreeBufferArray(scip, &grad);
    }
 
    SCIP_CALL( SCIPflushRowExtensions(scip, *row) );
@@ -364,6 +381,80 @@ SCIP_RETCODE setQuadraticObj(
    return SCIP_OKAY;
 }
 
+/** tries to separate sol by gradient cuts of the violated convex nlrows at sol itself
+ *
+ * a gradient cut at sol always separates sol from a violated convex constraint, but may be weak; we only add cuts
+ * that are efficacious, in which case the projection problem does not need to be solved
+ */
+static
+SCIP_RETCODE separateLinearizations(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_SEPA*            sepa,               /**< the cut separator itself */
+   SCIP_SOL*             sol,                /**< solution that should be separated */
+   SCIP_RESULT*          result              /**< pointer to store the result of the separation call */
+   )
+{
+   SCIP_SEPADATA* sepadata;
+   int i;
+
+   assert(sepa != NULL);
+   assert(sol != NULL);
+   assert(result != NULL);
+
+   sepadata = SCIPsepaGetData(sepa);
+
+   assert(sepadata != NULL);
+   assert(sepadata->nlrows != NULL);
+   assert(sepadata->convexsides != NULL);
+   assert(sepadata->constraintviolation != NULL);
+
+   for( i = 0; i < sepadata->nnlrows; ++i )
+   {
+      SCIP_ROW* row;
+      SCIP_Real activity;
+
+      /* ignore constraints that are not violated by `sol` */
+      if( SCIPisFeasZero(scip, sepadata->constraintviolation[i]) )
+         continue;
+
+      SCIP_CALL( SCIPgetNlRowSolActivity(scip, sepadata->nlrows[i], sol, &activity) );
+
+      /* the LP solution may be outside of the domain of the constraint function */
+      if( !SCIPisFinite(activity) || SCIPisInfinity(scip, REALABS(activity)) )
+         continue;
+
+      SCIP_CALL( generateCut(scip, sepa, sepadata->exprinterpreter, sol, sepadata->nlrows[i], sepadata->convexsides[i],
+               activity, &row) );
+
+      if( row == NULL )
+         continue;
+
+      SCIPdebugMsg(scip, "linearization cut with efficacy %g generated\n", SCIPgetCutEfficacy(scip, sol, row));
+
+      if( SCIPisCutEfficacious(scip, sol, row) )
+      {
+         SCIP_Bool infeasible;
+
+         SCIP_CALL( SCIPaddRow(scip, row, FALSE, &infeasible) );
+
+         if( infeasible )
+         {
+            *result = SCIP_CUTOFF;
+            SCIP_CALL( SCIPreleaseRow(scip, &row) );
+            break;
+         }
+         else
+         {
+            *result = SCIP_SEPARATED;
+         }
+      }
+
+      SCIP_CALL( SCIPreleaseRow(scip, &row) );
+   }
+
+   return SCIP_OKAY;
+}
+
 /** projects sol onto convex relaxation (stored in sepadata) and tries to generate gradient cuts at the projection
  * it generates cuts only for the constraints that were violated by the LP solution and are now active or still
  * violated (in case we don't solve to optimality).
@@ -521,6 +612,9 @@ SCIP_RETCODE separateCuts(
                SCIP_CALL( generateCut(scip, sepa, sepadata->exprinterpreter, projection, nlrow, convexside, activity,
                         &row) );
 
+               if( row == NULL )
+                  continue;
+
                SCIPdebugMsg(scip, "active or violated nlrow: (sols vio: %e)\n", sepadata->constraintviolation[i]);
                SCIPdebug( SCIP_CALL( SCIPprintNlRow(scip, nlrow, NULL) ) );
                SCIPdebugMsg(scip, "cut with efficacy %g generated\n", SCIPgetCutEfficacy(scip, sol, row));
@@ -892,8 +986,17 @@ SCIP_DECL_SEPAEXECLP(sepaExeclpConvexproj)
    /* run the separator */
    *result = SCIP_DIDNOTFIND;
 
+   /* if linearizing the violated constraints at the solution suffices, we do not need to solve the projection problem */
+   if( sepadata->linearizefirst )
+   {
+      SCIP_CALL( separateLinearizations(scip, sepa, lpsol, result) );
+   }
+
    /* separateCuts computes the projection and then gradient cuts on each constraint that was originally violated */
-   SCIP_CALL( separateCuts(scip, sepa, lpsol, result) );
+   if( *result == SCIP_DIDNOTFIND )
+   {
+      SCIP_CALL( separateCuts(scip, sepa, lpsol, result) );
+   }
 
    /* free memory */
    SCIP_CALL( SCIPfreeSol(scip, &lpsol) );
@@ -944,5 +1047,9 @@ SCIP_RETCODE SCIPincludeSepaConvexproj(
          "time limit of NLP solver; 0.0 for no limit",
          &sepadata->nlptimelimit, TRUE, DEFAULT_NLPTIMELIMIT, 0.0, SCIP_REAL_MAX, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddBoolParam(scip, "separating/" SEPA_NAME "/linearizefirst",
+         "should gradient cuts at the point to separate be tried first, such that the projection problem is only solved if none of them is efficacious?",
+         &sepadata->linearizefirst, TRUE, DEFAULT_LINEARIZEFIRST, NULL, NULL) );
+
    return SCIP_OKAY;
 }
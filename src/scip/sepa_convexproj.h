@@ -35,6 +35,10 @@
  *
  * By default, the separator runs only if the convex relaxation has at least one nonlinear convex function
  *
+ * Before solving the projection problem, the separator tries gradient cuts of the violated constraints at
+ * \f$ x_0 \f$ itself. These always separate \f$ x_0 \f$, but may be weak. Only if none of them is efficacious, the
+ * projection problem is solved.
+ *
  * The separator generates cuts for constraints which were violated by the solution we want to separate and active
  * at the projection. If the projection problem is not solved to optimality, it still tries to add a cut at the
  * best solution found. In case that the projection problem is solved to optimality, it is guaranteed that a cut
@@ -221,10 +221,7 @@ SCIP_RETCODE setupAndSolveSubscipRapidlearning(
    }
 
    /* fill subvars array in the order of the variables of the main SCIP */
-   for( i = 0; i < nvars; i++ )
-   {
-      subvars[i] = (SCIP_VAR*) SCIPhashmapGetImage(varmapfw, vars[i]);
-   }
+   SCIPhashmapGetImages(varmapfw, (void**)vars, (void**)subvars, nvars);
    SCIPhashmapFree(&varmapfw);
 
    /* change implicit integer variables to integer type */
@@ -124,7 +124,17 @@
                                                  *   conflict graph (-1: use every intermediate constraint) */
 #define SCIP_DEFAULT_CONF_MAXCONSS           10 /**< maximal number of conflict constraints accepted at an infeasible node
                                                  *   (-1: use all generated conflict constraints) */
+#define SCIP_DEFAULT_CONF_TIEREDSTORE     TRUE /**< should the conflict store keep conflicts in tiers by their literal block
+                                                 *   distance and usage? (FALSE: remove conflicts by age only) */
+#define SCIP_DEFAULT_CONF_CORETIERLBD        2 /**< maximal literal block distance of conflicts that are kept in the core
+                                                 *   tier of the conflict store */
+#define SCIP_DEFAULT_CONF_MIDTIERLBD         6 /**< maximal literal block distance of conflicts that are kept in the mid
+                                                 *   tier of the conflict store */
+#define SCIP_DEFAULT_CONF_MAXSTOREMEM     -1.0 /**< maximal memory in MB used by the conflicts of the conflict store
+                                                 *   (-1.0: no limit) */
 #define SCIP_DEFAULT_CONF_PREFERBINARY    FALSE /**< should binary conflicts be preferred? */
+#define SCIP_DEFAULT_CONF_USETRAIL         TRUE /**< should binary conflict candidates be kept on a timestamped trail
+                                                 *   instead of the candidate priority queue? */
 #define SCIP_DEFAULT_CONF_ALLOWLOCAL       TRUE /**< should conflict constraints be generated that are only valid locally? */
 #define SCIP_DEFAULT_CONF_SETTLELOCAL     FALSE /**< should conflict constraints be attached only to the local subtree
                                                  *   where they can be useful? */
@@ -257,6 +267,7 @@
 
 #define SCIP_DEFAULT_NLP_SOLVER              "" /**< name of NLP solver to use, or "" if solver should be chosen by priority */
 #define SCIP_DEFAULT_NLP_DISABLE          FALSE /**< should the NLP be always disabled? */
+#define SCIP_DEFAULT_NLP_WARMSTART         TRUE /**< should the NLP solver be warm started from the last NLP solution if no initial guess is given? */
 
 
 /* Memory */
@@ -296,6 +307,8 @@
                                                  *   orbitopes); 6: Schreier Sims cuts and orbital fixing; 7: Schreier Sims cuts, orbitopes, and orbital
                                                  *   fixing, see type_symmetry.h */
 #define SCIP_DEFAULT_MISC_SCALEOBJ         TRUE /**< should the objective function be scaled? */
+#define SCIP_DEFAULT_MISC_COMPRESSSOLS    FALSE /**< should stored solutions other than the incumbent be kept in a compressed sparse format? */
+#define SCIP_DEFAULT_MISC_SOLSINKFILE       "-" /**< file to which each new incumbent solution is appended ("-" for none) */
 
 #ifdef WITH_DEBUG_SOLUTION
 #define SCIP_DEFAULT_MISC_DEBUGSOLUTION     "-" /**< path to a debug solution */
@@ -1062,6 +1075,10 @@ SCIP_RETCODE SCIPsetCopyParams(
 
    SCIP_CALL( SCIPparamsetCopyParams(sourceset->paramset, targetset->paramset, targetset, messagehdlr) );
 
+   /* solutions of a copy must not be appended to the solution sink of the source */
+   SCIP_CALL( SCIPparamsetSetString(targetset->paramset, targetset, messagehdlr, "misc/solsinkfile",
+         SCIP_DEFAULT_MISC_SOLSINKFILE) );
+
    return SCIP_OKAY;
 }
 
@@ -1193,8 +1210,10 @@ SCIP_RETCODE SCIPsetCreate(
    (*set)->visual_bakfilename = NULL;
    (*set)->nlp_solver = NULL;
    (*set)->nlp_disable = FALSE;
+   (*set)->nlp_warmstart = TRUE;
    (*set)->num_relaxfeastol = SCIP_INVALID;
    (*set)->misc_debugsol = NULL;
+   (*set)->misc_solsinkfile = NULL;
 
    /* the default time limit is infinite */
    (*set)->istimelimitfinite = FALSE;
@@ -1364,11 +1383,36 @@ SCIP_RETCODE SCIPsetCreate(
          "maximal size of conflict store (-1: auto, 0: disable storage)",
          &(*set)->conf_maxstoresize, TRUE, SCIP_DEFAULT_CONF_MAXSTORESIZE, -1, INT_MAX,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
+         "conflict/tieredstore",
+         "should the conflict store keep conflicts in tiers by their literal block distance and usage? (FALSE: remove conflicts by age only)",
+         &(*set)->conf_tieredstore, TRUE, SCIP_DEFAULT_CONF_TIEREDSTORE,
+         NULL, NULL) );
+   SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
+         "conflict/coretierlbd",
+         "maximal literal block distance (number of distinct depth levels) of conflicts kept in the core tier of the conflict store",
+         &(*set)->conf_coretierlbd, TRUE, SCIP_DEFAULT_CONF_CORETIERLBD, 0, INT_MAX,
+         NULL, NULL) );
+   SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
+         "conflict/midtierlbd",
+         "maximal literal block distance (number of distinct depth levels) of conflicts kept in the mid tier of the conflict store",
+         &(*set)->conf_midtierlbd, TRUE, SCIP_DEFAULT_CONF_MIDTIERLBD, 0, INT_MAX,
+         NULL, NULL) );
+   SCIP_CALL( SCIPsetAddRealParam(*set, messagehdlr, blkmem,
+         "conflict/maxstoremem",
+         "maximal memory in MB used by the conflicts of the conflict store (-1.0: no limit)",
+         &(*set)->conf_maxstoremem, TRUE, SCIP_DEFAULT_CONF_MAXSTOREMEM, -1.0, (SCIP_Real)SCIP_MEM_NOLIMIT,
+         NULL, NULL) );
    SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
          "conflict/preferbinary",
          "should binary conflicts be preferred?",
          &(*set)->conf_preferbinary, FALSE, SCIP_DEFAULT_CONF_PREFERBINARY,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
+         "conflict/usetrail",
+         "should binary conflict candidates be kept on a timestamped trail instead of the candidate priority queue?",
+         &(*set)->conf_usetrail, TRUE, SCIP_DEFAULT_CONF_USETRAIL,
+         NULL, NULL) );
    SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
          "conflict/prefinfproof",
          "prefer infeasibility proof to boundexceeding proof",
@@ -1843,6 +1887,11 @@ SCIP_RETCODE SCIPsetCreate(
          "should the NLP relaxation be always disabled (also for NLPs/MINLPs)?",
          &(*set)->nlp_disable, FALSE, SCIP_DEFAULT_NLP_DISABLE,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
+         "nlp/warmstart",
+         "should the NLP solver be started from the primal and dual values of the last NLP solution if no initial guess is given?",
+         &(*set)->nlp_warmstart, TRUE, SCIP_DEFAULT_NLP_WARMSTART,
+         NULL, NULL) );
 
    /* memory parameters */
    SCIP_CALL( SCIPsetAddRealParam(*set, messagehdlr, blkmem,
@@ -1973,6 +2022,16 @@ SCIP_RETCODE SCIPsetCreate(
             "should the objective function be scaled so that it is always integer?",
             &(*set)->misc_scaleobj, FALSE, SCIP_DEFAULT_MISC_SCALEOBJ,
             NULL, NULL) );
+   SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
+            "misc/compresssols",
+            "should stored solutions other than the incumbent be kept in a compressed sparse format?",
+            &(*set)->misc_compresssols, FALSE, SCIP_DEFAULT_MISC_COMPRESSSOLS,
+            NULL, NULL) );
+   SCIP_CALL( SCIPsetAddStringParam(*set, messagehdlr, blkmem,
+            "misc/solsinkfile",
+            "file to which each new incumbent solution is appended (\"-\" for none)",
+            &(*set)->misc_solsinkfile, FALSE, SCIP_DEFAULT_MISC_SOLSINKFILE,
+            NULL, NULL) );
 
    SCIP_CALL( SCIPsetAddRealParam(*set, messagehdlr, blkmem,
          "misc/referencevalue",
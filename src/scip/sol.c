@@ -47,14 +47,73 @@
 
 
 
+/** recreates the dense solution arrays of a compressed primal CIP solution; does nothing if the solution is not
+ *  compressed
+ */
+SCIP_RETCODE SCIPsolDecompress(
+   SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   int i;
+
+   assert(sol != NULL);
+   assert(blkmem != NULL);
+   assert(set != NULL);
+
+   if( sol->vals != NULL )
+      return SCIP_OKAY;
+
+   assert(sol->valid == NULL);
+   assert(sol->solorigin == SCIP_SOLORIGIN_ZERO || sol->solorigin == SCIP_SOLORIGIN_ORIGINAL);
+
+   SCIP_CALL( SCIPrealarrayCreate(&sol->vals, blkmem) );
+   SCIP_CALL( SCIPboolarrayCreate(&sol->valid, blkmem) );
+
+   if( sol->nsparsevals > 0 )
+   {
+      SCIP_CALL( SCIPrealarrayExtend(sol->vals, set->mem_arraygrowinit, set->mem_arraygrowfac,
+            sol->sparseinds[0], sol->sparseinds[sol->nsparsevals - 1]) );
+      SCIP_CALL( SCIPboolarrayExtend(sol->valid, set->mem_arraygrowinit, set->mem_arraygrowfac,
+            sol->sparseinds[0], sol->sparseinds[sol->nsparsevals - 1]) );
+   }
+
+   /* entries that are not stored in the compressed solution are zero, which is the default of the origin */
+   for( i = 0; i < sol->nsparsevals; ++i )
+   {
+      SCIP_CALL( SCIPboolarraySetVal(sol->valid, set->mem_arraygrowinit, set->mem_arraygrowfac, sol->sparseinds[i], TRUE) );
+      SCIP_CALL( SCIPrealarraySetVal(sol->vals, set->mem_arraygrowinit, set->mem_arraygrowfac, sol->sparseinds[i],
+            sol->sparsevals[i]) );
+   }
+
+   BMSfreeBlockMemoryArrayNull(blkmem, &sol->sparsevals, sol->nsparsevals);
+   BMSfreeBlockMemoryArrayNull(blkmem, &sol->sparseinds, sol->nsparsevals);
+   sol->nsparsevals = 0;
+
+   return SCIP_OKAY;
+}
+
 /** clears solution arrays of primal CIP solution */
 static
 SCIP_RETCODE solClearArrays(
-   SCIP_SOL*             sol                 /**< primal CIP solution */
+   SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem              /**< block memory */
    )
 {
    assert(sol != NULL);
 
+   /* a compressed solution gets empty dense arrays */
+   if( sol->vals == NULL )
+   {
+      BMSfreeBlockMemoryArrayNull(blkmem, &sol->sparsevals, sol->nsparsevals);
+      BMSfreeBlockMemoryArrayNull(blkmem, &sol->sparseinds, sol->nsparsevals);
+      sol->nsparsevals = 0;
+
+      SCIP_CALL( SCIPrealarrayCreate(&sol->vals, blkmem) );
+      SCIP_CALL( SCIPboolarrayCreate(&sol->valid, blkmem) );
+   }
+
    SCIP_CALL( SCIPboolarrayClear(sol->valid) );
    sol->hasinfval = FALSE;
 
@@ -65,6 +124,7 @@ SCIP_RETCODE solClearArrays(
 static
 SCIP_RETCODE solSetArrayVal(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_VAR*             var,                /**< problem variable */
    SCIP_Real             val                 /**< value to set variable to */
@@ -74,6 +134,8 @@ SCIP_RETCODE solSetArrayVal(
 
    assert(sol != NULL);
 
+   SCIP_CALL( SCIPsolDecompress(sol, blkmem, set) );
+
    idx = SCIPvarGetIndex(var);
 
    /* from now on, variable must not be deleted */
@@ -96,6 +158,7 @@ SCIP_RETCODE solSetArrayVal(
 static
 SCIP_RETCODE solIncArrayVal(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_VAR*             var,                /**< problem variable */
    SCIP_Real             incval              /**< increase of variable's solution value */
@@ -105,6 +168,8 @@ SCIP_RETCODE solIncArrayVal(
 
    assert(sol != NULL);
 
+   SCIP_CALL( SCIPsolDecompress(sol, blkmem, set) );
+
    idx = SCIPvarGetIndex(var);
 
    /* from now on, variable must not be deleted */
@@ -146,6 +211,20 @@ SCIP_Real solGetArrayVal(
 
    idx = SCIPvarGetIndex(var);
 
+   /* a compressed solution stores all nonzero values explicitly */
+   if( sol->vals == NULL )
+   {
+      int pos;
+
+      assert(sol->solorigin == SCIP_SOLORIGIN_ZERO || sol->solorigin == SCIP_SOLORIGIN_ORIGINAL);
+
+      /* a compressed solution without nonzero values has no sparse arrays */
+      if( sol->nsparsevals > 0 && SCIPsortedvecFindInt(sol->sparseinds, idx, sol->nsparsevals, &pos) )
+         return sol->sparsevals[pos];
+
+      return 0.0;
+   }
+
    /* check, if the variable's value is valid */
    if( SCIPboolarrayGetVal(sol->valid, idx) )
    {
@@ -188,6 +267,7 @@ SCIP_Real solGetArrayVal(
 static
 SCIP_RETCODE solUnlinkVar(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_VAR*             var                 /**< problem variable */
    )
@@ -199,8 +279,8 @@ SCIP_RETCODE solUnlinkVar(
    assert(SCIPvarIsTransformed(var));
    assert(SCIPvarGetStatus(var) == SCIP_VARSTATUS_COLUMN || SCIPvarGetStatus(var) == SCIP_VARSTATUS_LOOSE);
 
-   /* if variable is already valid, nothing has to be done */
-   if( SCIPboolarrayGetVal(sol->valid, SCIPvarGetIndex(var)) )
+   /* if the solution is compressed or the variable is already valid, nothing has to be done */
+   if( sol->vals == NULL || SCIPboolarrayGetVal(sol->valid, SCIPvarGetIndex(var)) )
       return SCIP_OKAY;
 
    SCIPsetDebugMsg(set, "unlinking solution value of variable <%s>\n", SCIPvarGetName(var));
@@ -217,27 +297,27 @@ SCIP_RETCODE solUnlinkVar(
 
    case SCIP_SOLORIGIN_LPSOL:
       solval = SCIPvarGetLPSol(var);
-      SCIP_CALL( solSetArrayVal(sol, set, var, solval) );
+      SCIP_CALL( solSetArrayVal(sol, blkmem, set, var, solval) );
       return SCIP_OKAY;
 
    case SCIP_SOLORIGIN_NLPSOL:
       solval = SCIPvarGetNLPSol(var);
-      SCIP_CALL( solSetArrayVal(sol, set, var, solval) );
+      SCIP_CALL( solSetArrayVal(sol, blkmem, set, var, solval) );
       return SCIP_OKAY;
 
    case SCIP_SOLORIGIN_RELAXSOL:
       solval = SCIPvarGetRelaxSolTransVar(var);
-      SCIP_CALL( solSetArrayVal(sol, set, var, solval) );
+      SCIP_CALL( solSetArrayVal(sol, blkmem, set, var, solval) );
       return SCIP_OKAY;
 
    case SCIP_SOLORIGIN_PSEUDOSOL:
       solval = SCIPvarGetPseudoSol(var);
-      SCIP_CALL( solSetArrayVal(sol, set, var, solval) );
+      SCIP_CALL( solSetArrayVal(sol, blkmem, set, var, solval) );
       return SCIP_OKAY;
 
    case SCIP_SOLORIGIN_PARTIAL:
    case SCIP_SOLORIGIN_UNKNOWN:
-      SCIP_CALL( solSetArrayVal(sol, set, var, SCIP_UNKNOWN) );
+      SCIP_CALL( solSetArrayVal(sol, blkmem, set, var, SCIP_UNKNOWN) );
       return SCIP_OKAY;
 
    default:
@@ -293,6 +373,9 @@ SCIP_RETCODE SCIPsolCreate(
    SCIP_ALLOC( BMSallocBlockMemory(blkmem, sol) );
    SCIP_CALL( SCIPrealarrayCreate(&(*sol)->vals, blkmem) );
    SCIP_CALL( SCIPboolarrayCreate(&(*sol)->valid, blkmem) );
+   (*sol)->sparseinds = NULL;
+   (*sol)->sparsevals = NULL;
+   (*sol)->nsparsevals = 0;
 
    (*sol)->solorigin = SCIP_SOLORIGIN_ZERO;
    (*sol)->obj = 0.0;
@@ -331,6 +414,9 @@ SCIP_RETCODE SCIPsolCreateOriginal(
    SCIP_ALLOC( BMSallocBlockMemory(blkmem, sol) );
    SCIP_CALL( SCIPrealarrayCreate(&(*sol)->vals, blkmem) );
    SCIP_CALL( SCIPboolarrayCreate(&(*sol)->valid, blkmem) );
+   (*sol)->sparseinds = NULL;
+   (*sol)->sparsevals = NULL;
+   (*sol)->nsparsevals = 0;
    (*sol)->solorigin = SCIP_SOLORIGIN_ORIGINAL;
    (*sol)->obj = origprob->objoffset;
    (*sol)->primalindex = -1;
@@ -363,8 +449,29 @@ SCIP_RETCODE SCIPsolCopy(
    assert(sourcesol != NULL);
 
    SCIP_ALLOC( BMSallocBlockMemory(blkmem, sol) );
-   SCIP_CALL( SCIPrealarrayCopy(&(*sol)->vals, blkmem, sourcesol->vals) );
-   SCIP_CALL( SCIPboolarrayCopy(&(*sol)->valid, blkmem, sourcesol->valid) );
+   if( sourcesol->vals != NULL )
+   {
+      SCIP_CALL( SCIPrealarrayCopy(&(*sol)->vals, blkmem, sourcesol->vals) );
+      SCIP_CALL( SCIPboolarrayCopy(&(*sol)->valid, blkmem, sourcesol->valid) );
+      (*sol)->sparseinds = NULL;
+      (*sol)->sparsevals = NULL;
+   }
+   else if( sourcesol->nsparsevals > 0 )
+   {
+      (*sol)->vals = NULL;
+      (*sol)->valid = NULL;
+      SCIP_ALLOC( BMSduplicateBlockMemoryArray(blkmem, &(*sol)->sparseinds, sourcesol->sparseinds, sourcesol->nsparsevals) );
+      SCIP_ALLOC( BMSduplicateBlockMemoryArray(blkmem, &(*sol)->sparsevals, sourcesol->sparsevals, sourcesol->nsparsevals) );
+   }
+   else
+   {
+      /* a compressed solution without nonzero values has no sparse arrays */
+      (*sol)->vals = NULL;
+      (*sol)->valid = NULL;
+      (*sol)->sparseinds = NULL;
+      (*sol)->sparsevals = NULL;
+   }
+   (*sol)->nsparsevals = sourcesol->nsparsevals;
 
    /* copy solution type and creator information */
    switch( sourcesol->type )
@@ -424,6 +531,9 @@ SCIP_RETCODE SCIPsolTransform(
 {  /*lint --e{715}*/
    SCIP_REALARRAY* tmpvals;
    SCIP_BOOLARRAY* tmpvalid;
+   int* tmpsparseinds;
+   SCIP_Real* tmpsparsevals;
+   int tmpnsparsevals;
    SCIP_SOL* tsol;
 
    assert(sol != NULL);
@@ -442,10 +552,19 @@ SCIP_RETCODE SCIPsolTransform(
     */
    tmpvals = sol->vals;
    tmpvalid = sol->valid;
+   tmpsparseinds = sol->sparseinds;
+   tmpsparsevals = sol->sparsevals;
+   tmpnsparsevals = sol->nsparsevals;
    sol->vals = tsol->vals;
    sol->valid = tsol->valid;
+   sol->sparseinds = tsol->sparseinds;
+   sol->sparsevals = tsol->sparsevals;
+   sol->nsparsevals = tsol->nsparsevals;
    tsol->vals = tmpvals;
    tsol->valid = tmpvalid;
+   tsol->sparseinds = tmpsparseinds;
+   tsol->sparsevals = tmpsparsevals;
+   tsol->nsparsevals = tmpnsparsevals;
 
    /* copy solorigin and objective (should be the same, only to avoid numerical issues);
     * we keep the other statistics of the original solution, since that was the first time that this solution as found
@@ -463,6 +582,7 @@ SCIP_RETCODE SCIPsolTransform(
  */
 SCIP_RETCODE SCIPsolAdjustImplicitSolVals(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_PROB*            prob,               /**< either original or transformed problem, depending on sol origin */
@@ -590,7 +710,7 @@ SCIP_RETCODE SCIPsolAdjustImplicitSolVals(
          assert(SCIPsetIsFeasGE(set, newsolval, SCIPvarGetLbGlobal(var)));
       }
 
-      SCIP_CALL( SCIPsolSetVal(sol, set, stat, tree, var, newsolval) );
+      SCIP_CALL( SCIPsolSetVal(sol, blkmem, set, stat, tree, var, newsolval) );
    }
 
    return SCIP_OKAY;
@@ -613,7 +733,7 @@ SCIP_RETCODE SCIPsolCreateLPSol(
    assert(SCIPlpIsSolved(lp));
 
    SCIP_CALL( SCIPsolCreate(sol, blkmem, set, stat, primal, tree, heur) );
-   SCIP_CALL( SCIPsolLinkLPSol(*sol, set, stat, prob, tree, lp) );
+   SCIP_CALL( SCIPsolLinkLPSol(*sol, blkmem, set, stat, prob, tree, lp) );
 
    return SCIP_OKAY;
 }
@@ -634,7 +754,7 @@ SCIP_RETCODE SCIPsolCreateNLPSol(
    assert(nlp != NULL);
 
    SCIP_CALL( SCIPsolCreate(sol, blkmem, set, stat, primal, tree, heur) );
-   SCIP_CALL( SCIPsolLinkNLPSol(*sol, stat, tree, nlp) );
+   SCIP_CALL( SCIPsolLinkNLPSol(*sol, blkmem, stat, tree, nlp) );
 
    return SCIP_OKAY;
 }
@@ -656,7 +776,7 @@ SCIP_RETCODE SCIPsolCreateRelaxSol(
    assert(SCIPrelaxationIsSolValid(relaxation));
 
    SCIP_CALL( SCIPsolCreate(sol, blkmem, set, stat, primal, tree, heur) );
-   SCIP_CALL( SCIPsolLinkRelaxSol(*sol, set, stat, tree, relaxation) );
+   SCIP_CALL( SCIPsolLinkRelaxSol(*sol, blkmem, set, stat, tree, relaxation) );
 
    /* update solution type and store relaxator as creator only if no heuristic is specified as creator */
    if( heur == NULL )
@@ -681,7 +801,7 @@ SCIP_RETCODE SCIPsolCreatePseudoSol(
    assert(sol != NULL);
 
    SCIP_CALL( SCIPsolCreate(sol, blkmem, set, stat, primal, tree, heur) );
-   SCIP_CALL( SCIPsolLinkPseudoSol(*sol, set, stat, prob, tree, lp) );
+   SCIP_CALL( SCIPsolLinkPseudoSol(*sol, blkmem, set, stat, prob, tree, lp) );
 
    /* update solution type to pseudo solution */
    if( heur == NULL )
@@ -736,6 +856,9 @@ SCIP_RETCODE SCIPsolCreatePartial(
    SCIP_ALLOC( BMSallocBlockMemory(blkmem, sol) );
    SCIP_CALL( SCIPrealarrayCreate(&(*sol)->vals, blkmem) );
    SCIP_CALL( SCIPboolarrayCreate(&(*sol)->valid, blkmem) );
+   (*sol)->sparseinds = NULL;
+   (*sol)->sparsevals = NULL;
+   (*sol)->nsparsevals = 0;
    (*sol)->solorigin = SCIP_SOLORIGIN_PARTIAL;
    (*sol)->obj = SCIP_UNKNOWN;
    (*sol)->primalindex = -1;
@@ -771,6 +894,9 @@ SCIP_RETCODE SCIPsolCreateUnknown(
    SCIP_ALLOC( BMSallocBlockMemory(blkmem, sol) );
    SCIP_CALL( SCIPrealarrayCreate(&(*sol)->vals, blkmem) );
    SCIP_CALL( SCIPboolarrayCreate(&(*sol)->valid, blkmem) );
+   (*sol)->sparseinds = NULL;
+   (*sol)->sparsevals = NULL;
+   (*sol)->nsparsevals = 0;
    (*sol)->solorigin = SCIP_SOLORIGIN_UNKNOWN;
    (*sol)->obj = 0.0;
    (*sol)->primalindex = -1;
@@ -800,16 +926,90 @@ SCIP_RETCODE SCIPsolFree(
 
    SCIPprimalSolFreed(primal, *sol);
 
-   SCIP_CALL( SCIPrealarrayFree(&(*sol)->vals) );
-   SCIP_CALL( SCIPboolarrayFree(&(*sol)->valid) );
+   if( (*sol)->vals != NULL )
+   {
+      SCIP_CALL( SCIPrealarrayFree(&(*sol)->vals) );
+      SCIP_CALL( SCIPboolarrayFree(&(*sol)->valid) );
+   }
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*sol)->sparsevals, (*sol)->nsparsevals);
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*sol)->sparseinds, (*sol)->nsparsevals);
    BMSfreeBlockMemory(blkmem, sol);
 
    return SCIP_OKAY;
 }
 
+/** replaces the dense value arrays of an unlinked solution by a sorted list of its nonzero values, if this saves
+ *  memory; the dense arrays are recreated as soon as a value of the solution is changed
+ */
+SCIP_RETCODE SCIPsolCompress(
+   SCIP_SOL*             sol,                /**< primal CIP solution with origin ZERO or ORIGINAL */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   SCIP_Real val;
+   int minidx;
+   int maxidx;
+   int nnonzeros;
+   int idx;
+   int i;
+
+   assert(sol != NULL);
+   assert(blkmem != NULL);
+   assert(set != NULL);
+
+   /* only solutions that do not depend on the current LP, NLP, relaxation or pseudo solution can be compressed */
+   if( sol->vals == NULL || (sol->solorigin != SCIP_SOLORIGIN_ZERO && sol->solorigin != SCIP_SOLORIGIN_ORIGINAL) )
+      return SCIP_OKAY;
+
+   minidx = MAX(SCIPrealarrayGetMinIdx(sol->vals), SCIPboolarrayGetMinIdx(sol->valid));
+   maxidx = MIN(SCIPrealarrayGetMaxIdx(sol->vals), SCIPboolarrayGetMaxIdx(sol->valid));
+
+   nnonzeros = 0;
+   for( idx = minidx; idx <= maxidx; ++idx )
+   {
+      if( SCIPboolarrayGetVal(sol->valid, idx) && SCIPrealarrayGetVal(sol->vals, idx) != 0.0 ) /*lint !e777*/
+         ++nnonzeros;
+   }
+
+   /* keep the dense arrays if the sparse representation is not smaller */
+   if( nnonzeros > 0 && (sizeof(int) + sizeof(SCIP_Real)) * (size_t)nnonzeros
+      >= (sizeof(SCIP_Real) + sizeof(SCIP_Bool)) * (size_t)(maxidx - minidx + 1) )
+      return SCIP_OKAY;
+
+   if( nnonzeros > 0 )
+   {
+      SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &sol->sparseinds, nnonzeros) );
+      SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &sol->sparsevals, nnonzeros) );
+
+      i = 0;
+      for( idx = minidx; idx <= maxidx; ++idx )
+      {
+         if( !SCIPboolarrayGetVal(sol->valid, idx) )
+            continue;
+
+         val = SCIPrealarrayGetVal(sol->vals, idx);
+         if( val != 0.0 ) /*lint !e777*/
+         {
+            sol->sparseinds[i] = idx;
+            sol->sparsevals[i] = val;
+            ++i;
+         }
+      }
+      assert(i == nnonzeros);
+   }
+   sol->nsparsevals = nnonzeros;
+
+   SCIP_CALL( SCIPrealarrayFree(&sol->vals) );
+   SCIP_CALL( SCIPboolarrayFree(&sol->valid) );
+
+   return SCIP_OKAY;
+}
+
 /** copies current LP solution into CIP solution by linking */
 SCIP_RETCODE SCIPsolLinkLPSol(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_PROB*            prob,               /**< transformed problem data */
@@ -827,7 +1027,7 @@ SCIP_RETCODE SCIPsolLinkLPSol(
    SCIPsetDebugMsg(set, "linking solution to LP\n");
 
    /* clear the old solution arrays */
-   SCIP_CALL( solClearArrays(sol) );
+   SCIP_CALL( solClearArrays(sol, blkmem) );
 
    /* link solution to LP solution */
    if( SCIPlpDivingObjChanged(lp) )
@@ -868,6 +1068,7 @@ SCIP_RETCODE SCIPsolLinkLPSol(
 /** copies current NLP solution into CIP solution by linking */
 SCIP_RETCODE SCIPsolLinkNLPSol(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_TREE*            tree,               /**< branch and bound tree */
    SCIP_NLP*             nlp                 /**< current NLP data */
@@ -882,7 +1083,7 @@ SCIP_RETCODE SCIPsolLinkNLPSol(
    SCIPstatDebugMsg(stat, "linking solution to NLP\n");
 
    /* clear the old solution arrays */
-   SCIP_CALL( solClearArrays(sol) );
+   SCIP_CALL( solClearArrays(sol, blkmem) );
 
    /* get objective value of NLP solution */
    if( SCIPnlpIsDivingObjChanged(nlp) )
@@ -919,6 +1120,7 @@ SCIP_RETCODE SCIPsolLinkNLPSol(
 /** copies current relaxation solution into CIP solution by linking */
 SCIP_RETCODE SCIPsolLinkRelaxSol(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_TREE*            tree,               /**< branch and bound tree */
@@ -934,7 +1136,7 @@ SCIP_RETCODE SCIPsolLinkRelaxSol(
    SCIPsetDebugMsg(set, "linking solution to relaxation\n");
 
    /* clear the old solution arrays */
-   SCIP_CALL( solClearArrays(sol) );
+   SCIP_CALL( solClearArrays(sol, blkmem) );
 
    /* the objective value in the columns is correct, s.t. the LP's objective value is also correct */
    sol->obj = SCIPrelaxationGetSolObj(relaxation);
@@ -949,6 +1151,7 @@ SCIP_RETCODE SCIPsolLinkRelaxSol(
 /** copies current pseudo solution into CIP solution by linking */
 SCIP_RETCODE SCIPsolLinkPseudoSol(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_PROB*            prob,               /**< transformed problem data */
@@ -963,7 +1166,7 @@ SCIP_RETCODE SCIPsolLinkPseudoSol(
    SCIPsetDebugMsg(set, "linking solution to pseudo solution\n");
 
    /* clear the old solution arrays */
-   SCIP_CALL( solClearArrays(sol) );
+   SCIP_CALL( solClearArrays(sol, blkmem) );
 
    /* link solution to pseudo solution */
    sol->obj = SCIPlpGetPseudoObjval(lp, set, prob);
@@ -978,6 +1181,7 @@ SCIP_RETCODE SCIPsolLinkPseudoSol(
 /** copies current solution (LP or pseudo solution) into CIP solution by linking */
 SCIP_RETCODE SCIPsolLinkCurrentSol(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_PROB*            prob,               /**< transformed problem data */
@@ -991,11 +1195,11 @@ SCIP_RETCODE SCIPsolLinkCurrentSol(
 
    if( SCIPtreeHasCurrentNodeLP(tree) && SCIPlpIsSolved(lp) )
    {
-      SCIP_CALL( SCIPsolLinkLPSol(sol, set, stat, prob, tree, lp) );
+      SCIP_CALL( SCIPsolLinkLPSol(sol, blkmem, set, stat, prob, tree, lp) );
    }
    else
    {
-      SCIP_CALL( SCIPsolLinkPseudoSol(sol, set, stat, prob, tree, lp) );
+      SCIP_CALL( SCIPsolLinkPseudoSol(sol, blkmem, set, stat, prob, tree, lp) );
    }
 
    return SCIP_OKAY;
@@ -1004,13 +1208,14 @@ SCIP_RETCODE SCIPsolLinkCurrentSol(
 /** clears primal CIP solution */
 SCIP_RETCODE SCIPsolClear(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_TREE*            tree                /**< branch and bound tree */
    )
 {
    assert(sol != NULL);
 
-   SCIP_CALL( solClearArrays(sol) );
+   SCIP_CALL( solClearArrays(sol, blkmem) );
    sol->solorigin = SCIP_SOLORIGIN_ZERO;
    sol->obj = 0.0;
    solStamp(sol, stat, tree, TRUE);
@@ -1021,13 +1226,14 @@ SCIP_RETCODE SCIPsolClear(
 /** declares all entries in the primal CIP solution to be unknown */
 SCIP_RETCODE SCIPsolSetUnknown(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_TREE*            tree                /**< branch and bound tree */
    )
 {
    assert(sol != NULL);
 
-   SCIP_CALL( solClearArrays(sol) );
+   SCIP_CALL( solClearArrays(sol, blkmem) );
    sol->solorigin = SCIP_SOLORIGIN_UNKNOWN;
    sol->obj = 0.0;
    solStamp(sol, stat, tree, TRUE);
@@ -1038,6 +1244,7 @@ SCIP_RETCODE SCIPsolSetUnknown(
 /** stores solution values of variables in solution's own array */
 SCIP_RETCODE SCIPsolUnlink(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_PROB*            prob                /**< transformed problem data */
    )
@@ -1055,7 +1262,7 @@ SCIP_RETCODE SCIPsolUnlink(
 
       for( v = 0; v < prob->nvars; ++v )
       {
-         SCIP_CALL( solUnlinkVar(sol, set, prob->vars[v]) );
+         SCIP_CALL( solUnlinkVar(sol, blkmem, set, prob->vars[v]) );
       }
 
       sol->solorigin = SCIP_SOLORIGIN_ZERO;
@@ -1067,6 +1274,7 @@ SCIP_RETCODE SCIPsolUnlink(
 /** sets value of variable in primal CIP solution */
 SCIP_RETCODE SCIPsolSetVal(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_TREE*            tree,               /**< branch and bound tree, or NULL */
@@ -1101,7 +1309,7 @@ SCIP_RETCODE SCIPsolSetVal(
             SCIP_Real obj;
             SCIP_Real objcont;
 
-            SCIP_CALL( solSetArrayVal(sol, set, var, val) );
+            SCIP_CALL( solSetArrayVal(sol, blkmem, set, var, val) );
 
             /* update the objective value; we do not need to do this for partial solutions */
             if( !SCIPsolIsPartial(sol) )
@@ -1139,7 +1347,7 @@ SCIP_RETCODE SCIPsolSetVal(
          return SCIP_OKAY;
       }
       else
-         return SCIPsolSetVal(sol, set, stat, tree, SCIPvarGetTransVar(var), val);
+         return SCIPsolSetVal(sol, blkmem, set, stat, tree, SCIPvarGetTransVar(var), val);
 
    case SCIP_VARSTATUS_LOOSE:
    case SCIP_VARSTATUS_COLUMN:
@@ -1152,7 +1360,7 @@ SCIP_RETCODE SCIPsolSetVal(
          SCIP_Real obj;
          SCIP_Real objcont;
 
-         SCIP_CALL( solSetArrayVal(sol, set, var, val) );
+         SCIP_CALL( solSetArrayVal(sol, blkmem, set, var, val) );
 
          /* update objective: an unknown solution value does not count towards the objective */
          obj = SCIPvarGetUnchangedObj(var);
@@ -1203,11 +1411,11 @@ SCIP_RETCODE SCIPsolSetVal(
       assert(!SCIPsetIsInfinity(set, SCIPvarGetAggrScalar(var)) && !SCIPsetIsInfinity(set, -SCIPvarGetAggrScalar(var)));
 
       if( val == SCIP_UNKNOWN )/*lint !e777*/
-         return SCIPsolSetVal(sol, set, stat, tree, SCIPvarGetAggrVar(var), val);
+         return SCIPsolSetVal(sol, blkmem, set, stat, tree, SCIPvarGetAggrVar(var), val);
       if( SCIPsetIsInfinity(set, val) || SCIPsetIsInfinity(set, -val) )
-         return SCIPsolSetVal(sol, set, stat, tree, SCIPvarGetAggrVar(var),  SCIPvarGetAggrScalar(var) > 0 ? val : -val);
+         return SCIPsolSetVal(sol, blkmem, set, stat, tree, SCIPvarGetAggrVar(var),  SCIPvarGetAggrScalar(var) > 0 ? val : -val);
       else
-         return SCIPsolSetVal(sol, set, stat, tree, SCIPvarGetAggrVar(var), (val - SCIPvarGetAggrConstant(var))/SCIPvarGetAggrScalar(var));
+         return SCIPsolSetVal(sol, blkmem, set, stat, tree, SCIPvarGetAggrVar(var), (val - SCIPvarGetAggrConstant(var))/SCIPvarGetAggrScalar(var));
 
    case SCIP_VARSTATUS_MULTAGGR:
       if ( SCIPvarGetMultaggrNVars(var) == 1 )
@@ -1234,9 +1442,11 @@ SCIP_RETCODE SCIPsolSetVal(
          else
          {
             if( SCIPsetIsInfinity(set, val) || SCIPsetIsInfinity(set, -val) )
-               return SCIPsolSetVal(sol, set, stat, tree, multaggrvars[0],  multaggrscalars[0] > 0 ? val : -val);
+               return SCIPsolSetVal(sol, blkmem, set, stat, tree, multaggrvars[0],
+                      multaggrscalars[0] > 0 ? val : -val);
             else
-               return SCIPsolSetVal(sol, set, stat, tree, multaggrvars[0], (val - multaggrconstant)/multaggrscalars[0]);
+               return SCIPsolSetVal(sol, blkmem, set, stat, tree, multaggrvars[0],
+                     (val - multaggrconstant)/multaggrscalars[0]);
          }
       }
       SCIPerrorMessage("cannot set solution value for multiple aggregated variable\n");
@@ -1246,11 +1456,12 @@ SCIP_RETCODE SCIPsolSetVal(
       assert(!SCIPsetIsInfinity(set, SCIPvarGetNegationConstant(var)) && !SCIPsetIsInfinity(set, -SCIPvarGetNegationConstant(var)));
 
       if( val == SCIP_UNKNOWN )/*lint !e777*/
-         return SCIPsolSetVal(sol, set, stat, tree, SCIPvarGetNegationVar(var), val);
+         return SCIPsolSetVal(sol, blkmem, set, stat, tree, SCIPvarGetNegationVar(var), val);
       else if( SCIPsetIsInfinity(set, val) || SCIPsetIsInfinity(set, -val) )
-         return SCIPsolSetVal(sol, set, stat, tree, SCIPvarGetNegationVar(var), -val);
+         return SCIPsolSetVal(sol, blkmem, set, stat, tree, SCIPvarGetNegationVar(var), -val);
       else
-         return SCIPsolSetVal(sol, set, stat, tree, SCIPvarGetNegationVar(var), SCIPvarGetNegationConstant(var) - val);
+         return SCIPsolSetVal(sol, blkmem, set, stat, tree, SCIPvarGetNegationVar(var),
+               SCIPvarGetNegationConstant(var) - val);
 
    default:
       SCIPerrorMessage("unknown variable status\n");
@@ -1261,6 +1472,7 @@ SCIP_RETCODE SCIPsolSetVal(
 /** increases value of variable in primal CIP solution */
 SCIP_RETCODE SCIPsolIncVal(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_TREE*            tree,               /**< branch and bound tree */
@@ -1297,18 +1509,18 @@ SCIP_RETCODE SCIPsolIncVal(
    case SCIP_VARSTATUS_ORIGINAL:
       if( SCIPsolIsOriginal(sol) )
       {
-         SCIP_CALL( solIncArrayVal(sol, set, var, incval) );
+         SCIP_CALL( solIncArrayVal(sol, blkmem, set, var, incval) );
          sol->obj += SCIPvarGetUnchangedObj(var) * incval;
          solStamp(sol, stat, tree, FALSE);
          return SCIP_OKAY;
       }
       else
-         return SCIPsolIncVal(sol, set, stat, tree, SCIPvarGetTransVar(var), incval);
+         return SCIPsolIncVal(sol, blkmem, set, stat, tree, SCIPvarGetTransVar(var), incval);
 
    case SCIP_VARSTATUS_LOOSE:
    case SCIP_VARSTATUS_COLUMN:
       assert(!SCIPsolIsOriginal(sol));
-      SCIP_CALL( solIncArrayVal(sol, set, var, incval) );
+      SCIP_CALL( solIncArrayVal(sol, blkmem, set, var, incval) );
       sol->obj += SCIPvarGetUnchangedObj(var) * incval;
       solStamp(sol, stat, tree, FALSE);
       return SCIP_OKAY;
@@ -1319,14 +1531,14 @@ SCIP_RETCODE SCIPsolIncVal(
 
    case SCIP_VARSTATUS_AGGREGATED: /* x = a*y + c  =>  y = (x-c)/a */
       assert(!SCIPsetIsZero(set, SCIPvarGetAggrScalar(var)));
-      return SCIPsolIncVal(sol, set, stat, tree, SCIPvarGetAggrVar(var), incval/SCIPvarGetAggrScalar(var));
+      return SCIPsolIncVal(sol, blkmem, set, stat, tree, SCIPvarGetAggrVar(var), incval/SCIPvarGetAggrScalar(var));
 
    case SCIP_VARSTATUS_MULTAGGR:
       SCIPerrorMessage("cannot increase solution value for multiple aggregated variable\n");
       return SCIP_INVALIDDATA;
 
    case SCIP_VARSTATUS_NEGATED:
-      return SCIPsolIncVal(sol, set, stat, tree, SCIPvarGetNegationVar(var), -incval);
+      return SCIPsolIncVal(sol, blkmem, set, stat, tree, SCIPvarGetNegationVar(var), -incval);
 
    default:
       SCIPerrorMessage("unknown variable status\n");
@@ -1572,6 +1784,7 @@ void SCIPsolUpdateVarObj(
 /* mark the given solution as partial solution */
 SCIP_RETCODE SCIPsolMarkPartial(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< problem statistics */
    SCIP_VAR**            vars,               /**< problem variables */
@@ -1597,6 +1810,8 @@ SCIP_RETCODE SCIPsolMarkPartial(
       vals[v] = SCIPsolGetVal(sol, set, stat, vars[v]);
    }
 
+   SCIP_CALL( SCIPsolDecompress(sol, blkmem, set) );
+
    /* change origin to partial */
    sol->solorigin = SCIP_SOLORIGIN_PARTIAL;
 
@@ -1758,6 +1973,7 @@ SCIP_RETCODE SCIPsolCheck(
 /** try to round given solution */
 SCIP_RETCODE SCIPsolRound(
    SCIP_SOL*             sol,                /**< primal solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_PROB*            prob,               /**< transformed problem data */
@@ -1818,7 +2034,7 @@ SCIP_RETCODE SCIPsolRound(
          break;
 
       /* store new solution value */
-      SCIP_CALL( SCIPsolSetVal(sol, set, stat, tree, var, solval) );
+      SCIP_CALL( SCIPsolSetVal(sol, blkmem, set, stat, tree, var, solval) );
    }
 
    /* check, if rounding was successful */
@@ -1858,6 +2074,7 @@ void SCIPsolUpdateVarsum(
 /** retransforms solution to original problem space */
 SCIP_RETCODE SCIPsolRetransform(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_PROB*            origprob,           /**< original problem */
@@ -1952,7 +2169,7 @@ SCIP_RETCODE SCIPsolRetransform(
    }
 
    /* clear the solution and convert it into original space */
-   SCIP_CALL( solClearArrays(sol) );
+   SCIP_CALL( solClearArrays(sol, blkmem) );
    sol->solorigin = SCIP_SOLORIGIN_ORIGINAL;
    sol->obj = origprob->objoffset;
 
@@ -1963,7 +2180,7 @@ SCIP_RETCODE SCIPsolRetransform(
 
       if( !SCIPsetIsZero(set, solvals[v]) )
       {
-         SCIP_CALL( solSetArrayVal(sol, set, vars[v], solvals[v]) );
+         SCIP_CALL( solSetArrayVal(sol, blkmem, set, vars[v], solvals[v]) );
          if( solvals[v] != SCIP_UNKNOWN ) /*lint !e777*/
             sol->obj += SCIPvarGetUnchangedObj(vars[v]) * solvals[v];
       }
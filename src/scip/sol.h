@@ -95,6 +95,7 @@ SCIP_RETCODE SCIPsolTransform(
  */
 SCIP_RETCODE SCIPsolAdjustImplicitSolVals(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_PROB*            prob,               /**< either original or transformed problem, depending on sol origin */
@@ -193,9 +194,28 @@ SCIP_RETCODE SCIPsolFree(
    SCIP_PRIMAL*          primal              /**< primal data */
    );
 
+/** replaces the dense value arrays of an unlinked solution by a sorted list of its nonzero values, if this saves
+ *  memory; the dense arrays are recreated as soon as a value of the solution is changed
+ */
+SCIP_RETCODE SCIPsolCompress(
+   SCIP_SOL*             sol,                /**< primal CIP solution with origin ZERO or ORIGINAL */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   );
+
+/** recreates the dense solution arrays of a compressed primal CIP solution; does nothing if the solution is not
+ *  compressed
+ */
+SCIP_RETCODE SCIPsolDecompress(
+   SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   );
+
 /** copies current LP solution into CIP solution by linking */
 SCIP_RETCODE SCIPsolLinkLPSol(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_PROB*            prob,               /**< transformed problem data */
@@ -206,6 +226,7 @@ SCIP_RETCODE SCIPsolLinkLPSol(
 /** copies current NLP solution into CIP solution by linking */
 SCIP_RETCODE SCIPsolLinkNLPSol(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_TREE*            tree,               /**< branch and bound tree */
    SCIP_NLP*             nlp                 /**< current NLP data */
@@ -214,6 +235,7 @@ SCIP_RETCODE SCIPsolLinkNLPSol(
 /** copies current relaxation solution into CIP solution by linking */
 SCIP_RETCODE SCIPsolLinkRelaxSol(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_TREE*            tree,               /**< branch and bound tree */
@@ -223,6 +245,7 @@ SCIP_RETCODE SCIPsolLinkRelaxSol(
 /** copies current pseudo solution into CIP solution by linking */
 SCIP_RETCODE SCIPsolLinkPseudoSol(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_PROB*            prob,               /**< transformed problem data */
@@ -233,6 +256,7 @@ SCIP_RETCODE SCIPsolLinkPseudoSol(
 /** copies current solution (LP or pseudo solution) into CIP solution by linking */
 SCIP_RETCODE SCIPsolLinkCurrentSol(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_PROB*            prob,               /**< transformed problem data */
@@ -243,6 +267,7 @@ SCIP_RETCODE SCIPsolLinkCurrentSol(
 /** clears primal CIP solution */
 SCIP_RETCODE SCIPsolClear(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_TREE*            tree                /**< branch and bound tree */
    );
@@ -250,6 +275,7 @@ SCIP_RETCODE SCIPsolClear(
 /** declares all entries in the primal CIP solution to be unknown */
 SCIP_RETCODE SCIPsolSetUnknown(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_TREE*            tree                /**< branch and bound tree */
    );
@@ -257,6 +283,7 @@ SCIP_RETCODE SCIPsolSetUnknown(
 /** stores solution values of variables in solution's own array */
 SCIP_RETCODE SCIPsolUnlink(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_PROB*            prob                /**< transformed problem data */
    );
@@ -264,6 +291,7 @@ SCIP_RETCODE SCIPsolUnlink(
 /** sets value of variable in primal CIP solution */
 SCIP_RETCODE SCIPsolSetVal(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_TREE*            tree,               /**< branch and bound tree */
@@ -274,6 +302,7 @@ SCIP_RETCODE SCIPsolSetVal(
 /** increases value of variable in primal CIP solution */
 SCIP_RETCODE SCIPsolIncVal(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_TREE*            tree,               /**< branch and bound tree */
@@ -317,6 +346,7 @@ void SCIPsolUpdateVarObj(
 /* mark the given solution as partial solution */
 SCIP_RETCODE SCIPsolMarkPartial(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< problem statistics */
    SCIP_VAR**            vars,               /**< problem variables */
@@ -347,6 +377,7 @@ SCIP_RETCODE SCIPsolCheck(
 /** try to round given solution */
 SCIP_RETCODE SCIPsolRound(
    SCIP_SOL*             sol,                /**< primal solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_PROB*            prob,               /**< transformed problem data */
@@ -366,6 +397,7 @@ void SCIPsolUpdateVarsum(
 /** retransforms solution to original problem space */
 SCIP_RETCODE SCIPsolRetransform(
    SCIP_SOL*             sol,                /**< primal CIP solution */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_PROB*            origprob,           /**< original problem */
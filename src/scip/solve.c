@@ -252,6 +252,17 @@ SCIP_RETCODE SCIPprimalHeuristics(
    if( SCIPsolveIsStopped(set, stat, FALSE) )
       return SCIP_OKAY;
 
+   oldnbestsolsfound = primal->nbestsolsfound;
+
+   /* pass the solutions of asynchronous heuristics whose jobs finished in the meantime to SCIP */
+   for( h = 0; h < set->nheurs; ++h )
+   {
+      if( SCIPheurIsAsyncJobFinished(set->heurs[h]) )
+      {
+         SCIP_CALL( SCIPheurCollectAsync(set->heurs[h], set, primal, FALSE) );
+      }
+   }
+
    /* sort heuristics by priority, but move the delayed heuristics to the front */
    SCIPsetSortHeurs(set);
 
@@ -307,7 +318,6 @@ SCIP_RETCODE SCIPprimalHeuristics(
 
    /* call heuristics */
    ndelayedheurs = 0;
-   oldnbestsolsfound = primal->nbestsolsfound;
 
 #ifndef NDEBUG
    /* remember old probing and diving status */
@@ -1411,7 +1421,7 @@ SCIP_RETCODE updatePrimalRay(
       /* set values of all active variable in the solution that represents the primal ray */
       for( i = 0; i < nvars; i++ )
       {
-         SCIP_CALL( SCIPsolSetVal(primal->primalray, set, stat, tree, vars[i], ray[i]) );
+         SCIP_CALL( SCIPsolSetVal(primal->primalray, blkmem, set, stat, tree, vars[i], ray[i]) );
       }
 
       SCIPdebug( SCIP_CALL( SCIPprintRay(set->scip, primal->primalray, NULL, FALSE) ) );
@@ -75,6 +75,7 @@ SCIP_RETCODE SCIPstatCreate(
    SCIP_CALL( SCIPclockCreate(&(*stat)->sbsoltime, SCIP_CLOCKTYPE_DEFAULT) );
    SCIP_CALL( SCIPclockCreate(&(*stat)->nodeactivationtime, SCIP_CLOCKTYPE_DEFAULT) );
    SCIP_CALL( SCIPclockCreate(&(*stat)->nlpsoltime, SCIP_CLOCKTYPE_DEFAULT) );
+   SCIP_CALL( SCIPclockCreate(&(*stat)->divingnlpsoltime, SCIP_CLOCKTYPE_DEFAULT) );
    SCIP_CALL( SCIPclockCreate(&(*stat)->copyclock, SCIP_CLOCKTYPE_DEFAULT) );
    SCIP_CALL( SCIPclockCreate(&(*stat)->strongpropclock, SCIP_CLOCKTYPE_DEFAULT) );
    SCIP_CALL( SCIPclockCreate(&(*stat)->reoptupdatetime, SCIP_CLOCKTYPE_DEFAULT) );
@@ -128,6 +129,7 @@ SCIP_RETCODE SCIPstatFree(
    SCIPclockFree(&(*stat)->sbsoltime);
    SCIPclockFree(&(*stat)->nodeactivationtime);
    SCIPclockFree(&(*stat)->nlpsoltime);
+   SCIPclockFree(&(*stat)->divingnlpsoltime);
    SCIPclockFree(&(*stat)->copyclock);
    SCIPclockFree(&(*stat)->strongpropclock);
    SCIPclockFree(&(*stat)->reoptupdatetime);
@@ -204,6 +206,7 @@ void SCIPstatReset(
    SCIPclockReset(stat->sbsoltime);
    SCIPclockReset(stat->nodeactivationtime);
    SCIPclockReset(stat->nlpsoltime);
+   SCIPclockReset(stat->divingnlpsoltime);
    SCIPclockReset(stat->copyclock);
    SCIPclockReset(stat->strongpropclock);
 
@@ -287,6 +290,9 @@ void SCIPstatReset(
    stat->nrootstrongbranchs = 0;
    stat->nconflictlps = 0;
    stat->nnlps = 0;
+   stat->nnlpiterations = 0;
+   stat->ndivingnlps = 0;
+   stat->ndivingnlpiterations = 0;
    stat->maxtotaldepth = -1;
    stat->nactiveconss = 0;
    stat->nenabledconss = 0;
@@ -755,6 +761,7 @@ void SCIPstatEnableOrDisableStatClocks(
    SCIPclockEnableOrDisable(stat->sbsoltime, enable);
    SCIPclockEnableOrDisable(stat->nodeactivationtime, enable);
    SCIPclockEnableOrDisable(stat->nlpsoltime, enable);
+   SCIPclockEnableOrDisable(stat->divingnlpsoltime, enable);
    SCIPclockEnableOrDisable(stat->copyclock, enable);
    SCIPclockEnableOrDisable(stat->strongpropclock, enable);
 }
@@ -27,6 +27,7 @@
 
 #include "scip/def.h"
 #include "scip/type_clock.h"
+#include "lpi/type_lpi.h"
 #include "scip/type_benders.h"
 #include "scip/type_benderscut.h"
 
@@ -72,6 +73,7 @@ struct SCIP_Benders
    int                   ncalls;             /**< number of times, this Benders' decomposition was called */
    int                   ncutsfound;         /**< number of cuts found by the Benders' decomposition */
    int                   ntransferred;       /**< number of cuts transferred from sub SCIP to the master SCIP */
+   int                   nduplicatecuts;     /**< number of generated cuts discarded as duplicates within one call */
    SCIP_Bool             active;             /**< is the Benders' decomposition active? */
    SCIP_Bool             initialized;        /**< is Benders' decomposition initialized? */
    SCIP_Bool             cutlp;              /**< should Benders' cuts be generated for LP solutions? */
@@ -108,6 +110,9 @@ struct SCIP_Benders
    SCIP_VAR**            auxiliaryvars;      /**< the auxiliary variables for the Benders' optimality cuts */
    SCIP_PQUEUE*          subprobqueue;       /**< the priority queue for the subproblems */
    SCIP_SUBPROBLEMSOLVESTAT** solvestat;     /**< storing the solving statistics of all the subproblems */
+   SCIP_CLOCK**          subprobclocks;      /**< the time spent for solving each of the subproblems */
+   SCIP_LPISTATE**       subproblpistates;   /**< LP state of the last optimal LP solve of each subproblem, used for warm starts */
+   SCIP_LPINORMS**       subproblpinorms;    /**< LP pricing norms of the last optimal LP solve of each subproblem */
    SCIP_Real*            subprobobjval;      /**< the objective value of the subproblem in the current iteration */
    SCIP_Real*            bestsubprobobjval;  /**< the best objective value of the subproblem */
    SCIP_Real*            subproblowerbound;  /**< a lower bound on the subproblem - used for the integer cuts */
@@ -162,6 +167,14 @@ struct SCIP_Benders
    int                   storedcutssize;     /**< the size of the added cuts array */
    int                   nstoredcuts;        /**< the number of the added cuts */
 
+   /* cut deduplication information */
+   SCIP_HASHTABLE*       cuttable;           /**< hash table of the cuts generated in the current call */
+   SCIP_BENDERSCUTCUT**  callcuts;           /**< the cuts generated in the current call, sorted by variable index */
+   int                   callcutssize;       /**< the size of the call cuts array */
+   int                   ncallcuts;          /**< the number of cuts generated in the current call */
+   SCIP_Bool             cutdedup;           /**< should cuts that were already generated in the same call be discarded? */
+   SCIP_Bool             warmstartlp;        /**< should the LP basis of convex subproblems be reused in the next solve? */
+
 };
 
 /** statistics for solving the subproblems. Used for prioritising the solving of the subproblem */
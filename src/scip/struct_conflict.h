@@ -174,13 +174,23 @@ struct SCIP_Conflict
    SCIP_CONFLICTSET**    conflictsets;       /**< conflict sets found at the current node */
    SCIP_Real*            conflictsetscores;  /**< score values of the conflict sets found at the current node */
    SCIP_BDCHGINFO**      tmpbdchginfos;      /**< temporarily created bound change information data */
+   SCIP_BDCHGINFO**      trailbdchginfos;    /**< binary conflict candidates, indexed by their position on the trail */
+   uint64_t*             trailseen;          /**< bitset marking the trail positions that hold a binary conflict candidate */
+   int*                  trailstarts;        /**< trail position of the first bound change of each depth level of the path */
    int                   conflictsetssize;   /**< size of conflictsets array */
    int                   nconflictsets;      /**< number of available conflict sets (used slots in conflictsets array) */
    int                   proofsetssize;      /**< size of proofsets array */
    int                   nproofsets;         /**< number of available proof sets (used slots in proofsets array) */
    int                   tmpbdchginfossize;  /**< size of tmpbdchginfos array */
    int                   ntmpbdchginfos;     /**< number of temporary created bound change information data */
+   int                   trailsize;          /**< size of trailbdchginfos array (number of bits in trailseen) */
+   int                   trailstartssize;    /**< size of trailstarts array */
+   int                   ntraildepths;       /**< number of depth levels covered by the trail (0: trail is not used) */
+   int                   ntrailcands;        /**< number of binary conflict candidates currently marked on the trail */
+   int                   trailtop;           /**< upper bound on the largest marked trail position, or -1 */
    int                   count;              /**< conflict set counter to label binary conflict variables with */
+   int                   conflictsetlbd;     /**< literal block distance of the conflict set that is currently passed to the
+                                              *   conflict handlers, or -1 */
 };
 
 #ifdef __cplusplus
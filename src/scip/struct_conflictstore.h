@@ -42,6 +42,11 @@ struct SCIP_ConflictStore
    SCIP_CONS**           origconfs;          /**< array of original conflicts added in stage SCIP_STAGE_PROBLEM */
    SCIP_Real*            confprimalbnds;     /**< array of primal bounds valid at the time the corresponding bound exceeding
                                               *   conflict was found (-infinity if the conflict based on an infeasible LP) */
+   SCIP_Real*            conflastages;       /**< age of each conflict when it was last inspected during a clean-up */
+   int*                  conflbds;           /**< literal block distance (number of distinct depth levels of the bound
+                                              *   changes) of each conflict at the time it was added */
+   int*                  confnuses;          /**< number of clean-ups in which a conflict was seen to be useful since the last one */
+   int*                  confnvars;          /**< number of variables of each conflict (used to estimate its memory) */
    SCIP_Real*            dualprimalbnds;     /**< array of primal bounds valid at the time the corresponding dual proof
                                               *   based on a dual solution was found */
    SCIP_Real*            scalefactors;       /**< scaling factor that needs to be considered when updating the side */
@@ -54,6 +59,7 @@ struct SCIP_ConflictStore
    SCIP_Longint          ncleanups;          /**< number of storage cleanups */
    SCIP_Longint          nnzdualrays;        /**< number of non-zeros in all stored proofs based on dual rays */
    SCIP_Longint          nnzdualsols;        /**< number of non-zeros in all stored proofs based on dual solutions */
+   SCIP_Longint          storemem;           /**< estimated memory in bytes of all stored conflicts */
    int                   conflictsize;       /**< size of conflict array (bounded by conflict->maxpoolsize) */
    int                   origconflictsize;   /**< size of origconfs array */
    int                   nconflicts;         /**< number of stored conflicts */
@@ -28,6 +28,7 @@
 #include "scip/def.h"
 #include "scip/type_clock.h"
 #include "scip/type_heur.h"
+#include "tpi/type_tpi.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -84,6 +85,17 @@ struct SCIP_Diveset
    SCIP_DECL_DIVESETAVAILABLE((*divesetavailable)); /**< callback to check availability of dive set at the current stage, or NULL if always available */
 };
 
+/** snapshot of the problem variables that the job of an asynchronous primal heuristic refers to */
+struct SCIP_HeurSnapshot
+{
+   SCIP_VAR**            vars;               /**< captured problem variables at the time of the snapshot */
+   void*                 data;               /**< job data of the heuristic */
+   SCIP_HEUR*            heur;               /**< the heuristic that took the snapshot */
+   SCIP_LOCK             lock;               /**< lock to protect the interruption flag */
+   SCIP_Bool             interrupted;        /**< should the job stop as soon as possible? */
+   int                   nvars;              /**< number of variables */
+};
+
 /** primal heuristics data */
 struct SCIP_Heur
 {
@@ -99,7 +111,12 @@ struct SCIP_Heur
    SCIP_DECL_HEURINITSOL ((*heurinitsol));   /**< solving process initialization method of primal heuristic */
    SCIP_DECL_HEUREXITSOL ((*heurexitsol));   /**< solving process deinitialization method of primal heuristic */
    SCIP_DECL_HEUREXEC    ((*heurexec));      /**< execution method of primal heuristic */
+   SCIP_DECL_HEURASYNCPREPARE ((*heurasyncprepare)); /**< preparation method of asynchronous heuristic, or NULL */
+   SCIP_DECL_HEURASYNCEXEC ((*heurasyncexec)); /**< asynchronous execution method of heuristic, or NULL */
+   SCIP_DECL_HEURASYNCCOLLECT ((*heurasynccollect)); /**< collection method of asynchronous heuristic, or NULL */
    SCIP_HEURDATA*        heurdata;           /**< primal heuristics local data */
+   SCIP_HEURSNAPSHOT*    snapshot;           /**< snapshot of the running asynchronous job, or NULL */
+   SCIP_JOBBATCH*        jobbatch;           /**< running asynchronous job, or NULL */
    SCIP_DIVESET**        divesets;           /**< array of diving controllers of this heuristic */
    SCIP_CLOCK*           setuptime;          /**< time spend for setting up this heuristic for the next stages */
    SCIP_CLOCK*           heurclock;          /**< heuristic execution time */
@@ -111,6 +128,7 @@ struct SCIP_Heur
    int                   ndivesets;          /**< number of diving controllers of this heuristic */
    SCIP_HEURTIMING       timingmask;         /**< positions in the node solving loop where heuristic should be executed */
    SCIP_Bool             usessubscip;        /**< does the heuristic use a secondary SCIP instance? */
+   SCIP_Bool             async;              /**< should the heuristic run asynchronously on a thread of its own? */
    SCIP_Bool             initialized;        /**< is primal heuristic initialized? */
    char                  dispchar;           /**< display character of primal heuristic */
 };
@@ -91,7 +91,13 @@ struct SCIP_CliqueTable
    SCIP_HASHMAP*         varidxtable;        /**< mapping from binary variable to their corresponding node indices */
    SCIP_DISJOINTSET*     djset;              /**< disjoint set (union find) data structure to maintain component information */
    SCIP_CLIQUE**         cliques;            /**< cliques stored in the table */
+   int*                  csrlitbeg;          /**< frozen clique graph: start of each literal's cliques in csrlitcliques
+                                              *   (literal of variable x with value v is 2*probindex(x)+v) */
+   int*                  csrlitcliques;      /**< frozen clique graph: positions of the cliques containing each literal */
+   int*                  csrcliquebeg;       /**< frozen clique graph: start of each clique's literals in csrcliquelits */
+   int*                  csrcliquelits;      /**< frozen clique graph: literals of each clique */
    SCIP_Longint          nentries;           /**< number of entries in the whole clique table */
+   SCIP_Longint          csrnvarindexchgs;   /**< number of problem index changes when the frozen clique graph was built */
    int                   ncliques;           /**< number of cliques stored in the table */
    int                   size;               /**< size of cliques array */
    int                   ncreatedcliques;    /**< number of ever created cliques */
@@ -99,6 +105,9 @@ struct SCIP_CliqueTable
    int                   ncleanupaggrvars;   /**< number of aggregated variables when the last cleanup was performed */
    int                   ndirtycliques;      /**< number of cliques stored when the last cleanup was performed */
    int                   ncliquecomponents;  /**< number of connected components in clique graph */
+   int                   ncsrvars;           /**< number of problem variables covered by the frozen clique graph */
+   int                   ncsrcliques;        /**< number of cliques in the frozen clique graph */
+   SCIP_Bool             csrvalid;           /**< does the frozen clique graph reflect the current clique table? */
    SCIP_Bool             incleanup;          /**< is this clique table currently performing cleanup? */
    SCIP_Bool             compsfromscratch;   /**< must the connected components of the clique graph be recomputed from scratch? */
 };
@@ -25,6 +25,8 @@
 #define __SCIP_STRUCT_PRIMAL_H__
 
 
+#include <stdio.h>
+
 #include "scip/def.h"
 #include "scip/type_sol.h"
 #include "scip/type_primal.h"
@@ -51,6 +53,7 @@ struct SCIP_Primal
    SCIP_SOL*             currentsol;         /**< internal solution for temporarily storing the current solution */
    SCIP_SOL*             primalray;          /**< solution representing the primal ray for (infeasible or) unbounded problems;
                                               *   warning: this does not have to be a feasible solution */
+   FILE*                 solsink;            /**< file to which new incumbent solutions are appended, or NULL if not yet opened */
    int                   solssize;           /**< size of sols array */
    int                   partialsolssize;    /**< size of partialsols array */
    int                   nsols;              /**< number of primal CIP solutions stored in sols array */
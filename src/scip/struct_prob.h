@@ -43,6 +43,8 @@ struct SCIP_Prob
                                               *   extobj = objsense * objscale * (intobj + objoffset) */
    SCIP_Real             objlim;             /**< objective limit as external value (original problem space) */
    SCIP_Real             dualbound;          /**< dual bound as external value (original problem space) which is given or update during presolving */
+   SCIP_Longint          nvarindexchgs;      /**< number of changes of the variable array that may have moved variables to
+                                              *   other problem indices */
    char*                 name;               /**< problem name */
    SCIP_DECL_PROBCOPY    ((*probcopy));      /**< copies user data if you want to copy it to a subscip, or NULL */
    SCIP_DECL_PROBDELORIG ((*probdelorig));   /**< frees user data of original problem */
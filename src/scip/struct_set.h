@@ -198,6 +198,12 @@ struct SCIP_Set
    int                   conf_maxconss;      /**< maximal number of conflict constraints accepted at an infeasible node
                                               *   (-1: use all generated conflict constraints) */
    int                   conf_maxstoresize;  /**< maximal size of conflict store */
+   int                   conf_coretierlbd;   /**< maximal literal block distance of conflicts that are kept in the core tier
+                                              *   of the conflict store */
+   int                   conf_midtierlbd;    /**< maximal literal block distance of conflicts that are kept in the mid tier
+                                              *   of the conflict store */
+   SCIP_Real             conf_maxstoremem;   /**< maximal memory in MB used by the conflicts of the conflict store
+                                              *   (-1.0: no limit) */
    int                   conf_reconvlevels;  /**< number of depth levels up to which UIP reconvergence constraints are
                                               *   generated (-1: generate reconvergence constraints in all depth levels) */
    SCIP_Bool             conf_enable;        /**< should conflict analysis be enabled? */
@@ -214,6 +220,10 @@ struct SCIP_Set
    SCIP_Bool             conf_usepseudo;     /**< should pseudo solution conflict analysis be used? */
    SCIP_Bool             conf_prefinfproof;  /**< prefer infeasibility proof to boundexceeding proof */
    SCIP_Bool             conf_preferbinary;  /**< should binary conflicts be preferred? */
+   SCIP_Bool             conf_tieredstore;   /**< should the conflict store keep conflicts in tiers by their literal block
+                                              *   distance and usage? (FALSE: remove conflicts by age only) */
+   SCIP_Bool             conf_usetrail;      /**< should binary conflict candidates be kept on a timestamped trail instead
+                                              *   of the candidate priority queue? */
    SCIP_Bool             conf_allowlocal;    /**< should conflict constraints be generated that are only valid locally? */
    SCIP_Bool             conf_settlelocal;   /**< should conflict constraints be attached only to the local subtree where
                                               *   they can be useful? */
@@ -351,6 +361,7 @@ struct SCIP_Set
    /* NLP settings */
    SCIP_Bool             nlp_disable;        /**< should the NLP be disabled even if a constraint handler enabled it? */
    char*                 nlp_solver;         /**< name of NLP solver to use */
+   SCIP_Bool             nlp_warmstart;      /**< should the NLP solver be warm started from the last NLP solution if no initial guess is given? */
 
    /* memory settings */
    SCIP_Real             mem_savefac;        /**< fraction of maximal memory usage resulting in switch to memory saving mode */
@@ -388,6 +399,8 @@ struct SCIP_Set
                                               *   symresacks) */
    char*                 misc_debugsol;      /**< path to a debug solution */
    SCIP_Bool             misc_scaleobj;      /**< should the objective function be scaled? */
+   SCIP_Bool             misc_compresssols;  /**< should stored solutions other than the incumbent be kept in a compressed sparse format? */
+   char*                 misc_solsinkfile;   /**< file to which each new incumbent solution is appended ("-" for none) */
 
    /* randomization parameters */
    int                   random_randomseedshift;/**< global shift of all random seeds in the plugins, this will have no impact on the permutation and LP seeds */
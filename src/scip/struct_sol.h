@@ -60,6 +60,10 @@ struct SCIP_Viol
  *
  *  Solutions with origin ORIGINAL contain the values for original variables. The stored objective value also
  *  corresponds to the original problem.
+ *
+ *  Solutions with origin ZERO or ORIGINAL can be compressed by SCIPsolCompress(), which replaces the dense value
+ *  arrays by a sorted list of the nonzero values; in this case, vals and valid are NULL. The dense arrays are
+ *  recreated as soon as a value of the solution is changed.
  */
 struct SCIP_Sol
 {
@@ -69,6 +73,8 @@ struct SCIP_Sol
    SCIP_REALARRAY*       vals;               /**< solution values for variables */
    SCIP_BOOLARRAY*       valid;              /**< is value in vals array valid? otherwise it has to be retrieved from
                                               *   origin */
+   int*                  sparseinds;         /**< sorted indices of nonzero variables of a compressed solution, or NULL */
+   SCIP_Real*            sparsevals;         /**< values of nonzero variables of a compressed solution, or NULL */
    union
    {
       SCIP_HEUR*         heur;               /**< heuristic that found the solution, if solution is of heuristic type */
@@ -79,6 +85,7 @@ struct SCIP_Sol
    int                   depth;              /**< depth at which the solution was found */
    int                   primalindex;        /**< index of solution in array of existing solutions of primal data */
    int                   index;              /**< consecutively numbered unique index of all created solutions */
+   int                   nsparsevals;        /**< number of entries in sparseinds and sparsevals */
    SCIP_SOLORIGIN        solorigin;          /**< origin of solution: where to retrieve uncached elements */
    SCIP_Bool             hasinfval;          /**< does the solution (potentially) contain an infinite value? Note: this
                                               * could also be implemented as a counter for the number of infinite
@@ -163,6 +163,7 @@ struct SCIP_Stat
    SCIP_CLOCK*           sbsoltime;          /**< time needed for searching and storing feasible strong branching solutions */
    SCIP_CLOCK*           nodeactivationtime; /**< time needed for path switching and activating nodes */
    SCIP_CLOCK*           nlpsoltime;         /**< time needed for solving NLPs */
+   SCIP_CLOCK*           divingnlpsoltime;   /**< time needed for solving NLPs during NLP diving */
    SCIP_CLOCK*           copyclock;          /**< time needed for copying problems */
    SCIP_CLOCK*           strongpropclock;    /**< time needed for propagation during strong branching */
    SCIP_CLOCK*           reoptupdatetime;    /**< time needed for storing and recreating nodes and solutions for reoptimization */
@@ -200,6 +201,9 @@ struct SCIP_Stat
    SCIP_Longint          nrootstrongbranchs; /**< number of strong branching calls at the root node */
    SCIP_Longint          nconflictlps;       /**< number of LPs solved during conflict analysis */
    SCIP_Longint          nnlps;              /**< number of NLPs solved */
+   SCIP_Longint          nnlpiterations;     /**< total number of iterations used for solving NLPs */
+   SCIP_Longint          ndivingnlps;        /**< number of NLPs solved during NLP diving */
+   SCIP_Longint          ndivingnlpiterations; /**< total number of iterations used for solving NLPs during NLP diving */
    SCIP_Longint          nisstoppedcalls;    /**< number of calls to SCIPsolveIsStopped() */
    SCIP_Longint          totaldivesetdepth;  /**< the total probing depth over all diveset calls */
    int                   subscipdepth;       /**< depth of current scip instance (increased by each copy call) */
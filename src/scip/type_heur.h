@@ -68,6 +68,8 @@ typedef struct SCIP_HeurData SCIP_HEURDATA;       /**< locally defined primal he
 typedef struct SCIP_Diveset SCIP_DIVESET;         /**< common parameters for all diving heuristics */
 typedef struct SCIP_VGraph SCIP_VGRAPH;           /**< variable graph data structure to determine breadth-first
                                                     *  distances between variables */
+typedef struct SCIP_HeurSnapshot SCIP_HEURSNAPSHOT; /**< snapshot of the problem variables that the job of an
+                                                      *  asynchronous primal heuristic refers to */
 
 /** commonly used display characters indicating special classes of primal heuristics */
 #define SCIP_HEURDISPCHAR_LNS       'L'  /**< a 'L'arge Neighborhood or other local search heuristic */
@@ -153,6 +155,49 @@ typedef struct SCIP_VGraph SCIP_VGRAPH;           /**< variable graph data struc
 #define SCIP_DECL_HEUREXEC(x) SCIP_RETCODE x (SCIP* scip, SCIP_HEUR* heur, SCIP_HEURTIMING heurtiming, \
       SCIP_Bool nodeinfeasible, SCIP_RESULT* result)
 
+/** preparation method of an asynchronous primal heuristic
+ *
+ *  Called in the main thread instead of the execution method if the heuristic runs asynchronously. The snapshot
+ *  already holds the problem variables, to which the solutions of the job refer. The method reads the SCIP instance
+ *  to set up the job, e.g., copies the problem with the current LP solution and bounds into a sub-SCIP, and stores
+ *  everything the job needs via SCIPheurSnapshotSetData().
+ *
+ *  input:
+ *  - scip            : SCIP main data structure
+ *  - heur            : the primal heuristic itself
+ *  - snapshot        : snapshot of the current problem variables
+ *  - run             : pointer to store whether the job should be started
+ */
+#define SCIP_DECL_HEURASYNCPREPARE(x) SCIP_RETCODE x (SCIP* scip, SCIP_HEUR* heur, SCIP_HEURSNAPSHOT* snapshot, \
+      SCIP_Bool* run)
+
+/** asynchronous execution method of primal heuristic
+ *
+ *  Runs on a thread of its own while the tree search continues. The method must not access the main SCIP instance;
+ *  it only works on the snapshot and on the job data stored in it. It should stop as soon as
+ *  SCIPheurSnapshotIsInterrupted() returns TRUE, e.g., by interrupting its sub-SCIP from an event handler.
+ *
+ *  input:
+ *  - heur            : the primal heuristic itself
+ *  - snapshot        : snapshot with the job data set by the preparation method
+ */
+#define SCIP_DECL_HEURASYNCEXEC(x) SCIP_RETCODE x (SCIP_HEUR* heur, SCIP_HEURSNAPSHOT* snapshot)
+
+/** collection method of an asynchronous primal heuristic
+ *
+ *  Called in the main thread at the next point where primal heuristics are called after the job finished, or when
+ *  the solving process is freed. Unless the results should be discarded, the method passes the solutions found by
+ *  the job to SCIP, e.g., via SCIPtrySolFree(). In any case, it has to free the job data of the snapshot.
+ *
+ *  input:
+ *  - scip            : SCIP main data structure
+ *  - heur            : the primal heuristic itself
+ *  - snapshot        : snapshot with the job data
+ *  - discard         : should the results of the job be discarded?
+ */
+#define SCIP_DECL_HEURASYNCCOLLECT(x) SCIP_RETCODE x (SCIP* scip, SCIP_HEUR* heur, SCIP_HEURSNAPSHOT* snapshot, \
+      SCIP_Bool discard)
+
 
 /* callbacks for diving heuristic specific settings */
 
@@ -129,6 +129,34 @@ SCIP_RETCODE SCIPtpiCollectJobs(
    int                   jobid               /**< the jobid of the jobs to wait for */
    );
 
+/** starts a batch of independent jobs on up to @p nthreads threads that are created for this batch only
+ *
+ *  The batch does not use the thread pool of SCIPtpiInit(), so it can be used outside of the concurrent solve. If the
+ *  TPI cannot run the jobs in the background, all jobs are executed before the method returns.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPtpiStartJobBatch(
+   SCIP_JOBBATCH**       batch,              /**< pointer to store the batch */
+   SCIP_RETCODE          (*jobfunc)(void* args),/**< pointer to the job function that is called for each argument */
+   void**                jobargs,            /**< the jobs' arguments; must stay valid until the batch is finished */
+   int                   njobs,              /**< number of jobs */
+   int                   nthreads            /**< maximal number of threads to run the jobs on */
+   );
+
+/** returns whether all jobs of the batch have finished; does not block */
+SCIP_EXPORT
+SCIP_Bool SCIPtpiIsJobBatchFinished(
+   SCIP_JOBBATCH*        batch               /**< the batch */
+   );
+
+/** blocks until all jobs of the batch have finished, frees the batch,
+ *  and then returns the smallest SCIP_RETCODE of all the jobs
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPtpiFinishJobBatch(
+   SCIP_JOBBATCH**       batch               /**< pointer to the batch */
+   );
+
 /** initializes tpi */
 SCIP_EXPORT
 SCIP_RETCODE SCIPtpiInit(
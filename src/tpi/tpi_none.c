@@ -23,6 +23,13 @@
 /*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
 
 #include "tpi/tpi.h"
+#include "blockmemshell/memory.h"
+
+/** a batch of jobs; without a threading library, the jobs are executed when the batch is started */
+struct SCIP_JobBatch
+{
+   SCIP_RETCODE          retcode;            /**< smallest return code of the jobs */
+};
 
 /** creates a job for parallel processing */
 SCIP_RETCODE SCIPtpiCreateJob(
@@ -63,6 +70,63 @@ SCIP_RETCODE SCIPtpiCollectJobs(
    return SCIP_ERROR;
 }
 
+/** starts a batch of independent jobs; without a threading library, the jobs are executed one after the other */
+SCIP_RETCODE SCIPtpiStartJobBatch(
+   SCIP_JOBBATCH**       batch,              /**< pointer to store the batch */
+   SCIP_RETCODE          (*jobfunc)(void* args),/**< pointer to the job function that is called for each argument */
+   void**                jobargs,            /**< the jobs' arguments; must stay valid until the batch is finished */
+   int                   njobs,              /**< number of jobs */
+   int                   nthreads            /**< maximal number of threads to run the jobs on */
+   )
+{
+   int i;
+
+   assert(batch != NULL);
+   assert(jobfunc != NULL);
+   assert(njobs == 0 || jobargs != NULL);
+   SCIP_UNUSED( nthreads );
+
+   SCIP_ALLOC( BMSallocMemory(batch) );
+   (*batch)->retcode = SCIP_OKAY;
+
+   for( i = 0; i < njobs; ++i )
+   {
+      SCIP_RETCODE retcode = (*jobfunc)(jobargs[i]);
+
+      (*batch)->retcode = MIN((*batch)->retcode, retcode);
+   }
+
+   return SCIP_OKAY;
+}
+
+/** returns whether all jobs of the batch have finished; does not block */
+SCIP_Bool SCIPtpiIsJobBatchFinished(
+   SCIP_JOBBATCH*        batch               /**< the batch */
+   )
+{
+   SCIP_UNUSED( batch );
+
+   return TRUE;
+}
+
+/** blocks until all jobs of the batch have finished, frees the batch,
+ *  and then returns the smallest SCIP_RETCODE of all the jobs
+ */
+SCIP_RETCODE SCIPtpiFinishJobBatch(
+   SCIP_JOBBATCH**       batch               /**< pointer to the batch */
+   )
+{
+   SCIP_RETCODE retcode;
+
+   assert(batch != NULL);
+   assert(*batch != NULL);
+
+   retcode = (*batch)->retcode;
+   BMSfreeMemory(batch);
+
+   return retcode;
+}
+
 /** initializes tpi */
 SCIP_RETCODE SCIPtpiInit(
    int         nthreads,                     /**< the number of threads to be used */
@@ -58,6 +58,12 @@ typedef struct SCIP_JobQueues SCIP_JOBQUEUES;
 
 static SCIP_JOBQUEUES* _jobqueues = NULL;
 
+/** a batch of jobs; the jobs are distributed over the threads of a parallel region when the batch is started */
+struct SCIP_JobBatch
+{
+   SCIP_RETCODE          retcode;            /**< smallest return code of the jobs */
+};
+
 
 /** create job queue */
 static
@@ -509,6 +515,71 @@ SCIP_RETCODE SCIPtpiCollectJobs(
    return retcode;
 }
 
+/** starts a batch of independent jobs; the jobs are distributed over the threads of a parallel region, which is
+ *  left only after all jobs have finished
+ */
+SCIP_RETCODE SCIPtpiStartJobBatch(
+   SCIP_JOBBATCH**       batch,              /**< pointer to store the batch */
+   SCIP_RETCODE          (*jobfunc)(void* args),/**< pointer to the job function that is called for each argument */
+   void**                jobargs,            /**< the jobs' arguments; must stay valid until the batch is finished */
+   int                   njobs,              /**< number of jobs */
+   int                   nthreads            /**< maximal number of threads to run the jobs on */
+   )
+{
+   SCIP_RETCODE retcode;
+   int i;
+
+   assert(batch != NULL);
+   assert(jobfunc != NULL);
+   assert(njobs == 0 || jobargs != NULL);
+
+   SCIP_ALLOC( BMSallocMemory(batch) );
+
+   retcode = SCIP_OKAY;
+   nthreads = MAX(1, MIN(nthreads, njobs));
+
+   #pragma omp parallel for num_threads(nthreads) schedule(dynamic, 1)
+   for( i = 0; i < njobs; ++i )
+   {
+      SCIP_RETCODE jobretcode = (*jobfunc)(jobargs[i]);
+
+      #pragma omp critical (SCIPtpiJobBatch)
+      retcode = MIN(retcode, jobretcode);
+   }
+
+   (*batch)->retcode = retcode;
+
+   return SCIP_OKAY;
+}
+
+/** returns whether all jobs of the batch have finished; does not block */
+SCIP_Bool SCIPtpiIsJobBatchFinished(
+   SCIP_JOBBATCH*        batch               /**< the batch */
+   )
+{
+   SCIP_UNUSED( batch );
+
+   return TRUE;
+}
+
+/** blocks until all jobs of the batch have finished, frees the batch,
+ *  and then returns the smallest SCIP_RETCODE of all the jobs
+ */
+SCIP_RETCODE SCIPtpiFinishJobBatch(
+   SCIP_JOBBATCH**       batch               /**< pointer to the batch */
+   )
+{
+   SCIP_RETCODE retcode;
+
+   assert(batch != NULL);
+   assert(*batch != NULL);
+
+   retcode = (*batch)->retcode;
+   BMSfreeMemory(batch);
+
+   return retcode;
+}
+
 /** initializes tpi */
 SCIP_RETCODE SCIPtpiInit(
    int                   nthreads,           /**< the number of threads to be used */
@@ -77,6 +77,20 @@ struct SCIP_ThreadPool
    SCIP_CONDITION        jobfinished;        /**< condition to broadcast that a job has been finished */
 };
 
+/** a batch of jobs running on threads of its own */
+struct SCIP_JobBatch
+{
+   SCIP_RETCODE          (*jobfunc)(void* args);/**< pointer to the job function */
+   void**                jobargs;            /**< the jobs' arguments */
+   thrd_t*               threads;            /**< the threads of the batch */
+   int                   nthreads;           /**< number of threads of the batch */
+   int                   njobs;              /**< number of jobs */
+   int                   nextjob;            /**< index of the next job to be started */
+   int                   nfinishedjobs;      /**< number of finished jobs */
+   SCIP_RETCODE          retcode;            /**< smallest return code of the finished jobs */
+   SCIP_LOCK             lock;               /**< mutex to protect the job counters */
+};
+
 /** this function controls the execution of each of the threads */
 static
 SCIP_RETCODE threadPoolThreadRetcode(
@@ -213,6 +227,70 @@ int threadPoolThread(
    return (int) threadPoolThreadRetcode(threadnum);
 }
 
+/** counts jobs of a batch as finished with the given return code
+ *
+ *  If the lock of the batch cannot be acquired, the jobs are counted anyway with an error, such that nobody waits for
+ *  them forever.
+ */
+static
+void jobBatchFinishJobs(
+   SCIP_JOBBATCH*        batch,              /**< the batch */
+   int                   njobs,              /**< number of finished jobs */
+   SCIP_RETCODE          retcode             /**< return code of the jobs */
+   )
+{
+   SCIP_Bool locked;
+
+   locked = (SCIPtpiAcquireLock(&batch->lock) == SCIP_OKAY);
+   if( !locked )
+      retcode = MIN(retcode, SCIP_ERROR);
+
+   batch->retcode = MIN(batch->retcode, retcode);
+   batch->nfinishedjobs += njobs;
+
+   if( locked )
+      (void) SCIPtpiReleaseLock(&batch->lock);
+}
+
+/** executes jobs of a batch until all of them have been started */
+static
+SCIP_RETCODE jobBatchThreadRetcode(
+   SCIP_JOBBATCH*        batch               /**< the batch */
+   )
+{
+   while( TRUE ) /*lint !e716*/
+   {
+      SCIP_RETCODE retcode;
+      int jobidx;
+
+      /* if no job can be claimed, the thread stops; the jobs that are never started are reported as failed when the
+       * batch is finished
+       */
+      if( SCIPtpiAcquireLock(&batch->lock) != SCIP_OKAY )
+         return SCIP_ERROR;
+      jobidx = batch->nextjob < batch->njobs ? batch->nextjob++ : -1;
+      (void) SCIPtpiReleaseLock(&batch->lock);
+
+      if( jobidx < 0 )
+         break;
+
+      retcode = (*batch->jobfunc)(batch->jobargs[jobidx]);
+
+      jobBatchFinishJobs(batch, 1, retcode);
+   }
+
+   return SCIP_OKAY;
+}
+
+/** thread function of a batch */
+static
+int jobBatchThread(
+   void*                 batch               /**< the batch is passed in as argument stored inside a void pointer */
+   )
+{
+   return (int) jobBatchThreadRetcode((SCIP_JOBBATCH*) batch);
+}
+
 /** creates a threadpool */
 static
 SCIP_RETCODE createThreadPool(
@@ -537,6 +615,103 @@ int SCIPtpiGetNumThreads(
    return _threadpool->nthreads;
 }
 
+/** starts a batch of independent jobs on up to @p nthreads threads that are created for this batch only;
+ *  returns without waiting for the jobs
+ */
+SCIP_RETCODE SCIPtpiStartJobBatch(
+   SCIP_JOBBATCH**       batch,              /**< pointer to store the batch */
+   SCIP_RETCODE          (*jobfunc)(void* args),/**< pointer to the job function that is called for each argument */
+   void**                jobargs,            /**< the jobs' arguments; must stay valid until the batch is finished */
+   int                   njobs,              /**< number of jobs */
+   int                   nthreads            /**< maximal number of threads to run the jobs on */
+   )
+{
+   int i;
+
+   assert(batch != NULL);
+   assert(jobfunc != NULL);
+   assert(njobs == 0 || jobargs != NULL);
+
+   nthreads = MAX(1, MIN(nthreads, njobs));
+
+   SCIP_ALLOC( BMSallocMemory(batch) );
+   SCIP_ALLOC( BMSallocMemoryArray(&(*batch)->threads, nthreads) );
+   (*batch)->jobfunc = jobfunc;
+   (*batch)->jobargs = jobargs;
+   (*batch)->njobs = njobs;
+   (*batch)->nextjob = 0;
+   (*batch)->nfinishedjobs = 0;
+   (*batch)->retcode = SCIP_OKAY;
+   (*batch)->nthreads = 0;
+   SCIP_CALL( SCIPtpiInitLock(&(*batch)->lock) );
+
+   /* threads that cannot be created are not needed: the created ones process all jobs */
+   for( i = 0; i < nthreads; ++i )
+   {
+      if( thrd_create(&(*batch)->threads[(*batch)->nthreads], jobBatchThread, (void*) *batch) == thrd_success )
+         ++(*batch)->nthreads;
+   }
+
+   /* if no thread could be created, execute the jobs directly; their return codes are reported when the batch is
+    * finished
+    */
+   if( (*batch)->nthreads == 0 )
+      (void) jobBatchThreadRetcode(*batch);
+
+   return SCIP_OKAY;
+}
+
+/** returns whether all jobs of the batch have finished; does not block */
+SCIP_Bool SCIPtpiIsJobBatchFinished(
+   SCIP_JOBBATCH*        batch               /**< the batch */
+   )
+{
+   SCIP_Bool finished;
+
+   assert(batch != NULL);
+
+   SCIP_CALL_ABORT( SCIPtpiAcquireLock(&batch->lock) );
+   finished = (batch->nfinishedjobs == batch->njobs);
+   SCIP_CALL_ABORT( SCIPtpiReleaseLock(&batch->lock) );
+
+   return finished;
+}
+
+/** blocks until all jobs of the batch have finished, frees the batch,
+ *  and then returns the smallest SCIP_RETCODE of all the jobs
+ *
+ *  The batch is freed even if a thread cannot be joined; SCIP_ERROR is returned in this case.
+ */
+SCIP_RETCODE SCIPtpiFinishJobBatch(
+   SCIP_JOBBATCH**       batch               /**< pointer to the batch */
+   )
+{
+   SCIP_RETCODE retcode;
+   SCIP_Bool joined;
+   int i;
+
+   assert(batch != NULL);
+   assert(*batch != NULL);
+
+   joined = TRUE;
+   for( i = 0; i < (*batch)->nthreads; ++i )
+   {
+      if( thrd_join((*batch)->threads[i], NULL) != thrd_success )
+         joined = FALSE;
+   }
+
+   /* jobs that were never started, because no thread could claim them, count as failed */
+   retcode = (*batch)->retcode;
+   if( !joined || (*batch)->nfinishedjobs < (*batch)->njobs )
+      retcode = MIN(retcode, SCIP_ERROR);
+
+   SCIPtpiDestroyLock(&(*batch)->lock);
+   BMSfreeMemoryArray(&(*batch)->threads);
+   BMSfreeMemory(batch);
+
+   return retcode;
+}
+
 /** initializes tpi */
 SCIP_RETCODE SCIPtpiInit(
    int                   nthreads,           /**< the number of threads to be used */
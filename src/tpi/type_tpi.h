@@ -60,6 +60,7 @@ enum SCIP_Jobstatus
 typedef enum SCIP_Jobstatus SCIP_JOBSTATUS;
 
 typedef struct SCIP_Job SCIP_JOB;            /**< a job to be submitted to a separate thread */
+typedef struct SCIP_JobBatch SCIP_JOBBATCH;  /**< a batch of independent jobs running on threads of its own */
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,190 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   conflictstore.c
+ * @brief  unit test for removing conflicts from the conflict store by tier and age
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "scip/struct_conflict.h"
+#include "scip/struct_conflictstore.h"
+#include "scip/struct_scip.h"
+
+#include "include/scip_test.h"
+
+#define NVARS        10
+#define NCONFLICTS   32                      /**< number of conflicts that fit into the memory limit */
+#define NREMOVED      4                      /**< number of conflicts removed when one more conflict is added */
+
+static SCIP* scip;
+static SCIP_VAR* vars[NVARS];
+static SCIP_CONS* conflicts[NCONFLICTS + 1];
+
+static
+void setup(void)
+{
+   char name[SCIP_MAXSTRLEN];
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "conflictstore") );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x_%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, 1.0, 0.0, SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+   }
+
+   /* a conflict on two variables is estimated to use 320 bytes, such that exactly NCONFLICTS conflicts fit into the
+    * memory limit; adding one more removes conflicts until 90% of the limit is reached
+    */
+   SCIP_CALL( SCIPsetRealParam(scip, "conflict/maxstoremem", 0.01) );
+   SCIP_CALL( SCIPsetIntParam(scip, "conflict/maxstoresize", 100) );
+   SCIP_CALL( SCIPsetIntParam(scip, "conflict/coretierlbd", 2) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+}
+
+static
+void teardown(void)
+{
+   int i;
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/** adds NCONFLICTS + 1 conflicts to the store; the even ones are in the core tier and older than the odd ones, which
+ *  are in the local tier
+ *
+ *  the literal block distance is passed to the store like during conflict analysis, where it is set while the conflict
+ *  handlers are called
+ */
+static
+void addConflicts(void)
+{
+   SCIP_VAR* consvars[2];
+   char name[SCIP_MAXSTRLEN];
+   int i;
+
+   SCIP_CALL( SCIPtransformProb(scip) );
+
+   for( i = 0; i <= NCONFLICTS; ++i )
+   {
+      SCIP_CONS* cons;
+
+      consvars[0] = SCIPvarGetTransVar(vars[i % NVARS]);
+      consvars[1] = SCIPvarGetTransVar(vars[(i + 1) % NVARS]);
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "conf_%d", i);
+      SCIP_CALL( SCIPcreateConsLogicor(scip, &cons, name, 2, consvars, FALSE, TRUE, FALSE, FALSE, TRUE, FALSE, FALSE,
+            FALSE, TRUE, FALSE) );
+
+      if( i % 2 == 0 )
+      {
+         SCIP_CALL( SCIPaddConsAge(scip, cons, 10.0) );
+      }
+
+      /* keep a reference to the conflict, which is released by SCIPaddConflict() */
+      conflicts[i] = cons;
+      SCIP_CALL( SCIPcaptureCons(scip, cons) );
+
+      scip->conflict->conflictsetlbd = (i % 2 == 0 ? 1 : -1);
+      SCIP_CALL( SCIPaddConflict(scip, NULL, cons, NULL, SCIP_CONFTYPE_PROPAGATION, FALSE) );
+      scip->conflict->conflictsetlbd = -1;
+   }
+}
+
+/** counts the deleted conflicts of the core tier (even) and of the local tier (odd) */
+static
+void countDeleted(
+   int*                  ndelcore,           /**< pointer to store the number of deleted core conflicts */
+   int*                  ndellocal           /**< pointer to store the number of deleted local conflicts */
+   )
+{
+   int i;
+
+   *ndelcore = 0;
+   *ndellocal = 0;
+
+   for( i = 0; i <= NCONFLICTS; ++i )
+   {
+      if( SCIPconsIsDeleted(conflicts[i]) )
+      {
+         if( i % 2 == 0 )
+            ++(*ndelcore);
+         else
+            ++(*ndellocal);
+      }
+   }
+}
+
+/** releases the conflicts */
+static
+void releaseConflicts(void)
+{
+   int i;
+
+   for( i = 0; i <= NCONFLICTS; ++i )
+   {
+      SCIP_CALL( SCIPreleaseCons(scip, &conflicts[i]) );
+   }
+}
+
+TestSuite(conflictstore, .init = setup, .fini = teardown);
+
+Test(conflictstore, tiered, .description = "test that old conflicts of the core tier are kept if the memory limit is exceeded")
+{
+   int ndelcore;
+   int ndellocal;
+
+   SCIP_CALL( SCIPsetBoolParam(scip, "conflict/tieredstore", TRUE) );
+
+   addConflicts();
+   countDeleted(&ndelcore, &ndellocal);
+
+   cr_assert_eq(ndelcore, 0);
+   cr_assert_eq(ndellocal, NREMOVED);
+   cr_assert_eq(scip->conflictstore->nconflicts, NCONFLICTS + 1 - NREMOVED);
+
+   releaseConflicts();
+}
+
+Test(conflictstore, untiered, .description = "test that the oldest conflicts are removed if the tiers are switched off")
+{
+   int ndelcore;
+   int ndellocal;
+
+   SCIP_CALL( SCIPsetBoolParam(scip, "conflict/tieredstore", FALSE) );
+
+   addConflicts();
+   countDeleted(&ndelcore, &ndellocal);
+
+   cr_assert_eq(ndelcore, NREMOVED);
+   cr_assert_eq(ndellocal, 0);
+   cr_assert_eq(scip->conflictstore->nconflicts, NCONFLICTS + 1 - NREMOVED);
+
+   releaseConflicts();
+}
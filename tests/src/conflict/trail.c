@@ -0,0 +1,171 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   trail.c
+ * @brief  unit test for keeping binary conflict candidates on the trail of the current path
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+
+#include "include/scip_test.h"
+
+#define NPIGEONS  6
+#define NHOLES    5
+#define MAXNLITS  1000000
+
+/** literals of all conflicts found in a run, each conflict is terminated by -1 */
+static int* lits[2];
+static int nlits[2];
+static int run;
+
+/** records the literals of a conflict, sorted by variable and bound type */
+static
+SCIP_DECL_CONFLICTEXEC(conflictExecRecord)
+{  /*lint --e{715}*/
+   int* conflictlits;
+   int i;
+
+   *result = SCIP_DIDNOTRUN;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &conflictlits, nbdchginfos) );
+
+   for( i = 0; i < nbdchginfos; ++i )
+   {
+      conflictlits[i] = 2 * SCIPvarGetProbindex(SCIPbdchginfoGetVar(bdchginfos[i])) + (int)SCIPbdchginfoGetBoundtype(bdchginfos[i]);
+   }
+   SCIPsortInt(conflictlits, nbdchginfos);
+
+   cr_assert(nlits[run] + nbdchginfos + 1 <= MAXNLITS);
+   for( i = 0; i < nbdchginfos; ++i )
+      lits[run][nlits[run]++] = conflictlits[i];
+   lits[run][nlits[run]++] = -1;
+
+   SCIPfreeBufferArray(scip, &conflictlits);
+
+   return SCIP_OKAY;
+}
+
+/** solves the infeasible pigeonhole problem by propagation only and records all conflicts */
+static
+void solvePigeonhole(
+   SCIP_Bool             usetrail            /**< whether binary conflict candidates are kept on the trail */
+   )
+{
+   SCIP* scip;
+   SCIP_VAR* vars[NPIGEONS][NHOLES];
+   SCIP_VAR* consvars[NPIGEONS];
+   SCIP_CONS* cons;
+   char name[SCIP_MAXSTRLEN];
+   int p;
+   int h;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPincludeConflicthdlrBasic(scip, NULL, "record", "records all conflicts", 1000000, conflictExecRecord, NULL) );
+
+   SCIP_CALL( SCIPcreateProbBasic(scip, "pigeonhole") );
+
+   for( p = 0; p < NPIGEONS; ++p )
+   {
+      for( h = 0; h < NHOLES; ++h )
+      {
+         (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x_%d_%d", p, h);
+         SCIP_CALL( SCIPcreateVarBasic(scip, &vars[p][h], name, 0.0, 1.0, 0.0, SCIP_VARTYPE_BINARY) );
+         SCIP_CALL( SCIPaddVar(scip, vars[p][h]) );
+      }
+   }
+
+   /* every pigeon sits in exactly one hole */
+   for( p = 0; p < NPIGEONS; ++p )
+   {
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "pigeon_%d", p);
+      SCIP_CALL( SCIPcreateConsBasicSetpart(scip, &cons, name, NHOLES, vars[p]) );
+      SCIP_CALL( SCIPaddCons(scip, cons) );
+      SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   }
+
+   /* every hole takes at most one pigeon */
+   for( h = 0; h < NHOLES; ++h )
+   {
+      for( p = 0; p < NPIGEONS; ++p )
+         consvars[p] = vars[p][h];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "hole_%d", h);
+      SCIP_CALL( SCIPcreateConsBasicSetpack(scip, &cons, name, NPIGEONS, consvars) );
+      SCIP_CALL( SCIPaddCons(scip, cons) );
+      SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   }
+
+   /* solve by branching and propagation only, such that all infeasibilities are analyzed by propagation conflicts */
+   SCIP_CALL( SCIPsetBoolParam(scip, "conflict/usetrail", usetrail) );
+   SCIP_CALL( SCIPsetIntParam(scip, "lp/solvefreq", -1) );
+   SCIP_CALL( SCIPsetIntParam(scip, "presolving/maxrounds", 0) );
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+
+   SCIP_CALL( SCIPsolve(scip) );
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_INFEASIBLE);
+
+   for( p = 0; p < NPIGEONS; ++p )
+   {
+      for( h = 0; h < NHOLES; ++h )
+      {
+         SCIP_CALL( SCIPreleaseVar(scip, &vars[p][h]) );
+      }
+   }
+
+   SCIP_CALL( SCIPfree(&scip) );
+}
+
+static
+void setup(void)
+{
+   lits[0] = (int*)malloc(MAXNLITS * sizeof(int));
+   lits[1] = (int*)malloc(MAXNLITS * sizeof(int));
+   nlits[0] = 0;
+   nlits[1] = 0;
+}
+
+static
+void teardown(void)
+{
+   free(lits[1]);
+   free(lits[0]);
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(trail, .init = setup, .fini = teardown);
+
+Test(trail, same_conflicts, .description = "test that conflict analysis finds the same conflicts with and without the trail")
+{
+   int i;
+
+   run = 0;
+   solvePigeonhole(FALSE);
+
+   run = 1;
+   solvePigeonhole(TRUE);
+
+   /* the pigeonhole problem needs branching, so conflicts should have been found */
+   cr_assert_gt(nlits[0], 0);
+   cr_assert_eq(nlits[0], nlits[1]);
+
+   for( i = 0; i < nlits[0]; ++i )
+      cr_assert_eq(lits[0][i], lits[1][i]);
+}
@@ -0,0 +1,99 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   hashmap.c
+ * @brief  unittest for the bulk methods of the hash map in misc.c
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <assert.h>
+
+#include "scip/scip.h"
+#include "scip/pub_misc.h"
+
+#include "include/scip_test.h"
+
+#define NELEMS 1000
+
+static SCIP* scip;
+static SCIP_HASHMAP* hashmap;
+static int elems[NELEMS];
+static void* origins[NELEMS];
+
+static
+void setup(void)
+{
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+
+   /* create a small hash map such that bulk insertion has to resize it */
+   SCIP_CALL( SCIPhashmapCreate(&hashmap, SCIPblkmem(scip), 1) );
+
+   for( i = 0; i < NELEMS; ++i )
+      origins[i] = (void*)&elems[i];
+}
+
+static
+void teardown(void)
+{
+   SCIPhashmapFree(&hashmap);
+   SCIP_CALL( SCIPfree(&scip) );
+}
+
+TestSuite(hashmap, .init = setup, .fini = teardown);
+
+Test(hashmap, insert_array, .description = "test that pointer images inserted in bulk can be retrieved")
+{
+   void* images[NELEMS];
+   void* retrieved[NELEMS];
+   int i;
+
+   for( i = 0; i < NELEMS; ++i )
+      images[i] = origins[(i + 1) % NELEMS];
+
+   SCIP_CALL( SCIPhashmapInsertArray(hashmap, origins, images, NELEMS) );
+   cr_assert_eq(SCIPhashmapGetNElements(hashmap), NELEMS);
+
+   SCIPhashmapGetImages(hashmap, origins, retrieved, NELEMS);
+   for( i = 0; i < NELEMS; ++i )
+   {
+      cr_assert_eq(retrieved[i], images[i]);
+      cr_assert_eq(SCIPhashmapGetImage(hashmap, origins[i]), images[i]);
+   }
+
+   /* origins that are not contained get a NULL image */
+   SCIPhashmapGetImages(hashmap, (void**)&scip, retrieved, 1);
+   cr_assert_null(retrieved[0]);
+
+   /* inserting an existing origin is an error */
+   cr_assert_eq(SCIPhashmapInsertArray(hashmap, origins, images, 1), SCIP_KEYALREADYEXISTING);
+}
+
+Test(hashmap, insert_array_int, .description = "test that integer images inserted in bulk can be retrieved")
+{
+   int i;
+
+   /* insert the first half with positions as images, the second half with explicit images */
+   SCIP_CALL( SCIPhashmapInsertArrayInt(hashmap, origins, NULL, NELEMS / 2) );
+   for( i = NELEMS / 2; i < NELEMS; ++i )
+      elems[i] = -i;
+   SCIP_CALL( SCIPhashmapInsertArrayInt(hashmap, &origins[NELEMS / 2], &elems[NELEMS / 2], NELEMS - NELEMS / 2) );
+
+   cr_assert_eq(SCIPhashmapGetNElements(hashmap), NELEMS);
+   for( i = 0; i < NELEMS; ++i )
+      cr_assert_eq(SCIPhashmapGetImageInt(hashmap, origins[i]), i < NELEMS / 2 ? i : -i);
+}
@@ -0,0 +1,201 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   exprgraph.c
+ * @brief  unit tests for merging common subexpressions when simplifying and for propagating bounds in an expression graph
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <math.h>
+
+#include "scip/scip.h"
+#include "nlpi/pub_expr.h"
+
+#include "include/scip_test.h"
+
+static SCIP* scip;
+static SCIP_VAR* vars[2];
+static SCIP_EXPRGRAPH* exprgraph;
+
+static
+void setup(void)
+{
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "exprgraph") );
+
+   SCIP_CALL( SCIPcreateVarBasic(scip, &vars[0], "x", 0.0, 1.0, 0.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL( SCIPcreateVarBasic(scip, &vars[1], "y", 0.0, 1.0, 0.0, SCIP_VARTYPE_CONTINUOUS) );
+
+   SCIP_CALL( SCIPexprgraphCreate(SCIPblkmem(scip), &exprgraph, -1, -1, NULL, NULL, NULL, NULL) );
+}
+
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPexprgraphFree(&exprgraph) );
+   SCIP_CALL( SCIPreleaseVar(scip, &vars[0]) );
+   SCIP_CALL( SCIPreleaseVar(scip, &vars[1]) );
+   SCIP_CALL( SCIPfree(&scip) );
+}
+
+/** adds exp(child) as expression tree to the expression graph and returns its root node */
+static
+void addExpTree(
+   SCIP_EXPR*            child,              /**< argument of exponential function */
+   SCIP_EXPRGRAPHNODE**  rootnode            /**< buffer to store root node */
+   )
+{
+   SCIP_EXPRTREE* tree;
+   SCIP_EXPR* expexpr;
+   SCIP_Bool isnew;
+
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &expexpr, SCIP_EXPR_EXP, child) );
+   SCIP_CALL( SCIPexprtreeCreate(SCIPblkmem(scip), &tree, expexpr, 2, 0, NULL) );
+   SCIP_CALL( SCIPexprtreeSetVars(tree, 2, vars) );
+
+   SCIP_CALL( SCIPexprgraphAddExprtreeSum(exprgraph, 1, &tree, NULL, rootnode, &isnew) );
+   SCIPexprgraphCaptureNode(*rootnode);
+
+   SCIP_CALL( SCIPexprtreeFree(&tree) );
+}
+
+TestSuite(exprgraph, .init = setup, .fini = teardown);
+
+Test(exprgraph, merge_common_subexpressions, .description = "test that subexpressions that become equal by simplification are merged")
+{
+   SCIP_EXPRGRAPHNODE* rootnodes[2];
+   SCIP_EXPR* x;
+   SCIP_EXPR* y;
+   SCIP_EXPR* xy;
+   SCIP_EXPR* two;
+   SCIP_EXPR* arg1;
+   SCIP_EXPR* arg2;
+   SCIP_Real varvals[2] = { 0.3, 0.7 };
+   SCIP_Bool havechange;
+   SCIP_Bool domainerror;
+
+   /* exp((x*y)*2) */
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &x, SCIP_EXPR_VARIDX, 0) );
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &y, SCIP_EXPR_VARIDX, 1) );
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &xy, SCIP_EXPR_MUL, x, y) );
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &two, SCIP_EXPR_CONST, 2.0) );
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &arg1, SCIP_EXPR_MUL, xy, two) );
+   addExpTree(arg1, &rootnodes[0]);
+
+   /* exp(2*(y*x + x) - 2*x) */
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &x, SCIP_EXPR_VARIDX, 0) );
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &y, SCIP_EXPR_VARIDX, 1) );
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &xy, SCIP_EXPR_MUL, y, x) );
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &x, SCIP_EXPR_VARIDX, 0) );
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &arg2, SCIP_EXPR_PLUS, xy, x) );
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &two, SCIP_EXPR_CONST, 2.0) );
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &arg2, SCIP_EXPR_MUL, two, arg2) );
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &x, SCIP_EXPR_VARIDX, 0) );
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &two, SCIP_EXPR_CONST, 2.0) );
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &arg1, SCIP_EXPR_MUL, two, x) );
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &arg2, SCIP_EXPR_MINUS, arg2, arg1) );
+   addExpTree(arg2, &rootnodes[1]);
+
+   cr_assert_neq(SCIPexprgraphGetNodeChildren(rootnodes[0])[0], SCIPexprgraphGetNodeChildren(rootnodes[1])[0]);
+
+   SCIP_CALL( SCIPexprgraphSimplify(exprgraph, SCIPgetMessagehdlr(scip), 1e-9, 2, &havechange, &domainerror) );
+   cr_assert(havechange);
+   cr_assert(!domainerror);
+
+   /* both roots are in use, so remain separate nodes, but should share the argument of exp */
+   cr_assert_neq(rootnodes[0], rootnodes[1]);
+   cr_assert_eq(SCIPexprgraphGetNodeChildren(rootnodes[0])[0], SCIPexprgraphGetNodeChildren(rootnodes[1])[0]);
+
+   SCIP_CALL( SCIPexprgraphEval(exprgraph, varvals) );
+   cr_assert_float_eq(SCIPexprgraphGetNodeVal(rootnodes[0]), exp(2.0 * varvals[0] * varvals[1]), 1e-12);
+   cr_assert_float_eq(SCIPexprgraphGetNodeVal(rootnodes[1]), exp(2.0 * varvals[0] * varvals[1]), 1e-12);
+
+   SCIP_CALL( SCIPexprgraphReleaseNode(exprgraph, &rootnodes[0]) );
+   SCIP_CALL( SCIPexprgraphReleaseNode(exprgraph, &rootnodes[1]) );
+}
+
+/** sets the bounds of a variable in the expression graph */
+static
+void setVarBounds(
+   SCIP_VAR*             var,                /**< variable */
+   SCIP_Real             lb,                 /**< new lower bound */
+   SCIP_Real             ub                  /**< new upper bound */
+   )
+{
+   SCIP_EXPRGRAPHNODE* varnode;
+   SCIP_INTERVAL bounds;
+
+   cr_assert(SCIPexprgraphFindVarNode(exprgraph, (void*)var, &varnode));
+   SCIPintervalSetBounds(&bounds, lb, ub);
+   SCIPexprgraphSetVarNodeBounds(exprgraph, varnode, bounds);
+}
+
+Test(exprgraph, propagate_bounds, .description = "test that bound tightenings of variables and nodes are propagated forward")
+{
+   SCIP_EXPRGRAPHNODE* rootnode;
+   SCIP_EXPRGRAPHNODE* xynode;
+   SCIP_EXPR* x;
+   SCIP_EXPR* y;
+   SCIP_EXPR* xy;
+   SCIP_INTERVAL bounds;
+   SCIP_Bool domainerror;
+   SCIP_Bool cutoff;
+
+   /* exp(x*y) */
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &x, SCIP_EXPR_VARIDX, 0) );
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &y, SCIP_EXPR_VARIDX, 1) );
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &xy, SCIP_EXPR_MUL, x, y) );
+   addExpTree(xy, &rootnode);
+   xynode = SCIPexprgraphGetNodeChildren(rootnode)[0];
+
+   setVarBounds(vars[0], 0.0, 1.0);
+   setVarBounds(vars[1], 0.0, 1.0);
+   SCIP_CALL( SCIPexprgraphPropagateVarBounds(exprgraph, SCIPinfinity(scip), TRUE, &domainerror) );
+   cr_assert(!domainerror);
+   cr_assert_float_eq(SCIPexprgraphGetNodeBounds(rootnode).inf, 1.0, 1e-9);
+   cr_assert_float_eq(SCIPexprgraphGetNodeBounds(rootnode).sup, exp(1.0), 1e-9);
+
+   /* tightening a variable bound has to be propagated up to the root */
+   setVarBounds(vars[0], 0.0, 0.5);
+   SCIP_CALL( SCIPexprgraphPropagateVarBounds(exprgraph, SCIPinfinity(scip), FALSE, &domainerror) );
+   cr_assert(!domainerror);
+   cr_assert_float_eq(SCIPexprgraphGetNodeBounds(xynode).sup, 0.5, 1e-9);
+   cr_assert_float_eq(SCIPexprgraphGetNodeBounds(rootnode).sup, exp(0.5), 1e-9);
+
+   /* tighten the root and propagate backward, which tightens x*y */
+   SCIPintervalSetBounds(&bounds, 1.0, exp(0.25));
+   SCIPexprgraphTightenNodeBounds(exprgraph, rootnode, bounds, 0.05, SCIPinfinity(scip), &cutoff);
+   cr_assert(!cutoff);
+   SCIPexprgraphPropagateNodeBounds(exprgraph, SCIPinfinity(scip), 0.05, &cutoff);
+   cr_assert(!cutoff);
+   cr_assert_float_eq(SCIPexprgraphGetNodeBounds(xynode).sup, 0.25, 1e-9);
+
+   /* a further tightening of y has to be propagated through the node that was tightened by its parent */
+   setVarBounds(vars[1], 0.0, 0.2);
+   SCIP_CALL( SCIPexprgraphPropagateVarBounds(exprgraph, SCIPinfinity(scip), FALSE, &domainerror) );
+   cr_assert(!domainerror);
+   cr_assert_float_eq(SCIPexprgraphGetNodeBounds(xynode).sup, 0.1, 1e-9);
+   cr_assert_float_eq(SCIPexprgraphGetNodeBounds(rootnode).sup, exp(0.1), 1e-9);
+
+   /* relaxing a variable bound resets the tightenings from backward propagation */
+   setVarBounds(vars[0], 0.0, 1.0);
+   setVarBounds(vars[1], 0.0, 1.0);
+   SCIP_CALL( SCIPexprgraphPropagateVarBounds(exprgraph, SCIPinfinity(scip), TRUE, &domainerror) );
+   cr_assert(!domainerror);
+   cr_assert_float_eq(SCIPexprgraphGetNodeBounds(rootnode).sup, exp(1.0), 1e-9);
+
+   SCIP_CALL( SCIPexprgraphReleaseNode(exprgraph, &rootnode) );
+}
@@ -0,0 +1,218 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   oracle.c
+ * @brief  unit test for the evaluation of constraints with equal expression trees in the NLPI oracle
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <math.h>
+
+#include "scip/scip.h"
+#include "nlpi/nlpioracle.h"
+#include "nlpi/exprinterpret.h"
+#include "nlpi/pub_expr.h"
+
+#include "include/scip_test.h"
+
+#define NCONSS 4
+
+static SCIP* scip;
+static SCIP_NLPIORACLE* oracle;
+
+/** creates the expression tree exp(x) */
+static
+void createExpTree(
+   SCIP_EXPRTREE**       tree
+   )
+{
+   SCIP_EXPR* varexpr;
+   SCIP_EXPR* expexpr;
+
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &varexpr, SCIP_EXPR_VARIDX, 0) );
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &expexpr, SCIP_EXPR_EXP, varexpr) );
+   SCIP_CALL( SCIPexprtreeCreate(SCIPblkmem(scip), tree, expexpr, 1, 0, NULL) );
+}
+
+/* creates oracle with constraints exp(x0), exp(x1), 2 x0 + exp(x2), and exp(x1) */
+static
+void setup(void)
+{
+   SCIP_EXPRTREE* exprtrees[NCONSS];
+   int* exprvaridxs[NCONSS];
+   int* lininds[NCONSS] = { NULL, NULL, NULL, NULL };
+   SCIP_Real* linvals[NCONSS] = { NULL, NULL, NULL, NULL };
+   int nlininds[NCONSS] = { 0, 0, 1, 0 };
+   int varidxs[3] = { 0, 1, 2 };
+   int linind = 0;
+   SCIP_Real linval = 2.0;
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPnlpiOracleCreate(SCIPblkmem(scip), &oracle) );
+   SCIP_CALL( SCIPnlpiOracleAddVars(oracle, 3, NULL, NULL, NULL) );
+
+   for( i = 0; i < NCONSS; ++i )
+      createExpTree(&exprtrees[i]);
+
+   exprvaridxs[0] = &varidxs[0];
+   exprvaridxs[1] = &varidxs[1];
+   exprvaridxs[2] = &varidxs[2];
+   exprvaridxs[3] = &varidxs[1];
+   lininds[2] = &linind;
+   linvals[2] = &linval;
+
+   SCIP_CALL( SCIPnlpiOracleAddConstraints(oracle, NCONSS, NULL, NULL, nlininds, lininds, linvals, NULL, NULL, exprvaridxs, exprtrees, NULL) );
+
+   for( i = 0; i < NCONSS; ++i )
+   {
+      SCIP_CALL( SCIPexprtreeFree(&exprtrees[i]) );
+   }
+}
+
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPnlpiOracleFree(&oracle) );
+   SCIP_CALL( SCIPfree(&scip) );
+}
+
+TestSuite(oracle, .init = setup, .fini = teardown);
+
+Test(oracle, equal_exprtrees, .description = "test that constraints with equal expression trees are evaluated correctly")
+{
+   const int* jacoffsets;
+   const int* jaccols;
+   const int* hesoffsets;
+   const int* hescols;
+   SCIP_Real convals[NCONSS];
+   SCIP_Real lambda[NCONSS] = { 1.0, 1.0, 1.0, 1.0 };
+   SCIP_Real jacobi[5];
+   SCIP_Real hessian[3];
+   int r;
+
+   if( (SCIPexprintGetCapability() & SCIP_EXPRINTCAPABILITY_HESSIAN) == 0 )
+      return;
+
+   SCIP_CALL( SCIPnlpiOracleGetJacobianSparsity(oracle, &jacoffsets, &jaccols) );
+   SCIP_CALL( SCIPnlpiOracleGetHessianLagSparsity(oracle, &hesoffsets, &hescols) );
+   cr_assert_eq(jacoffsets[NCONSS], 5);
+   cr_assert_eq(hesoffsets[3], 3);
+
+   /* evaluate at two points, such that stale interpreter data would give wrong results */
+   for( r = 0; r < 2; ++r )
+   {
+      SCIP_Real x[3];
+
+      x[0] = 0.1 + r;
+      x[1] = 0.2 + r;
+      x[2] = 0.3 + r;
+
+      SCIP_CALL( SCIPnlpiOracleEvalConstraintValues(oracle, x, convals) );
+      cr_assert_float_eq(convals[0], exp(x[0]), 1e-12);
+      cr_assert_float_eq(convals[1], exp(x[1]), 1e-12);
+      cr_assert_float_eq(convals[2], 2.0 * x[0] + exp(x[2]), 1e-12);
+      cr_assert_float_eq(convals[3], exp(x[1]), 1e-12);
+
+      SCIP_CALL( SCIPnlpiOracleEvalJacobian(oracle, x, FALSE, NULL, jacobi) );
+      cr_assert_float_eq(jacobi[0], exp(x[0]), 1e-12);
+      cr_assert_float_eq(jacobi[1], exp(x[1]), 1e-12);
+      cr_assert_float_eq(jacobi[2], 2.0, 1e-12);
+      cr_assert_float_eq(jacobi[3], exp(x[2]), 1e-12);
+      cr_assert_float_eq(jacobi[4], exp(x[1]), 1e-12);
+
+      SCIP_CALL( SCIPnlpiOracleEvalHessianLag(oracle, x, FALSE, 0.0, lambda, hessian) );
+      cr_assert_float_eq(hessian[0], exp(x[0]), 1e-12);
+      cr_assert_float_eq(hessian[1], 2.0 * exp(x[1]), 1e-12);
+      cr_assert_float_eq(hessian[2], exp(x[2]), 1e-12);
+   }
+}
+
+Test(oracle, chg_exprparam, .description = "test that the Hessian sparsity is updated when a parameter of an expression tree changes")
+{
+   SCIP_EXPRTREE* exprtree;
+   SCIP_EXPR* children[2];
+   SCIP_EXPR* prodexpr;
+   SCIP_EXPR* expr;
+   const int* hesoffsets;
+   const int* hescols;
+   SCIP_Real lambda[NCONSS] = { 0.0, 0.0, 0.0, 0.0 };
+   SCIP_Real hessian[4];
+   SCIP_Real x[3] = { 0.5, 1.5, 2.5 };
+   SCIP_Real param = 0.0;
+   int varidxs[2] = { 0, 1 };
+   int nnz;
+   int pos;
+
+   if( (SCIPexprintGetCapability() & SCIP_EXPRINTCAPABILITY_HESSIAN) == 0 )
+      return;
+
+   /* objective p * x0 * x1, where the product vanishes from the tape for p = 0 */
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &children[0], SCIP_EXPR_VARIDX, 0) );
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &children[1], SCIP_EXPR_VARIDX, 1) );
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &prodexpr, SCIP_EXPR_MUL, children[0], children[1]) );
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &children[0], SCIP_EXPR_PARAM, 0) );
+   SCIP_CALL( SCIPexprCreate(SCIPblkmem(scip), &expr, SCIP_EXPR_MUL, children[0], prodexpr) );
+   SCIP_CALL( SCIPexprtreeCreate(SCIPblkmem(scip), &exprtree, expr, 2, 1, &param) );
+
+   SCIP_CALL( SCIPnlpiOracleSetObjective(oracle, 0.0, 0, NULL, NULL, 0, NULL, varidxs, exprtree) );
+   SCIP_CALL( SCIPexprtreeFree(&exprtree) );
+
+   SCIP_CALL( SCIPnlpiOracleGetHessianLagSparsity(oracle, &hesoffsets, &hescols) );
+   cr_assert_eq(hesoffsets[3], 3);
+
+   SCIP_CALL( SCIPnlpiOracleEvalHessianLag(oracle, x, TRUE, 1.0, lambda, hessian) );
+   cr_assert_float_eq(hessian[0], 0.0, 1e-12);
+   cr_assert_float_eq(hessian[1], 0.0, 1e-12);
+   cr_assert_float_eq(hessian[2], 0.0, 1e-12);
+
+   /* with p = 2, the mixed second derivative of x0 and x1 is 2 */
+   SCIP_CALL( SCIPnlpiOracleChgExprParam(oracle, -1, 0, 2.0) );
+
+   SCIP_CALL( SCIPnlpiOracleGetHessianLagSparsity(oracle, &hesoffsets, &hescols) );
+   nnz = hesoffsets[3];
+   cr_assert_eq(nnz, 4);
+   cr_assert(SCIPsortedvecFindInt((int*)&hescols[hesoffsets[1]], 0, hesoffsets[2] - hesoffsets[1], &pos));
+   pos += hesoffsets[1];
+
+   SCIP_CALL( SCIPnlpiOracleEvalHessianLag(oracle, x, TRUE, 1.0, lambda, hessian) );
+   cr_assert_float_eq(hessian[pos], 2.0, 1e-12);
+}
+
+Test(oracle, del_vars, .description = "test that constraints are evaluated correctly after their expression trees were freed by deleting variables")
+{
+   SCIP_Real convals[NCONSS];
+   SCIP_Real x[4] = { 0.1, 0.2, 0.3, 0.4 };
+   int delstats[4] = { 1, 1, 1, 0 };
+   int c;
+
+   /* add a variable that is kept, since the oracle cannot delete all variables of a problem with constraints */
+   SCIP_CALL( SCIPnlpiOracleAddVars(oracle, 1, NULL, NULL, NULL) );
+
+   /* group the equal expression trees */
+   SCIP_CALL( SCIPnlpiOracleEvalConstraintValues(oracle, x, convals) );
+   cr_assert_float_eq(convals[3], exp(x[1]), 1e-12);
+
+   /* deleting the variables of the expression trees frees the trees */
+   SCIP_CALL( SCIPnlpiOracleDelVarSet(oracle, delstats) );
+   cr_assert_eq(SCIPnlpiOracleGetNVars(oracle), 1);
+   cr_assert_eq(delstats[3], 0);
+
+   x[0] = x[3];
+   SCIP_CALL( SCIPnlpiOracleEvalConstraintValues(oracle, x, convals) );
+   for( c = 0; c < NCONSS; ++c )
+      cr_assert_float_eq(convals[c], 0.0, 1e-12);
+}
@@ -0,0 +1,194 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   compresssols.c
+ * @brief  unit test for keeping stored solutions other than the incumbent in a compressed sparse format
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "scip/struct_sol.h"
+
+#include "include/scip_test.h"
+
+#define NVARS        10
+#define NSOLS         3
+
+static SCIP* scip;
+static SCIP_VAR* vars[NVARS];
+
+/** values of the solutions in the order they are added; for the objective of the problem, the solutions are sorted in
+ *  the reverse order, such that the first one is added as incumbent and then replaced by the second one, which is
+ *  replaced by the third one
+ */
+static const SCIP_Real solvals[NSOLS][NVARS] = {
+   { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },    /* all-zero solution, objective value 0 */
+   { 1.5, 0.0, 0.0, -2.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },   /* mixed solution, objective value -0.5 */
+   { 1.0, 2.0, -1.0, 3.0, -4.0, 0.5, 1.0, -2.0, 0.0, -3.0 } /* dense solution, objective value -2.5 */
+};
+
+static
+void setup(void)
+{
+   char name[SCIP_MAXSTRLEN];
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "compresssols") );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x_%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, -10.0, 10.0, 1.0, SCIP_VARTYPE_CONTINUOUS) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+   }
+
+   SCIP_CALL( SCIPsetBoolParam(scip, "misc/compresssols", TRUE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+}
+
+static
+void teardown(void)
+{
+   int i;
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/** adds the solutions to the solution storage; all values are set explicitly, such that the dense arrays cover all
+ *  variables
+ */
+static
+void addSols(void)
+{
+   int s;
+   int i;
+
+   for( s = 0; s < NSOLS; ++s )
+   {
+      SCIP_SOL* sol;
+      SCIP_Bool stored;
+
+      SCIP_CALL( SCIPcreateOrigSol(scip, &sol, NULL) );
+
+      for( i = 0; i < NVARS; ++i )
+      {
+         SCIP_CALL( SCIPsetSolVal(scip, sol, vars[i], solvals[s][i]) );
+      }
+
+      SCIP_CALL( SCIPaddSolFree(scip, &sol, &stored) );
+      cr_assert(stored);
+   }
+}
+
+/** checks that only the incumbent is dense and that all stored solutions return their values */
+static
+void checkSols(
+   const int*            order               /**< indices of the expected solutions in the order of the storage */
+   )
+{
+   SCIP_SOL** sols;
+   int s;
+   int i;
+
+   cr_assert_eq(SCIPgetNSols(scip), NSOLS);
+   sols = SCIPgetSols(scip);
+
+   for( s = 0; s < NSOLS; ++s )
+   {
+      const SCIP_Real* vals = solvals[order[s]];
+
+      if( s == 0 )
+         cr_assert(sols[s]->vals != NULL, "incumbent is compressed");
+      else
+         cr_assert(sols[s]->vals == NULL, "solution %d is not compressed", s);
+
+      for( i = 0; i < NVARS; ++i )
+         cr_assert_eq(SCIPgetSolVal(scip, sols[s], vars[i]), vals[i], "solution %d, variable %d: %g != %g", s, i,
+            SCIPgetSolVal(scip, sols[s], vars[i]), vals[i]);
+   }
+}
+
+/** presolves the problem without changing it, such that the solutions are transferred to the transformed problem */
+static
+void transferSols(void)
+{
+   /* keep the variables and do not find other solutions */
+   SCIP_CALL( SCIPsetIntParam(scip, "presolving/maxrounds", 0) );
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+
+   SCIP_CALL( SCIPpresolve(scip) );
+}
+
+TestSuite(compresssols, .init = setup, .fini = teardown);
+
+Test(compresssols, readback, .description = "test that compressed all-zero and mixed solutions return their values")
+{
+   const int order[NSOLS] = { 2, 1, 0 };
+   SCIP_SOL* copy;
+   SCIP_SOL** sols;
+   int i;
+
+   addSols();
+   checkSols(order);
+
+   /* the all-zero solution is compressed without any sparse arrays */
+   sols = SCIPgetSols(scip);
+   cr_assert_eq(sols[NSOLS - 1]->nsparsevals, 0);
+   cr_assert_eq(sols[NSOLS - 2]->nsparsevals, 2);
+
+   /* a copy of the compressed all-zero solution returns the same values */
+   SCIP_CALL( SCIPcreateSolCopyOrig(scip, &copy, sols[NSOLS - 1]) );
+   for( i = 0; i < NVARS; ++i )
+      cr_assert_eq(SCIPgetSolVal(scip, copy, vars[i]), 0.0);
+   SCIP_CALL( SCIPfreeSol(scip, &copy) );
+}
+
+Test(compresssols, transform, .description = "test that the compression is kept when the solutions are transferred to the transformed problem")
+{
+   const int order[NSOLS] = { 2, 1, 0 };
+
+   addSols();
+   transferSols();
+
+   checkSols(order);
+}
+
+Test(compresssols, newincumbent, .description = "test that a compressed solution is expanded when it becomes the incumbent")
+{
+   const int order[NSOLS] = { 0, 1, 2 };
+   int i;
+
+   addSols();
+
+   /* reverse the order of the solutions, such that the compressed all-zero solution becomes the incumbent */
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_CALL( SCIPchgVarObj(scip, vars[i], -1.0) );
+   }
+   transferSols();
+
+   checkSols(order);
+}